@@ -69,11 +69,15 @@ bool BlenderObjectCulling::test(Scene *scene, BL::Object &b_ob, Transform &tfm)
     bb[i] = transform_point(&tfm, p);
   }
 
-  bool camera_culled = use_camera_cull_ && test_camera(scene, bb);
-  bool distance_culled = use_distance_cull_ && test_distance(scene, bb);
-
-  return ((camera_culled && distance_culled) || (camera_culled && !use_distance_cull_) ||
-          (distance_culled && !use_camera_cull_));
+  /* With both tests enabled the object is only culled when both agree. Test the distance first
+   * as it is cheaper, and skip the camera projection for objects close to the camera. */
+  if (use_camera_cull_ && use_distance_cull_) {
+    return test_distance(scene, bb) && test_camera(scene, bb);
+  }
+  if (use_camera_cull_) {
+    return test_camera(scene, bb);
+  }
+  return test_distance(scene, bb);
 }
 
 /* TODO(sergey): Not really optimal, consider approaches based on k-DOP in order
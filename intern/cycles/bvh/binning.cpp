@@ -13,6 +13,7 @@
 
 #include "util/algorithm.h"
 #include "util/boundbox.h"
+#include "util/tbb.h"
 #include "util/types.h"
 
 CCL_NAMESPACE_BEGIN
@@ -90,8 +91,55 @@ BVHObjectBinning::BVHObjectBinning(const BVHRange &job,
     bin_bounds[i][0] = bin_bounds[i][1] = bin_bounds[i][2] = BoundBox::empty;
   }
 
+  if (size() >= PARALLEL_BINNING_MIN_SIZE) {
+    /* Large ranges at the top of the tree: map geometry to per-thread bins in parallel and
+     * merge them, as the recursive build only becomes parallel below the first splits. */
+    struct Bins {
+      BoundBox bounds[MAX_BINS][4];
+      int4 count[MAX_BINS];
+    };
+    Bins empty_bins;
+    for (size_t i = 0; i < num_bins; i++) {
+      empty_bins.count[i] = make_int4(0);
+      empty_bins.bounds[i][0] = empty_bins.bounds[i][1] = empty_bins.bounds[i][2] =
+          BoundBox::empty;
+    }
+
+    const Bins bins = parallel_reduce(
+        blocked_range<size_t>(start(), end(), 4096),
+        empty_bins,
+        [&](const blocked_range<size_t> &range, const Bins &partial_bins) {
+          Bins result = partial_bins;
+          for (size_t i = range.begin(); i < range.end(); i++) {
+            const BoundBox prim_bounds = get_prim_bounds(prims[i]);
+            const int4 bin = get_bin(prim_bounds);
+            for (int d = 0; d < 3; d++) {
+              result.count[bin[d]][d]++;
+              result.bounds[bin[d]][d].grow(prim_bounds);
+            }
+          }
+          return result;
+        },
+        [&](const Bins &bins_a, const Bins &bins_b) {
+          Bins result = bins_a;
+          for (size_t i = 0; i < num_bins; i++) {
+            result.count[i] = result.count[i] + bins_b.count[i];
+            for (int d = 0; d < 3; d++) {
+              result.bounds[i][d].grow(bins_b.bounds[i][d]);
+            }
+          }
+          return result;
+        });
+
+    for (size_t i = 0; i < num_bins; i++) {
+      bin_count[i] = bins.count[i];
+      for (int d = 0; d < 3; d++) {
+        bin_bounds[i][d] = bins.bounds[i][d];
+      }
+    }
+  }
   /* map geometry to bins, unrolled once */
-  {
+  else {
     int64_t i;
 
     for (i = 0; i < int64_t(size()) - 1; i += 2) {
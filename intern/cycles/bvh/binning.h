@@ -17,7 +17,7 @@ CCL_NAMESPACE_BEGIN
 
 class BVHBuild;
 
-/* Single threaded object binner. Finds the split with the best SAH heuristic
+/* Object binner, binning large ranges in parallel. Finds the split with the best SAH heuristic
  * by testing for each dimension multiple partitionings for regular spaced
  * partition locations. A partitioning for a partition location is computed,
  * by putting primitives whose centroid is on the left and right of the split
@@ -58,6 +58,8 @@ class BVHObjectBinning : public BVHRange {
 
   enum { MAX_BINS = 32 };
   enum { LOG_BLOCK_SIZE = 2 };
+  /* Minimum number of primitives for binning them in parallel. */
+  enum { PARALLEL_BINNING_MIN_SIZE = 32768 };
 
   /* computes the bin numbers for each dimension for a box. */
   __forceinline int4 get_bin(const BoundBox &box) const
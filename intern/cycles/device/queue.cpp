@@ -50,6 +50,15 @@ DeviceQueue::~DeviceQueue()
       VLOG_DEVICE_STATS << "GPU queue total time: " << std::fixed << std::setprecision(5)
                         << total_time;
     }
+
+    VLOG_DEVICE_STATS << "GPU queue kernel launches:";
+    for (const auto &[kernel, work] : stats_kernel_work_) {
+      const auto &[num_launches, total_work_size] = work;
+      VLOG_DEVICE_STATS << "  " << std::setfill(' ') << std::setw(10) << std::right
+                        << num_launches << " launches, " << std::setw(12) << total_work_size
+                        << " work items (average " << total_work_size / num_launches
+                        << "): " << device_kernel_as_string(kernel);
+    }
   }
 }
 
@@ -67,6 +76,10 @@ void DeviceQueue::debug_enqueue_begin(DeviceKernel kernel, const int work_size)
   if (VLOG_DEVICE_STATS_IS_ON) {
     VLOG_DEVICE_STATS << "GPU queue launch " << device_kernel_as_string(kernel) << ", work_size "
                       << work_size;
+
+    auto &[num_launches, total_work_size] = stats_kernel_work_[kernel];
+    num_launches++;
+    total_work_size += work_size;
   }
 
   last_kernels_enqueued_ |= (uint64_t(1) << (uint64_t)kernel);
@@ -180,6 +180,9 @@ class DeviceQueue {
   double last_sync_time_;
   /* Accumulated execution time for combinations of kernels launched together. */
   map<DeviceKernelMask, double> stats_kernel_time_;
+  /* Number of launches and accumulated work size of every kernel, which tells how full the
+   * queues were when the kernel got scheduled. */
+  map<DeviceKernel, pair<int64_t, int64_t>> stats_kernel_work_;
   /* If it is true, then a performance statistics in the debugging logs will have focus on kernels
    * and an explicit queue synchronization will be added after each kernel execution. */
   bool is_per_kernel_performance_;
@@ -442,11 +442,13 @@ void PathTrace::adaptive_sample(RenderWork &render_work)
 
     const double start_time = time_dt();
 
+    const int num_works = path_trace_works_.size();
     uint num_active_pixels = 0;
-    parallel_for_each(path_trace_works_, [&](unique_ptr<PathTraceWork> &path_trace_work) {
+    parallel_for(0, num_works, [&](int i) {
       const uint num_active_pixels_in_work =
-          path_trace_work->adaptive_sampling_converge_filter_count_active(
+          path_trace_works_[i]->adaptive_sampling_converge_filter_count_active(
               render_work.adaptive_sampling.threshold, render_work.adaptive_sampling.reset);
+      work_balance_infos_[i].num_active_pixels = num_active_pixels_in_work;
       if (num_active_pixels_in_work) {
         atomic_add_and_fetch_u(&num_active_pixels, num_active_pixels_in_work);
       }
@@ -455,6 +457,13 @@ void PathTrace::adaptive_sample(RenderWork &render_work)
     render_scheduler_.report_adaptive_filter_time(
         render_work, time_dt() - start_time, is_cancel_requested());
 
+    /* Converged pixels are not rendered anymore, so a work whose pixels converge faster than the
+     * others runs out of work. Don't wait for the regular rebalance interval in this case. */
+    if (work_balance_need_rebalance_on_convergence(work_balance_infos_)) {
+      VLOG_WORK << "Adaptive sampling made work uneven, requesting rebalance.";
+      render_scheduler_.request_rebalance_at_next_work();
+    }
+
     if (num_active_pixels == 0) {
       VLOG_WORK << "All pixels converged.";
       if (!render_scheduler_.render_work_reschedule_on_converge(render_work)) {
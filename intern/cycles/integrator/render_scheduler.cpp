@@ -36,6 +36,13 @@ void RenderScheduler::set_need_schedule_rebalance(bool need_schedule_rebalance)
   need_schedule_rebalance_works_ = need_schedule_rebalance;
 }
 
+void RenderScheduler::request_rebalance_at_next_work()
+{
+  if (need_schedule_rebalance_works_) {
+    state_.need_rebalance_at_next_work = true;
+  }
+}
+
 bool RenderScheduler::is_background() const
 {
   return background_;
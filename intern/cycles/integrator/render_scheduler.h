@@ -96,6 +96,10 @@ class RenderScheduler {
    * as possible. */
   void set_need_schedule_rebalance(bool need_schedule_rebalance);
 
+  /* Schedule rebalance of works as part of the next work, without waiting for the regular
+   * rebalance interval. */
+  void request_rebalance_at_next_work();
+
   bool is_background() const;
 
   void set_denoiser_params(const DenoiseParams &params);
@@ -46,6 +46,11 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
 {
   const int num_infos = work_balance_infos.size();
 
+  /* Distribution of active pixels is to be re-measured for the new balance. */
+  for (WorkBalanceInfo &info : work_balance_infos) {
+    info.active_pixels_share = -1.0;
+  }
+
   const double total_time = calculate_total_time(work_balance_infos);
   const double time_average = total_time / num_infos;
 
@@ -87,4 +92,34 @@ bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos)
   return true;
 }
 
+bool work_balance_need_rebalance_on_convergence(vector<WorkBalanceInfo> &work_balance_infos)
+{
+  if (work_balance_infos.size() < 2) {
+    return false;
+  }
+
+  int64_t total_active_pixels = 0;
+  for (const WorkBalanceInfo &info : work_balance_infos) {
+    total_active_pixels += info.num_active_pixels;
+  }
+  if (total_active_pixels == 0) {
+    return false;
+  }
+
+  /* Compare with the distribution of active pixels right after the latest rebalance. Only react
+   * to a big difference, to avoid moving render buffers between devices too often. */
+  bool need_rebalance = false;
+  for (WorkBalanceInfo &info : work_balance_infos) {
+    const double active_pixels_share = double(info.num_active_pixels) / total_active_pixels;
+    if (info.active_pixels_share < 0.0) {
+      info.active_pixels_share = active_pixels_share;
+    }
+    else if (active_pixels_share < info.active_pixels_share * 0.5) {
+      need_rebalance = true;
+    }
+  }
+
+  return need_rebalance;
+}
+
 CCL_NAMESPACE_END
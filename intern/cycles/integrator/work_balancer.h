@@ -18,6 +18,14 @@ struct WorkBalanceInfo {
   /* Normalized weight, which is ready to be used for work balancing (like calculating fraction of
    * the big tile which is to be rendered on the device). */
   double weight = 1.0;
+
+  /* Number of pixels of the work which did not converge yet, as reported by the latest adaptive
+   * sampling filter. */
+  int num_active_pixels = 0;
+
+  /* Fraction of all active pixels which belonged to this work at the first adaptive sampling
+   * filter after the latest rebalance, or negative if not known yet. */
+  double active_pixels_share = -1.0;
 };
 
 /* Balance work for an initial render integration, before any statistics is known. */
@@ -27,4 +35,9 @@ void work_balance_do_initial(vector<WorkBalanceInfo> &work_balance_infos);
  * Returns true if the balancing did change. */
 bool work_balance_do_rebalance(vector<WorkBalanceInfo> &work_balance_infos);
 
+/* Check whether adaptive sampling made the work uneven since the latest rebalance, which happens
+ * when pixels of some work converge much faster than the pixels of the others.
+ * Uses the number of active pixels of the works, and returns true if rebalance is needed. */
+bool work_balance_need_rebalance_on_convergence(vector<WorkBalanceInfo> &work_balance_infos);
+
 CCL_NAMESPACE_END
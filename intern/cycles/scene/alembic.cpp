@@ -4,6 +4,8 @@
 
 #include "scene/alembic.h"
 
+#include <atomic>
+
 #include "scene/alembic_read.h"
 #include "scene/camera.h"
 #include "scene/curves.h"
@@ -16,6 +18,8 @@
 #include "util/foreach.h"
 #include "util/log.h"
 #include "util/progress.h"
+#include "util/task.h"
+#include "util/tbb.h"
 #include "util/transform.h"
 #include "util/vector.h"
 
@@ -869,6 +873,8 @@ void AlembicProcedural::generate(Scene *scene, Progress &progress)
   if (!archive.valid() || filepath_is_modified() || layers_is_modified()) {
     Alembic::AbcCoreFactory::IFactory factory;
     factory.setPolicy(Alembic::Abc::ErrorHandler::kQuietNoopPolicy);
+    /* Allow the caches of the objects to be read concurrently, see #build_caches. */
+    factory.setOgawaNumStreams(TaskScheduler::max_concurrency());
 
     std::vector<std::string> filenames;
     filenames.push_back(filepath.c_str());
@@ -1481,12 +1487,15 @@ void AlembicProcedural::walk_hierarchy(
 
 void AlembicProcedural::build_caches(Progress &progress)
 {
-  size_t memory_used = 0;
+  std::atomic<size_t> memory_used = 0;
+  std::atomic<bool> memory_limit_reached = false;
 
-  for (Node *node : objects) {
-    AlembicObject *object = static_cast<AlembicObject *>(node);
+  /* Every object reads from its own schema, so the caches are built concurrently. The archive is
+   * opened with multiple Ogawa streams for the reads to not be serialized on a single file. */
+  parallel_for(size_t(0), objects.size(), [&](const size_t i) {
+    AlembicObject *object = static_cast<AlembicObject *>(objects[i]);
 
-    if (progress.get_cancel()) {
+    if (progress.get_cancel() || memory_limit_reached) {
       return;
     }
 
@@ -1547,14 +1556,24 @@ void AlembicProcedural::build_caches(Progress &progress)
       object->setup_transform_cache(object->get_cached_data(), scale);
     }
 
-    memory_used += object->get_cached_data().memory_used();
+    const size_t object_memory_used = object->get_cached_data().memory_used();
+    const size_t total_memory_used = memory_used.fetch_add(object_memory_used) +
+                                     object_memory_used;
 
     if (use_prefetch) {
-      if (memory_used > get_prefetch_cache_size_in_bytes()) {
-        progress.set_error("Error: Alembic Procedural memory limit reached");
-        return;
+      if (total_memory_used > get_prefetch_cache_size_in_bytes()) {
+        memory_limit_reached = true;
       }
     }
+  });
+
+  if (progress.get_cancel()) {
+    return;
+  }
+
+  if (memory_limit_reached) {
+    progress.set_error("Error: Alembic Procedural memory limit reached");
+    return;
   }
 
   VLOG_WORK << "AlembicProcedural memory usage : " << string_human_readable_size(memory_used);
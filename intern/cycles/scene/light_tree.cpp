@@ -538,6 +538,35 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
   const float3 extent = centroid_bbox.size();
   const float max_extent = max4(extent.x, extent.y, extent.z, 0.0f);
 
+  /* Fill in buckets with emitters, where the centroid box is split into equal partitions along
+   * each dimension. */
+  std::array<std::array<LightTreeBucket, LightTreeBucket::num_buckets>, 3> dim_buckets;
+  auto fill_buckets = [&](const int dim) {
+    const float inv_extent = 1 / (centroid_bbox.size()[dim]);
+    std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = dim_buckets[dim];
+    for (int i = start; i < end; i++) {
+      const LightTreeEmitter *emitter = emitters + i;
+
+      int bucket_idx = LightTreeBucket::num_buckets *
+                       (emitter->centroid[dim] - centroid_bbox.min[dim]) * inv_extent;
+      bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
+
+      buckets[bucket_idx].add(*emitter);
+    }
+  };
+
+  /* Near the root the recursive build has not been split into tasks yet, so fill the buckets of
+   * all dimensions in parallel. Each dimension is still filled in emitter order, so the result is
+   * identical to the serial path. */
+  const bool buckets_filled = num_emitters > MIN_EMITTERS_PER_THREAD;
+  if (buckets_filled) {
+    parallel_for(0, 3, [&](const int dim) {
+      if (centroid_bbox.size()[dim] != 0.0f || dim == 0) {
+        fill_buckets(dim);
+      }
+    });
+  }
+
   /* Check each dimension to find the minimum splitting cost. */
   float total_cost = 0.0f;
   float min_cost = FLT_MAX;
@@ -550,19 +579,10 @@ bool LightTree::should_split(LightTreeEmitter *emitters,
 
     const float inv_extent = 1 / (centroid_bbox.size()[dim]);
 
-    /* Fill in buckets with emitters. */
-    std::array<LightTreeBucket, LightTreeBucket::num_buckets> buckets;
-    for (int i = start; i < end; i++) {
-      const LightTreeEmitter *emitter = emitters + i;
-
-      /* Place emitter into the appropriate bucket, where the centroid box is split into equal
-       * partitions. */
-      int bucket_idx = LightTreeBucket::num_buckets *
-                       (emitter->centroid[dim] - centroid_bbox.min[dim]) * inv_extent;
-      bucket_idx = clamp(bucket_idx, 0, LightTreeBucket::num_buckets - 1);
-
-      buckets[bucket_idx].add(*emitter);
+    if (!buckets_filled) {
+      fill_buckets(dim);
     }
+    const std::array<LightTreeBucket, LightTreeBucket::num_buckets> &buckets = dim_buckets[dim];
 
     /* Precompute the left bucket measure cumulatively. */
     std::array<LightTreeBucket, LightTreeBucket::num_buckets - 1> left_buckets;
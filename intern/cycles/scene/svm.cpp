@@ -27,7 +27,10 @@ SVMShaderManager::SVMShaderManager() {}
 
 SVMShaderManager::~SVMShaderManager() {}
 
-void SVMShaderManager::reset(Scene * /*scene*/) {}
+void SVMShaderManager::reset(Scene * /*scene*/)
+{
+  compiled_shaders.clear();
+}
 
 void SVMShaderManager::device_update_shader(Scene *scene,
                                             Shader *shader,
@@ -73,19 +76,41 @@ void SVMShaderManager::device_update_specific(Device *device,
   /* test if we need to update */
   device_free(device, dscene, scene);
 
-  /* Build all shaders. */
+  /* Build all shaders. Shaders that were not modified since the previous update reuse the nodes
+   * they were compiled into back then. */
   TaskPool task_pool;
   vector<array<int4>> shader_svm_nodes(num_shaders);
+  int num_reused = 0;
   for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+    const bool background = (shader == scene->background->get_shader(scene));
+
+    auto it = compiled_shaders.find(shader);
+    if (it != compiled_shaders.end()) {
+      CompiledShader &compiled = it->second;
+      const bool reuse = !shader->is_modified() && compiled.graph == shader->graph &&
+                         compiled.background == background;
+      if (reuse) {
+        shader_svm_nodes[i].steal_data(compiled.svm_nodes);
+        num_reused++;
+      }
+      compiled_shaders.erase(it);
+      if (reuse) {
+        continue;
+      }
+    }
+
     task_pool.push(function_bind(&SVMShaderManager::device_update_shader,
                                  this,
                                  scene,
-                                 scene->shaders[i],
+                                 shader,
                                  &progress,
                                  &shader_svm_nodes[i]));
   }
   task_pool.wait_work();
 
+  VLOG_INFO << "Reused compiled nodes of " << num_reused << " unmodified shaders.";
+
   if (progress.get_cancel()) {
     return;
   }
@@ -132,6 +157,17 @@ void SVMShaderManager::device_update_specific(Device *device,
     svm_nodes += shader_size;
   }
 
+  /* Keep the compiled nodes around for the next update. Shaders that were removed from the scene
+   * are dropped here as well. */
+  compiled_shaders.clear();
+  for (int i = 0; i < num_shaders; i++) {
+    Shader *shader = scene->shaders[i];
+    CompiledShader &compiled = compiled_shaders[shader];
+    compiled.graph = shader->graph;
+    compiled.background = (shader == scene->background->get_shader(scene));
+    compiled.svm_nodes.steal_data(shader_svm_nodes[i]);
+  }
+
   if (progress.get_cancel()) {
     return;
   }
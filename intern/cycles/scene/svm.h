@@ -10,6 +10,7 @@
 #include "scene/shader_graph.h"
 
 #include "util/array.h"
+#include "util/map.h"
 #include "util/set.h"
 #include "util/string.h"
 #include "util/thread.h"
@@ -45,6 +46,15 @@ class SVMShaderManager : public ShaderManager {
                             Shader *shader,
                             Progress *progress,
                             array<int4> *svm_nodes);
+
+  /* Nodes each shader was compiled into during the previous update, reused as long as the
+   * shader is not modified. */
+  struct CompiledShader {
+    ShaderGraph *graph = nullptr;
+    bool background = false;
+    array<int4> svm_nodes;
+  };
+  unordered_map<const Shader *, CompiledShader> compiled_shaders;
 };
 
 /* Graph Compiler */
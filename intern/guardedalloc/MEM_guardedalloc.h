@@ -266,6 +266,36 @@ void MEM_use_lockfree_allocator(void);
  */
 void MEM_use_guarded_allocator(void);
 
+/**
+ * Arena for many small short lived allocations, which are all freed at once with
+ * #MEM_arena_clear. Every thread allocates from its own chunks without locking, so this is meant
+ * for temporary data of multi-threaded evaluation.
+ *
+ * Allocations are not tracked individually, only the chunks are visible in the memory statistics.
+ * Usage of all arenas is printed by #MEM_printmemlist_stats.
+ *
+ * \note Clearing and freeing the arena must not happen while other threads allocate from it.
+ */
+typedef struct MEM_Arena MEM_Arena;
+
+/** The name must be static, because only a pointer to it is stored! */
+MEM_Arena *MEM_arena_new(const char *name) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+/**
+ * Allocate uninitialized memory that stays valid until the arena is cleared or freed.
+ * The alignment has to be a power of two.
+ */
+void *MEM_arena_alloc(MEM_Arena *arena, size_t len, size_t alignment)
+    /* ATTR_MALLOC */ ATTR_WARN_UNUSED_RESULT ATTR_ALLOC_SIZE(2) ATTR_NONNULL(1);
+/**
+ * Get the memory reserved for all threads, the requested size of the allocations and their number
+ * since the arena was last cleared.
+ */
+void MEM_arena_get_stats(MEM_Arena *arena, size_t *r_reserved, size_t *r_used, size_t *r_allocs_num)
+    ATTR_NONNULL(1, 2, 3, 4);
+/** Free all allocations at once, some memory is kept for reuse. */
+void MEM_arena_clear(MEM_Arena *arena) ATTR_NONNULL(1);
+void MEM_arena_free(MEM_Arena *arena) ATTR_NONNULL(1);
+
 #ifdef __cplusplus
 }
 #endif /* __cplusplus */
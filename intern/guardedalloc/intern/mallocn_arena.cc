@@ -0,0 +1,296 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup intern_mem
+ *
+ * Thread-local arena allocator, see #MEM_Arena.
+ */
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cstdio>
+#include <mutex>
+#include <thread>
+
+#include "MEM_guardedalloc.h"
+
+#include "mallocn_intern.hh"
+
+/** Size of the first chunk of every thread, following chunks grow up to #ARENA_CHUNK_SIZE_MAX. */
+#define ARENA_CHUNK_SIZE_MIN (64 * 1024)
+#define ARENA_CHUNK_SIZE_MAX (4 * 1024 * 1024)
+/** Alignment of chunks, larger alignments are still supported by padding. */
+#define ARENA_CHUNK_ALIGNMENT 64
+
+namespace {
+
+struct ArenaChunk {
+  ArenaChunk *next;
+  size_t size;
+};
+
+/**
+ * Memory of a single thread, only ever accessed by that thread, except when clearing. The
+ * statistics are atomic because they can also be read while the thread allocates.
+ */
+struct ArenaThreadData {
+  ArenaThreadData *next = nullptr;
+  std::thread::id thread_id;
+
+  ArenaChunk *chunks = nullptr;
+  char *chunk_pos = nullptr;
+  char *chunk_end = nullptr;
+  size_t next_chunk_size = ARENA_CHUNK_SIZE_MIN;
+
+  std::atomic<size_t> reserved = 0;
+  std::atomic<size_t> used = 0;
+  std::atomic<size_t> allocs_num = 0;
+};
+
+}  // namespace
+
+struct MEM_Arena {
+  MEM_Arena *next = nullptr, *prev = nullptr;
+  const char *name = nullptr;
+  /** Unique for every arena ever created, used to validate the thread-local caches. */
+  uint64_t id = 0;
+
+  std::mutex mutex;
+  ArenaThreadData *threads = nullptr;
+
+  /** Statistics that are kept when clearing. */
+  std::atomic<size_t> reserved_peak = 0;
+  std::atomic<size_t> used_peak = 0;
+  std::atomic<size_t> allocs_num_total = 0;
+  std::atomic<size_t> clears_num = 0;
+};
+
+/** All arenas, for printing statistics. */
+static std::mutex arenas_mutex;
+static MEM_Arena *arenas_first = nullptr;
+static std::atomic<uint64_t> arena_id_last = 0;
+
+/** Avoids locking the arena for every allocation, a few arenas can be used at the same time. */
+#define ARENA_THREAD_CACHE_SIZE 4
+struct ArenaThreadCache {
+  uint64_t arena_ids[ARENA_THREAD_CACHE_SIZE];
+  ArenaThreadData *datas[ARENA_THREAD_CACHE_SIZE];
+  int next_slot;
+};
+static thread_local ArenaThreadCache arena_thread_cache = {};
+
+static ArenaThreadData *arena_thread_data_get(MEM_Arena *arena)
+{
+  ArenaThreadCache &cache = arena_thread_cache;
+  for (int i = 0; i < ARENA_THREAD_CACHE_SIZE; i++) {
+    if (cache.arena_ids[i] == arena->id) {
+      return cache.datas[i];
+    }
+  }
+
+  const std::thread::id thread_id = std::this_thread::get_id();
+  ArenaThreadData *data = nullptr;
+  {
+    std::lock_guard lock(arena->mutex);
+    for (data = arena->threads; data; data = data->next) {
+      if (data->thread_id == thread_id) {
+        break;
+      }
+    }
+    if (data == nullptr) {
+      data = MEM_new<ArenaThreadData>(__func__);
+      data->thread_id = thread_id;
+      data->next = arena->threads;
+      arena->threads = data;
+    }
+  }
+
+  cache.arena_ids[cache.next_slot] = arena->id;
+  cache.datas[cache.next_slot] = data;
+  cache.next_slot = (cache.next_slot + 1) % ARENA_THREAD_CACHE_SIZE;
+  return data;
+}
+
+static void arena_thread_data_chunk_add(const MEM_Arena *arena,
+                                        ArenaThreadData *data,
+                                        const size_t min_size)
+{
+  size_t size = data->next_chunk_size;
+  if (min_size + sizeof(ArenaChunk) > size) {
+    /* Large allocations get their own chunk, without changing the size of following chunks. */
+    size = min_size + sizeof(ArenaChunk);
+  }
+  else {
+    data->next_chunk_size = std::min<size_t>(data->next_chunk_size * 2, ARENA_CHUNK_SIZE_MAX);
+  }
+
+  ArenaChunk *chunk = static_cast<ArenaChunk *>(
+      MEM_mallocN_aligned(size, ARENA_CHUNK_ALIGNMENT, arena->name));
+  chunk->size = size;
+  chunk->next = data->chunks;
+  data->chunks = chunk;
+  data->chunk_pos = reinterpret_cast<char *>(chunk + 1);
+  data->chunk_end = reinterpret_cast<char *>(chunk) + size;
+  data->reserved.fetch_add(size, std::memory_order_relaxed);
+}
+
+static void arena_thread_data_clear(ArenaThreadData *data, const bool keep_chunk)
+{
+  ArenaChunk *chunk_keep = nullptr;
+  ArenaChunk *chunk = data->chunks;
+  while (chunk) {
+    ArenaChunk *chunk_next = chunk->next;
+    /* Keep the last regular chunk, which is the largest one. */
+    if (keep_chunk && chunk_keep == nullptr && chunk->size <= data->next_chunk_size) {
+      chunk_keep = chunk;
+    }
+    else {
+      MEM_freeN(chunk);
+    }
+    chunk = chunk_next;
+  }
+
+  data->chunks = chunk_keep;
+  data->chunk_pos = nullptr;
+  data->chunk_end = nullptr;
+  size_t reserved = 0;
+  if (chunk_keep) {
+    chunk_keep->next = nullptr;
+    reserved = chunk_keep->size;
+    data->chunk_pos = reinterpret_cast<char *>(chunk_keep + 1);
+    data->chunk_end = reinterpret_cast<char *>(chunk_keep) + chunk_keep->size;
+  }
+  data->reserved.store(reserved, std::memory_order_relaxed);
+  data->used.store(0, std::memory_order_relaxed);
+  data->allocs_num.store(0, std::memory_order_relaxed);
+}
+
+MEM_Arena *MEM_arena_new(const char *name)
+{
+  MEM_Arena *arena = MEM_new<MEM_Arena>(__func__);
+  arena->name = name;
+  arena->id = ++arena_id_last;
+
+  std::lock_guard lock(arenas_mutex);
+  arena->next = arenas_first;
+  if (arenas_first) {
+    arenas_first->prev = arena;
+  }
+  arenas_first = arena;
+  return arena;
+}
+
+void *MEM_arena_alloc(MEM_Arena *arena, const size_t len, const size_t alignment)
+{
+  /* Alignment has to be a power of two. */
+  assert((alignment & (alignment - 1)) == 0);
+
+  ArenaThreadData *data = arena_thread_data_get(arena);
+  /* Only this thread modifies the statistics, so they don't need an atomic read-modify-write. */
+  data->allocs_num.store(data->allocs_num.load(std::memory_order_relaxed) + 1,
+                         std::memory_order_relaxed);
+  data->used.store(data->used.load(std::memory_order_relaxed) + len, std::memory_order_relaxed);
+
+  uintptr_t pos = (uintptr_t(data->chunk_pos) + (alignment - 1)) & ~uintptr_t(alignment - 1);
+  if (data->chunk_pos == nullptr || pos + len > uintptr_t(data->chunk_end)) {
+    arena_thread_data_chunk_add(arena, data, len + alignment);
+    pos = (uintptr_t(data->chunk_pos) + (alignment - 1)) & ~uintptr_t(alignment - 1);
+  }
+  data->chunk_pos = reinterpret_cast<char *>(pos + len);
+  return reinterpret_cast<void *>(pos);
+}
+
+/** Expects the arena to be locked. */
+static void arena_stats_current(const MEM_Arena *arena,
+                                size_t *r_reserved,
+                                size_t *r_used,
+                                size_t *r_allocs_num)
+{
+  *r_reserved = 0;
+  *r_used = 0;
+  *r_allocs_num = 0;
+  for (const ArenaThreadData *data = arena->threads; data; data = data->next) {
+    *r_reserved += data->reserved.load(std::memory_order_relaxed);
+    *r_used += data->used.load(std::memory_order_relaxed);
+    *r_allocs_num += data->allocs_num.load(std::memory_order_relaxed);
+  }
+}
+
+void MEM_arena_get_stats(MEM_Arena *arena,
+                         size_t *r_reserved,
+                         size_t *r_used,
+                         size_t *r_allocs_num)
+{
+  std::lock_guard lock(arena->mutex);
+  arena_stats_current(arena, r_reserved, r_used, r_allocs_num);
+}
+
+void MEM_arena_clear(MEM_Arena *arena)
+{
+  std::lock_guard lock(arena->mutex);
+  size_t reserved, used, allocs_num;
+  arena_stats_current(arena, &reserved, &used, &allocs_num);
+  arena->reserved_peak.store(std::max(arena->reserved_peak.load(), reserved));
+  arena->used_peak.store(std::max(arena->used_peak.load(), used));
+  arena->allocs_num_total.fetch_add(allocs_num);
+  arena->clears_num.fetch_add(1);
+  for (ArenaThreadData *data = arena->threads; data; data = data->next) {
+    arena_thread_data_clear(data, true);
+  }
+}
+
+void MEM_arena_free(MEM_Arena *arena)
+{
+  {
+    std::lock_guard lock(arenas_mutex);
+    if (arena->prev) {
+      arena->prev->next = arena->next;
+    }
+    else {
+      arenas_first = arena->next;
+    }
+    if (arena->next) {
+      arena->next->prev = arena->prev;
+    }
+  }
+
+  while (ArenaThreadData *data = arena->threads) {
+    arena->threads = data->next;
+    arena_thread_data_clear(data, false);
+    MEM_delete(data);
+  }
+  MEM_delete(arena);
+}
+
+void mem_arena_print_stats()
+{
+  std::lock_guard lock(arenas_mutex);
+  if (arenas_first == nullptr) {
+    return;
+  }
+
+  printf("\nArena allocators:\n");
+  printf("%-32s %12s %12s %12s %12s %8s\n",
+         "name",
+         "reserved MB",
+         "peak MB",
+         "used peak MB",
+         "allocations",
+         "clears");
+  for (MEM_Arena *arena = arenas_first; arena; arena = arena->next) {
+    std::lock_guard arena_lock(arena->mutex);
+    size_t reserved, used, allocs_num;
+    arena_stats_current(arena, &reserved, &used, &allocs_num);
+
+    printf("%-32s %12.3f %12.3f %12.3f %12zu %8zu\n",
+           arena->name,
+           double(reserved) / double(1024 * 1024),
+           double(std::max(arena->reserved_peak.load(), reserved)) / double(1024 * 1024),
+           double(std::max(arena->used_peak.load(), used)) / double(1024 * 1024),
+           arena->allocs_num_total.load() + allocs_num,
+           arena->clears_num.load());
+  }
+}
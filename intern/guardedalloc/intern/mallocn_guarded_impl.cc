@@ -859,6 +859,8 @@ void MEM_guarded_printmemlist_stats()
 
   mem_unlock_thread();
 
+  mem_arena_print_stats();
+
 #ifdef HAVE_MALLOC_STATS
   printf("System Statistics:\n");
   malloc_stats();
@@ -96,6 +96,8 @@ size_t memory_usage_current(void);
 size_t memory_usage_peak(void);
 void memory_usage_peak_reset(void);
 
+void mem_arena_print_stats(void);
+
 /**
  * Clear the listbase of allocated memory blocks.
  *
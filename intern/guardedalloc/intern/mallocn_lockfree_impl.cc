@@ -506,6 +506,8 @@ void MEM_lockfree_printmemlist_stats()
       "\nFor more detailed per-block statistics run Blender with memory debugging command line "
       "argument.\n");
 
+  mem_arena_print_stats();
+
 #ifdef HAVE_MALLOC_STATS
   printf("System Statistics:\n");
   malloc_stats();
@@ -0,0 +1,117 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+#include "MEM_guardedalloc.h"
+#include "guardedalloc_test_base.h"
+
+static void test_arena_alloc()
+{
+  MEM_Arena *arena = MEM_arena_new("test arena");
+  size_t reserved, used, allocs_num;
+
+  size_t used_expected = 0;
+  for (const size_t alignment : {1, 8, 16, 64, 256}) {
+    for (int i = 0; i < 100; i++) {
+      used_expected += 7 + i;
+      void *ptr = MEM_arena_alloc(arena, 7 + i, alignment);
+      EXPECT_EQ(size_t(ptr) % alignment, 0);
+      memset(ptr, 0xFF, 7 + i);
+    }
+  }
+  /* Larger than a chunk. */
+  void *large = MEM_arena_alloc(arena, 10 * 1024 * 1024, 64);
+  memset(large, 0, 10 * 1024 * 1024);
+  used_expected += 10 * 1024 * 1024;
+
+  MEM_arena_get_stats(arena, &reserved, &used, &allocs_num);
+  EXPECT_EQ(used, used_expected);
+  EXPECT_EQ(allocs_num, size_t(501));
+  EXPECT_GT(reserved, size_t(10 * 1024 * 1024));
+
+  MEM_arena_clear(arena);
+  /* Some memory is kept for reuse, but the large chunk is freed. */
+  MEM_arena_get_stats(arena, &reserved, &used, &allocs_num);
+  EXPECT_EQ(used, size_t(0));
+  EXPECT_EQ(allocs_num, size_t(0));
+  EXPECT_LT(reserved, size_t(1024 * 1024));
+
+  int *value = static_cast<int *>(MEM_arena_alloc(arena, sizeof(int), alignof(int)));
+  *value = 42;
+  EXPECT_EQ(*value, 42);
+  MEM_arena_get_stats(arena, &reserved, &used, &allocs_num);
+  EXPECT_EQ(used, sizeof(int));
+  EXPECT_EQ(allocs_num, size_t(1));
+
+  MEM_arena_free(arena);
+}
+
+static void test_arena_threads()
+{
+  MEM_Arena *arena = MEM_arena_new("test arena");
+
+  const int threads_num = 8;
+  const int allocs_num_per_thread = 10000;
+  std::vector<std::vector<int *>> values(threads_num);
+  for (int iter = 0; iter < 2; iter++) {
+    std::vector<std::thread> threads;
+    for (int thread = 0; thread < threads_num; thread++) {
+      threads.emplace_back([&, thread]() {
+        for (int i = 0; i < allocs_num_per_thread; i++) {
+          int *value = static_cast<int *>(
+              MEM_arena_alloc(arena, sizeof(int) * 3, alignof(int)));
+          value[0] = value[1] = value[2] = thread * allocs_num_per_thread + i;
+          values[thread].push_back(value);
+        }
+      });
+    }
+    for (std::thread &thread : threads) {
+      thread.join();
+    }
+
+    /* No allocations overlap. */
+    for (int thread = 0; thread < threads_num; thread++) {
+      for (int i = 0; i < allocs_num_per_thread; i++) {
+        const int *value = values[thread][i];
+        EXPECT_EQ(value[0], thread * allocs_num_per_thread + i);
+        EXPECT_EQ(value[2], thread * allocs_num_per_thread + i);
+      }
+      values[thread].clear();
+    }
+
+    size_t reserved, used, allocs_num;
+    MEM_arena_get_stats(arena, &reserved, &used, &allocs_num);
+    EXPECT_EQ(allocs_num, size_t(threads_num * allocs_num_per_thread));
+    EXPECT_EQ(used, size_t(threads_num * allocs_num_per_thread) * sizeof(int) * 3);
+    EXPECT_GE(reserved, used);
+    MEM_arena_clear(arena);
+  }
+
+  MEM_arena_free(arena);
+}
+
+TEST_F(LockFreeAllocatorTest, MEM_arena_alloc)
+{
+  test_arena_alloc();
+}
+
+TEST_F(GuardedAllocatorTest, MEM_arena_alloc)
+{
+  test_arena_alloc();
+}
+
+TEST_F(LockFreeAllocatorTest, MEM_arena_threads)
+{
+  test_arena_threads();
+}
+
+TEST_F(GuardedAllocatorTest, MEM_arena_threads)
+{
+  test_arena_threads();
+}
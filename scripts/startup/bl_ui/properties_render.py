@@ -1160,6 +1160,12 @@ class RENDER_PT_eevee_performance_memory(RenderButtonsPanel, Panel):
         layout.prop(props, "shadow_pool_size", text="Shadow Pool")
         layout.prop(props, "gi_irradiance_pool_size", text="Light Probes Volume Pool")
 
+        col = layout.column()
+        col.prop(props, "use_render_tiles")
+        sub = col.column()
+        sub.active = props.use_render_tiles
+        sub.prop(props, "render_tile_size")
+
 
 class RENDER_PT_eevee_performance_viewport(RenderButtonsPanel, Panel):
     bl_label = "Viewport"
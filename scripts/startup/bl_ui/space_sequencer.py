@@ -1818,6 +1818,7 @@ class SEQUENCER_PT_source(SequencerButtonsPanel, Panel):
                 col.prop(strip.colorspace_settings, "name", text="Color Space")
                 col.prop(strip, "stream_index")
                 col.prop(strip, "use_deinterlace")
+                col.prop(strip, "use_hardware_decoding")
 
             if scene.render.use_multiview:
                 layout.prop(strip, "use_multiview")
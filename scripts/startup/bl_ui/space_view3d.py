@@ -3643,6 +3643,8 @@ class VIEW3D_MT_sculpt(Menu):
 
         # Rebuild BVH
         layout.operator("sculpt.optimize")
+        props = layout.operator("sculpt.optimize", text="Rebuild BVH & Reorder Mesh")
+        props.reorder_mesh = True
 
         layout.operator(
             "sculpt.dynamic_topology_toggle", text="Dynamic Topology",
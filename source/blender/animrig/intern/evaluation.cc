@@ -4,7 +4,12 @@
 
 #include "ANIM_evaluation.hh"
 
+#include <cctype>
+#include <optional>
+#include <string>
+
 #include "RNA_access.hh"
+#include "RNA_path.hh"
 
 #include "BKE_animsys.h"
 #include "BKE_fcurve.hh"
@@ -85,6 +90,107 @@ void evaluate_and_apply_action(PointerRNA &animated_id_ptr,
   apply_evaluation_result(evaluation_result, animated_id_ptr, flush_to_original);
 }
 
+namespace {
+
+/**
+ * Resolves the RNA paths of many channels of the same data-block. Channels usually come in
+ * groups that animate the same struct, like the transform channels of a bone. The path to each
+ * struct is only resolved once, after that only the property has to be found in it.
+ */
+class RNAPathResolver {
+  PointerRNA &id_ptr_;
+  /** Resolved structs, keyed by the part of the RNA path before the property name. */
+  Map<StringRef, std::optional<PointerRNA>> struct_ptrs_;
+
+ public:
+  RNAPathResolver(PointerRNA &id_ptr) : id_ptr_(id_ptr) {}
+
+  /** The same as #BKE_animsys_rna_path_resolve. */
+  bool resolve(const char *rna_path, const int array_index, PathResolvedRNA &r_result)
+  {
+    const int64_t separator = rna_path ? find_property_separator(rna_path) : -1;
+    if (separator == -1) {
+      return BKE_animsys_rna_path_resolve(&id_ptr_, rna_path, array_index, &r_result);
+    }
+
+    const StringRef struct_path = StringRef(rna_path, separator);
+    const std::optional<PointerRNA> &struct_ptr = struct_ptrs_.lookup_or_add_cb(
+        struct_path, [&]() -> std::optional<PointerRNA> {
+          PointerRNA ptr;
+          PropertyRNA *prop;
+          if (!RNA_path_resolve(&id_ptr_, std::string(struct_path).c_str(), &ptr, &prop) ||
+              prop != nullptr || ptr.data == nullptr)
+          {
+            return std::nullopt;
+          }
+          return ptr;
+        });
+    if (!struct_ptr) {
+      return BKE_animsys_rna_path_resolve(&id_ptr_, rna_path, array_index, &r_result);
+    }
+
+    r_result.ptr = *struct_ptr;
+    r_result.prop = RNA_struct_find_property(&r_result.ptr, rna_path + separator + 1);
+    if (r_result.prop == nullptr) {
+      /* Let the full path resolving report the error. */
+      return BKE_animsys_rna_path_resolve(&id_ptr_, rna_path, array_index, &r_result);
+    }
+    return BKE_animsys_rna_path_resolve_check(&id_ptr_, rna_path, array_index, &r_result);
+  }
+
+ private:
+  /**
+   * Find the dot before the name of the property at the end of the path, ignoring dots in quoted
+   * strings and brackets. Returns -1 when the path doesn't end with a plain property name, like
+   * `pose.bones["Bone"]["custom_prop"]`.
+   */
+  static int64_t find_property_separator(const StringRef path)
+  {
+    int64_t separator = -1;
+    int bracket_depth = 0;
+    bool in_quotes = false;
+    for (int64_t i = 0; i < path.size(); i++) {
+      const char c = path[i];
+      if (in_quotes) {
+        if (c == '\\') {
+          i++;
+        }
+        else if (c == '"') {
+          in_quotes = false;
+        }
+        continue;
+      }
+      switch (c) {
+        case '"':
+          in_quotes = true;
+          break;
+        case '[':
+          bracket_depth++;
+          break;
+        case ']':
+          bracket_depth--;
+          break;
+        case '.':
+          if (bracket_depth == 0) {
+            separator = i;
+          }
+          break;
+      }
+    }
+    if (separator <= 0 || separator == path.size() - 1) {
+      return -1;
+    }
+    for (const char c : path.drop_prefix(separator + 1)) {
+      if (!(isalnum(c) || c == '_')) {
+        return -1;
+      }
+    }
+    return separator;
+  }
+};
+
+}  // namespace
+
 /* Copy of the same-named function in anim_sys.cc, with the check on action groups removed. */
 static bool is_fcurve_evaluatable(const FCurve *fcu)
 {
@@ -115,18 +221,15 @@ static void animsys_construct_orig_pointer_rna(const PointerRNA *ptr, PointerRNA
   ptr_orig->data = ptr_orig->owner_id;
 }
 
-/* Copy of the same-named function in anim_sys.cc. */
-static void animsys_write_orig_anim_rna(PointerRNA *ptr,
+/* Copy of the same-named function in anim_sys.cc, resolving the path with \a orig_resolver. */
+static void animsys_write_orig_anim_rna(RNAPathResolver &orig_resolver,
                                         const char *rna_path,
                                         const int array_index,
                                         const float value)
 {
-  PointerRNA ptr_orig;
-  animsys_construct_orig_pointer_rna(ptr, &ptr_orig);
-
   PathResolvedRNA orig_anim_rna;
   /* TODO(sergey): Should be possible to cache resolved path in dependency graph somehow. */
-  if (BKE_animsys_rna_path_resolve(&ptr_orig, rna_path, array_index, &orig_anim_rna)) {
+  if (orig_resolver.resolve(rna_path, array_index, orig_anim_rna)) {
     BKE_animsys_write_to_rna_path(&orig_anim_rna, value);
   }
 }
@@ -142,6 +245,7 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
   }
 
   EvaluationResult evaluation_result;
+  RNAPathResolver resolver(animated_id_ptr);
   for (FCurve *fcu : channelbag_for_slot->fcurves()) {
     /* Blatant copy of animsys_evaluate_fcurves(). */
 
@@ -150,9 +254,7 @@ static EvaluationResult evaluate_keyframe_data(PointerRNA &animated_id_ptr,
     }
 
     PathResolvedRNA anim_rna;
-    if (!BKE_animsys_rna_path_resolve(
-            &animated_id_ptr, fcu->rna_path, fcu->array_index, &anim_rna))
-    {
+    if (!resolver.resolve(fcu->rna_path, fcu->array_index, anim_rna)) {
       printf("Cannot resolve RNA path %s[%d] on ID %s\n",
              fcu->rna_path,
              fcu->array_index,
@@ -171,6 +273,13 @@ void apply_evaluation_result(const EvaluationResult &evaluation_result,
                              PointerRNA &animated_id_ptr,
                              const bool flush_to_original)
 {
+  PointerRNA orig_id_ptr;
+  std::optional<RNAPathResolver> orig_resolver;
+  if (flush_to_original) {
+    animsys_construct_orig_pointer_rna(&animated_id_ptr, &orig_id_ptr);
+    orig_resolver.emplace(orig_id_ptr);
+  }
+
   for (auto channel_result : evaluation_result.items()) {
     const PropIdentifier &prop_ident = channel_result.key;
     const AnimatedProperty &anim_prop = channel_result.value;
@@ -182,7 +291,7 @@ void apply_evaluation_result(const EvaluationResult &evaluation_result,
     if (flush_to_original) {
       /* Convert the StringRef to a `const char *`, as the rest of the RNA path handling code in
        * BKE still uses `char *` instead of `StringRef`. */
-      animsys_write_orig_anim_rna(&animated_id_ptr,
+      animsys_write_orig_anim_rna(*orig_resolver,
                                   StringRefNull(prop_ident.rna_path).c_str(),
                                   prop_ident.array_index,
                                   animated_value);
@@ -8,11 +8,13 @@
 
 #include "BKE_action.hh"
 #include "BKE_animsys.h"
+#include "BKE_constraint.h"
 #include "BKE_idtype.hh"
 #include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_object.hh"
 
+#include "DNA_constraint_types.h"
 #include "DNA_object_types.h"
 
 #include "RNA_access.hh"
@@ -183,6 +185,29 @@ TEST_F(AnimationEvaluationTest, evaluate_layer__keyframes)
   EXPECT_EQ(7.0f, cube->rot[2]) << "Evaluation should not modify the animated ID";
 }
 
+TEST_F(AnimationEvaluationTest, evaluate_layer__nested_struct_paths)
+{
+  BKE_constraint_add_for_object(cube, "Limit", CONSTRAINT_TYPE_LOCLIMIT);
+
+  Strip &strip = layer->strip_add(*action, Strip::Type::Keyframe);
+  StripKeyframeData &strip_data = strip.data<StripKeyframeData>(*action);
+
+  /* Several properties of the same struct, and paths that can't be resolved. */
+  strip_data.keyframe_insert(
+      bmain, *slot, {"constraints[\"Limit\"].influence", 0}, {1.0f, 0.25f}, settings);
+  strip_data.keyframe_insert(
+      bmain, *slot, {"constraints[\"Limit\"].min_x", 0}, {1.0f, 3.0f}, settings);
+  strip_data.keyframe_insert(
+      bmain, *slot, {"constraints[\"Limit\"].no_such_property", 0}, {1.0f, 1.0f}, settings);
+  strip_data.keyframe_insert(
+      bmain, *slot, {"constraints[\"Missing\"].influence", 0}, {1.0f, 1.0f}, settings);
+
+  EXPECT_TRUE(test_evaluate_layer("constraints[\"Limit\"].influence", 0, {1.0f, 0.25f}));
+  EXPECT_TRUE(test_evaluate_layer("constraints[\"Limit\"].min_x", 0, {1.0f, 3.0f}));
+  EXPECT_TRUE(test_evaluate_layer_no_result("constraints[\"Limit\"].no_such_property", 0, 1.0f));
+  EXPECT_TRUE(test_evaluate_layer_no_result("constraints[\"Missing\"].influence", 0, 1.0f));
+}
+
 TEST_F(AnimationEvaluationTest, strip_boundaries__single_strip)
 {
   /* Single finite strip, check first, middle, and last frame. */
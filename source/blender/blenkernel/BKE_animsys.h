@@ -272,6 +272,14 @@ bool BKE_animsys_rna_path_resolve(struct PointerRNA *ptr,
                                   const char *rna_path,
                                   int array_index,
                                   struct PathResolvedRNA *r_result);
+/**
+ * The checks of #BKE_animsys_rna_path_resolve, for when the pointer and property of \a r_result
+ * were already found by resolving \a rna_path on \a ptr in another way.
+ */
+bool BKE_animsys_rna_path_resolve_check(const struct PointerRNA *ptr,
+                                        const char *rna_path,
+                                        int array_index,
+                                        struct PathResolvedRNA *r_result);
 bool BKE_animsys_read_from_rna_path(struct PathResolvedRNA *anim_rna, float *r_value);
 /**
  * Write the given value to a setting using RNA, and return success.
@@ -606,6 +606,16 @@ void BKE_pose_constraints_evaluate(Depsgraph *depsgraph,
 
 void BKE_pose_bone_done(Depsgraph *depsgraph, Object *object, int pchan_index);
 
+/**
+ * #BKE_pose_eval_bone followed by #BKE_pose_bone_done, for bones that are known to have no
+ * constraints and to not be part of an IK chain: nothing can modify their pose matrix in between,
+ * so the finalize step does not need a separate operation.
+ */
+void BKE_pose_eval_bone_and_done(Depsgraph *depsgraph,
+                                 Scene *scene,
+                                 Object *object,
+                                 int pchan_index);
+
 void BKE_pose_eval_bbone_segments(Depsgraph *depsgraph, Object *object, int pchan_index);
 
 void BKE_pose_iktree_evaluate(Depsgraph *depsgraph,
@@ -10,6 +10,8 @@
 
 #include "BKE_bake_items.hh"
 
+struct BLI_mmap_file;
+
 namespace blender::bke::bake {
 
 /**
@@ -19,6 +21,17 @@ namespace blender::bke::bake {
 struct BlobSlice {
   std::string name;
   IndexRange range;
+  /**
+   * Set when the data in #range is a zstd frame, to the size of the data after decompression.
+   * Compressed slices can't be memory-mapped.
+   */
+  std::optional<int64_t> decompressed_size;
+
+  /** Size of the data after decompression. */
+  int64_t data_size() const
+  {
+    return decompressed_size.value_or(range.size());
+  }
 
   std::shared_ptr<io::serialize::DictionaryValue> serialize() const;
   static std::optional<BlobSlice> deserialize(const io::serialize::DictionaryValue &io_slice);
@@ -43,6 +56,15 @@ class BlobReader {
    */
   [[nodiscard]] virtual bool read_as_stream(const BlobSlice &slice,
                                             FunctionRef<bool(std::istream &)> fn) const;
+
+  /**
+   * Access the data of the given slice without reading it into a new buffer, if the reader
+   * supports that. The data is only paged in from disk when it is accessed, and the returned
+   * sharing info keeps it alive. Writing to the data never modifies the file.
+   * \param alignment: Required alignment of the returned data.
+   */
+  virtual std::optional<ImplicitSharingInfoAndData> read_mapped(const BlobSlice &slice,
+                                                                int64_t alignment) const;
 };
 
 /**
@@ -51,10 +73,24 @@ class BlobReader {
 class BlobWriter {
  protected:
   int64_t total_written_size_ = 0;
+  /** See #write_array. */
+  bool use_compression_ = false;
 
  public:
   virtual ~BlobWriter() = default;
 
+  /** Compress large arrays written with #write_array. */
+  void set_use_compression(const bool use_compression)
+  {
+    use_compression_ = use_compression;
+  }
+
+  /**
+   * Write an array, which is compressed if compression is enabled and reduces the size. Readers
+   * have to check #BlobSlice::decompressed_size.
+   */
+  BlobSlice write_array(const void *data, int64_t size);
+
   /**
    * Write the provided binary data.
    * \return Slice where the data has been written to.
@@ -162,12 +198,19 @@ class BlobReadSharing : NonCopyable, NonMovable {
 class DiskBlobReader : public BlobReader {
  private:
   const std::string blobs_dir_;
+  /** Support #read_mapped by memory-mapping the blob files. */
+  const bool use_mapping_;
   mutable std::mutex mutex_;
   mutable Map<std::string, std::unique_ptr<fstream>> open_input_streams_;
+  /** May contain null when mapping a file failed. */
+  mutable Map<std::string, BLI_mmap_file *> mapped_files_;
 
  public:
-  DiskBlobReader(std::string blobs_dir);
+  DiskBlobReader(std::string blobs_dir, bool use_mapping = false);
+  ~DiskBlobReader() override;
   [[nodiscard]] bool read(const BlobSlice &slice, void *r_data) const override;
+  std::optional<ImplicitSharingInfoAndData> read_mapped(const BlobSlice &slice,
+                                                        int64_t alignment) const override;
 };
 
 /**
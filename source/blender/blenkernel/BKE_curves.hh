@@ -236,7 +236,7 @@ class CurvesGeometry : public ::CurvesGeometry {
   MutableSpan<int8_t> normal_mode_for_write();
 
   /**
-   * Handle types for Bezier control points. Call #tag_topology_changed after changes.
+   * Handle types for Bezier control points. Call #tag_handle_types_changed after changes.
    */
   VArray<int8_t> handle_types_left() const;
   MutableSpan<int8_t> handle_types_left_for_write();
@@ -381,6 +381,11 @@ class CurvesGeometry : public ::CurvesGeometry {
    * (number of points, evaluated points, or the total count).
    */
   void tag_topology_changed();
+  /**
+   * Call after changing Bezier handle types. This changes the number of evaluated points of
+   * Bezier curves, but keeps caches that only depend on other curve types (like the NURBS basis).
+   */
+  void tag_handle_types_changed();
   /** Call after changing the "tilt" or "up" attributes. */
   void tag_normals_changed();
   /**
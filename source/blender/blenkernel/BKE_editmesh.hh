@@ -13,6 +13,7 @@
  */
 
 #include <array>
+#include <memory>
 
 #include "BLI_array.hh"
 #include "BLI_math_vector_types.hh"
@@ -29,6 +30,9 @@ struct Depsgraph;
 struct Mesh;
 struct Object;
 struct Scene;
+namespace blender::bke {
+struct EditMeshEvalCache;
+}
 
 /**
  * This structure is used for mesh edit-mode.
@@ -64,6 +68,19 @@ struct BMEditMesh {
    * Set #Main.is_memfile_undo_flush_needed when enabling.
    */
   char needs_flush_to_id;
+
+  /**
+   * The last conversion of #bm to a #Mesh for the modifier stack. While only vertex positions
+   * change (e.g. while transforming), the rest of its data is reused instead of converting the
+   * whole mesh again. Reset at the start of every evaluation unless
+   * #eval_cache_positions_only is set.
+   */
+  std::shared_ptr<blender::bke::EditMeshEvalCache> eval_cache;
+  /**
+   * Set by edit operations that only moved vertices since the last evaluation.
+   * Consumed by the evaluation, see #eval_cache.
+   */
+  bool eval_cache_positions_only = false;
 };
 
 /* editmesh.cc */
@@ -99,6 +116,11 @@ BMEditMesh *BKE_editmesh_from_object(Object *ob);
  * \note Does not free the #BMEditMesh  itself.
  */
 void BKE_editmesh_free_data(BMEditMesh *em);
+/**
+ * Free the mesh that was converted for evaluation, it can't be reused after changes other than
+ * to vertex positions.
+ */
+void BKE_editmesh_eval_cache_clear(BMEditMesh *em);
 
 blender::Array<blender::float3> BKE_editmesh_vert_coords_alloc(Depsgraph *depsgraph,
                                                                BMEditMesh *em,
@@ -8,11 +8,16 @@
  * \ingroup bke
  */
 
+#include <mutex>
+
 #include "BLI_array.hh"
 #include "BLI_bounds_types.hh"
 #include "BLI_math_vector_types.hh"
 
+#include "DNA_customdata_types.h"
+
 struct BMEditMesh;
+struct Mesh;
 
 namespace blender::bke {
 
@@ -40,6 +45,21 @@ struct EditMeshData {
   Array<float3> face_centers;
 };
 
+/**
+ * A mesh converted from the edit mesh by #BKE_mesh_wrapper_ensure_mdata, stored in
+ * #BMEditMesh::eval_cache. Its data is shared with later conversions as long as the topology and
+ * attributes of the edit mesh are unchanged, only the positions are copied again.
+ */
+struct EditMeshEvalCache {
+  /** Locked while converting, meshes wrapping the same edit mesh may be converted in parallel. */
+  std::mutex mutex;
+  Mesh *mesh = nullptr;
+  /** The #MeshRuntime::cd_mask_extra used for the conversion. */
+  CustomData_MeshMasks cd_mask_extra = {};
+
+  ~EditMeshEvalCache();
+};
+
 }  // namespace blender::bke
 
 blender::Span<blender::float3> BKE_editmesh_cache_ensure_face_normals(
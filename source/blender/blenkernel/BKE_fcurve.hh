@@ -595,6 +595,24 @@ void BKE_fcurve_correct_bezpart(const float v1[2], float v2[2], float v3[2], con
 /* evaluate fcurve */
 float evaluate_fcurve(const FCurve *fcu, float evaltime);
 float evaluate_fcurve_only_curve(const FCurve *fcu, float evaltime);
+/**
+ * Evaluate the F-Curve at all \a evaltimes, which must be sorted in ascending order. This gives
+ * the same values as #evaluate_fcurve for every time, but walks along the keyframe segments
+ * instead of searching the segment of every time separately.
+ */
+void evaluate_fcurve_times(const FCurve *fcu,
+                           blender::Span<float> evaltimes,
+                           blender::MutableSpan<float> r_values);
+/**
+ * Evaluate all \a fcurves at the sorted \a evaltimes in parallel, with #evaluate_fcurve_times.
+ * This is meant for sampling the animation of many data-blocks outside of the depsgraph, so the
+ * curves can't be drivers.
+ *
+ * \param r_values: The values of each curve at all times, one curve after the other.
+ */
+void evaluate_fcurves_times(blender::Span<const FCurve *> fcurves,
+                            blender::Span<float> evaltimes,
+                            blender::MutableSpan<float> r_values);
 float evaluate_fcurve_driver(PathResolvedRNA *anim_rna,
                              FCurve *fcu,
                              ChannelDriver *driver_orig,
@@ -222,6 +222,22 @@ enum {
   G_FLAG_GPU_BACKEND_FALLBACK = (1 << 17),
   G_FLAG_GPU_BACKEND_FALLBACK_QUIET = (1 << 18),
 
+  /**
+   * Keep large pointer-free arrays read from uncompressed blend-files and from geometry node
+   * bakes backed by the memory-mapped file instead of copying them, see
+   * `--enable-zero-copy-load`.
+   */
+  G_FLAG_READFILE_ZERO_COPY = (1 << 19),
+  /**
+   * Read the data of large data-blocks from uncompressed blend-files on multiple threads,
+   * see `--enable-threaded-load`.
+   */
+  G_FLAG_READFILE_THREADED = (1 << 20),
+  /**
+   * When saving over an existing uncompressed or compressed blend-file, copy byte ranges that did
+   * not change from the previous file instead of writing them, see `--enable-incremental-save`.
+   */
+  G_FLAG_WRITEFILE_INCREMENTAL = (1 << 21),
 };
 
 #define G_FLAG_INTERNET_OVERRIDE_PREF_ANY \
@@ -232,7 +248,8 @@ enum {
   (G_FLAG_SCRIPT_AUTOEXEC | G_FLAG_SCRIPT_OVERRIDE_PREF | G_FLAG_INTERNET_ALLOW | \
    G_FLAG_INTERNET_OVERRIDE_PREF_ONLINE | G_FLAG_INTERNET_OVERRIDE_PREF_OFFLINE | \
    G_FLAG_EVENT_SIMULATE | G_FLAG_USERPREF_NO_SAVE_ON_EXIT | G_FLAG_GPU_BACKEND_FALLBACK | \
-   G_FLAG_GPU_BACKEND_FALLBACK_QUIET | \
+   G_FLAG_GPU_BACKEND_FALLBACK_QUIET | G_FLAG_READFILE_ZERO_COPY | G_FLAG_READFILE_THREADED | \
+   G_FLAG_WRITEFILE_INCREMENTAL | \
 \
    /* #BPY_python_reset is responsible for resetting these flags on file load. */ \
    G_FLAG_SCRIPT_AUTOEXEC_FAIL | G_FLAG_SCRIPT_AUTOEXEC_FAIL_QUIET)
@@ -269,8 +286,9 @@ enum {
   G_DEBUG_XR = (1 << 21),                    /* XR/OpenXR messages */
   G_DEBUG_XR_TIME = (1 << 22),               /* XR/OpenXR timing messages */
 
-  G_DEBUG_GHOST = (1 << 23),  /* Debug GHOST module. */
-  G_DEBUG_WINTAB = (1 << 24), /* Debug Wintab. */
+  G_DEBUG_GHOST = (1 << 23),        /* Debug GHOST module. */
+  G_DEBUG_WINTAB = (1 << 24),       /* Debug Wintab. */
+  G_DEBUG_STARTUP_TIME = (1 << 25), /* Startup time profiling. */
 };
 
 #define G_DEBUG_ALL \
@@ -62,6 +62,12 @@ enum {
    * IDs have at least an 'extra user' (#ID_TAG_EXTRAUSER).
    */
   IDTYPE_FLAGS_NEVER_UNUSED = 1 << 6,
+  /**
+   * Indicates that #IDTypeInfo.blend_write of the given IDType only modifies the temporary copy
+   * of the ID it gets and does not access any other shared state, so that multiple IDs of this
+   * type can be written on different threads when saving a blend-file.
+   */
+  IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE = 1 << 7,
 };
 
 struct IDCacheKey {
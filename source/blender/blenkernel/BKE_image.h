@@ -353,6 +353,10 @@ void BKE_image_free_all_gputextures(struct Main *bmain);
  * Same as #BKE_image_free_all_gputextures but only free animated images.
  */
 void BKE_image_free_anim_gputextures(struct Main *bmain);
+/**
+ * Garbage collect the GPU textures of images that were not used for a while, and of the least
+ * recently used images when their textures use more memory than the user defined limit.
+ */
 void BKE_image_free_old_gputextures(struct Main *bmain);
 
 /**
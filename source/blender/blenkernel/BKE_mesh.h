@@ -10,6 +10,7 @@
 #include "BLI_array.hh"
 #include "BLI_compiler_attrs.h"
 #include "BLI_compiler_compat.h"
+#include "BLI_index_mask_fwd.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -41,6 +42,8 @@ enum eMeshBatchDirtyMode {
   BKE_MESH_BATCH_DIRTY_SHADING,
   BKE_MESH_BATCH_DIRTY_UVEDIT_ALL,
   BKE_MESH_BATCH_DIRTY_UVEDIT_SELECT,
+  /** Only positions changed, other attributes and the topology are shared. */
+  BKE_MESH_BATCH_DIRTY_DEFORM,
 };
 
 /* `mesh.cc` */
@@ -505,8 +508,22 @@ void BKE_mesh_eval_geometry(Depsgraph *depsgraph, Mesh *mesh);
 /* Draw Cache */
 void BKE_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode);
 void BKE_mesh_batch_cache_free(void *batch_cache);
+/**
+ * Move the batch cache of \a mesh_src to \a mesh_dst when \a mesh_dst is a deformed version of
+ * it, sharing its topology and all attributes except the positions. This avoids rebuilding the
+ * position independent GPU buffers when an evaluated mesh is replaced during playback.
+ */
+void BKE_mesh_batch_cache_reuse_deformed(Mesh *mesh_src, Mesh *mesh_dst);
+/**
+ * Like #BKE_MESH_BATCH_DIRTY_DEFORM, but only the positions of \a changed_verts differ, which
+ * allows updating the position buffer partially.
+ */
+void BKE_mesh_batch_cache_tag_positions_changed(Mesh *mesh,
+                                                const blender::IndexMask &changed_verts);
 
 extern void (*BKE_mesh_batch_cache_dirty_tag_cb)(Mesh *mesh, eMeshBatchDirtyMode mode);
+extern void (*BKE_mesh_batch_cache_tag_positions_changed_cb)(
+    Mesh *mesh, const blender::IndexMask &changed_verts);
 extern void (*BKE_mesh_batch_cache_free_cb)(void *batch_cache);
 
 /* `mesh_debug.cc` */
@@ -45,6 +45,20 @@ void corner_tris_calc_with_normals(Span<float3> vert_positions,
                                    Span<float3> face_normals,
                                    MutableSpan<int3> corner_tris);
 
+/**
+ * Recalculate the triangles of the faces in \a face_mask, the other triangles are unchanged.
+ * Since the triangulation of faces with three corners doesn't depend on the positions, it makes
+ * sense to only pass the changed faces with more corners.
+ *
+ * \param face_normals: Pre-calculated face normals or an empty span.
+ */
+void corner_tris_calc(Span<float3> vert_positions,
+                      OffsetIndices<int> faces,
+                      Span<int> corner_verts,
+                      Span<float3> face_normals,
+                      const IndexMask &face_mask,
+                      MutableSpan<int3> corner_tris);
+
 void corner_tris_calc_face_indices(OffsetIndices<int> faces, MutableSpan<int> tri_faces);
 
 /**
@@ -104,6 +118,35 @@ void normals_calc_verts(Span<float3> vert_positions,
                         Span<float3> face_normals,
                         MutableSpan<float3> vert_normals);
 
+/**
+ * Calculate vertex normals without the face normals, which are recomputed for every vertex
+ * of the face instead. This gives the same result as calculating the face normals first, but
+ * avoids allocating and filling a separate array when only vertex normals are needed.
+ */
+void normals_calc_verts(Span<float3> vert_positions,
+                        OffsetIndices<int> faces,
+                        Span<int> corner_verts,
+                        GroupedSpan<int> vert_to_face_map,
+                        MutableSpan<float3> vert_normals);
+
+/** Like #normals_calc_faces but only the normals of the faces in \a mask are written. */
+void normals_calc_faces(Span<float3> vert_positions,
+                        OffsetIndices<int> faces,
+                        Span<int> corner_verts,
+                        const IndexMask &mask,
+                        MutableSpan<float3> face_normals);
+
+/**
+ * Like the version of #normals_calc_verts without face normals, but only the normals of the
+ * vertices in \a mask are written.
+ */
+void normals_calc_verts(Span<float3> vert_positions,
+                        OffsetIndices<int> faces,
+                        Span<int> corner_verts,
+                        GroupedSpan<int> vert_to_face_map,
+                        const IndexMask &mask,
+                        MutableSpan<float3> vert_normals);
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
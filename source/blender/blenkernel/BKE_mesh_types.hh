@@ -33,6 +33,9 @@ struct EditMeshData;
 namespace blender::bke::bake {
 struct BakeMaterialsList;
 }
+namespace blender::bke::pbvh {
+class Tree;
+}
 
 /** #MeshRuntime.wrapper_type */
 enum eMeshWrapperType {
@@ -171,6 +174,18 @@ struct MeshRuntime {
   std::unique_ptr<SubdivCCG> subdiv_ccg;
   int subdiv_ccg_tot_level = 0;
 
+  /**
+   * Incremented whenever the topology changes (see #BKE_mesh_runtime_clear_geometry), to detect
+   * whether data derived from the topology that is stored elsewhere is still valid.
+   */
+  int64_t topology_version = 0;
+  /**
+   * A sculpt mode BVH tree built for this mesh that isn't used anymore, kept to avoid building it
+   * again when sculpt mode is entered again or after updates that didn't change the topology.
+   * See #pbvh::keep_for_reuse.
+   */
+  std::unique_ptr<pbvh::Tree> pbvh_for_reuse;
+
   /** Set by modifier stack if only deformed from original. */
   bool deformed_only = false;
   /**
@@ -10,6 +10,7 @@
 #include "BLI_function_ref.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_span.hh"
+#include "BLI_vector.hh"
 
 #include "DNA_modifier_types.h" /* Needed for all enum type definitions. */
 
@@ -394,6 +395,14 @@ struct ModifierTypeInfo {
       Object *object,
       ModifierData *md,
       blender::FunctionRef<void(const IDCacheKey &cache_key, void **cache_p, uint flags)> fn);
+
+  /**
+   * Optional. Implemented by modifiers whose #modify_mesh result only depends on the input mesh,
+   * the material count of the object and the modifier settings. Appends the settings to \a r_key
+   * so that the result can be cached by the modifier stack evaluation. Modifiers without pointers
+   * in their settings can use #BKE_modifier_result_cache_key_append_settings.
+   */
+  void (*result_cache_key)(const ModifierData *md, blender::Vector<char> &r_key);
 };
 
 /* Used to set a modifier's panel type. */
@@ -432,6 +441,12 @@ ModifierData *BKE_modifier_copy_ex(const ModifierData *md, int flag);
  * Callback's can use this to avoid copying every member.
  */
 void BKE_modifier_copydata_generic(const ModifierData *md, ModifierData *md_dst, int flag);
+/**
+ * Append all settings of the modifier to a result cache key, see
+ * #ModifierTypeInfo::result_cache_key.
+ */
+void BKE_modifier_result_cache_key_append_settings(const ModifierData *md,
+                                                   blender::Vector<char> &r_key);
 void BKE_modifier_copydata(const ModifierData *md, ModifierData *target);
 void BKE_modifier_copydata_ex(const ModifierData *md, ModifierData *target, int flag);
 bool BKE_modifier_depends_ontime(Scene *scene, ModifierData *md);
@@ -337,6 +337,12 @@ struct bNodeType {
 
   /* Execute a geometry node. */
   NodeGeometryExecFunction geometry_node_execute;
+  /**
+   * The outputs of the node only depend on its inputs and properties, so they can be reused from
+   * the memory cache when the node is evaluated again with the same inputs. Warnings reported by
+   * the node are not reported again when the cached outputs are used.
+   */
+  bool geometry_node_cache_outputs = false;
 
   /**
    * Declares which sockets and panels the node has. It has to be able to generate a declaration
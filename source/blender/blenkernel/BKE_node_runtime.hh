@@ -151,8 +151,11 @@ class bNodeTreeRuntime : NonCopyable, NonMovable {
 
   /* End legacy execution data. */
 
-  /** Information about how inputs and outputs of the node group interact with fields. */
-  std::unique_ptr<nodes::FieldInferencingInterface> field_inferencing_interface;
+  /**
+   * Information about how inputs and outputs of the node group interact with fields. It is
+   * replaced instead of modified when the tree changes, so copies of the tree share it.
+   */
+  std::shared_ptr<const nodes::FieldInferencingInterface> field_inferencing_interface;
   /** Information about usage of anonymous attributes within the group. */
   std::unique_ptr<node_tree_reference_lifetimes::ReferenceLifetimesInfo> reference_lifetimes_info;
   std::unique_ptr<nodes::gizmos::TreeGizmoPropagation> gizmo_propagation;
@@ -562,6 +562,11 @@ void BKE_sculptsession_free(Object *ob);
 void BKE_sculptsession_free_deformMats(SculptSession *ss);
 void BKE_sculptsession_free_vwpaint_data(SculptSession *ss);
 void BKE_sculptsession_free_pbvh(Object &object);
+/**
+ * Like #BKE_sculptsession_free_pbvh, but a regular mesh BVH tree is kept with the original mesh,
+ * so it can be reused when it's needed again and the topology didn't change in the meantime.
+ */
+void BKE_sculptsession_release_pbvh(Object &object);
 void BKE_sculptsession_bm_to_me(Object *ob, bool reorder);
 void BKE_sculptsession_bm_to_me_for_render(Object *object);
 
@@ -243,6 +243,12 @@ class Tree {
 
   std::unique_ptr<DrawCache> draw_data;
 
+  /**
+   * The #MeshRuntime::topology_version of the mesh the tree was built from, used to check whether
+   * a tree kept with #keep_for_reuse is still valid. Only used for #Type::Mesh.
+   */
+  int64_t mesh_topology_version_ = -1;
+
  public:
   Tree(const Tree &other) = delete;
   Tree(Tree &&other) = default;
@@ -530,6 +536,20 @@ void store_bounds_orig(Tree &pbvh);
 
 /** Update node "fully masked" and "fully unmasked" values after mask values have been changed. */
 void update_mask_mesh(const Mesh &mesh, const IndexMask &node_mask, Tree &pbvh);
+
+/**
+ * Store a regular mesh tree that isn't used anymore in the runtime data of the mesh it was built
+ * from. Sculpt mode data that isn't derived from the topology (drawing and texture painting data)
+ * is freed.
+ */
+void keep_for_reuse(const Mesh &mesh, std::unique_ptr<Tree> pbvh);
+
+/**
+ * Retrieve the tree stored with #keep_for_reuse, if the topology of the mesh hasn't changed since
+ * it was built. Bounds, visibility and masks are updated for the current mesh, which is much
+ * cheaper than building the tree again.
+ */
+std::unique_ptr<Tree> take_kept_for_reuse(const Mesh &mesh);
 void update_mask_grids(const SubdivCCG &subdiv_ccg, const IndexMask &node_mask, Tree &pbvh);
 void update_mask_bmesh(const BMesh &bm, const IndexMask &node_mask, Tree &pbvh);
 
@@ -246,6 +246,14 @@ Subdiv *update_from_mesh(Subdiv *subdiv, const Settings *settings, const Mesh *m
 
 void free(Subdiv *subdiv);
 
+/* Free a descriptor which is not used anymore, or keep it for reuse when a new descriptor is
+ * requested with the same settings and topology by #update_from_converter. This avoids building
+ * the topology refiner and evaluator again when the owner is re-created, for example when an
+ * evaluated copy of a deforming mesh is replaced or for a new render depsgraph. Only CPU
+ * descriptors are kept, and the least recently released ones are freed when their estimated
+ * memory usage exceeds a fixed budget. */
+void free_or_keep_for_reuse(Subdiv *subdiv);
+
 /* --------------------------------------------------------------------
  * Displacement API.
  */
@@ -15,6 +15,7 @@
 struct Mesh;
 struct OpenSubdiv_EvaluatorCache;
 struct OpenSubdiv_EvaluatorSettings;
+struct OpenSubdiv_PatchCoord;
 
 namespace blender::bke::subdiv {
 
@@ -93,4 +94,12 @@ void eval_displacement(Subdiv *subdiv,
 /* Evaluate point on a limit surface with displacement applied to it. */
 void eval_final_point(Subdiv *subdiv, int ptex_face_index, float u, float v, float r_P[3]);
 
+/* Batched queries. */
+
+/* Evaluate points at the limit surface, same as #eval_limit_point for every patch coordinate but
+ * without the per-point evaluator overhead. */
+void eval_limit_points(Subdiv *subdiv,
+                       Span<OpenSubdiv_PatchCoord> patch_coords,
+                       MutableSpan<float3> r_P);
+
 }  // namespace blender::bke::subdiv
@@ -28,8 +28,13 @@ struct DenseFloatVolumeGrid {
   float *voxels;
 };
 
+/**
+ * Extract the active voxels bounding box of the grid as dense floats. When the bounding box is
+ * larger than \a max_resolution along any axis, the grid is resampled to fit (0 for no limit).
+ */
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
+                                  int max_resolution,
                                   DenseFloatVolumeGrid *r_dense_grid);
 void BKE_volume_dense_float_grid_clear(DenseFloatVolumeGrid *dense_grid);
 
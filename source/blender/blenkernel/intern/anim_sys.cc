@@ -372,6 +372,14 @@ bool BKE_animsys_rna_path_resolve(
     return false;
   }
 
+  return BKE_animsys_rna_path_resolve_check(ptr, rna_path, array_index, r_result);
+}
+
+bool BKE_animsys_rna_path_resolve_check(const PointerRNA *ptr,
+                                        const char *rna_path,
+                                        const int array_index,
+                                        PathResolvedRNA *r_result)
+{
   if (ptr->owner_id != nullptr && !RNA_property_animateable(&r_result->ptr, r_result->prop)) {
     return false;
   }
@@ -382,7 +390,7 @@ bool BKE_animsys_rna_path_resolve(
       CLOG_WARN(&LOG,
                 "Animato: Invalid array index. ID = '%s',  '%s[%d]', array length is %d",
                 (ptr->owner_id) ? (ptr->owner_id->name + 2) : "<No ID>",
-                path,
+                rna_path,
                 array_index,
                 array_len - 1);
     }
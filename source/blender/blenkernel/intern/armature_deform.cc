@@ -17,6 +17,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
@@ -201,32 +202,6 @@ static float dist_bone_deform(const bPoseChannel *pchan,
   return contrib;
 }
 
-static void pchan_bone_deform(const bPoseChannel *pchan,
-                              const float weight,
-                              float vec[3],
-                              DualQuat *dq,
-                              float mat[3][3],
-                              const float co[3],
-                              const bool full_deform,
-                              float *contrib)
-{
-  const Bone *bone = pchan->bone;
-
-  if (!weight) {
-    return;
-  }
-
-  if (bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments) {
-    b_bone_deform(pchan, co, weight, vec, dq, mat, full_deform);
-  }
-  else {
-    pchan_deform_accumulate(
-        &pchan->runtime.deform_dual_quat, pchan->chan_mat, co, weight, vec, dq, mat, full_deform);
-  }
-
-  (*contrib) += weight;
-}
-
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -235,6 +210,20 @@ static void pchan_bone_deform(const bPoseChannel *pchan,
  * #BKE_armature_deform_coords and related functions.
  * \{ */
 
+/**
+ * The bone that deforms the vertices of a vertex group, with the data needed in the inner loop
+ * resolved once for all vertices and stored contiguously.
+ */
+struct ArmatureDeformGroup {
+  /** Null for groups without a deforming bone. */
+  const bPoseChannel *pchan;
+  /** Copy of #bPoseChannel::chan_mat. */
+  float deform_mat[4][4];
+  bool use_bbone;
+  /** #BONE_MULT_VG_ENV: also multiply the group weight with the envelope factor. */
+  bool use_envelope_multiply;
+};
+
 struct ArmatureUserdata {
   const Object *ob_arm;
   const Mesh *me_target;
@@ -252,11 +241,13 @@ struct ArmatureUserdata {
   const MDeformVert *dverts;
   int dverts_len;
 
-  bPoseChannel **pchan_from_defbase;
+  const ArmatureDeformGroup *deform_groups;
   int defbase_len;
 
   float premat[4][4];
   float postmat[4][4];
+  /** The deformed object and the armature share their space, #premat and #postmat are unit. */
+  bool use_object_space;
 
   /** Specific data types. */
   struct {
@@ -336,7 +327,9 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
   }
 
   /* Apply the object's matrix */
-  mul_m4_v3(data->premat, co);
+  if (!data->use_object_space) {
+    mul_m4_v3(data->premat, co);
+  }
 
   if (use_dverts && dvert && dvert->totweight) { /* use weight groups ? */
     const MDeformWeight *dw = dvert->dw;
@@ -344,19 +337,40 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     uint j;
     for (j = dvert->totweight; j != 0; j--, dw++) {
       const uint index = dw->def_nr;
-      if (index < data->defbase_len && (pchan = data->pchan_from_defbase[index])) {
-        float weight = dw->weight;
-        const Bone *bone = pchan->bone;
+      if (index >= data->defbase_len) {
+        continue;
+      }
+      const ArmatureDeformGroup &group = data->deform_groups[index];
+      if (group.pchan == nullptr) {
+        continue;
+      }
+      float weight = dw->weight;
 
-        deformed = 1;
+      deformed = 1;
 
-        if (bone && bone->flag & BONE_MULT_VG_ENV) {
-          weight *= distfactor_to_bone(
-              co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
-        }
+      if (group.use_envelope_multiply) {
+        const Bone *bone = group.pchan->bone;
+        weight *= distfactor_to_bone(
+            co, bone->arm_head, bone->arm_tail, bone->rad_head, bone->rad_tail, bone->dist);
+      }
 
-        pchan_bone_deform(pchan, weight, vec, dq, smat, co, full_deform, &contrib);
+      if (weight == 0.0f) {
+        continue;
       }
+      if (group.use_bbone) {
+        b_bone_deform(group.pchan, co, weight, vec, dq, smat, full_deform);
+      }
+      else {
+        pchan_deform_accumulate(&group.pchan->runtime.deform_dual_quat,
+                                group.deform_mat,
+                                co,
+                                weight,
+                                vec,
+                                dq,
+                                smat,
+                                full_deform);
+      }
+      contrib += weight;
     }
     /* If there are vertex-groups but not groups with bones (like for soft-body groups). */
     if (deformed == 0 && use_envelope) {
@@ -403,22 +417,29 @@ static void armature_vert_task_with_dvert(const ArmatureUserdata *data,
     }
 
     if (full_deform) {
-      float pre[3][3], post[3][3], tmpmat[3][3];
-
-      copy_m3_m4(pre, data->premat);
-      copy_m3_m4(post, data->postmat);
+      float tmpmat[3][3];
       copy_m3_m3(tmpmat, vert_deform_mats[i]);
 
       if (!use_quaternion) { /* quaternion already is scale corrected */
         mul_m3_fl(smat, armature_weight / contrib);
       }
 
-      mul_m3_series(vert_deform_mats[i], post, smat, pre, tmpmat);
+      if (data->use_object_space) {
+        mul_m3_m3m3(vert_deform_mats[i], smat, tmpmat);
+      }
+      else {
+        float pre[3][3], post[3][3];
+        copy_m3_m4(pre, data->premat);
+        copy_m3_m4(post, data->postmat);
+        mul_m3_series(vert_deform_mats[i], post, smat, pre, tmpmat);
+      }
     }
   }
 
   /* always, check above code */
-  mul_m4_v3(data->postmat, co);
+  if (!data->use_object_space) {
+    mul_m4_v3(data->postmat, co);
+  }
 
   /* interpolate with previous modifier position using weight group */
   if (vert_coords_prev) {
@@ -493,7 +514,7 @@ static void armature_deform_coords_impl(const Object *ob_arm,
                                         const BMEditMesh *em_target)
 {
   const bArmature *arm = static_cast<const bArmature *>(ob_arm->data);
-  bPoseChannel **pchan_from_defbase = nullptr;
+  blender::Array<ArmatureDeformGroup> deform_groups;
   const bool use_envelope = (deformflag & ARM_DEF_ENVELOPE) != 0;
   const bool use_quaternion = (deformflag & ARM_DEF_QUATERNION) != 0;
   const bool invert_vgroup = (deformflag & ARM_DEF_INVERT_VGROUP) != 0;
@@ -534,21 +555,23 @@ static void armature_deform_coords_impl(const Object *ob_arm,
       }
 
       if (use_dverts) {
-        pchan_from_defbase = static_cast<bPoseChannel **>(
-            MEM_callocN(sizeof(*pchan_from_defbase) * defbase_len, "defnrToBone"));
-        /* TODO(sergey): Some considerations here:
-         *
-         * - Check whether keeping this consistent across frames gives speedup.
-         */
+        deform_groups.reinitialize(defbase_len);
         int i;
         LISTBASE_FOREACH_INDEX (bDeformGroup *, dg, defbase, i) {
-          pchan_from_defbase[i] = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
+          ArmatureDeformGroup &group = deform_groups[i];
+          const bPoseChannel *pchan = BKE_pose_channel_find_name(ob_arm->pose, dg->name);
           /* exclude non-deforming bones */
-          if (pchan_from_defbase[i]) {
-            if (pchan_from_defbase[i]->bone->flag & BONE_NO_DEFORM) {
-              pchan_from_defbase[i] = nullptr;
-            }
+          if (pchan && (pchan->bone->flag & BONE_NO_DEFORM)) {
+            pchan = nullptr;
+          }
+          group.pchan = pchan;
+          if (pchan == nullptr) {
+            continue;
           }
+          const Bone *bone = pchan->bone;
+          copy_m4_m4(group.deform_mat, pchan->chan_mat);
+          group.use_bbone = bone->segments > 1 && pchan->runtime.bbone_segments == bone->segments;
+          group.use_envelope_multiply = (bone->flag & BONE_MULT_VG_ENV) != 0;
         }
       }
     }
@@ -567,15 +590,25 @@ static void armature_deform_coords_impl(const Object *ob_arm,
   data.armature_def_nr = armature_def_nr;
   data.dverts = dverts.data();
   data.dverts_len = dverts.size();
-  data.pchan_from_defbase = pchan_from_defbase;
+  data.deform_groups = deform_groups.data();
   data.defbase_len = defbase_len;
   data.bmesh.cd_dvert_offset = cd_dvert_offset;
 
-  float obinv[4][4];
-  invert_m4_m4(obinv, ob_target->object_to_world().ptr());
+  /* A deformed object that is parented to the armature without an offset is common, especially
+   * for the many agents of crowds. Skip the two transforms per vertex then, they only add
+   * round-off errors. */
+  data.use_object_space = ob_target->object_to_world() == ob_arm->object_to_world();
+  if (data.use_object_space) {
+    unit_m4(data.postmat);
+    unit_m4(data.premat);
+  }
+  else {
+    float obinv[4][4];
+    invert_m4_m4(obinv, ob_target->object_to_world().ptr());
 
-  mul_m4_m4m4(data.postmat, obinv, ob_arm->object_to_world().ptr());
-  invert_m4_m4(data.premat, data.postmat);
+    mul_m4_m4m4(data.postmat, obinv, ob_arm->object_to_world().ptr());
+    invert_m4_m4(data.premat, data.postmat);
+  }
 
   if (em_target != nullptr) {
     /* While this could cause an extra loop over mesh data, in most cases this will
@@ -600,10 +633,6 @@ static void armature_deform_coords_impl(const Object *ob_arm,
     settings.min_iter_per_thread = 32;
     BLI_task_parallel_range(0, vert_coords_len, &data, armature_vert_task, &settings);
   }
-
-  if (pchan_from_defbase) {
-    MEM_freeN(pchan_from_defbase);
-  }
 }
 
 void BKE_armature_deform_coords_with_gpencil_stroke(const Object *ob_arm,
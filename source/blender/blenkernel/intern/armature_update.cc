@@ -946,16 +946,9 @@ static void pose_channel_flush_to_orig_if_needed(Depsgraph *depsgraph,
   pchan_orig->constflag = pchan->constflag;
 }
 
-void BKE_pose_bone_done(Depsgraph *depsgraph, Object *object, int pchan_index)
+static void pose_channel_done(Depsgraph *depsgraph, Object *object, bPoseChannel *pchan)
 {
-  const bArmature *armature = (bArmature *)object->data;
-  if (armature->edbo != nullptr) {
-    return;
-  }
-  bPoseChannel *pchan = pose_pchan_get_indexed(object, pchan_index);
   float imat[4][4];
-  DEG_debug_print_eval_subdata(
-      depsgraph, __func__, object->id.name, object, "pchan", pchan->name, pchan);
   if (pchan->bone) {
     invert_m4_m4(imat, pchan->bone->arm_mat);
     mul_m4_m4m4(pchan->chan_mat, pchan->pose_mat, imat);
@@ -972,6 +965,31 @@ void BKE_pose_bone_done(Depsgraph *depsgraph, Object *object, int pchan_index)
   }
 }
 
+void BKE_pose_bone_done(Depsgraph *depsgraph, Object *object, int pchan_index)
+{
+  const bArmature *armature = (bArmature *)object->data;
+  if (armature->edbo != nullptr) {
+    return;
+  }
+  bPoseChannel *pchan = pose_pchan_get_indexed(object, pchan_index);
+  DEG_debug_print_eval_subdata(
+      depsgraph, __func__, object->id.name, object, "pchan", pchan->name, pchan);
+  pose_channel_done(depsgraph, object, pchan);
+}
+
+void BKE_pose_eval_bone_and_done(Depsgraph *depsgraph,
+                                 Scene *scene,
+                                 Object *object,
+                                 int pchan_index)
+{
+  const bArmature *armature = (bArmature *)object->data;
+  if (armature->edbo != nullptr) {
+    return;
+  }
+  BKE_pose_eval_bone(depsgraph, scene, object, pchan_index);
+  pose_channel_done(depsgraph, object, pose_pchan_get_indexed(object, pchan_index));
+}
+
 void BKE_pose_eval_bbone_segments(Depsgraph *depsgraph, Object *object, int pchan_index)
 {
   const bArmature *armature = (bArmature *)object->data;
@@ -15,7 +15,9 @@
 
 #include "BLI_endian_defines.h"
 #include "BLI_endian_switch.h"
+#include "BLI_fileops.h"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_mmap.h"
 #include "BLI_path_utils.hh"
 
 #include "DNA_material_types.h"
@@ -25,9 +27,17 @@
 #include "RNA_access.hh"
 #include "RNA_enum_types.hh"
 
+#include <fcntl.h>
 #include <fmt/format.h>
 #include <sstream>
 #include <xxhash.h>
+#include <zstd.h>
+
+#ifndef WIN32
+#  include <unistd.h>
+#else
+#  include <io.h>
+#endif
 
 #ifdef WITH_OPENVDB
 #  include <openvdb/io/Stream.h>
@@ -47,6 +57,10 @@ std::shared_ptr<DictionaryValue> BlobSlice::serialize() const
   io_slice->append_str("name", this->name);
   io_slice->append_int("start", range.start());
   io_slice->append_int("size", range.size());
+  if (decompressed_size) {
+    io_slice->append_str("compression", "zstd");
+    io_slice->append_int("decompressed_size", *decompressed_size);
+  }
   return io_slice;
 }
 
@@ -58,8 +72,36 @@ std::optional<BlobSlice> BlobSlice::deserialize(const DictionaryValue &io_slice)
   if (!name || !start || !size) {
     return std::nullopt;
   }
+  BlobSlice slice{*name, {*start, *size}};
+  if (const std::optional<StringRefNull> compression = io_slice.lookup_str("compression")) {
+    const std::optional<int64_t> decompressed_size = io_slice.lookup_int("decompressed_size");
+    if (*compression != "zstd" || !decompressed_size) {
+      return std::nullopt;
+    }
+    slice.decompressed_size = *decompressed_size;
+  }
+  return slice;
+}
+
+/** Compressing small arrays doesn't save enough to be worth the overhead. */
+static constexpr int64_t compressed_blob_min_size = 4096;
 
-  return BlobSlice{*name, {*start, *size}};
+BlobSlice BlobWriter::write_array(const void *data, const int64_t size)
+{
+  if (!use_compression_ || size < compressed_blob_min_size) {
+    return this->write(data, size);
+  }
+  const int64_t max_compressed_size = int64_t(ZSTD_compressBound(size_t(size)));
+  Array<std::byte> compressed(max_compressed_size, NoInitialization());
+  /* A low level keeps baking fast, higher levels gain little on attribute arrays. */
+  const size_t compressed_size = ZSTD_compress(
+      compressed.data(), size_t(compressed.size()), data, size_t(size), 3);
+  if (ZSTD_isError(compressed_size) || int64_t(compressed_size) >= size) {
+    return this->write(data, size);
+  }
+  BlobSlice slice = this->write(compressed.data(), int64_t(compressed_size));
+  slice.decompressed_size = size;
+  return slice;
 }
 
 BlobSlice BlobWriter::write_as_stream(const StringRef /*file_extension*/,
@@ -71,12 +113,33 @@ BlobSlice BlobWriter::write_as_stream(const StringRef /*file_extension*/,
   return this->write(data.data(), data.size());
 }
 
+/**
+ * Read the data of the slice with #BlobReader::read and decompress it if necessary.
+ * \param r_data: Buffer for #BlobSlice::data_size bytes.
+ */
+[[nodiscard]] static bool read_blob_slice(const BlobReader &blob_reader,
+                                          const BlobSlice &slice,
+                                          void *r_data)
+{
+  if (!slice.decompressed_size) {
+    return blob_reader.read(slice, r_data);
+  }
+  Array<std::byte> compressed(slice.range.size(), NoInitialization());
+  if (!blob_reader.read(slice, compressed.data())) {
+    return false;
+  }
+  const size_t decompressed_size = ZSTD_decompress(
+      r_data, size_t(*slice.decompressed_size), compressed.data(), size_t(compressed.size()));
+  return !ZSTD_isError(decompressed_size) &&
+         int64_t(decompressed_size) == *slice.decompressed_size;
+}
+
 bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::istream &)> fn) const
 {
-  const int64_t size = slice.range.size();
+  const int64_t size = slice.data_size();
   std::string buffer;
   buffer.resize(size);
-  if (!this->read(slice, buffer.data())) {
+  if (!read_blob_slice(*this, slice, buffer.data())) {
     return false;
   }
   std::istringstream stream{buffer, std::ios::binary};
@@ -86,7 +149,80 @@ bool BlobReader::read_as_stream(const BlobSlice &slice, FunctionRef<bool(std::is
   return true;
 }
 
-DiskBlobReader::DiskBlobReader(std::string blobs_dir) : blobs_dir_(std::move(blobs_dir)) {}
+std::optional<ImplicitSharingInfoAndData> BlobReader::read_mapped(
+    const BlobSlice & /*slice*/, const int64_t /*alignment*/) const
+{
+  return std::nullopt;
+}
+
+/**
+ * Sharing info for data that points into a memory-mapped blob file. The mapping is private, so
+ * writing to the data only copies the touched pages.
+ */
+class MappedBlobSharingInfo : public ImplicitSharingInfo {
+ private:
+  BLI_mmap_file *mmap_file_;
+
+ public:
+  MappedBlobSharingInfo(BLI_mmap_file *mmap_file) : mmap_file_(mmap_file)
+  {
+    BLI_mmap_add_user(mmap_file_);
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    BLI_mmap_free(mmap_file_);
+    MEM_delete(this);
+  }
+};
+
+DiskBlobReader::DiskBlobReader(std::string blobs_dir, const bool use_mapping)
+    : blobs_dir_(std::move(blobs_dir)), use_mapping_(use_mapping)
+{
+}
+
+DiskBlobReader::~DiskBlobReader()
+{
+  for (BLI_mmap_file *mmap_file : mapped_files_.values()) {
+    if (mmap_file) {
+      BLI_mmap_free(mmap_file);
+    }
+  }
+}
+
+std::optional<ImplicitSharingInfoAndData> DiskBlobReader::read_mapped(
+    const BlobSlice &slice, const int64_t alignment) const
+{
+  if (!use_mapping_ || slice.range.is_empty()) {
+    return std::nullopt;
+  }
+  char blob_path[FILE_MAX];
+  BLI_path_join(blob_path, sizeof(blob_path), blobs_dir_.c_str(), slice.name.c_str());
+
+  std::lock_guard lock{mutex_};
+  BLI_mmap_file *mmap_file = mapped_files_.lookup_or_add_cb(blob_path, [&]() {
+    const int file = BLI_open(blob_path, O_BINARY | O_RDONLY, 0);
+    if (file == -1) {
+      return static_cast<BLI_mmap_file *>(nullptr);
+    }
+    BLI_mmap_file *mmap_file = BLI_mmap_open(file);
+    close(file);
+    return mmap_file;
+  });
+  if (mmap_file == nullptr || BLI_mmap_has_io_error(mmap_file)) {
+    return std::nullopt;
+  }
+  if (slice.range.one_after_last() > int64_t(BLI_mmap_get_length(mmap_file))) {
+    return std::nullopt;
+  }
+  /* The mapping itself is page aligned. */
+  if (slice.range.start() % alignment != 0) {
+    return std::nullopt;
+  }
+  const void *data = POINTER_OFFSET(BLI_mmap_get_pointer(mmap_file), slice.range.start());
+  return ImplicitSharingInfoAndData{MEM_new<MappedBlobSharingInfo>(__func__, mmap_file), data};
+}
 
 [[nodiscard]] bool DiskBlobReader::read(const BlobSlice &slice, void *r_data) const
 {
@@ -115,6 +251,9 @@ DiskBlobWriter::DiskBlobWriter(std::string blob_dir, std::string base_name)
   blob_name_ = base_name_ + ".blob";
 }
 
+/** Alignment of the slices written by #DiskBlobWriter. */
+static constexpr int64_t blob_alignment = 16;
+
 BlobSlice DiskBlobWriter::write(const void *data, const int64_t size)
 {
   if (!blob_stream_.is_open()) {
@@ -124,6 +263,17 @@ BlobSlice DiskBlobWriter::write(const void *data, const int64_t size)
     blob_stream_.open(blob_path, std::ios::out | std::ios::binary);
   }
 
+  /* Align the start of every slice, so that the data can be used directly when the file is
+   * memory-mapped for reading. */
+  const int64_t padding = int64_t(ceil_to_multiple_ul(uint64_t(current_offset_),
+                                                     uint64_t(blob_alignment))) -
+                          current_offset_;
+  if (padding > 0) {
+    const char zeros[blob_alignment] = {};
+    blob_stream_.write(zeros, padding);
+    current_offset_ += padding;
+  }
+
   const int64_t old_offset = current_offset_;
   blob_stream_.write(static_cast<const char *>(data), size);
   current_offset_ += size;
@@ -255,7 +405,7 @@ std::shared_ptr<io::serialize::DictionaryValue> BlobWriteSharing::write_deduplic
 {
   const uint64_t content_hash = XXH3_64bits(data, size_in_bytes);
   const BlobSlice slice = slice_by_content_hash_.lookup_or_add_cb(
-      content_hash, [&]() { return writer.write(data, size_in_bytes); });
+      content_hash, [&]() { return writer.write_array(data, size_in_bytes); });
   return slice.serialize();
 }
 
@@ -355,10 +505,10 @@ static std::shared_ptr<DictionaryValue> write_blob_raw_data_with_endian(
   if (!slice) {
     return false;
   }
-  if (slice->range.size() != element_size * elements_num) {
+  if (slice->data_size() != element_size * elements_num) {
     return false;
   }
-  if (!blob_reader.read(*slice, r_data)) {
+  if (!read_blob_slice(blob_reader, *slice, r_data)) {
     return false;
   }
   const StringRefNull stored_endian = io_data.lookup_str("endian").value_or("little");
@@ -403,10 +553,10 @@ static std::shared_ptr<DictionaryValue> write_blob_raw_bytes(BlobWriter &blob_wr
   if (!slice) {
     return false;
   }
-  if (slice->range.size() != bytes_num) {
+  if (slice->data_size() != bytes_num) {
     return false;
   }
-  return blob_reader.read(*slice, r_data);
+  return read_blob_slice(blob_reader, *slice, r_data);
 }
 
 static std::shared_ptr<DictionaryValue> write_blob_simple_gspan(BlobWriter &blob_writer,
@@ -468,6 +618,34 @@ static std::shared_ptr<DictionaryValue> write_blob_shared_simple_gspan(
       sharing_info, [&]() { return write_blob_simple_gspan(blob_writer, blob_sharing, data); });
 }
 
+/** Reading smaller arrays with a copy is cheaper than keeping the mapping around for them. */
+static constexpr int64_t mapped_blob_min_size = 64 * 1024;
+
+/**
+ * Try to use the data of the blob without copying it, which only works when the reader supports
+ * that and the data doesn't need any conversion.
+ */
+static std::optional<ImplicitSharingInfoAndData> read_blob_mapped_simple_gspan(
+    const BlobReader &blob_reader,
+    const DictionaryValue &io_data,
+    const CPPType &cpp_type,
+    const int64_t size)
+{
+  const int64_t size_in_bytes = size * cpp_type.size();
+  if (size_in_bytes < mapped_blob_min_size) {
+    return std::nullopt;
+  }
+  const std::optional<BlobSlice> slice = BlobSlice::deserialize(io_data);
+  if (!slice || slice->decompressed_size || slice->range.size() != size_in_bytes) {
+    return std::nullopt;
+  }
+  const StringRefNull stored_endian = io_data.lookup_str("endian").value_or("little");
+  if (stored_endian != get_endian_io_name(ENDIAN_ORDER)) {
+    return std::nullopt;
+  }
+  return blob_reader.read_mapped(*slice, cpp_type.alignment());
+}
+
 [[nodiscard]] static const void *read_blob_shared_simple_gspan(
     const DictionaryValue &io_data,
     const BlobReader &blob_reader,
@@ -479,6 +657,11 @@ static std::shared_ptr<DictionaryValue> write_blob_shared_simple_gspan(
   const char *func = __func__;
   const std::optional<ImplicitSharingInfoAndData> sharing_info_and_data = blob_sharing.read_shared(
       io_data, [&]() -> std::optional<ImplicitSharingInfoAndData> {
+        if (std::optional<ImplicitSharingInfoAndData> mapped = read_blob_mapped_simple_gspan(
+                blob_reader, io_data, cpp_type, size))
+        {
+          return mapped;
+        }
         void *data_mem = MEM_mallocN_aligned(size * cpp_type.size(), cpp_type.alignment(), func);
         if (!read_blob_simple_gspan(blob_reader, io_data, {cpp_type, data_mem, size})) {
           MEM_freeN(data_mem);
@@ -1274,6 +1274,10 @@ void BKE_brush_calc_curve_factors(const eBrushCurvePreset preset,
           factors[i] = 0.0f;
           continue;
         }
+        if (factors[i] == 0.0f) {
+          /* Skip the comparatively expensive curve evaluation. */
+          continue;
+        }
         factors[i] *= BKE_curvemapping_evaluateF(cumap, 0, distance * radius_rcp);
       }
       break;
@@ -9,7 +9,9 @@
 #include "DNA_meshdata_types.h"
 #include "DNA_pointcloud_types.h"
 
+#include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
+#include "BLI_offset_indices.hh"
 #include "BLI_task.h"
 
 #include "BKE_attribute.hh"
@@ -20,6 +22,9 @@
 using blender::BitSpan;
 using blender::BitVector;
 using blender::float3;
+using blender::GrainSize;
+using blender::IndexMask;
+using blender::IndexMaskMemory;
 using blender::IndexRange;
 using blender::int3;
 using blender::Span;
@@ -553,6 +558,17 @@ static BVHTree *bvhtree_new_common(
   return BLI_bvhtree_new(elems_num_active, epsilon, tree_type, axis);
 }
 
+/** The elements of the optional mask, or all elements if the mask is empty. */
+static IndexMask mask_from_bits_or_all(const BitSpan mask,
+                                       const int elems_num,
+                                       IndexMaskMemory &memory)
+{
+  if (mask.is_empty()) {
+    return IndexMask(elems_num);
+  }
+  return IndexMask::from_bits(mask.take_front(elems_num), memory);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -571,13 +587,13 @@ static BVHTree *bvhtree_from_mesh_verts_create_tree(float epsilon,
     return nullptr;
   }
 
-  for (const int i : positions.index_range()) {
-    if (!verts_mask.is_empty() && !verts_mask[i]) {
-      continue;
-    }
-    BLI_bvhtree_insert(tree, i, positions[i], 1);
-  }
-  BLI_assert(BLI_bvhtree_get_len(tree) == verts_num_active);
+  IndexMaskMemory memory;
+  const IndexMask mask = mask_from_bits_or_all(verts_mask, positions.size(), memory);
+  BLI_assert(mask.size() == verts_num_active);
+  BLI_bvhtree_add_leafs(tree, mask.size());
+  mask.foreach_index(GrainSize(4096), [&](const int i, const int leaf) {
+    BLI_bvhtree_set_leaf(tree, leaf, i, positions[i], 1);
+  });
 
   return tree;
 }
@@ -622,16 +638,17 @@ static BVHTree *bvhtree_from_mesh_edges_create_tree(const Span<float3> positions
     return nullptr;
   }
 
-  for (const int i : edges.index_range()) {
-    if (!edges_mask.is_empty() && !edges_mask[i]) {
-      continue;
-    }
+  IndexMaskMemory memory;
+  const IndexMask mask = mask_from_bits_or_all(edges_mask, edges.size(), memory);
+  BLI_assert(mask.size() == edges_num_active);
+  BLI_bvhtree_add_leafs(tree, mask.size());
+  mask.foreach_index(GrainSize(4096), [&](const int i, const int leaf) {
     float co[2][3];
     copy_v3_v3(co[0], positions[edges[i][0]]);
     copy_v3_v3(co[1], positions[edges[i][1]]);
 
-    BLI_bvhtree_insert(tree, i, co[0], 2);
-  }
+    BLI_bvhtree_set_leaf(tree, leaf, i, co[0], 2);
+  });
 
   return tree;
 }
@@ -727,20 +744,18 @@ static BVHTree *bvhtree_from_mesh_corner_tris_create_tree(float epsilon,
     return nullptr;
   }
 
-  for (const int i : corner_tris.index_range()) {
+  IndexMaskMemory memory;
+  const IndexMask mask = mask_from_bits_or_all(corner_tris_mask, corner_tris.size(), memory);
+  BLI_assert(mask.size() == corner_tris_num_active);
+  BLI_bvhtree_add_leafs(tree, mask.size());
+  mask.foreach_index(GrainSize(4096), [&](const int i, const int leaf) {
     float co[3][3];
-    if (!corner_tris_mask.is_empty() && !corner_tris_mask[i]) {
-      continue;
-    }
-
     copy_v3_v3(co[0], positions[corner_verts[corner_tris[i][0]]]);
     copy_v3_v3(co[1], positions[corner_verts[corner_tris[i][1]]]);
     copy_v3_v3(co[2], positions[corner_verts[corner_tris[i][2]]]);
 
-    BLI_bvhtree_insert(tree, i, co[0], 3);
-  }
-
-  BLI_assert(BLI_bvhtree_get_len(tree) == corner_tris_num_active);
+    BLI_bvhtree_set_leaf(tree, leaf, i, co[0], 3);
+  });
 
   return tree;
 }
@@ -1057,26 +1072,33 @@ void BKE_bvhtree_from_mesh_tris_init(const Mesh &mesh,
                                nullptr,
                                &r_data);
 
-  int tris_num = 0;
-  faces_mask.foreach_index(
-      [&](const int i) { tris_num += mesh::face_triangles_num(faces[i].size()); });
+  /* The first leaf of the triangles of each selected face. */
+  Array<int> leaf_offsets_data(faces_mask.size() + 1);
+  faces_mask.foreach_index(GrainSize(4096), [&](const int face_i, const int pos) {
+    leaf_offsets_data[pos] = mesh::face_triangles_num(faces[face_i].size());
+  });
+  const OffsetIndices leaf_offsets = offset_indices::accumulate_counts_to_offsets(
+      leaf_offsets_data);
 
   int active_num = -1;
-  BVHTree *tree = bvhtree_new_common(0.0f, 2, 6, tris_num, active_num);
+  BVHTree *tree = bvhtree_new_common(0.0f, 2, 6, leaf_offsets.total_size(), active_num);
   r_data.tree = tree;
   if (tree == nullptr) {
     return;
   }
 
-  faces_mask.foreach_index([&](const int face_i) {
+  BLI_bvhtree_add_leafs(tree, leaf_offsets.total_size());
+  faces_mask.foreach_index(GrainSize(1024), [&](const int face_i, const int pos) {
     const IndexRange triangles_range = mesh::face_triangles_range(faces, face_i);
-    for (const int tri_i : triangles_range) {
+    const int first_leaf = leaf_offsets[pos].start();
+    for (const int i : triangles_range.index_range()) {
+      const int tri_i = triangles_range[i];
       float co[3][3];
       copy_v3_v3(co[0], positions[corner_verts[corner_tris[tri_i][0]]]);
       copy_v3_v3(co[1], positions[corner_verts[corner_tris[tri_i][1]]]);
       copy_v3_v3(co[2], positions[corner_verts[corner_tris[tri_i][2]]]);
 
-      BLI_bvhtree_insert(tree, tri_i, co[0], 3);
+      BLI_bvhtree_set_leaf(tree, first_leaf + i, tri_i, co[0], 3);
     }
   });
 
@@ -1108,12 +1130,13 @@ void BKE_bvhtree_from_mesh_edges_init(const Mesh &mesh,
     return;
   }
 
-  edges_mask.foreach_index([&](const int edge_i) {
+  BLI_bvhtree_add_leafs(tree, edges_mask.size());
+  edges_mask.foreach_index(GrainSize(4096), [&](const int edge_i, const int leaf) {
     const int2 &edge = edges[edge_i];
     float co[2][3];
     copy_v3_v3(co[0], positions[edge[0]]);
     copy_v3_v3(co[1], positions[edge[1]]);
-    BLI_bvhtree_insert(tree, edge_i, co[0], 2);
+    BLI_bvhtree_set_leaf(tree, leaf, edge_i, co[0], 2);
   });
 
   BLI_bvhtree_balance(tree);
@@ -1143,9 +1166,9 @@ void BKE_bvhtree_from_mesh_verts_init(const Mesh &mesh,
     return;
   }
 
-  verts_mask.foreach_index([&](const int vert_i) {
-    const float3 &position = positions[vert_i];
-    BLI_bvhtree_insert(tree, vert_i, position, 1);
+  BLI_bvhtree_add_leafs(tree, verts_mask.size());
+  verts_mask.foreach_index(GrainSize(4096), [&](const int vert_i, const int leaf) {
+    BLI_bvhtree_set_leaf(tree, leaf, vert_i, positions[vert_i], 1);
   });
 
   BLI_bvhtree_balance(tree);
@@ -1184,7 +1207,10 @@ void BKE_bvhtree_from_pointcloud_get(const PointCloud &pointcloud,
   }
 
   const Span<float3> positions = pointcloud.positions();
-  points_mask.foreach_index([&](const int i) { BLI_bvhtree_insert(tree, i, positions[i], 1); });
+  BLI_bvhtree_add_leafs(tree, points_mask.size());
+  points_mask.foreach_index(GrainSize(4096), [&](const int i, const int leaf) {
+    BLI_bvhtree_set_leaf(tree, leaf, i, positions[i], 1);
+  });
 
   BLI_bvhtree_balance(tree);
 
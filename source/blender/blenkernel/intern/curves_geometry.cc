@@ -1077,6 +1077,11 @@ void CurvesGeometry::tag_topology_changed()
   this->runtime->nurbs_basis_cache.tag_dirty();
   this->runtime->check_type_counts = true;
 }
+void CurvesGeometry::tag_handle_types_changed()
+{
+  this->tag_positions_changed();
+  this->runtime->evaluated_offsets_cache.tag_dirty();
+}
 void CurvesGeometry::tag_normals_changed()
 {
   this->runtime->evaluated_normal_cache.tag_dirty();
@@ -1583,8 +1588,12 @@ void CurvesGeometry::blend_read(BlendDataReader &reader)
   CustomData_blend_read(&reader, &this->curve_data, this->curve_num);
 
   if (this->curve_offsets) {
-    this->runtime->curve_offsets_sharing_info = BLO_read_shared(
-        &reader, &this->curve_offsets, [&]() {
+    this->runtime->curve_offsets_sharing_info = BLO_read_shared_mapped(
+        &reader,
+        &this->curve_offsets,
+        sizeof(int) * (this->curve_num + 1),
+        alignof(int),
+        [&]() {
           BLO_read_int32_array(&reader, this->curve_num + 1, &this->curve_offsets);
           return implicit_sharing::info_for_mem_free(this->curve_offsets);
         });
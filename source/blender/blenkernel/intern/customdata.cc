@@ -5486,15 +5486,26 @@ void CustomData_blend_read(BlendDataReader *reader, CustomData *data, const int
     layer->sharing_info = nullptr;
 
     if (CustomData_verify_versions(data, i)) {
-      layer->sharing_info = BLO_read_shared(
-          reader, &layer->data, [&]() -> const ImplicitSharingInfo * {
-            blend_read_layer_data(reader, *layer, count);
-            if (layer->data == nullptr) {
-              return nullptr;
-            }
-            return make_implicit_sharing_info_for_layer(
-                eCustomDataType(layer->type), layer->data, count);
-          });
+      const eCustomDataType type = eCustomDataType(layer->type);
+      const auto read_fn = [&]() -> const ImplicitSharingInfo * {
+        blend_read_layer_data(reader, *layer, count);
+        if (layer->data == nullptr) {
+          return nullptr;
+        }
+        return make_implicit_sharing_info_for_layer(type, layer->data, count);
+      };
+      const LayerTypeInfo *type_info = layerType_getInfo(type);
+      if (type_info->copy == nullptr && type_info->free == nullptr) {
+        /* Trivial types without pointers, the data may stay in the memory-mapped file. */
+        layer->sharing_info = BLO_read_shared_mapped(reader,
+                                                     &layer->data,
+                                                     size_t(count) * type_info->size,
+                                                     type_info->alignment,
+                                                     read_fn);
+      }
+      else {
+        layer->sharing_info = BLO_read_shared(reader, &layer->data, read_fn);
+      }
       i++;
     }
   }
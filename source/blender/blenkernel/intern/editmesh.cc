@@ -52,6 +52,8 @@ BMEditMesh *BKE_editmesh_copy(BMEditMesh *em)
    * in that case it makes more sense to do the
    * tessellation only when/if that copy ends up getting used. */
   em_copy->looptris = {};
+  /* The evaluated mesh data doesn't match the copied BMesh element order. */
+  BKE_editmesh_eval_cache_clear(em_copy);
 
   /* Copy various settings. */
   em_copy->selectmode = em->selectmode;
@@ -120,12 +122,19 @@ void BKE_editmesh_looptris_and_normals_calc_with_partial(BMEditMesh *em, BMParti
 void BKE_editmesh_free_data(BMEditMesh *em)
 {
   em->looptris = {};
+  BKE_editmesh_eval_cache_clear(em);
 
   if (em->bm) {
     BM_mesh_free(em->bm);
   }
 }
 
+void BKE_editmesh_eval_cache_clear(BMEditMesh *em)
+{
+  em->eval_cache.reset();
+  em->eval_cache_positions_only = false;
+}
+
 struct CageUserData {
   int totvert;
   blender::MutableSpan<float3> positions_cage;
@@ -16,10 +16,18 @@
 
 #include "BKE_editmesh.hh"
 #include "BKE_editmesh_cache.hh" /* own include */
+#include "BKE_lib_id.hh"
 
 using blender::float3;
 using blender::Span;
 
+blender::bke::EditMeshEvalCache::~EditMeshEvalCache()
+{
+  if (this->mesh) {
+    BKE_id_free(nullptr, this->mesh);
+  }
+}
+
 /* -------------------------------------------------------------------- */
 /** \name Ensure Data (derived from coords)
  * \{ */
@@ -6,6 +6,7 @@
  * \ingroup bke
  */
 
+#include <algorithm>
 #include <cfloat>
 #include <cmath>
 #include <cstddef>
@@ -22,6 +23,7 @@
 #include "DNA_object_types.h"
 #include "DNA_text_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_blenlib.h"
 #include "BLI_easing.h"
 #include "BLI_ghash.h"
@@ -1006,9 +1008,23 @@ void fcurve_store_samples(FCurve *fcu, void *data, int start, int end, FcuSample
       MEM_callocN(sizeof(FPoint) * (end - start + 1), "FPoint Samples"));
 
   /* Use the sampling callback at 1-frame intervals from start to end frames. */
-  for (int cfra = start; cfra <= end; cfra++, fpt++) {
-    fpt->vec[0] = float(cfra);
-    fpt->vec[1] = sample_cb(fcu, data, float(cfra));
+  if (sample_cb == fcurve_samplingcb_evalcurve) {
+    blender::Array<float> times(end - start + 1);
+    blender::Array<float> values(end - start + 1);
+    for (const int i : times.index_range()) {
+      times[i] = float(start + i);
+    }
+    evaluate_fcurve_times(fcu, times, values);
+    for (const int i : times.index_range()) {
+      fpt[i].vec[0] = times[i];
+      fpt[i].vec[1] = values[i];
+    }
+  }
+  else {
+    for (int cfra = start; cfra <= end; cfra++, fpt++) {
+      fpt->vec[0] = float(cfra);
+      fpt->vec[1] = sample_cb(fcu, data, float(cfra));
+    }
   }
 
   /* Free any existing sample/keyframe data on curve. */
@@ -2003,27 +2019,28 @@ static float fcurve_eval_keyframes_extrapolate(const FCurve *fcu,
   return endpoint_bezt->vec[1][1] - (fac * dx);
 }
 
-static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
-                                               const BezTriple *bezts,
-                                               float evaltime)
+/**
+ * Threshold for finding the keyframe segment of an evaluation time. It has the following
+ * constraints:
+ * - 0.001 is too coarse:
+ *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
+ *
+ * - 0.00001 is too fine:
+ *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
+ *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
+ */
+static constexpr float FCURVE_EVAL_SEGMENT_THRESH = 0.0001f;
+
+/**
+ * Evaluate the segment ending at keyframe \a a, as found with
+ * #BKE_fcurve_bezt_binarysearch_index_ex.
+ *
+ * \param exact: The evaluation time is on keyframe \a a.
+ */
+static float fcurve_eval_keyframes_segment(
+    const FCurve *fcu, const BezTriple *bezts, float evaltime, const uint a, const bool exact)
 {
   const float eps = 1.e-8f;
-  uint a;
-
-  /* Evaluation-time occurs somewhere in the middle of the curve. */
-  bool exact = false;
-
-  /* Use binary search to find appropriate keyframes...
-   *
-   * The threshold here has the following constraints:
-   * - 0.001 is too coarse:
-   *   We get artifacts with 2cm driver movements at 1BU = 1m (see #40332).
-   *
-   * - 0.00001 is too fine:
-   *   Weird errors, like selecting the wrong keyframe range (see #39207), occur.
-   *   This lower bound was established in b888a32eee8147b028464336ad2404d8155c64dd.
-   */
-  a = BKE_fcurve_bezt_binarysearch_index_ex(bezts, evaltime, fcu->totvert, 0.0001, &exact);
   const BezTriple *bezt = bezts + a;
 
   if (exact) {
@@ -2266,6 +2283,20 @@ static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
   return 0.0f;
 }
 
+static float fcurve_eval_keyframes_interpolate(const FCurve *fcu,
+                                               const BezTriple *bezts,
+                                               float evaltime)
+{
+  /* Evaluation-time occurs somewhere in the middle of the curve. */
+  bool exact = false;
+
+  /* Use binary search to find appropriate keyframes. */
+  const uint a = BKE_fcurve_bezt_binarysearch_index_ex(
+      bezts, evaltime, fcu->totvert, FCURVE_EVAL_SEGMENT_THRESH, &exact);
+
+  return fcurve_eval_keyframes_segment(fcu, bezts, evaltime, a, exact);
+}
+
 /* Calculate F-Curve value for 'evaltime' using #BezTriple keyframes. */
 static float fcurve_eval_keyframes(const FCurve *fcu, const BezTriple *bezts, float evaltime)
 {
@@ -2376,6 +2407,99 @@ float evaluate_fcurve_only_curve(const FCurve *fcu, float evaltime)
   return evaluate_fcurve_ex(fcu, evaltime, 0.0);
 }
 
+/**
+ * Whether no evaluation time can be within #FCURVE_EVAL_SEGMENT_THRESH of more than one key. The
+ * binary search is only guaranteed to find the same segment as a walk along the keys then.
+ */
+static bool fcurve_keys_are_separated(const FCurve *fcu)
+{
+  for (int i = 1; i < fcu->totvert; i++) {
+    /* Leave some margin for rounding errors. */
+    if (!(fcu->bezt[i].vec[1][0] - fcu->bezt[i - 1].vec[1][0] > 4.0f * FCURVE_EVAL_SEGMENT_THRESH))
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void evaluate_fcurve_times(const FCurve *fcu,
+                           const blender::Span<float> evaltimes,
+                           blender::MutableSpan<float> r_values)
+{
+  BLI_assert(fcu->driver == nullptr);
+  BLI_assert(evaltimes.size() == r_values.size());
+  BLI_assert(std::is_sorted(evaltimes.begin(), evaltimes.end()));
+
+  /* Time modifiers may change the order of the times that the keys are evaluated at. */
+  if (fcu->bezt == nullptr || fcu->totvert <= 1 || !BLI_listbase_is_empty(&fcu->modifiers) ||
+      !fcurve_keys_are_separated(fcu))
+  {
+    for (const int64_t i : evaltimes.index_range()) {
+      r_values[i] = evaluate_fcurve_ex(fcu, evaltimes[i], 0.0f);
+    }
+    return;
+  }
+
+  /* Same as #evaluate_fcurve_ex, but keeping track of the current segment. */
+  const BezTriple *bezts = fcu->bezt;
+  const float first_time = bezts[0].vec[1][0];
+  const float last_time = bezts[fcu->totvert - 1].vec[1][0];
+  uint a = 0;
+  for (const int64_t i : evaltimes.index_range()) {
+    const float evaltime = evaltimes[i];
+    float cvalue;
+    if (evaltime <= first_time) {
+      cvalue = fcurve_eval_keyframes_extrapolate(fcu, bezts, evaltime, 0, +1);
+    }
+    else if (last_time <= evaltime) {
+      cvalue = fcurve_eval_keyframes_extrapolate(fcu, bezts, evaltime, fcu->totvert - 1, -1);
+    }
+    else {
+      /* Find the first key after the time, or on it (within the threshold). */
+      while (bezts[a].vec[1][0] < evaltime &&
+             !IS_EQT(evaltime, bezts[a].vec[1][0], FCURVE_EVAL_SEGMENT_THRESH))
+      {
+        a++;
+      }
+      const bool exact = IS_EQT(evaltime, bezts[a].vec[1][0], FCURVE_EVAL_SEGMENT_THRESH);
+      cvalue = fcurve_eval_keyframes_segment(fcu, bezts, evaltime, a, exact);
+    }
+
+    if (fcu->flag & FCURVE_INT_VALUES) {
+      cvalue = floorf(cvalue + 0.5f);
+    }
+    r_values[i] = cvalue;
+  }
+}
+
+void evaluate_fcurves_times(const blender::Span<const FCurve *> fcurves,
+                            const blender::Span<float> evaltimes,
+                            blender::MutableSpan<float> r_values)
+{
+  using namespace blender;
+  BLI_assert(r_values.size() == fcurves.size() * evaltimes.size());
+  const int64_t times_num = evaltimes.size();
+  if (times_num == 0) {
+    return;
+  }
+  /* Also split up the times, so that a few curves sampled at many times still use all threads. */
+  const int64_t times_per_task = 1024;
+  const int64_t tasks_per_curve = divide_ceil_ul(uint64_t(times_num), times_per_task);
+  threading::parallel_for(
+      IndexRange(fcurves.size() * tasks_per_curve), 1, [&](const IndexRange range) {
+        for (const int64_t task : range) {
+          const int64_t curve = task / tasks_per_curve;
+          const int64_t times_start = (task % tasks_per_curve) * times_per_task;
+          const IndexRange times = IndexRange::from_begin_size(
+              times_start, std::min(times_per_task, times_num - times_start));
+          const MutableSpan<float> curve_values = r_values.slice(curve * times_num, times_num);
+          evaluate_fcurve_times(
+              fcurves[curve], evaltimes.slice(times), curve_values.slice(times));
+        }
+      });
+}
+
 float evaluate_fcurve_driver(PathResolvedRNA *anim_rna,
                              FCurve *fcu,
                              ChannelDriver *driver_orig,
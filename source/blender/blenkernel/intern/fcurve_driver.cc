@@ -1199,6 +1199,10 @@ static bool driver_compile_simple_expr(ChannelDriver *driver)
   if (atomic_cas_ptr((void **)&driver->expr_simple, nullptr, expr) != nullptr) {
     BLI_expr_pylike_free(expr);
   }
+  else if (!BLI_expr_pylike_is_valid(expr)) {
+    /* Evaluating with Python takes the GIL, so report which drivers can't run in parallel. */
+    CLOG_INFO(&LOG, 1, "driver expression is evaluated with Python: '%s'", driver->expression);
+  }
 
   return true;
 }
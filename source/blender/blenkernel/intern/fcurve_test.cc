@@ -3,6 +3,8 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 #include "testing/testing.h"
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
 #include "BKE_fcurve.hh"
@@ -13,7 +15,9 @@
 
 #include "DNA_anim_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_vector.hh"
 
 namespace blender::bke::tests {
 using namespace blender::animrig;
@@ -234,6 +238,75 @@ TEST(evaluate_fcurve, ExtrapolationBezierKeys)
   BKE_fcurve_free(fcu);
 }
 
+TEST(evaluate_fcurve, EvaluateTimes)
+{
+  FCurve *fcu = BKE_fcurve_create();
+
+  const KeyframeSettings settings = get_keyframe_settings(false);
+  insert_vert_fcurve(fcu, {1.0f, 7.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu, {2.0f, 13.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu, {3.0f, 19.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu, {5.0f, -3.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu, {6.0f, 4.0f}, settings, INSERTKEY_NOFLAGS);
+  fcu->bezt[1].ipo = BEZT_IPO_LIN;
+  fcu->bezt[2].ipo = BEZT_IPO_ELASTIC;
+  fcu->bezt[3].ipo = BEZT_IPO_CONST;
+  fcu->extend = FCURVE_EXTRAPOLATE_LINEAR;
+
+  Vector<float> times;
+  for (int i = -100; i <= 800; i++) {
+    times.append(float(i) * 0.01f);
+  }
+  /* Times close to keys, within the threshold for being evaluated on the key. */
+  times.extend({2.99992f, 2.99999f, 3.0f, 3.00001f, 3.00008f, 3.01f});
+  std::sort(times.begin(), times.end());
+
+  Array<float> values(times.size());
+  evaluate_fcurve_times(fcu, times, values);
+  for (const int i : times.index_range()) {
+    EXPECT_EQ(values[i], evaluate_fcurve(fcu, times[i])) << "at time " << times[i];
+  }
+
+  fcu->flag |= FCURVE_INT_VALUES;
+  evaluate_fcurve_times(fcu, times, values);
+  for (const int i : times.index_range()) {
+    EXPECT_EQ(values[i], evaluate_fcurve(fcu, times[i])) << "at time " << times[i];
+  }
+
+  BKE_fcurve_free(fcu);
+}
+
+TEST(evaluate_fcurve, EvaluateCurvesTimes)
+{
+  FCurve *fcu_a = BKE_fcurve_create();
+  FCurve *fcu_b = BKE_fcurve_create();
+
+  const KeyframeSettings settings = get_keyframe_settings(false);
+  insert_vert_fcurve(fcu_a, {1.0f, 7.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu_a, {20.0f, 13.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu_b, {5.0f, -2.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu_b, {10.0f, 4.0f}, settings, INSERTKEY_NOFLAGS);
+  insert_vert_fcurve(fcu_b, {15.0f, 1.0f}, settings, INSERTKEY_NOFLAGS);
+
+  /* Enough times to be split up over multiple tasks per curve. */
+  Array<float> times(3000);
+  for (const int i : times.index_range()) {
+    times[i] = float(i) * 0.01f;
+  }
+
+  const Array<const FCurve *> fcurves = {fcu_a, fcu_b};
+  Array<float> values(fcurves.size() * times.size());
+  evaluate_fcurves_times(fcurves, times, values);
+  for (const int curve : fcurves.index_range()) {
+    for (const int i : times.index_range()) {
+      EXPECT_EQ(values[curve * times.size() + i], evaluate_fcurve(fcurves[curve], times[i]));
+    }
+  }
+
+  BKE_fcurve_free(fcu_a);
+  BKE_fcurve_free(fcu_b);
+}
+
 TEST(fcurve_subdivide, BKE_fcurve_bezt_subdivide_handles)
 {
   FCurve *fcu = BKE_fcurve_create();
@@ -327,6 +327,12 @@ static void tag_component_curve_types_changed(void *owner)
   curves.tag_topology_changed();
 }
 
+static void tag_component_handle_types_changed(void *owner)
+{
+  CurvesGeometry &curves = *static_cast<CurvesGeometry *>(owner);
+  curves.tag_handle_types_changed();
+}
+
 static void tag_component_positions_changed(void *owner)
 {
   CurvesGeometry &curves = *static_cast<CurvesGeometry *>(owner);
@@ -548,7 +554,7 @@ static ComponentAttributeProviders create_attribute_providers_for_curve()
                                                           CD_PROP_INT8,
                                                           BuiltinAttributeProvider::Deletable,
                                                           point_access,
-                                                          tag_component_topology_changed,
+                                                          tag_component_handle_types_changed,
                                                           AttributeValidator{&handle_type_clamp});
 
   static BuiltinCustomDataLayerProvider handle_type_left("handle_type_left",
@@ -556,7 +562,7 @@ static ComponentAttributeProviders create_attribute_providers_for_curve()
                                                          CD_PROP_INT8,
                                                          BuiltinAttributeProvider::Deletable,
                                                          point_access,
-                                                         tag_component_topology_changed,
+                                                         tag_component_handle_types_changed,
                                                          AttributeValidator{&handle_type_clamp});
 
   static BuiltinCustomDataLayerProvider nurbs_weight("nurbs_weight",
@@ -6,6 +6,8 @@
  * \ingroup bke
  */
 
+#include <algorithm>
+
 #include "MEM_guardedalloc.h"
 
 #include "BLI_boxpack_2d.h"
@@ -13,6 +15,7 @@
 #include "BLI_listbase.h"
 #include "BLI_threads.h"
 #include "BLI_time.h"
+#include "BLI_vector.hh"
 
 #include "DNA_image_types.h"
 #include "DNA_userdef_types.h"
@@ -580,11 +583,68 @@ void BKE_image_free_anim_gputextures(Main *bmain)
   }
 }
 
+static size_t image_gpu_memory_size(const Image *ima)
+{
+  size_t memory_size = 0;
+  for (int eye = 0; eye < 2; eye++) {
+    for (int i = 0; i < TEXTARGET_COUNT; i++) {
+      if (ima->gputexture[i][eye] != nullptr) {
+        memory_size += GPU_texture_memory_size(ima->gputexture[i][eye]);
+      }
+    }
+  }
+  return memory_size;
+}
+
+/**
+ * Free the GPU textures of the least recently used images until the memory used by image
+ * textures fits inside the user defined limit. Images used during the last second are kept to
+ * avoid freeing and re-uploading the textures that are on screen every redraw.
+ */
+static void image_free_gputextures_over_limit(Main *bmain, const int ctime)
+{
+  const size_t memory_limit = size_t(U.texmemlimit) * 1024 * 1024;
+
+  struct ImageMemory {
+    Image *ima;
+    size_t memory_size;
+  };
+  blender::Vector<ImageMemory> candidates;
+  size_t memory_usage = 0;
+  LISTBASE_FOREACH (Image *, ima, &bmain->images) {
+    const size_t memory_size = image_gpu_memory_size(ima);
+    memory_usage += memory_size;
+    if (memory_size > 0 && (ima->flag & IMA_NOCOLLECT) == 0 && ima->lastused < ctime) {
+      candidates.append({ima, memory_size});
+    }
+  }
+
+  if (memory_usage <= memory_limit) {
+    return;
+  }
+
+  std::sort(candidates.begin(), candidates.end(), [](const ImageMemory &a, const ImageMemory &b) {
+    return a.ima->lastused < b.ima->lastused;
+  });
+
+  for (const ImageMemory &candidate : candidates) {
+    if (memory_usage <= memory_limit) {
+      break;
+    }
+    BKE_image_free_gputextures(candidate.ima);
+    memory_usage -= candidate.memory_size;
+  }
+}
+
 void BKE_image_free_old_gputextures(Main *bmain)
 {
   static int lasttime = 0;
   int ctime = int(BLI_time_now_seconds());
 
+  if (U.texmemlimit != 0 && !G.is_rendering) {
+    image_free_gputextures_over_limit(bmain, ctime);
+  }
+
   /*
    * Run garbage collector once for every collecting period of time
    * if textimeout is 0, that's the option to NOT run the collector
@@ -22,10 +22,14 @@
 
 #include "BLI_bitmap.h"
 #include "BLI_blenlib.h"
+#include "BLI_hash.hh"
+#include "BLI_implicit_sharing_ptr.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector_types.hh"
+#include "BLI_memory_cache.hh"
+#include "BLI_memory_counter.hh"
 #include "BLI_span.hh"
 #include "BLI_task.h"
 #include "BLI_task.hh"
@@ -64,6 +68,8 @@
 
 #include "CLG_log.h"
 
+#include <xxhash.h>
+
 #ifdef WITH_OPENSUBDIV
 #  include "DNA_userdef_types.h"
 #endif
@@ -287,6 +293,175 @@ static Mesh *modifier_modify_mesh_and_geometry_set(ModifierData *md,
   return mesh_output;
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Modifier Result Cache
+ *
+ * Results of modifiers that implement #ModifierTypeInfo::result_cache_key are stored in the
+ * memory cache, so that changing a modifier doesn't recompute the cached modifiers before it.
+ *
+ * Like in the geometry nodes output cache, the input mesh is not hashed. It is identified by the
+ * implicit sharing infos and versions of its arrays instead, which stay the same as long as the
+ * original mesh and the previous modifiers are unchanged. Results taken from the cache share their
+ * arrays with it, so consecutive cached modifiers are found in the cache as well.
+ * \{ */
+
+class ModifierResultCacheKey : public GenericKey {
+ public:
+  /** The modifier settings and small values of the input mesh. */
+  Vector<char> data;
+  /** References to the arrays of the input mesh, with their versions. */
+  Vector<std::pair<WeakImplicitSharingPtr, int64_t>> shared_data;
+
+  template<typename T> void append(const T &value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    data.extend(Span(reinterpret_cast<const char *>(&value), sizeof(T)));
+  }
+
+  void append_string(const StringRef str)
+  {
+    this->append(str.size());
+    data.extend(Span(str.data(), str.size()));
+  }
+
+  [[nodiscard]] bool append_shared_data(const ImplicitSharingInfo *sharing_info)
+  {
+    if (sharing_info == nullptr) {
+      return false;
+    }
+    sharing_info->add_weak_user();
+    shared_data.append({WeakImplicitSharingPtr(sharing_info), sharing_info->version()});
+    return true;
+  }
+
+  uint64_t hash() const override
+  {
+    uint64_t hash = XXH3_64bits(data.data(), size_t(data.size()));
+    for (const auto &[sharing_info, version] : shared_data) {
+      hash = get_default_hash(hash, sharing_info.get(), version);
+    }
+    return hash;
+  }
+
+  bool equal_to(const GenericKey &other) const override
+  {
+    if (const auto *other_typed = dynamic_cast<const ModifierResultCacheKey *>(&other)) {
+      return data == other_typed->data && shared_data == other_typed->shared_data;
+    }
+    return false;
+  }
+
+  std::unique_ptr<GenericKey> to_storable() const override
+  {
+    return std::make_unique<ModifierResultCacheKey>(*this);
+  }
+};
+
+class CachedModifierResult : public memory_cache::CachedValue {
+ public:
+  Mesh *mesh;
+
+  CachedModifierResult(Mesh *mesh) : mesh(mesh) {}
+
+  ~CachedModifierResult() override
+  {
+    BKE_id_free(nullptr, mesh);
+  }
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    mesh->count_memory(memory);
+  }
+
+  StringRefNull category() const override
+  {
+    return "modifiers";
+  }
+};
+
+static bool add_custom_data_to_key(const CustomData &data, ModifierResultCacheKey &key)
+{
+  key.append(data.totlayer);
+  for (const CustomDataLayer &layer : Span(data.layers, data.totlayer)) {
+    key.append(layer.type);
+    key.append(layer.flag);
+    key.append_string(layer.name);
+    if (!key.append_shared_data(layer.sharing_info)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool add_modifier_input_to_key(const ModifierData &md,
+                                      const ModifierEvalContext &mectx,
+                                      const Mesh &mesh,
+                                      ModifierResultCacheKey &key)
+{
+  const ModifierTypeInfo *mti = BKE_modifier_get_info(ModifierType(md.type));
+  key.append(md.type);
+  mti->result_cache_key(&md, key.data);
+  key.append(mectx.flag);
+  key.append(mectx.object->totcol);
+
+  key.append(mesh.verts_num);
+  key.append(mesh.edges_num);
+  key.append(mesh.faces_num);
+  key.append(mesh.corners_num);
+  if (mesh.faces_num > 0 && !key.append_shared_data(mesh.runtime->face_offsets_sharing_info)) {
+    return false;
+  }
+  key.append(mesh.flag);
+  key.append(mesh.runtime->cd_mask_extra);
+  key.append(mesh.totcol);
+  for (const Material *material : Span(mesh.mat, mesh.totcol)) {
+    key.append(material ? reinterpret_cast<const ID *>(material)->session_uid : 0u);
+  }
+  LISTBASE_FOREACH (const bDeformGroup *, group, &mesh.vertex_group_names) {
+    key.append_string(group->name);
+  }
+  key.append_string(mesh.active_color_attribute ? mesh.active_color_attribute : "");
+  key.append_string(mesh.default_color_attribute ? mesh.default_color_attribute : "");
+
+  return add_custom_data_to_key(mesh.vert_data, key) &&
+         add_custom_data_to_key(mesh.edge_data, key) &&
+         add_custom_data_to_key(mesh.face_data, key) &&
+         add_custom_data_to_key(mesh.corner_data, key);
+}
+
+/**
+ * Same as #modifier_modify_mesh_and_geometry_set, but reuses the result of an earlier evaluation
+ * of modifiers that support it when the input and the settings are unchanged.
+ */
+static Mesh *modifier_modify_mesh_cached(ModifierData *md,
+                                         const ModifierEvalContext &mectx,
+                                         Mesh *input_mesh,
+                                         GeometrySet &geometry_set)
+{
+  const ModifierTypeInfo *mti = BKE_modifier_get_info((ModifierType)md->type);
+  if (mti->result_cache_key == nullptr || mti->modify_geometry_set != nullptr ||
+      input_mesh->runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA)
+  {
+    return modifier_modify_mesh_and_geometry_set(md, mectx, input_mesh, geometry_set);
+  }
+  ModifierResultCacheKey key;
+  if (!add_modifier_input_to_key(*md, mectx, *input_mesh, key)) {
+    return modifier_modify_mesh_and_geometry_set(md, mectx, input_mesh, geometry_set);
+  }
+  const std::shared_ptr<const CachedModifierResult> result =
+      memory_cache::get<CachedModifierResult>(key, [&]() {
+        Mesh *mesh = BKE_modifier_modify_mesh(md, &mectx, input_mesh);
+        if (mesh == nullptr || mesh == input_mesh) {
+          /* The input is still owned by the modifier stack, so the cache needs its own copy. */
+          mesh = BKE_mesh_copy_for_eval(*input_mesh);
+        }
+        return std::make_unique<CachedModifierResult>(mesh);
+      });
+  return BKE_mesh_copy_for_eval(*result->mesh);
+}
+
+/** \} */
+
 static void set_rest_position(Mesh &mesh)
 {
   MutableAttributeAccessor attributes = mesh.attributes_for_write();
@@ -570,7 +745,7 @@ static void mesh_calc_modifiers(Depsgraph &depsgraph,
         }
       }
 
-      Mesh *mesh_next = modifier_modify_mesh_and_geometry_set(md, mectx, mesh, geometry_set_final);
+      Mesh *mesh_next = modifier_modify_mesh_cached(md, mectx, mesh, geometry_set_final);
       ASSERT_IS_VALID_MESH(mesh_next);
 
       if (mesh_next) {
@@ -811,6 +986,11 @@ static void editbmesh_calc_modifiers(Depsgraph &depsgraph,
   CDMaskLink *md_datamask = datamasks;
   CustomData_MeshMasks append_mask = CD_MASK_BAREMESH;
 
+  /* Only keep the previous conversion of the edit mesh if it is still valid. */
+  if (!std::exchange(em_input.eval_cache_positions_only, false) || !em_input.eval_cache) {
+    em_input.eval_cache = std::make_shared<EditMeshEvalCache>();
+  }
+
   Mesh *mesh = BKE_mesh_wrapper_from_editmesh(
       mesh_input.runtime->edit_mesh, &final_datamask, &mesh_input);
 
@@ -1144,6 +1324,26 @@ static void object_get_datamask(const Depsgraph &depsgraph,
   }
 }
 
+/**
+ * Detach the evaluated mesh from the object so it outlives #BKE_object_free_derived_caches. Its
+ * GPU batch cache can be moved to the new result if that only differs in its positions.
+ */
+static Mesh *mesh_eval_take_for_batch_cache_reuse(Object &ob)
+{
+  ID *data_eval = ob.runtime->data_eval;
+  if (data_eval == nullptr || !ob.runtime->is_data_eval_owned || GS(data_eval->name) != ID_ME) {
+    return nullptr;
+  }
+  Mesh *mesh_eval = reinterpret_cast<Mesh *>(data_eval);
+  if (mesh_eval->runtime->batch_cache == nullptr || mesh_eval->runtime->subdiv_ccg ||
+      ob.runtime->editmesh_eval_cage != nullptr || ob.runtime->mesh_deform_eval == mesh_eval)
+  {
+    return nullptr;
+  }
+  ob.runtime->data_eval = nullptr;
+  return mesh_eval;
+}
+
 void mesh_data_update(Depsgraph &depsgraph,
                       const Scene &scene,
                       Object &ob,
@@ -1155,6 +1355,7 @@ void mesh_data_update(Depsgraph &depsgraph,
    * they aren't cleaned up properly on mode switch, causing crashes, e.g #58150. */
   BLI_assert(ob.id.tag & ID_TAG_COPIED_ON_EVAL);
 
+  Mesh *mesh_eval_prev = mesh_eval_take_for_batch_cache_reuse(ob);
   BKE_object_free_derived_caches(&ob);
   if (DEG_is_active(&depsgraph)) {
     BKE_sculpt_update_object_before_eval(&ob);
@@ -1175,6 +1376,15 @@ void mesh_data_update(Depsgraph &depsgraph,
   }
   else {
     mesh_build_data(depsgraph, scene, ob, cddata_masks, need_mapping);
+    if (mesh_eval_prev && ob.runtime->is_data_eval_owned) {
+      /* Avoid rebuilding all GPU buffers when only a deformation changed, e.g. during playback. */
+      BKE_mesh_batch_cache_reuse_deformed(mesh_eval_prev,
+                                          reinterpret_cast<Mesh *>(ob.runtime->data_eval));
+    }
+  }
+
+  if (mesh_eval_prev) {
+    BKE_id_free(nullptr, mesh_eval_prev);
   }
 }
 
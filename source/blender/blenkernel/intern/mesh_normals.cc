@@ -19,6 +19,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_bit_vector.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_base.hh"
 #include "BLI_math_vector.hh"
@@ -155,6 +156,47 @@ void normals_calc_faces(const Span<float3> positions,
   });
 }
 
+void normals_calc_faces(const Span<float3> positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const IndexMask &mask,
+                        MutableSpan<float3> face_normals)
+{
+  BLI_assert(faces.size() == face_normals.size());
+  mask.foreach_index(GrainSize(1024), [&](const int i) {
+    face_normals[i] = normal_calc_ngon(positions, corner_verts.slice(faces[i]));
+  });
+}
+
+/**
+ * Accumulate the normals of the faces around a vertex, weighted by the angle of the face corner.
+ * \param get_face_normal: Either reads an existing face normal or computes it on the fly.
+ */
+template<typename GetFaceNormalFn>
+BLI_INLINE float3 vert_normal_calc(const Span<float3> positions,
+                                   const OffsetIndices<int> faces,
+                                   const Span<int> corner_verts,
+                                   const Span<int> vert_faces,
+                                   const int vert,
+                                   const GetFaceNormalFn &get_face_normal)
+{
+  if (vert_faces.is_empty()) {
+    return math::normalize(positions[vert]);
+  }
+
+  float3 vert_normal(0);
+  for (const int face : vert_faces) {
+    const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
+    const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
+    const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
+    const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
+
+    vert_normal += get_face_normal(face) * factor;
+  }
+
+  return math::normalize(vert_normal);
+}
+
 void normals_calc_verts(const Span<float3> vert_positions,
                         const OffsetIndices<int> faces,
                         const Span<int> corner_verts,
@@ -165,27 +207,45 @@ void normals_calc_verts(const Span<float3> vert_positions,
   const Span<float3> positions = vert_positions;
   threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
     for (const int vert : range) {
-      const Span<int> vert_faces = vert_to_face_map[vert];
-      if (vert_faces.is_empty()) {
-        vert_normals[vert] = math::normalize(positions[vert]);
-        continue;
-      }
-
-      float3 vert_normal(0);
-      for (const int face : vert_faces) {
-        const int2 adjacent_verts = face_find_adjacent_verts(faces[face], corner_verts, vert);
-        const float3 dir_prev = math::normalize(positions[adjacent_verts[0]] - positions[vert]);
-        const float3 dir_next = math::normalize(positions[adjacent_verts[1]] - positions[vert]);
-        const float factor = math::safe_acos_approx(math::dot(dir_prev, dir_next));
-
-        vert_normal += face_normals[face] * factor;
-      }
-
-      vert_normals[vert] = math::normalize(vert_normal);
+      vert_normals[vert] = vert_normal_calc(
+          positions, faces, corner_verts, vert_to_face_map[vert], vert, [&](const int face) {
+            return face_normals[face];
+          });
     }
   });
 }
 
+void normals_calc_verts(const Span<float3> vert_positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const GroupedSpan<int> vert_to_face_map,
+                        const IndexMask &mask,
+                        MutableSpan<float3> vert_normals)
+{
+  const Span<float3> positions = vert_positions;
+  /* Using the same face normal function as #normals_calc_faces makes the result identical. */
+  mask.foreach_index(GrainSize(1024), [&](const int vert) {
+    vert_normals[vert] = vert_normal_calc(
+        positions, faces, corner_verts, vert_to_face_map[vert], vert, [&](const int face) {
+          return normal_calc_ngon(positions, corner_verts.slice(faces[face]));
+        });
+  });
+}
+
+void normals_calc_verts(const Span<float3> vert_positions,
+                        const OffsetIndices<int> faces,
+                        const Span<int> corner_verts,
+                        const GroupedSpan<int> vert_to_face_map,
+                        MutableSpan<float3> vert_normals)
+{
+  normals_calc_verts(vert_positions,
+                     faces,
+                     corner_verts,
+                     vert_to_face_map,
+                     IndexMask(vert_positions.size()),
+                     vert_normals);
+}
+
 /** \} */
 
 }  // namespace blender::bke::mesh
@@ -241,8 +301,19 @@ blender::Span<blender::float3> Mesh::vert_normals() const
   const Span<float3> positions = this->vert_positions();
   const OffsetIndices faces = this->faces();
   const Span<int> corner_verts = this->corner_verts();
-  const Span<float3> face_normals = this->face_normals();
   const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
+  if (!this->runtime->face_normals_cache.is_cached() &&
+      this->normals_domain() == MeshNormalDomain::Point)
+  {
+    /* Face normals are unlikely to be needed when the mesh is smooth shaded, so computing them
+     * on the fly avoids allocating and caching a separate array. */
+    this->runtime->vert_normals_cache.ensure([&](Vector<float3> &r_data) {
+      r_data.reinitialize(positions.size());
+      mesh::normals_calc_verts(positions, faces, corner_verts, vert_to_face, r_data);
+    });
+    return this->runtime->vert_normals_cache.data();
+  }
+  const Span<float3> face_normals = this->face_normals();
   this->runtime->vert_normals_cache.ensure([&](Vector<float3> &r_data) {
     r_data.reinitialize(positions.size());
     mesh::normals_calc_verts(positions, faces, corner_verts, vert_to_face, face_normals, r_data);
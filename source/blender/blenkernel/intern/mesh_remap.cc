@@ -17,6 +17,7 @@
 #include "BLI_array.hh"
 #include "BLI_astar.h"
 #include "BLI_bit_vector.hh"
+#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_solvers.h"
@@ -25,6 +26,7 @@
 #include "BLI_memarena.h"
 #include "BLI_polyfill_2d.h"
 #include "BLI_rand.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_bvhutils.hh"
@@ -324,7 +326,12 @@ void BKE_mesh_remap_free(MeshPairRemap *map)
   map->mem = nullptr;
 }
 
+/**
+ * Items of different elements can be defined from multiple threads, as long as each thread uses
+ * its own \a mem arena.
+ */
 static void mesh_remap_item_define(MeshPairRemap *map,
+                                   MemArena *mem,
                                    const int index,
                                    const float /*hit_dist*/,
                                    const int island,
@@ -333,7 +340,6 @@ static void mesh_remap_item_define(MeshPairRemap *map,
                                    const float *weights_src)
 {
   MeshPairRemapItem *mapit = &map->items[index];
-  MemArena *mem = map->mem;
 
   if (sources_num) {
     mapit->sources_num = sources_num;
@@ -353,6 +359,37 @@ static void mesh_remap_item_define(MeshPairRemap *map,
   mapit->island = island;
 }
 
+static void mesh_remap_item_define(MeshPairRemap *map,
+                                   const int index,
+                                   const float hit_dist,
+                                   const int island,
+                                   const int sources_num,
+                                   const int *indices_src,
+                                   const float *weights_src)
+{
+  mesh_remap_item_define(
+      map, map->mem, index, hit_dist, island, sources_num, indices_src, weights_src);
+}
+
+/**
+ * Call \a fn for ranges of the \a items_num destination elements in parallel, with a thread-local
+ * arena to define their items in. The arenas are moved into the map's arena afterwards.
+ */
+template<typename Fn>
+static void mesh_remap_items_define_parallel(MeshPairRemap *map, const int items_num, const Fn &fn)
+{
+  using namespace blender;
+  threading::EnumerableThreadSpecific<MemArena *> arenas(
+      []() { return BLI_memarena_new(BLI_MEMARENA_STD_BUFSIZE, "mesh_remap_items_define"); });
+  threading::parallel_for(IndexRange(items_num), 512, [&](const IndexRange range) {
+    fn(int(range.first()), int(range.one_after_last()), arenas.local());
+  });
+  for (MemArena *mem : arenas) {
+    BLI_memarena_merge(map->mem, mem);
+    BLI_memarena_free(mem);
+  }
+}
+
 void BKE_mesh_remap_item_define_invalid(MeshPairRemap *map, const int index)
 {
   mesh_remap_item_define(map, index, FLT_MAX, 0, 0, nullptr, nullptr);
@@ -472,80 +509,98 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh treedata = {nullptr};
-    BVHTreeNearest nearest = {0};
-    BVHTreeRayHit rayhit = {0};
-    float hit_dist;
-    float tmp_co[3], tmp_no[3];
 
+    /* The destination vertices are mapped independently, in parallel. */
     if (mode == MREMAP_MODE_VERT_NEAREST) {
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_VERTS, 2);
-      nearest.index = -1;
 
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+      mesh_remap_items_define_parallel(
+          r_map, numverts_dst, [&](const int start, const int end, MemArena *mem) {
+            BVHTreeNearest nearest = {0};
+            nearest.index = -1;
+            float hit_dist;
+            float tmp_co[3];
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+            for (int v = start; v < end; v++) {
+              copy_v3_v3(tmp_co, vert_positions_dst[v]);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &nearest.index, &full_weight);
-        }
-        else {
-          /* No source for this dest vertex! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+              /* Convert the vertex to tree coordinates, if needed. */
+              if (space_transform) {
+                BLI_space_transform_apply(space_transform, tmp_co);
+              }
+
+              /* Don't use the previous result as a hint, so the result doesn't depend on how the
+               * elements are split into ranges. */
+              nearest.index = -1;
+              if (mesh_remap_bvhtree_query_nearest(
+                      &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
+              {
+                mesh_remap_item_define(
+                    r_map, mem, v, hit_dist, 0, 1, &nearest.index, &full_weight);
+              }
+              else {
+                /* No source for this dest vertex! */
+                BKE_mesh_remap_item_define_invalid(r_map, v);
+              }
+            }
+          });
     }
     else if (ELEM(mode, MREMAP_MODE_VERT_EDGE_NEAREST, MREMAP_MODE_VERT_EDGEINTERP_NEAREST)) {
       const blender::Span<blender::int2> edges_src = me_src->edges();
       const blender::Span<blender::float3> positions_src = me_src->vert_positions();
 
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_EDGES, 2);
-      nearest.index = -1;
 
-      for (i = 0; i < numverts_dst; i++) {
-        copy_v3_v3(tmp_co, vert_positions_dst[i]);
+      mesh_remap_items_define_parallel(
+          r_map, numverts_dst, [&](const int start, const int end, MemArena *mem) {
+            BVHTreeNearest nearest = {0};
+            nearest.index = -1;
+            float hit_dist;
+            float tmp_co[3];
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+            for (int v = start; v < end; v++) {
+              copy_v3_v3(tmp_co, vert_positions_dst[v]);
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const blender::int2 &edge = edges_src[nearest.index];
-          const float *v1cos = positions_src[edge[0]];
-          const float *v2cos = positions_src[edge[1]];
-
-          if (mode == MREMAP_MODE_VERT_EDGE_NEAREST) {
-            const float dist_v1 = len_squared_v3v3(tmp_co, v1cos);
-            const float dist_v2 = len_squared_v3v3(tmp_co, v2cos);
-            const int index = (dist_v1 > dist_v2) ? edge[1] : edge[0];
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &index, &full_weight);
-          }
-          else if (mode == MREMAP_MODE_VERT_EDGEINTERP_NEAREST) {
-            int indices[2];
-            float weights[2];
+              /* Convert the vertex to tree coordinates, if needed. */
+              if (space_transform) {
+                BLI_space_transform_apply(space_transform, tmp_co);
+              }
 
-            indices[0] = edge[0];
-            indices[1] = edge[1];
+              nearest.index = -1;
+              if (mesh_remap_bvhtree_query_nearest(
+                      &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
+              {
+                const blender::int2 &edge = edges_src[nearest.index];
+                const float *v1cos = positions_src[edge[0]];
+                const float *v2cos = positions_src[edge[1]];
+
+                if (mode == MREMAP_MODE_VERT_EDGE_NEAREST) {
+                  const float dist_v1 = len_squared_v3v3(tmp_co, v1cos);
+                  const float dist_v2 = len_squared_v3v3(tmp_co, v2cos);
+                  const int index = (dist_v1 > dist_v2) ? edge[1] : edge[0];
+                  mesh_remap_item_define(r_map, mem, v, hit_dist, 0, 1, &index, &full_weight);
+                }
+                else if (mode == MREMAP_MODE_VERT_EDGEINTERP_NEAREST) {
+                  int indices[2];
+                  float weights[2];
 
-            /* Weight is inverse of point factor here... */
-            weights[0] = line_point_factor_v3(tmp_co, v2cos, v1cos);
-            CLAMP(weights[0], 0.0f, 1.0f);
-            weights[1] = 1.0f - weights[0];
+                  indices[0] = edge[0];
+                  indices[1] = edge[1];
 
-            mesh_remap_item_define(r_map, i, hit_dist, 0, 2, indices, weights);
-          }
-        }
-        else {
-          /* No source for this dest vertex! */
-          BKE_mesh_remap_item_define_invalid(r_map, i);
-        }
-      }
+                  /* Weight is inverse of point factor here... */
+                  weights[0] = line_point_factor_v3(tmp_co, v2cos, v1cos);
+                  CLAMP(weights[0], 0.0f, 1.0f);
+                  weights[1] = 1.0f - weights[0];
+
+                  mesh_remap_item_define(r_map, mem, v, hit_dist, 0, 2, indices, weights);
+                }
+              }
+              else {
+                /* No source for this dest vertex! */
+                BKE_mesh_remap_item_define_invalid(r_map, v);
+              }
+            }
+          });
     }
     else if (ELEM(mode,
                   MREMAP_MODE_VERT_FACE_NEAREST,
@@ -558,108 +613,116 @@ void BKE_mesh_remap_calc_verts_from_mesh(const int mode,
       const blender::Span<blender::float3> vert_normals_dst = me_dst->vert_normals();
       const blender::Span<int> tri_faces = me_src->corner_tri_faces();
 
-      size_t tmp_buff_size = MREMAP_DEFAULT_BUFSIZE;
-      float(*vcos)[3] = static_cast<float(*)[3]>(
-          MEM_mallocN(sizeof(*vcos) * tmp_buff_size, __func__));
-      int *indices = static_cast<int *>(MEM_mallocN(sizeof(*indices) * tmp_buff_size, __func__));
-      float *weights = static_cast<float *>(
-          MEM_mallocN(sizeof(*weights) * tmp_buff_size, __func__));
-
       BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_CORNER_TRIS, 2);
 
-      if (mode == MREMAP_MODE_VERT_POLYINTERP_VNORPROJ) {
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
-          copy_v3_v3(tmp_no, vert_normals_dst[i]);
+      mesh_remap_items_define_parallel(
+          r_map, numverts_dst, [&](const int start, const int end, MemArena *mem) {
+            BVHTreeNearest nearest = {0};
+            nearest.index = -1;
+            BVHTreeRayHit rayhit = {0};
+            float hit_dist;
+            float tmp_co[3], tmp_no[3];
 
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-            BLI_space_transform_apply_normal(space_transform, tmp_no);
-          }
+            size_t tmp_buff_size = MREMAP_DEFAULT_BUFSIZE;
+            float(*vcos)[3] = static_cast<float(*)[3]>(
+                MEM_mallocN(sizeof(*vcos) * tmp_buff_size, __func__));
+            int *indices = static_cast<int *>(
+                MEM_mallocN(sizeof(*indices) * tmp_buff_size, __func__));
+            float *weights = static_cast<float *>(
+                MEM_mallocN(sizeof(*weights) * tmp_buff_size, __func__));
 
-          if (mesh_remap_bvhtree_query_raycast(
-                  &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
-          {
-            const int face_index = tri_faces[rayhit.index];
-            const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
-                                                                    corner_verts_src,
-                                                                    positions_src,
-                                                                    rayhit.co,
-                                                                    &tmp_buff_size,
-                                                                    &vcos,
-                                                                    false,
-                                                                    &indices,
-                                                                    &weights,
-                                                                    true,
-                                                                    nullptr);
-
-            mesh_remap_item_define(r_map, i, hit_dist, 0, sources_num, indices, weights);
-          }
-          else {
-            /* No source for this dest vertex! */
-            BKE_mesh_remap_item_define_invalid(r_map, i);
-          }
-        }
-      }
-      else {
-        nearest.index = -1;
+            for (int v = start; v < end; v++) {
+              copy_v3_v3(tmp_co, vert_positions_dst[v]);
 
-        for (i = 0; i < numverts_dst; i++) {
-          copy_v3_v3(tmp_co, vert_positions_dst[i]);
+              if (mode == MREMAP_MODE_VERT_POLYINTERP_VNORPROJ) {
+                copy_v3_v3(tmp_no, vert_normals_dst[v]);
 
-          /* Convert the vertex to tree coordinates, if needed. */
-          if (space_transform) {
-            BLI_space_transform_apply(space_transform, tmp_co);
-          }
+                /* Convert the vertex to tree coordinates, if needed. */
+                if (space_transform) {
+                  BLI_space_transform_apply(space_transform, tmp_co);
+                  BLI_space_transform_apply_normal(space_transform, tmp_no);
+                }
 
-          if (mesh_remap_bvhtree_query_nearest(
-                  &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-          {
-            const int face_index = tri_faces[nearest.index];
-
-            if (mode == MREMAP_MODE_VERT_FACE_NEAREST) {
-              int index;
-              mesh_remap_interp_face_data_get(faces_src[face_index],
-                                              corner_verts_src,
-                                              positions_src,
-                                              nearest.co,
-                                              &tmp_buff_size,
-                                              &vcos,
-                                              false,
-                                              &indices,
-                                              &weights,
-                                              false,
-                                              &index);
+                if (mesh_remap_bvhtree_query_raycast(
+                        &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
+                {
+                  const int face_index = tri_faces[rayhit.index];
+                  const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
+                                                                          corner_verts_src,
+                                                                          positions_src,
+                                                                          rayhit.co,
+                                                                          &tmp_buff_size,
+                                                                          &vcos,
+                                                                          false,
+                                                                          &indices,
+                                                                          &weights,
+                                                                          true,
+                                                                          nullptr);
+
+                  mesh_remap_item_define(
+                      r_map, mem, v, hit_dist, 0, sources_num, indices, weights);
+                }
+                else {
+                  /* No source for this dest vertex! */
+                  BKE_mesh_remap_item_define_invalid(r_map, v);
+                }
+                continue;
+              }
 
-              mesh_remap_item_define(r_map, i, hit_dist, 0, 1, &index, &full_weight);
-            }
-            else if (mode == MREMAP_MODE_VERT_POLYINTERP_NEAREST) {
-              const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
-                                                                      corner_verts_src,
-                                                                      positions_src,
-                                                                      nearest.co,
-                                                                      &tmp_buff_size,
-                                                                      &vcos,
-                                                                      false,
-                                                                      &indices,
-                                                                      &weights,
-                                                                      true,
-                                                                      nullptr);
-
-              mesh_remap_item_define(r_map, i, hit_dist, 0, sources_num, indices, weights);
+              /* Convert the vertex to tree coordinates, if needed. */
+              if (space_transform) {
+                BLI_space_transform_apply(space_transform, tmp_co);
+              }
+
+              nearest.index = -1;
+              if (mesh_remap_bvhtree_query_nearest(
+                      &treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
+              {
+                const int face_index = tri_faces[nearest.index];
+
+                if (mode == MREMAP_MODE_VERT_FACE_NEAREST) {
+                  int index;
+                  mesh_remap_interp_face_data_get(faces_src[face_index],
+                                                  corner_verts_src,
+                                                  positions_src,
+                                                  nearest.co,
+                                                  &tmp_buff_size,
+                                                  &vcos,
+                                                  false,
+                                                  &indices,
+                                                  &weights,
+                                                  false,
+                                                  &index);
+
+                  mesh_remap_item_define(r_map, mem, v, hit_dist, 0, 1, &index, &full_weight);
+                }
+                else if (mode == MREMAP_MODE_VERT_POLYINTERP_NEAREST) {
+                  const int sources_num = mesh_remap_interp_face_data_get(faces_src[face_index],
+                                                                          corner_verts_src,
+                                                                          positions_src,
+                                                                          nearest.co,
+                                                                          &tmp_buff_size,
+                                                                          &vcos,
+                                                                          false,
+                                                                          &indices,
+                                                                          &weights,
+                                                                          true,
+                                                                          nullptr);
+
+                  mesh_remap_item_define(
+                      r_map, mem, v, hit_dist, 0, sources_num, indices, weights);
+                }
+              }
+              else {
+                /* No source for this dest vertex! */
+                BKE_mesh_remap_item_define_invalid(r_map, v);
+              }
             }
-          }
-          else {
-            /* No source for this dest vertex! */
-            BKE_mesh_remap_item_define_invalid(r_map, i);
-          }
-        }
-      }
 
-      MEM_freeN(vcos);
-      MEM_freeN(indices);
-      MEM_freeN(weights);
+            MEM_freeN(vcos);
+            MEM_freeN(indices);
+            MEM_freeN(weights);
+          });
     }
     else {
       CLOG_WARN(&LOG, "Unsupported mesh-to-mesh vertex mapping mode (%d)!", mode);
@@ -2064,7 +2127,6 @@ void BKE_mesh_remap_calc_faces_from_mesh(const int mode,
   }
   else {
     BVHTreeFromMesh treedata = {nullptr};
-    BVHTreeNearest nearest = {0};
     BVHTreeRayHit rayhit = {0};
     float hit_dist;
     const blender::Span<int> tri_faces = me_src->corner_tri_faces();
@@ -2072,56 +2134,71 @@ void BKE_mesh_remap_calc_faces_from_mesh(const int mode,
     BKE_bvhtree_from_mesh_get(&treedata, me_src, BVHTREE_FROM_CORNER_TRIS, 2);
 
     if (mode == MREMAP_MODE_POLY_NEAREST) {
-      nearest.index = -1;
+      mesh_remap_items_define_parallel(
+          r_map, int(faces_dst.size()), [&](const int start, const int end, MemArena *mem) {
+            BVHTreeNearest nearest_local = {0};
+            nearest_local.index = -1;
+            float hit_dist_local;
+
+            for (int f = start; f < end; f++) {
+              const blender::IndexRange face = faces_dst[f];
+              blender::float3 co = blender::bke::mesh::face_center_calc(
+                  {reinterpret_cast<const blender::float3 *>(vert_positions_dst), numverts_dst},
+                  {&corner_verts_dst[face.start()], face.size()});
 
-      for (const int64_t i : faces_dst.index_range()) {
-        const blender::IndexRange face = faces_dst[i];
-        tmp_co = blender::bke::mesh::face_center_calc(
-            {reinterpret_cast<const blender::float3 *>(vert_positions_dst), numverts_dst},
-            {&corner_verts_dst[face.start()], face.size()});
-
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-        }
+              /* Convert the vertex to tree coordinates, if needed. */
+              if (space_transform) {
+                BLI_space_transform_apply(space_transform, co);
+              }
 
-        if (mesh_remap_bvhtree_query_nearest(&treedata, &nearest, tmp_co, max_dist_sq, &hit_dist))
-        {
-          const int face_index = tri_faces[nearest.index];
-          mesh_remap_item_define(r_map, int(i), hit_dist, 0, 1, &face_index, &full_weight);
-        }
-        else {
-          /* No source for this dest face! */
-          BKE_mesh_remap_item_define_invalid(r_map, int(i));
-        }
-      }
+              nearest_local.index = -1;
+              if (mesh_remap_bvhtree_query_nearest(
+                      &treedata, &nearest_local, co, max_dist_sq, &hit_dist_local))
+              {
+                const int face_index = tri_faces[nearest_local.index];
+                mesh_remap_item_define(
+                    r_map, mem, f, hit_dist_local, 0, 1, &face_index, &full_weight);
+              }
+              else {
+                /* No source for this dest face! */
+                BKE_mesh_remap_item_define_invalid(r_map, f);
+              }
+            }
+          });
     }
     else if (mode == MREMAP_MODE_POLY_NOR) {
-      for (const int64_t i : faces_dst.index_range()) {
-        const blender::IndexRange face = faces_dst[i];
+      mesh_remap_items_define_parallel(
+          r_map, int(faces_dst.size()), [&](const int start, const int end, MemArena *mem) {
+            BVHTreeRayHit rayhit_local = {0};
+            float hit_dist_local;
 
-        tmp_co = blender::bke::mesh::face_center_calc(
-            {reinterpret_cast<const blender::float3 *>(vert_positions_dst), numverts_dst},
-            {&corner_verts_dst[face.start()], face.size()});
-        copy_v3_v3(tmp_no, face_normals_dst[i]);
+            for (int f = start; f < end; f++) {
+              const blender::IndexRange face = faces_dst[f];
 
-        /* Convert the vertex to tree coordinates, if needed. */
-        if (space_transform) {
-          BLI_space_transform_apply(space_transform, tmp_co);
-          BLI_space_transform_apply_normal(space_transform, tmp_no);
-        }
+              blender::float3 co = blender::bke::mesh::face_center_calc(
+                  {reinterpret_cast<const blender::float3 *>(vert_positions_dst), numverts_dst},
+                  {&corner_verts_dst[face.start()], face.size()});
+              blender::float3 no = face_normals_dst[f];
 
-        if (mesh_remap_bvhtree_query_raycast(
-                &treedata, &rayhit, tmp_co, tmp_no, ray_radius, max_dist, &hit_dist))
-        {
-          const int face_index = tri_faces[rayhit.index];
-          mesh_remap_item_define(r_map, int(i), hit_dist, 0, 1, &face_index, &full_weight);
-        }
-        else {
-          /* No source for this dest face! */
-          BKE_mesh_remap_item_define_invalid(r_map, int(i));
-        }
-      }
+              /* Convert the vertex to tree coordinates, if needed. */
+              if (space_transform) {
+                BLI_space_transform_apply(space_transform, co);
+                BLI_space_transform_apply_normal(space_transform, no);
+              }
+
+              if (mesh_remap_bvhtree_query_raycast(
+                      &treedata, &rayhit_local, co, no, ray_radius, max_dist, &hit_dist_local))
+              {
+                const int face_index = tri_faces[rayhit_local.index];
+                mesh_remap_item_define(
+                    r_map, mem, f, hit_dist_local, 0, 1, &face_index, &full_weight);
+              }
+              else {
+                /* No source for this dest face! */
+                BKE_mesh_remap_item_define_invalid(r_map, f);
+              }
+            }
+          });
     }
     else if (mode == MREMAP_MODE_POLY_POLYINTERP_PNORPROJ) {
       /* We cast our rays randomly, with a pseudo-even distribution
@@ -9,7 +9,9 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
+#include "BLI_string.h"
 #include "BLI_task.hh"
 
 #include "BKE_bake_data_block_id.hh"
@@ -20,12 +22,15 @@
 #include "BKE_mesh.hh"
 #include "BKE_mesh_mapping.hh"
 #include "BKE_mesh_runtime.hh"
+#include "BKE_pbvh_api.hh"
 #include "BKE_shrinkwrap.hh"
 #include "BKE_subdiv_ccg.hh"
 
 using blender::float3;
+using blender::IndexRange;
 using blender::MutableSpan;
 using blender::Span;
+using blender::StringRef;
 
 /* -------------------------------------------------------------------- */
 /** \name Mesh Runtime Struct Utils
@@ -314,6 +319,8 @@ void BKE_mesh_runtime_clear_geometry(Mesh *mesh)
   /* Tagging shared caches dirty will free the allocated data if there is only one user. */
   free_bvh_cache(*mesh->runtime);
   mesh->runtime->subdiv_ccg.reset();
+  mesh->runtime->topology_version++;
+  mesh->runtime->pbvh_for_reuse.reset();
   mesh->runtime->bounds_cache.tag_dirty();
   mesh->runtime->vert_to_face_offset_cache.tag_dirty();
   mesh->runtime->vert_to_face_map_cache.tag_dirty();
@@ -390,6 +397,76 @@ void Mesh::tag_positions_changed()
   this->tag_positions_changed_no_normals();
 }
 
+void Mesh::tag_positions_changed(const blender::IndexMask &changed_verts)
+{
+  using namespace blender;
+  bke::MeshRuntime &runtime = *this->runtime;
+  const bool has_face_normals = runtime.face_normals_cache.is_cached();
+  const bool has_vert_normals = runtime.vert_normals_cache.is_cached();
+  const bool has_corner_tris = runtime.corner_tris_cache.data.is_cached() &&
+                               !runtime.corner_tris_cache.frozen;
+  /* For large changes, the overhead of finding the affected elements isn't worth it. */
+  if (changed_verts.size() > this->verts_num / 8 ||
+      !(has_face_normals || has_vert_normals || has_corner_tris))
+  {
+    this->tag_positions_changed();
+    return;
+  }
+
+  const OffsetIndices<int> faces = this->faces();
+  const Span<int> corner_verts = this->corner_verts();
+  const GroupedSpan<int> vert_to_face = this->vert_to_face_map();
+
+  /* Writing the same value from multiple threads is fine. */
+  Array<bool> faces_changed(faces.size(), false);
+  changed_verts.foreach_index(GrainSize(1024), [&](const int vert) {
+    faces_changed.as_mutable_span().fill_indices(vert_to_face[vert], true);
+  });
+  IndexMaskMemory memory;
+  const IndexMask changed_faces = IndexMask::from_bools(faces_changed, memory);
+
+  const Span<float3> positions = this->vert_positions();
+  if (has_face_normals) {
+    runtime.face_normals_cache.update([&](Vector<float3> &r_data) {
+      bke::mesh::normals_calc_faces(positions, faces, corner_verts, changed_faces, r_data);
+    });
+  }
+  if (has_vert_normals) {
+    /* The normals of all vertices of the changed faces depend on the moved vertices. */
+    Array<bool> verts_changed(this->verts_num, false);
+    changed_verts.to_bools(verts_changed);
+    changed_faces.foreach_index(GrainSize(1024), [&](const int face) {
+      verts_changed.as_mutable_span().fill_indices(corner_verts.slice(faces[face]), true);
+    });
+    const IndexMask affected_verts = IndexMask::from_bools(verts_changed, memory);
+    runtime.vert_normals_cache.update([&](Vector<float3> &r_data) {
+      bke::mesh::normals_calc_verts(
+          positions, faces, corner_verts, vert_to_face, affected_verts, r_data);
+    });
+  }
+  if (has_corner_tris) {
+    /* Only the triangulation of faces with more than three corners depends on the positions. */
+    const IndexMask changed_quads_and_ngons = IndexMask::from_predicate(
+        changed_faces, GrainSize(4096), memory, [&](const int face) {
+          return faces[face].size() > 3;
+        });
+    const Span<float3> face_normals = has_face_normals ?
+                                          runtime.face_normals_cache.data().as_span() :
+                                          Span<float3>();
+    runtime.corner_tris_cache.data.update([&](Array<int3> &r_data) {
+      bke::mesh::corner_tris_calc(
+          positions, faces, corner_verts, face_normals, changed_quads_and_ngons, r_data);
+    });
+  }
+  else {
+    runtime.corner_tris_cache.tag_dirty();
+  }
+  runtime.corner_normals_cache.tag_dirty();
+  free_bvh_cache(runtime);
+  runtime.bounds_cache.tag_dirty();
+  runtime.shrinkwrap_boundary_cache.tag_dirty();
+}
+
 void Mesh::tag_positions_changed_no_normals()
 {
   free_bvh_cache(*this->runtime);
@@ -420,6 +497,8 @@ void Mesh::tag_topology_changed()
 
 void (*BKE_mesh_batch_cache_dirty_tag_cb)(Mesh *mesh, eMeshBatchDirtyMode mode) = nullptr;
 void (*BKE_mesh_batch_cache_free_cb)(void *batch_cache) = nullptr;
+void (*BKE_mesh_batch_cache_tag_positions_changed_cb)(
+    Mesh *mesh, const blender::IndexMask &changed_verts) = nullptr;
 
 void BKE_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
 {
@@ -427,11 +506,93 @@ void BKE_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
     BKE_mesh_batch_cache_dirty_tag_cb(mesh, mode);
   }
 }
+void BKE_mesh_batch_cache_tag_positions_changed(Mesh *mesh,
+                                                const blender::IndexMask &changed_verts)
+{
+  if (mesh->runtime->batch_cache) {
+    BKE_mesh_batch_cache_tag_positions_changed_cb(mesh, changed_verts);
+  }
+}
 void BKE_mesh_batch_cache_free(void *batch_cache)
 {
   BKE_mesh_batch_cache_free_cb(batch_cache);
 }
 
+static bool custom_data_shared_except(const CustomData &a,
+                                      const CustomData &b,
+                                      const StringRef ignored_name)
+{
+  if (a.totlayer != b.totlayer) {
+    return false;
+  }
+  for (const int i : IndexRange(a.totlayer)) {
+    const CustomDataLayer &layer_a = a.layers[i];
+    const CustomDataLayer &layer_b = b.layers[i];
+    if (layer_a.type != layer_b.type || !STREQ(layer_a.name, layer_b.name)) {
+      return false;
+    }
+    if (layer_a.name == ignored_name) {
+      continue;
+    }
+    /* Comparing pointers is only meaningful while both meshes keep the data alive. */
+    if (layer_a.sharing_info == nullptr || layer_a.sharing_info != layer_b.sharing_info ||
+        layer_a.data != layer_b.data)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool mesh_is_deformed_copy(const Mesh &mesh_src, const Mesh &mesh_dst)
+{
+  if (mesh_src.verts_num != mesh_dst.verts_num || mesh_src.edges_num != mesh_dst.edges_num ||
+      mesh_src.faces_num != mesh_dst.faces_num || mesh_src.corners_num != mesh_dst.corners_num ||
+      mesh_src.totcol != mesh_dst.totcol)
+  {
+    return false;
+  }
+  if (mesh_src.face_offset_indices != mesh_dst.face_offset_indices ||
+      mesh_src.runtime->face_offsets_sharing_info != mesh_dst.runtime->face_offsets_sharing_info)
+  {
+    return false;
+  }
+  return custom_data_shared_except(mesh_src.vert_data, mesh_dst.vert_data, "position") &&
+         custom_data_shared_except(mesh_src.edge_data, mesh_dst.edge_data, "") &&
+         custom_data_shared_except(mesh_src.face_data, mesh_dst.face_data, "") &&
+         custom_data_shared_except(mesh_src.corner_data, mesh_dst.corner_data, "");
+}
+
+void BKE_mesh_batch_cache_reuse_deformed(Mesh *mesh_src, Mesh *mesh_dst)
+{
+  using namespace blender;
+  if (mesh_src->runtime->batch_cache == nullptr || mesh_dst->runtime->batch_cache != nullptr) {
+    return;
+  }
+  for (const Mesh *mesh : {mesh_src, mesh_dst}) {
+    /* The edit mode and GPU subdivision caches depend on more than the mesh data. */
+    if (mesh->runtime->edit_mesh || mesh->runtime->subsurf_runtime_data ||
+        mesh->runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA)
+    {
+      return;
+    }
+  }
+  if (!mesh_is_deformed_copy(*mesh_src, *mesh_dst)) {
+    return;
+  }
+  std::swap(mesh_src->runtime->batch_cache, mesh_dst->runtime->batch_cache);
+
+  /* Often only part of the mesh is deformed, e.g. by a hook or a vertex group. */
+  const Span<float3> positions_src = mesh_src->vert_positions();
+  const Span<float3> positions_dst = mesh_dst->vert_positions();
+  IndexMaskMemory memory;
+  const IndexMask changed_verts = IndexMask::from_predicate(
+      positions_dst.index_range(), GrainSize(4096), memory, [&](const int64_t i) {
+        return positions_src[i] != positions_dst[i];
+      });
+  BKE_mesh_batch_cache_tag_positions_changed(mesh_dst, changed_verts);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
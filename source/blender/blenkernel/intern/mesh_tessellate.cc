@@ -13,6 +13,7 @@
 
 #include "BLI_array_utils.hh"
 #include "BLI_enumerable_thread_specific.hh"
+#include "BLI_index_mask.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
@@ -165,16 +166,17 @@ static void corner_tris_calc_impl(const Span<float3> positions,
                                   const OffsetIndices<int> faces,
                                   const Span<int> corner_verts,
                                   const Span<float3> face_normals,
+                                  const IndexMask &face_mask,
                                   MutableSpan<int3> corner_tris)
 {
   threading::EnumerableThreadSpecific<LocalData> all_local_data;
-  if (face_normals.is_empty()) {
-    threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
-      LocalData &local_data = all_local_data.local();
-      for (const int64_t i : range) {
-        const int face_start = int(faces[i].start());
-        const int face_size = int(faces[i].size());
-        const int tris_start = poly_to_tri_count(int(i), face_start);
+  threading::parallel_for(face_mask.index_range(), 1024, [&](const IndexRange range) {
+    LocalData &local_data = all_local_data.local();
+    face_mask.slice(range).foreach_index([&](const int i) {
+      const int face_start = int(faces[i].start());
+      const int face_size = int(faces[i].size());
+      const int tris_start = poly_to_tri_count(i, face_start);
+      if (face_normals.is_empty()) {
         mesh_calc_tessellation_for_face(corner_verts,
                                         positions,
                                         face_start,
@@ -182,15 +184,7 @@ static void corner_tris_calc_impl(const Span<float3> positions,
                                         &corner_tris[tris_start],
                                         &local_data.pf_arena);
       }
-    });
-  }
-  else {
-    threading::parallel_for(faces.index_range(), 1024, [&](const IndexRange range) {
-      LocalData &local_data = all_local_data.local();
-      for (const int64_t i : range) {
-        const int face_start = int(faces[i].start());
-        const int face_size = int(faces[i].size());
-        const int tris_start = poly_to_tri_count(int(i), face_start);
+      else {
         mesh_calc_tessellation_for_face_with_normal(corner_verts,
                                                     positions,
                                                     face_start,
@@ -200,15 +194,26 @@ static void corner_tris_calc_impl(const Span<float3> positions,
                                                     face_normals[i]);
       }
     });
-  }
+  });
+}
+
+void corner_tris_calc(const Span<float3> vert_positions,
+                      const OffsetIndices<int> faces,
+                      const Span<int> corner_verts,
+                      MutableSpan<int3> corner_tris)
+{
+  corner_tris_calc_impl(
+      vert_positions, faces, corner_verts, {}, faces.index_range(), corner_tris);
 }
 
 void corner_tris_calc(const Span<float3> vert_positions,
                       const OffsetIndices<int> faces,
                       const Span<int> corner_verts,
+                      const Span<float3> face_normals,
+                      const IndexMask &face_mask,
                       MutableSpan<int3> corner_tris)
 {
-  corner_tris_calc_impl(vert_positions, faces, corner_verts, {}, corner_tris);
+  corner_tris_calc_impl(vert_positions, faces, corner_verts, face_normals, face_mask, corner_tris);
 }
 
 void corner_tris_calc_face_indices(const OffsetIndices<int> faces, MutableSpan<int> tri_faces)
@@ -230,7 +235,8 @@ void corner_tris_calc_with_normals(const Span<float3> vert_positions,
                                    MutableSpan<int3> corner_tris)
 {
   BLI_assert(!face_normals.is_empty() || faces.is_empty());
-  corner_tris_calc_impl(vert_positions, faces, corner_verts, face_normals, corner_tris);
+  corner_tris_calc_impl(
+      vert_positions, faces, corner_verts, face_normals, faces.index_range(), corner_tris);
 }
 
 /** \} */
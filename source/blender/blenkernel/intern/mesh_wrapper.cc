@@ -26,6 +26,7 @@
 #include "DNA_object_types.h"
 
 #include "BLI_ghash.h"
+#include "BLI_implicit_sharing.hh"
 #include "BLI_math_matrix.h"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector.hh"
@@ -33,6 +34,7 @@
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
+#include "BKE_customdata.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_editmesh_cache.hh"
 #include "BKE_lib_id.hh"
@@ -50,6 +52,7 @@
 
 using blender::float3;
 using blender::Span;
+using blender::bke::EditMeshEvalCache;
 
 Mesh *BKE_mesh_wrapper_from_editmesh(std::shared_ptr<BMEditMesh> em,
                                      const CustomData_MeshMasks *cd_mask_extra,
@@ -88,6 +91,100 @@ Mesh *BKE_mesh_wrapper_from_editmesh(std::shared_ptr<BMEditMesh> em,
   return mesh;
 }
 
+static bool eval_cache_matches(const EditMeshEvalCache &eval_cache,
+                               const BMesh &bm,
+                               const Mesh &mesh)
+{
+  const Mesh *mesh_cached = eval_cache.mesh;
+  if (mesh_cached == nullptr) {
+    return false;
+  }
+  /* The cache is cleared on topology changes, checking the sizes is just for safety. */
+  if (mesh_cached->verts_num != bm.totvert || mesh_cached->edges_num != bm.totedge ||
+      mesh_cached->faces_num != bm.totface || mesh_cached->corners_num != bm.totloop)
+  {
+    return false;
+  }
+  const CustomData_MeshMasks &a = eval_cache.cd_mask_extra;
+  const CustomData_MeshMasks &b = mesh.runtime->cd_mask_extra;
+  return a.vmask == b.vmask && a.emask == b.emask && a.fmask == b.fmask && a.pmask == b.pmask &&
+         a.lmask == b.lmask;
+}
+
+/**
+ * Share all data of \a src and the caches derived from it with the empty mesh \a dst.
+ */
+static void mesh_share_data(const Mesh &src, Mesh &dst)
+{
+  dst.verts_num = src.verts_num;
+  dst.edges_num = src.edges_num;
+  dst.faces_num = src.faces_num;
+  dst.corners_num = src.corners_num;
+  dst.act_face = src.act_face;
+
+  CustomData_init_from(&src.vert_data, &dst.vert_data, CD_MASK_ALL, src.verts_num);
+  CustomData_init_from(&src.edge_data, &dst.edge_data, CD_MASK_ALL, src.edges_num);
+  CustomData_init_from(&src.face_data, &dst.face_data, CD_MASK_ALL, src.faces_num);
+  CustomData_init_from(&src.corner_data, &dst.corner_data, CD_MASK_ALL, src.corners_num);
+  blender::implicit_sharing::copy_shared_pointer(src.face_offset_indices,
+                                                 src.runtime->face_offsets_sharing_info,
+                                                 &dst.face_offset_indices,
+                                                 &dst.runtime->face_offsets_sharing_info);
+
+  const blender::bke::MeshRuntime &src_runtime = *src.runtime;
+  blender::bke::MeshRuntime &dst_runtime = *dst.runtime;
+  dst_runtime.bounds_cache = src_runtime.bounds_cache;
+  dst_runtime.vert_normals_cache = src_runtime.vert_normals_cache;
+  dst_runtime.face_normals_cache = src_runtime.face_normals_cache;
+  dst_runtime.corner_normals_cache = src_runtime.corner_normals_cache;
+  dst_runtime.loose_verts_cache = src_runtime.loose_verts_cache;
+  dst_runtime.verts_no_face_cache = src_runtime.verts_no_face_cache;
+  dst_runtime.loose_edges_cache = src_runtime.loose_edges_cache;
+  dst_runtime.corner_tris_cache = src_runtime.corner_tris_cache;
+  dst_runtime.corner_tri_faces_cache = src_runtime.corner_tri_faces_cache;
+  dst_runtime.vert_to_face_offset_cache = src_runtime.vert_to_face_offset_cache;
+  dst_runtime.vert_to_face_map_cache = src_runtime.vert_to_face_map_cache;
+  dst_runtime.vert_to_corner_map_cache = src_runtime.vert_to_corner_map_cache;
+  dst_runtime.corner_to_face_map_cache = src_runtime.corner_to_face_map_cache;
+}
+
+/**
+ * Copy the current positions into a mesh that shares its data with the previous conversion, and
+ * only update the normals and triangulation around the vertices that moved.
+ */
+static void positions_update_from_edit_mesh(BMesh &bm,
+                                            const blender::bke::EditMeshData &edit_data,
+                                            Mesh &mesh)
+{
+  using namespace blender;
+  MutableSpan<float3> positions = mesh.vert_positions_for_write();
+  Array<bool> changed(positions.size());
+  if (!edit_data.vert_positions.is_empty()) {
+    const Span<float3> src = edit_data.vert_positions;
+    threading::parallel_for(positions.index_range(), 4096, [&](const IndexRange range) {
+      for (const int i : range) {
+        changed[i] = positions[i] != src[i];
+        positions[i] = src[i];
+      }
+    });
+  }
+  else {
+    BMIter iter;
+    BMVert *v;
+    int i;
+    BM_ITER_MESH_INDEX (v, &iter, &bm, BM_VERTS_OF_MESH, i) {
+      changed[i] = positions[i] != float3(v->co);
+      positions[i] = v->co;
+    }
+  }
+
+  IndexMaskMemory memory;
+  const IndexMask changed_verts = IndexMask::from_bools(changed, memory);
+  if (!changed_verts.is_empty()) {
+    mesh.tag_positions_changed(changed_verts);
+  }
+}
+
 void BKE_mesh_wrapper_ensure_mdata(Mesh *mesh)
 {
   std::lock_guard lock{mesh->runtime->eval_mutex};
@@ -112,24 +209,51 @@ void BKE_mesh_wrapper_ensure_mdata(Mesh *mesh)
         BLI_assert(mesh->runtime->edit_data != nullptr);
 
         BMEditMesh *em = mesh->runtime->edit_mesh.get();
-        BM_mesh_bm_to_me_for_eval(*em->bm, *mesh, &mesh->runtime->cd_mask_extra);
-
-        /* Adding original index layers here assumes that all BMesh Mesh wrappers are created from
-         * original edit mode meshes (the only case where adding original indices makes sense).
-         * If that assumption is broken, the layers might be incorrect because they might not
-         * actually be "original".
-         *
-         * There is also a performance aspect, where this also assumes that original indices are
-         * always needed when converting a BMesh to a mesh with the mesh wrapper system. That might
-         * be wrong, but it's not harmful. */
-        BKE_mesh_ensure_default_orig_index_customdata_no_check(mesh);
-
         blender::bke::EditMeshData &edit_data = *mesh->runtime->edit_data;
+
+        /* Keep a reference, the edit mesh may get a new cache while this one is in use. */
+        const std::shared_ptr<EditMeshEvalCache> eval_cache = em->eval_cache;
+        std::unique_lock<std::mutex> cache_lock;
+        if (eval_cache) {
+          cache_lock = std::unique_lock(eval_cache->mutex);
+        }
+
+        if (eval_cache && eval_cache_matches(*eval_cache, *em->bm, *mesh)) {
+          mesh_share_data(*eval_cache->mesh, *mesh);
+          positions_update_from_edit_mesh(*em->bm, edit_data, *mesh);
+        }
+        else {
+          BM_mesh_bm_to_me_for_eval(*em->bm, *mesh, &mesh->runtime->cd_mask_extra);
+
+          /* Adding original index layers here assumes that all BMesh Mesh wrappers are created
+           * from original edit mode meshes (the only case where adding original indices makes
+           * sense). If that assumption is broken, the layers might be incorrect because they might
+           * not actually be "original".
+           *
+           * There is also a performance aspect, where this also assumes that original indices are
+           * always needed when converting a BMesh to a mesh with the mesh wrapper system. That
+           * might be wrong, but it's not harmful. */
+          BKE_mesh_ensure_default_orig_index_customdata_no_check(mesh);
+
+          if (!edit_data.vert_positions.is_empty()) {
+            mesh->vert_positions_for_write().copy_from(edit_data.vert_positions);
+          }
+        }
         if (!edit_data.vert_positions.is_empty()) {
-          mesh->vert_positions_for_write().copy_from(edit_data.vert_positions);
           mesh->runtime->is_original_bmesh = false;
         }
 
+        if (eval_cache) {
+          /* Cheap, all arrays and caches are shared. */
+          Mesh *mesh_cached = static_cast<Mesh *>(BKE_id_new_nomain(ID_ME, nullptr));
+          mesh_share_data(*mesh, *mesh_cached);
+          if (eval_cache->mesh) {
+            BKE_id_free(nullptr, eval_cache->mesh);
+          }
+          eval_cache->mesh = mesh_cached;
+          eval_cache->cd_mask_extra = mesh->runtime->cd_mask_extra;
+        }
+
         mesh->runtime->edit_data.reset();
         break;
       }
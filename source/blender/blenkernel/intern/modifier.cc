@@ -332,6 +332,18 @@ void BKE_modifier_copydata_generic(const ModifierData *md_src,
   md_dst->runtime = nullptr;
 }
 
+void BKE_modifier_result_cache_key_append_settings(const ModifierData *md,
+                                                   blender::Vector<char> &r_key)
+{
+  const ModifierTypeInfo *mti = BKE_modifier_get_info(ModifierType(md->type));
+  /* The shared #ModifierData contains the name, UI flags and runtime data that don't affect the
+   * result. */
+  const size_t data_size = sizeof(ModifierData);
+  BLI_assert(data_size <= size_t(mti->struct_size));
+  const char *md_data = reinterpret_cast<const char *>(md) + data_size;
+  r_key.extend(blender::Span(md_data, mti->struct_size - int64_t(data_size)));
+}
+
 static void modifier_copy_data_id_us_cb(void * /*user_data*/,
                                         Object * /*ob*/,
                                         ID **idpoin,
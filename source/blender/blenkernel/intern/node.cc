@@ -117,7 +117,6 @@ using blender::VectorSet;
 using blender::bke::bNodeRuntime;
 using blender::bke::bNodeSocketRuntime;
 using blender::bke::bNodeTreeRuntime;
-using blender::nodes::FieldInferencingInterface;
 using blender::nodes::InputSocketFieldType;
 using blender::nodes::NodeDeclaration;
 using blender::nodes::OutputFieldDependency;
@@ -223,10 +222,7 @@ static void ntree_copy_data(Main * /*bmain*/,
     ntree_dst->previews = nullptr;
   }
 
-  if (ntree_src->runtime->field_inferencing_interface) {
-    dst_runtime.field_inferencing_interface = std::make_unique<FieldInferencingInterface>(
-        *ntree_src->runtime->field_inferencing_interface);
-  }
+  dst_runtime.field_inferencing_interface = ntree_src->runtime->field_inferencing_interface;
   if (ntree_src->runtime->reference_lifetimes_info) {
     using namespace node_tree_reference_lifetimes;
     dst_runtime.reference_lifetimes_info = std::make_unique<ReferenceLifetimesInfo>(
@@ -2108,6 +2108,16 @@ void BKE_sculptsession_free_pbvh(Object &object)
   ss->clear_active_vert(false);
 }
 
+void BKE_sculptsession_release_pbvh(Object &object)
+{
+  using namespace blender;
+  SculptSession *ss = object.sculpt;
+  if (ss && ss->pbvh && ss->pbvh->type() == bke::pbvh::Type::Mesh) {
+    bke::pbvh::keep_for_reuse(*BKE_object_get_original_mesh(&object), std::move(ss->pbvh));
+  }
+  BKE_sculptsession_free_pbvh(object);
+}
+
 void BKE_sculptsession_bm_to_me_for_render(Object *object)
 {
   if (object && object->sculpt) {
@@ -2522,7 +2532,7 @@ void BKE_sculpt_update_object_before_eval(Object *ob_eval)
     /* We free pbvh on changes, except in the middle of drawing a stroke
      * since it can't deal with changing PVBH node organization, we hope
      * topology does not change in the meantime .. weak. */
-    BKE_sculptsession_free_pbvh(*ob_orig);
+    BKE_sculptsession_release_pbvh(*ob_orig);
 
     BKE_sculptsession_free_deformMats(ss);
 
@@ -2774,7 +2784,10 @@ static std::unique_ptr<pbvh::Tree> build_pbvh_from_regular_mesh(Object *ob,
                                                                 const Mesh *me_eval_deform)
 {
   const Mesh &mesh = *BKE_object_get_original_mesh(ob);
-  std::unique_ptr<pbvh::Tree> pbvh = std::make_unique<pbvh::Tree>(pbvh::Tree::from_mesh(mesh));
+  std::unique_ptr<pbvh::Tree> pbvh = pbvh::take_kept_for_reuse(mesh);
+  if (!pbvh) {
+    pbvh = std::make_unique<pbvh::Tree>(pbvh::Tree::from_mesh(mesh));
+  }
 
   const bool is_deformed = check_sculpt_object_deformed(ob, true);
   if (is_deformed && me_eval_deform != nullptr) {
@@ -43,6 +43,7 @@
 #include "BLI_math_vector.h"
 #include "BLI_rand.h"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_utildefines.h"
 
@@ -2780,21 +2781,12 @@ static bool psys_thread_context_init_path(ParticleThreadContext *ctx,
   return true;
 }
 
-static void psys_task_init_path(ParticleTask *task, ParticleSimulationData *sim)
-{
-  /* init random number generator */
-  int seed = 31415926 + sim->psys->seed;
-
-  task->rng_path = BLI_rng_new(seed);
-}
-
 /* NOTE: this function must be thread safe, except for branching! */
-static void psys_thread_create_path(ParticleTask *task,
+static void psys_thread_create_path(ParticleThreadContext *ctx,
                                     ChildParticle *cpa,
                                     ParticleCacheKey *child_keys,
                                     int i)
 {
-  ParticleThreadContext *ctx = task->ctx;
   Object *ob = ctx->sim.ob;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleSettings *part = psys->part;
@@ -3129,19 +3121,14 @@ static void psys_thread_create_path(ParticleTask *task,
   }
 }
 
-static void exec_child_path_cache(TaskPool *__restrict /*pool*/, void *taskdata)
+static void exec_child_path_cache(ParticleThreadContext *ctx, const blender::IndexRange range)
 {
-  ParticleTask *task = static_cast<ParticleTask *>(taskdata);
-  ParticleThreadContext *ctx = task->ctx;
   ParticleSystem *psys = ctx->sim.psys;
   ParticleCacheKey **cache = psys->childcache;
-  ChildParticle *cpa;
-  int i;
 
-  cpa = psys->child + task->begin;
-  for (i = task->begin; i < task->end; i++, cpa++) {
+  for (const int i : range) {
     BLI_assert(i < psys->totchildcache);
-    psys_thread_create_path(task, cpa, cache[i], i);
+    psys_thread_create_path(ctx, &psys->child[i], cache[i], i);
   }
 }
 
@@ -3150,22 +3137,17 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
                             const bool editupdate,
                             const bool use_render_params)
 {
-  TaskPool *task_pool;
   ParticleThreadContext ctx;
-  ParticleTask *tasks_parent, *tasks_child;
-  int numtasks_parent, numtasks_child;
-  int i, totchild, totparent;
+  int totchild, totparent;
 
   if (sim->psys->flag & PSYS_GLOBAL_HAIR) {
     return;
   }
 
-  /* create a task pool for child path tasks */
   if (!psys_thread_context_init_path(&ctx, sim, sim->scene, cfra, editupdate, use_render_params)) {
     return;
   }
 
-  task_pool = BLI_task_pool_create(&ctx, TASK_PRIORITY_HIGH);
   totchild = ctx.totchild;
   totparent = ctx.totparent;
 
@@ -3181,32 +3163,23 @@ void psys_cache_child_paths(ParticleSimulationData *sim,
     sim->psys->totchildcache = totchild;
   }
 
+  /* The cost of a path varies a lot with kink, clumping and roughness settings, so use small
+   * ranges to let the scheduler balance the work between threads. */
+  const int grain_size = 64;
+
   /* cache parent paths */
   ctx.parent_pass = 1;
-  psys_tasks_create(&ctx, 0, totparent, &tasks_parent, &numtasks_parent);
-  for (i = 0; i < numtasks_parent; i++) {
-    ParticleTask *task = &tasks_parent[i];
-
-    psys_task_init_path(task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
+  blender::threading::parallel_for(
+      blender::IndexRange(totparent), grain_size, [&](const blender::IndexRange range) {
+        exec_child_path_cache(&ctx, range);
+      });
 
   /* cache child paths */
   ctx.parent_pass = 0;
-  psys_tasks_create(&ctx, totparent, totchild, &tasks_child, &numtasks_child);
-  for (i = 0; i < numtasks_child; i++) {
-    ParticleTask *task = &tasks_child[i];
-
-    psys_task_init_path(task, sim);
-    BLI_task_pool_push(task_pool, exec_child_path_cache, task, false, nullptr);
-  }
-  BLI_task_pool_work_and_wait(task_pool);
-
-  BLI_task_pool_free(task_pool);
-
-  psys_tasks_free(tasks_parent, numtasks_parent);
-  psys_tasks_free(tasks_child, numtasks_child);
+  blender::threading::parallel_for(
+      blender::IndexRange::from_begin_end(totparent, totchild),
+      grain_size,
+      [&](const blender::IndexRange range) { exec_child_path_cache(&ctx, range); });
 
   psys_thread_context_free(&ctx);
 }
@@ -484,9 +484,6 @@ void psys_tasks_free(ParticleTask *tasks, int numtasks)
     if (tasks[i].rng) {
       BLI_rng_free(tasks[i].rng);
     }
-    if (tasks[i].rng_path) {
-      BLI_rng_free(tasks[i].rng_path);
-    }
   }
 
   MEM_freeN(tasks);
@@ -76,6 +76,94 @@ static int partition_along_axis(const Span<float3> face_centers,
   return split - faces.begin();
 }
 
+/** Number of buckets used to evaluate the surface area heuristic along the split axis. */
+static constexpr int sah_buckets_num = 16;
+
+struct SAHBucket {
+  Bounds<float3> bounds = negative_bounds();
+  int count = 0;
+};
+
+static float bounds_half_area(const Bounds<float3> &bounds)
+{
+  const float3 size = bounds.max - bounds.min;
+  return size.x * size.y + size.y * size.z + size.z * size.x;
+}
+
+/**
+ * Find the split position along the axis with the lowest surface area heuristic cost. The face
+ * centers are sorted into buckets, and the cost of a child is approximated with the bounds of the
+ * face centers it contains, since the face bounds aren't stored. Falls back to the middle of the
+ * bounds when there is no split with faces on both sides.
+ */
+static float sah_split_position(const Span<float3> face_centers,
+                                const Span<int> faces,
+                                const int axis,
+                                const Bounds<float3> &bounds)
+{
+  const float middle = math::midpoint(bounds.min[axis], bounds.max[axis]);
+  const float extent = bounds.max[axis] - bounds.min[axis];
+  if (!(extent > 0.0f)) {
+    return middle;
+  }
+  const float scale = sah_buckets_num / extent;
+  const auto bucket_index = [&](const float3 &center) {
+    return std::clamp(int((center[axis] - bounds.min[axis]) * scale), 0, sah_buckets_num - 1);
+  };
+
+  using Buckets = std::array<SAHBucket, sah_buckets_num>;
+  const Buckets buckets = threading::parallel_reduce(
+      faces.index_range(),
+      1024,
+      Buckets(),
+      [&](const IndexRange range, Buckets value) {
+        for (const int face : faces.slice(range)) {
+          const float3 &center = face_centers[face];
+          SAHBucket &bucket = value[bucket_index(center)];
+          math::min_max(center, bucket.bounds.min, bucket.bounds.max);
+          bucket.count++;
+        }
+        return value;
+      },
+      [](const Buckets &a, const Buckets &b) {
+        Buckets result;
+        for (const int i : IndexRange(sah_buckets_num)) {
+          result[i].bounds = bounds::merge(a[i].bounds, b[i].bounds);
+          result[i].count = a[i].count + b[i].count;
+        }
+        return result;
+      });
+
+  /* The cost of the faces above each bucket boundary, accumulated from the top. */
+  std::array<float, sah_buckets_num> cost_above;
+  SAHBucket above;
+  for (int i = sah_buckets_num - 1; i > 0; i--) {
+    above.bounds = bounds::merge(above.bounds, buckets[i].bounds);
+    above.count += buckets[i].count;
+    cost_above[i] = above.count == 0 ? 0.0f : bounds_half_area(above.bounds) * above.count;
+  }
+
+  int best_split = -1;
+  float best_cost = std::numeric_limits<float>::max();
+  SAHBucket below;
+  for (const int i : IndexRange(1, sah_buckets_num - 1)) {
+    below.bounds = bounds::merge(below.bounds, buckets[i - 1].bounds);
+    below.count += buckets[i - 1].count;
+    if (below.count == 0 || below.count == faces.size()) {
+      continue;
+    }
+    const float cost = bounds_half_area(below.bounds) * below.count + cost_above[i];
+    if (cost < best_cost) {
+      best_cost = cost;
+      best_split = i;
+    }
+  }
+  if (best_split == -1) {
+    return middle;
+  }
+  return bounds.min[axis] + best_split / scale;
+}
+
 static int partition_material_indices(const Span<int> material_indices, MutableSpan<int> faces)
 {
   const int first = material_indices[faces.first()];
@@ -194,7 +282,7 @@ static void build_nodes_recursive_mesh(const Span<int> material_indices,
 
     /* Partition primitives along that axis */
     split = partition_along_axis(
-        face_centers, faces, axis, math::midpoint(bounds.min[axis], bounds.max[axis]));
+        face_centers, faces, axis, sah_split_position(face_centers, faces, axis, bounds));
   }
   else {
     /* Partition primitives by material */
@@ -236,6 +324,7 @@ Tree Tree::from_mesh(const Mesh &mesh)
   SCOPED_TIMER_AVERAGED(__func__);
 #endif
   Tree pbvh(Type::Mesh);
+  pbvh.mesh_topology_version_ = mesh.runtime->topology_version;
   const Span<float3> vert_positions = mesh.vert_positions();
   const OffsetIndices<int> faces = mesh.faces();
   const Span<int> corner_verts = mesh.corner_verts();
@@ -347,7 +436,7 @@ static void build_nodes_recursive_grids(const Span<int> material_indices,
 
     /* Partition primitives along that axis */
     split = partition_along_axis(
-        face_centers, faces, axis, math::midpoint(bounds.min[axis], bounds.max[axis]));
+        face_centers, faces, axis, sah_split_position(face_centers, faces, axis, bounds));
   }
   else {
     /* Partition primitives by material */
@@ -545,6 +634,86 @@ Tree::~Tree()
   pixels_free(this);
 }
 
+void keep_for_reuse(const Mesh &mesh, std::unique_ptr<Tree> pbvh)
+{
+  BLI_assert(pbvh->type() == Type::Mesh);
+  pbvh->draw_data.reset();
+  pixels_free(pbvh.get());
+  for (MeshNode &node : pbvh->nodes<MeshNode>()) {
+    node_pixels_free(&node);
+    /* Other flags are recomputed when the tree is reused. */
+    node.flag_ = (node.flag_ & PBVH_Leaf) | PBVH_UpdateRedraw;
+  }
+  pbvh->bounds_dirty_.clear_and_shrink();
+  pbvh->normals_dirty_.clear_and_shrink();
+  pbvh->visibility_dirty_.clear_and_shrink();
+  mesh.runtime->pbvh_for_reuse = std::move(pbvh);
+}
+
+static bool kept_tree_matches_mesh(const Tree &pbvh, const Mesh &mesh)
+{
+  if (pbvh.mesh_topology_version_ != mesh.runtime->topology_version) {
+    return false;
+  }
+  const Span<MeshNode> nodes = pbvh.nodes<MeshNode>();
+  if (nodes.is_empty() != (mesh.faces_num == 0)) {
+    return false;
+  }
+  /* Leaf nodes are built with a single material, that is expected when drawing. */
+  const AttributeAccessor attributes = mesh.attributes();
+  const VArraySpan material_index = *attributes.lookup<int>("material_index", AttrDomain::Face);
+  if (material_index.is_empty()) {
+    return true;
+  }
+  return !threading::parallel_reduce(
+      nodes.index_range(),
+      8,
+      false,
+      [&](const IndexRange range, bool needs_split) {
+        for (const int i : range) {
+          if (needs_split) {
+            break;
+          }
+          const MeshNode &node = nodes[i];
+          needs_split = (node.flag_ & PBVH_Leaf) && !node.faces().is_empty() &&
+                        leaf_needs_material_split(node.faces(), material_index);
+        }
+        return needs_split;
+      },
+      std::logical_or());
+}
+
+std::unique_ptr<Tree> take_kept_for_reuse(const Mesh &mesh)
+{
+  std::unique_ptr<Tree> pbvh = std::move(mesh.runtime->pbvh_for_reuse);
+  if (!pbvh || !kept_tree_matches_mesh(*pbvh, mesh)) {
+    return nullptr;
+  }
+  MutableSpan<MeshNode> nodes = pbvh->nodes<MeshNode>();
+  if (nodes.is_empty()) {
+    return pbvh;
+  }
+
+  /* Only the topology is the same, everything else may have changed in the meantime. */
+  pbvh->tag_positions_changed(nodes.index_range());
+  update_bounds_mesh(mesh.vert_positions(), *pbvh);
+  store_bounds_orig(*pbvh);
+
+  const AttributeAccessor attributes = mesh.attributes();
+  const VArraySpan hide_vert = *attributes.lookup<bool>(".hide_vert", AttrDomain::Point);
+  if (!hide_vert.is_empty()) {
+    threading::parallel_for(nodes.index_range(), 8, [&](const IndexRange range) {
+      for (const int i : range) {
+        node_update_visibility_mesh(hide_vert, nodes[i]);
+      }
+    });
+  }
+
+  update_mask_mesh(mesh, nodes.index_range(), *pbvh);
+
+  return pbvh;
+}
+
 void Tree::tag_positions_changed(const IndexMask &node_mask)
 {
   this->bounds_dirty_.resize(std::max(this->bounds_dirty_.size(), node_mask.min_array_size()),
@@ -16,6 +16,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_memarena.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_time.h"
 #include "BLI_utildefines.h"
 
@@ -969,54 +970,75 @@ static void short_edge_queue_edge_add(EdgeQueueContext *eq_ctx, BMEdge *e)
   }
 }
 
-static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+static bool edge_queue_face_in_range(const EdgeQueue *q, BMFace *f)
 {
 #ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  if (q->use_view_normal) {
+    if (dot_v3v3(f->no, q->view_normal) < 0.0f) {
+      return false;
     }
   }
 #endif
+  return q->edge_queue_tri_in_range(q, f);
+}
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    /* Check each edge of the face. */
-    BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
-    BMLoop *l_iter = l_first;
-    do {
-#ifdef USE_EDGEQUEUE_EVEN_SUBDIV
-      const float len_sq = BM_edge_calc_length_squared(l_iter->e);
-      if (len_sq > eq_ctx->q->limit_len_squared) {
-        long_edge_queue_edge_add_recursive(
-            eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
+/**
+ * Find the faces in range of the brush in the leaf nodes marked for topology update. The tests
+ * only read the mesh, so all nodes are checked in parallel. Adding the edges to the queue stays
+ * single threaded, the faces are returned in the same order as before so the result is the same.
+ */
+static Array<Vector<BMFace *>> edge_queue_faces_in_range(const EdgeQueue *q,
+                                                         const Span<BMeshNode> nodes)
+{
+  Array<Vector<BMFace *>> faces_by_node(nodes.size());
+  threading::parallel_for(nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      const BMeshNode &node = nodes[i];
+      if (!(node.flag_ & PBVH_Leaf) || !(node.flag_ & PBVH_UpdateTopology) ||
+          (node.flag_ & PBVH_FullyHidden))
+      {
+        continue;
       }
-#else
-      long_edge_queue_edge_add(eq_ctx, l_iter->e);
-#endif
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+      for (BMFace *f : node.bm_faces_) {
+        if (edge_queue_face_in_range(q, f)) {
+          faces_by_node[i].append(f);
+        }
+      }
+    }
+  });
+  return faces_by_node;
 }
 
-static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+/** Add the long edges of a face that is in range, see #edge_queue_face_in_range. */
+static void long_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
 {
-#ifdef USE_EDGEQUEUE_FRONTFACE
-  if (eq_ctx->q->use_view_normal) {
-    if (dot_v3v3(f->no, eq_ctx->q->view_normal) < 0.0f) {
-      return;
+  /* Check each edge of the face. */
+  BMLoop *l_first = BM_FACE_FIRST_LOOP(f);
+  BMLoop *l_iter = l_first;
+  do {
+#ifdef USE_EDGEQUEUE_EVEN_SUBDIV
+    const float len_sq = BM_edge_calc_length_squared(l_iter->e);
+    if (len_sq > eq_ctx->q->limit_len_squared) {
+      long_edge_queue_edge_add_recursive(
+          eq_ctx, l_iter->radial_next, l_iter, len_sq, eq_ctx->q->limit_len);
     }
-  }
+#else
+    long_edge_queue_edge_add(eq_ctx, l_iter->e);
 #endif
+  } while ((l_iter = l_iter->next) != l_first);
+}
 
-  if (eq_ctx->q->edge_queue_tri_in_range(eq_ctx->q, f)) {
-    BMLoop *l_iter;
-    BMLoop *l_first;
+/** Add the short edges of a face that is in range, see #edge_queue_face_in_range. */
+static void short_edge_queue_face_add(EdgeQueueContext *eq_ctx, BMFace *f)
+{
+  BMLoop *l_iter;
+  BMLoop *l_first;
 
-    /* Check each edge of the face. */
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      short_edge_queue_edge_add(eq_ctx, l_iter->e);
-    } while ((l_iter = l_iter->next) != l_first);
-  }
+  /* Check each edge of the face. */
+  l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+  do {
+    short_edge_queue_edge_add(eq_ctx, l_iter->e);
+  } while ((l_iter = l_iter->next) != l_first);
 }
 
 /**
@@ -1066,14 +1088,9 @@ static void long_edge_queue_create(EdgeQueueContext *eq_ctx,
   pbvh_bmesh_edge_tag_verify(pbvh);
 #endif
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update. */
-    if ((node.flag_ & PBVH_Leaf) && (node.flag_ & PBVH_UpdateTopology) &&
-        !(node.flag_ & PBVH_FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        long_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Span<BMFace *> faces : edge_queue_faces_in_range(eq_ctx->q, nodes)) {
+    for (BMFace *f : faces) {
+      long_edge_queue_face_add(eq_ctx, f);
     }
   }
 }
@@ -1121,14 +1138,9 @@ static void short_edge_queue_create(EdgeQueueContext *eq_ctx,
     eq_ctx->q->edge_queue_tri_in_range = edge_queue_tri_in_sphere;
   }
 
-  for (BMeshNode &node : nodes) {
-    /* Check leaf nodes marked for topology update */
-    if ((node.flag_ & PBVH_Leaf) && (node.flag_ & PBVH_UpdateTopology) &&
-        !(node.flag_ & PBVH_FullyHidden))
-    {
-      for (BMFace *f : node.bm_faces_) {
-        short_edge_queue_face_add(eq_ctx, f);
-      }
+  for (const Span<BMFace *> faces : edge_queue_faces_in_range(eq_ctx->q, nodes)) {
+    for (BMFace *f : faces) {
+      short_edge_queue_face_add(eq_ctx, f);
     }
   }
 }
@@ -6,12 +6,15 @@
  * \ingroup bke
  */
 
+#include <mutex>
+
 #include "BKE_subdiv.hh"
 
 #include "DNA_mesh_types.h"
 #include "DNA_modifier_types.h"
 
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_subdiv_modifier.hh"
 
@@ -37,8 +40,11 @@ void init()
   openSubdiv_init();
 }
 
+static void free_kept_for_reuse();
+
 void exit()
 {
+  free_kept_for_reuse();
   openSubdiv_cleanup();
 }
 
@@ -144,6 +150,137 @@ Subdiv *new_from_mesh(const Settings *settings, const Mesh *mesh)
 
 /* Creation with cached-aware semantic. */
 
+/* Descriptors released by their owners, the most recently released ones are at the end. Since
+ * the topology refiners can be large, the pool is limited by their estimated memory usage. */
+static constexpr int64_t reuse_pool_max_bytes = 256 * 1024 * 1024;
+
+struct KeptSubdiv {
+  Subdiv *subdiv;
+  int64_t estimated_bytes;
+};
+
+struct ReusePool {
+  std::mutex mutex;
+  Vector<KeptSubdiv> descriptors;
+  int64_t estimated_bytes = 0;
+};
+
+static ReusePool &reuse_pool()
+{
+  static ReusePool pool;
+  return pool;
+}
+
+#ifdef WITH_OPENSUBDIV
+/* Rough estimate of the memory used by the topology refiner and the evaluator, whose stencil and
+ * patch tables grow with the number of refined elements as well. */
+static int64_t estimate_memory(const Subdiv &subdiv)
+{
+  constexpr int64_t bytes_per_element = 64;
+  const OpenSubdiv::Far::TopologyRefiner &refiner = *subdiv.topology_refiner->topology_refiner;
+  const int64_t elements_num = int64_t(refiner.GetNumVerticesTotal()) +
+                               refiner.GetNumEdgesTotal() + refiner.GetNumFacesTotal() +
+                               refiner.GetNumFaceVerticesTotal();
+  return elements_num * bytes_per_element;
+}
+
+static void keep_for_reuse(Subdiv *subdiv)
+{
+  const int64_t estimated_bytes = estimate_memory(*subdiv);
+  if (estimated_bytes > reuse_pool_max_bytes) {
+    free(subdiv);
+    return;
+  }
+  Vector<Subdiv *> subdivs_to_free;
+  {
+    ReusePool &pool = reuse_pool();
+    std::lock_guard lock{pool.mutex};
+    pool.descriptors.append({subdiv, estimated_bytes});
+    pool.estimated_bytes += estimated_bytes;
+    /* Remove the least recently released descriptors. */
+    int remove_num = 0;
+    while (pool.estimated_bytes > reuse_pool_max_bytes) {
+      const KeptSubdiv &kept = pool.descriptors[remove_num++];
+      pool.estimated_bytes -= kept.estimated_bytes;
+      subdivs_to_free.append(kept.subdiv);
+    }
+    pool.descriptors.remove(0, remove_num);
+  }
+  /* Freeing can take a while, so it is done without holding the lock. */
+  for (Subdiv *subdiv_to_free : subdivs_to_free) {
+    free(subdiv_to_free);
+  }
+}
+
+static Subdiv *take_kept_for_reuse(const Settings *settings, OpenSubdiv_Converter *converter)
+{
+  ReusePool &pool = reuse_pool();
+  Subdiv *result = nullptr;
+  Vector<Subdiv *> rejected;
+  while (result == nullptr) {
+    /* Take the most recently released candidate out of the pool, so that its topology can be
+     * compared without holding the lock. */
+    Subdiv *candidate = nullptr;
+    {
+      std::lock_guard lock{pool.mutex};
+      for (int i = pool.descriptors.size() - 1; i >= 0; i--) {
+        const KeptSubdiv &kept = pool.descriptors[i];
+        if (settings_equal(&kept.subdiv->settings, settings)) {
+          candidate = kept.subdiv;
+          pool.estimated_bytes -= kept.estimated_bytes;
+          pool.descriptors.remove(i);
+          break;
+        }
+      }
+    }
+    if (candidate == nullptr) {
+      break;
+    }
+    /* Cheap when the topology differs, the element counts are compared first. */
+    if (candidate->topology_refiner->isEqualToConverter(converter)) {
+      result = candidate;
+    }
+    else {
+      rejected.append(candidate);
+    }
+  }
+  for (Subdiv *subdiv : rejected) {
+    keep_for_reuse(subdiv);
+  }
+  return result;
+}
+#endif
+
+void free_or_keep_for_reuse(Subdiv *subdiv)
+{
+#ifdef WITH_OPENSUBDIV
+  /* GPU evaluators are owned by the draw code, and there is nothing to reuse without topology. */
+  const bool can_reuse = subdiv->topology_refiner != nullptr &&
+                         (subdiv->evaluator == nullptr ||
+                          subdiv->evaluator->type == OPENSUBDIV_EVALUATOR_CPU);
+  if (!can_reuse) {
+    free(subdiv);
+    return;
+  }
+  /* The displacement refers to data of the previous owner. */
+  displacement_detach(subdiv);
+  keep_for_reuse(subdiv);
+#else
+  free(subdiv);
+#endif
+}
+
+static void free_kept_for_reuse()
+{
+  ReusePool &pool = reuse_pool();
+  std::lock_guard lock{pool.mutex};
+  for (const KeptSubdiv &kept : pool.descriptors) {
+    free(kept.subdiv);
+  }
+  pool.descriptors.clear_and_shrink();
+  pool.estimated_bytes = 0;
+}
+
 Subdiv *update_from_converter(Subdiv *subdiv,
                               const Settings *settings,
                               OpenSubdiv_Converter *converter)
@@ -171,6 +308,9 @@ Subdiv *update_from_converter(Subdiv *subdiv,
   if (subdiv != nullptr) {
     free(subdiv);
   }
+  if (Subdiv *kept_subdiv = take_kept_for_reuse(settings, converter)) {
+    return kept_subdiv;
+  }
   return new_from_converter(settings, converter);
 #else
   UNUSED_VARS(subdiv, settings, converter);
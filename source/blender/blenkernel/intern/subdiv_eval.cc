@@ -381,4 +381,21 @@ void eval_final_point(
   }
 }
 
+/* --------------------------------------------------------------------
+ * Batched queries.
+ */
+
+void eval_limit_points(Subdiv *subdiv,
+                       const Span<OpenSubdiv_PatchCoord> patch_coords,
+                       MutableSpan<float3> r_P)
+{
+  BLI_assert(patch_coords.size() == r_P.size());
+  subdiv->evaluator->evaluatePatchesLimit(subdiv->evaluator,
+                                          patch_coords.data(),
+                                          patch_coords.size(),
+                                          reinterpret_cast<float *>(r_P.data()),
+                                          nullptr,
+                                          nullptr);
+}
+
 }  // namespace blender::bke::subdiv
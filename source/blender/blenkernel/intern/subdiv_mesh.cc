@@ -16,6 +16,7 @@
 #include "BLI_math_vector.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_task.hh"
+#include "BLI_vector.hh"
 
 #include "BKE_attribute_math.hh"
 #include "BKE_customdata.hh"
@@ -29,6 +30,8 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "opensubdiv_capi_type.hh"
+
 namespace blender::bke::subdiv {
 
 /* -------------------------------------------------------------------- */
@@ -79,6 +82,13 @@ struct SubdivMeshContext {
   int *accumulated_counters;
   bool have_displacement;
 
+  /**
+   * Without displacement the limit positions of inner vertices are evaluated in batches after the
+   * traversal, which is much cheaper than evaluating every vertex separately. Vertices that are
+   * not inner vertices have a negative ptex face index.
+   */
+  Array<OpenSubdiv_PatchCoord> inner_vert_patch_coords;
+
   /* Write optimal display edge tags into a boolean array rather than the final bit vector
    * to avoid race conditions when setting bits. */
   Array<bool> subdiv_display_edges;
@@ -585,6 +595,10 @@ static bool subdiv_mesh_topology_info(const ForeachContext *foreach_context,
 
   subdiv_mesh_ctx_cache_custom_data_layers(subdiv_context);
   subdiv_mesh_prepare_accumulator(subdiv_context, num_vertices);
+  if (!subdiv_context->have_displacement) {
+    subdiv_context->inner_vert_patch_coords.reinitialize(num_vertices);
+    subdiv_context->inner_vert_patch_coords.fill({-1, 0.0f, 0.0f});
+  }
   subdiv_mesh.runtime->subsurf_face_dot_tags.clear();
   subdiv_mesh.runtime->subsurf_face_dot_tags.resize(num_vertices);
   if (subdiv_context->settings->use_optimal_display) {
@@ -832,11 +846,47 @@ static void subdiv_mesh_vertex_inner(const ForeachContext *foreach_context,
   float3 &subdiv_position = ctx->subdiv_positions[subdiv_vertex_index];
   subdiv_mesh_ensure_vertex_interpolation(ctx, tls, coarse_face_index, coarse_corner);
   subdiv_vertex_data_interpolate(ctx, subdiv_vertex_index, &tls->vertex_interpolation, u, v);
-  eval_final_point(subdiv, ptex_face_index, u, v, subdiv_position);
+  if (ctx->have_displacement) {
+    eval_final_point(subdiv, ptex_face_index, u, v, subdiv_position);
+  }
+  else {
+    ctx->inner_vert_patch_coords[subdiv_vertex_index] = {ptex_face_index, u, v};
+  }
   subdiv_mesh_tag_center_vertex(coarse_face, subdiv_vertex_index, u, v, subdiv_mesh);
   subdiv_vertex_orco_evaluate(ctx, ptex_face_index, u, v, subdiv_vertex_index);
 }
 
+static void subdiv_mesh_evaluate_inner_vertices(SubdivMeshContext *ctx)
+{
+  const Span<OpenSubdiv_PatchCoord> patch_coords = ctx->inner_vert_patch_coords;
+  threading::parallel_for(patch_coords.index_range(), 4096, [&](const IndexRange range) {
+    const Span<OpenSubdiv_PatchCoord> range_coords = patch_coords.slice(range);
+    Vector<int> verts;
+    for (const int i : range) {
+      if (patch_coords[i].ptex_face >= 0) {
+        verts.append(i);
+      }
+    }
+    if (verts.size() == range.size()) {
+      /* Inner vertices are stored after the corner and edge vertices, this is the common case. */
+      eval_limit_points(ctx->subdiv, range_coords, ctx->subdiv_positions.slice(range));
+      return;
+    }
+    if (verts.is_empty()) {
+      return;
+    }
+    Array<OpenSubdiv_PatchCoord> coords(verts.size());
+    for (const int i : verts.index_range()) {
+      coords[i] = patch_coords[verts[i]];
+    }
+    Array<float3> positions(verts.size());
+    eval_limit_points(ctx->subdiv, coords, positions);
+    for (const int i : verts.index_range()) {
+      ctx->subdiv_positions[verts[i]] = positions[i];
+    }
+  });
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1201,6 +1251,9 @@ Mesh *subdiv_to_mesh(Subdiv *subdiv, const ToMeshSettings *settings, const Mesh
   foreach_context.user_data_tls_size = sizeof(SubdivMeshTLS);
   foreach_context.user_data_tls = &tls;
   foreach_subdiv_geometry(subdiv, &foreach_context, settings, coarse_mesh);
+  if (!subdiv_context.inner_vert_patch_coords.is_empty()) {
+    subdiv_mesh_evaluate_inner_vertices(&subdiv_context);
+  }
   stats_end(&subdiv->stats, SUBDIV_STATS_SUBDIV_TO_MESH_GEOMETRY);
   Mesh *result = subdiv_context.subdiv_mesh;
 
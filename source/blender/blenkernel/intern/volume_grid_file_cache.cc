@@ -171,6 +171,11 @@ class GridReadValue : public memory_cache::CachedValue {
     }
     memory.add(bytes_);
   }
+
+  StringRefNull category() const override
+  {
+    return "volume_grid";
+  }
 };
 
 /**
@@ -96,17 +96,35 @@ static void create_texture_to_object_matrix(const openvdb::Mat4d &grid_transform
 
 bool BKE_volume_grid_dense_floats(const Volume *volume,
                                   const blender::bke::VolumeGridData *volume_grid,
+                                  const int max_resolution,
                                   DenseFloatVolumeGrid *r_dense_grid)
 {
 #ifdef WITH_OPENVDB
   const VolumeGridType grid_type = volume_grid->grid_type();
   blender::bke::VolumeTreeAccessToken tree_token;
-  const openvdb::GridBase &grid = volume_grid->grid(tree_token);
+  const openvdb::GridBase *grid = &volume_grid->grid(tree_token);
 
-  const openvdb::CoordBBox bbox = grid.evalActiveVoxelBoundingBox();
+  openvdb::CoordBBox bbox = grid->evalActiveVoxelBoundingBox();
   if (bbox.empty()) {
     return false;
   }
+
+  /* Resample the grid when its bounding box is too large, instead of allocating dense voxels
+   * that could not be used anyway. */
+  openvdb::GridBase::Ptr resampled_grid;
+  const openvdb::Coord bbox_dim = bbox.dim();
+  const int max_dim = std::max({bbox_dim.x(), bbox_dim.y(), bbox_dim.z()});
+  if (max_resolution > 0 && max_dim > max_resolution) {
+    /* Leave a voxel of margin for the filter footprint of the resampling. */
+    const float resolution_factor = float(max_resolution - 1) / float(max_dim);
+    resampled_grid = BKE_volume_grid_create_with_changed_resolution(
+        grid_type, *grid, resolution_factor);
+    grid = resampled_grid.get();
+    bbox = grid->evalActiveVoxelBoundingBox();
+    if (bbox.empty()) {
+      return false;
+    }
+  }
   const std::array<int64_t, 6> bbox_indices = {UNPACK3(openvdb::math::Abs(bbox.min())),
                                                UNPACK3(openvdb::math::Abs(bbox.max()))};
   const int64_t max_bbox_index = *std::max_element(bbox_indices.begin(), bbox_indices.end());
@@ -126,8 +144,8 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
     return false;
   }
 
-  extract_dense_float_voxels(grid_type, grid, bbox, voxels);
-  create_texture_to_object_matrix(grid.transform().baseMap()->getAffineMap()->getMat4(),
+  extract_dense_float_voxels(grid_type, *grid, bbox, voxels);
+  create_texture_to_object_matrix(grid->transform().baseMap()->getAffineMap()->getMat4(),
                                   bbox,
                                   r_dense_grid->texture_to_object);
 
@@ -136,7 +154,7 @@ bool BKE_volume_grid_dense_floats(const Volume *volume,
   copy_v3_v3_int(r_dense_grid->resolution, resolution.asV());
   return true;
 #endif
-  UNUSED_VARS(volume, volume_grid, r_dense_grid);
+  UNUSED_VARS(volume, volume_grid, max_resolution, r_dense_grid);
   return false;
 }
 
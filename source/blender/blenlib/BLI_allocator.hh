@@ -51,6 +51,27 @@ class GuardedAllocator {
   }
 };
 
+/**
+ * Allocates from a #MEM_Arena, so that threads don't have to synchronize. Deallocating does
+ * nothing, the memory is only freed when the arena is cleared. Therefore this should only be used
+ * for containers whose size is bounded while the arena is not cleared.
+ */
+class ArenaAllocator {
+ private:
+  MEM_Arena *arena_ = nullptr;
+
+ public:
+  ArenaAllocator() = default;
+  ArenaAllocator(MEM_Arena *arena) : arena_(arena) {}
+
+  void *allocate(size_t size, size_t alignment, const char * /*name*/)
+  {
+    return MEM_arena_alloc(arena_, size, alignment);
+  }
+
+  void deallocate(void * /*ptr*/) {}
+};
+
 /**
  * This is a wrapper around malloc/free. Only use this when the GuardedAllocator cannot be
  * used. This can be the case when the allocated memory might live longer than Blender's
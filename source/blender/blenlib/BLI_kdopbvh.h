@@ -138,6 +138,19 @@ void BLI_bvhtree_free(BVHTree *tree);
  */
 void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoints);
 void BLI_bvhtree_balance(BVHTree *tree);
+/**
+ * Add \a leafs_num leafs at once, which must then be initialized with #BLI_bvhtree_set_leaf.
+ * This is equivalent to calling #BLI_bvhtree_insert for each of them, but allows filling the
+ * leafs from multiple threads.
+ */
+void BLI_bvhtree_add_leafs(BVHTree *tree, int leafs_num);
+/**
+ * Initialize a leaf added with #BLI_bvhtree_add_leafs. This can be called from multiple threads
+ * for different leafs.
+ * \param leaf_index: The position of the leaf in insertion order.
+ */
+void BLI_bvhtree_set_leaf(
+    BVHTree *tree, int leaf_index, int index, const float co[3], int numpoints);
 
 /**
  * Update: first update points/nodes, then call update_tree to refit the bounding volumes.
@@ -221,6 +234,22 @@ int BLI_bvhtree_find_nearest(const BVHTree *tree,
                              BVHTree_NearestPointCallback callback,
                              void *userdata);
 
+/**
+ * Same as #BLI_bvhtree_find_nearest, but the search is bounded by the element at \a hint_index
+ * from the start, which lets the traversal skip most of the tree right away when the hint is
+ * close. In a batch of coherent queries, the result of the previous query is a good hint.
+ *
+ * \param nearest: Must be initialized like for #BLI_bvhtree_find_nearest.
+ * \param hint_index: Element index passed to \a callback before the traversal, or -1.
+ * Ignored when there is no callback or \a nearest is null.
+ */
+int BLI_bvhtree_find_nearest_with_hint(const BVHTree *tree,
+                                       const float co[3],
+                                       BVHTreeNearest *nearest,
+                                       BVHTree_NearestPointCallback callback,
+                                       void *userdata,
+                                       int hint_index);
+
 /**
  * Find the first node nearby.
  * Favors speed over quality since it doesn't find the best target node.
@@ -246,6 +275,20 @@ int BLI_bvhtree_ray_cast(const BVHTree *tree,
                          BVHTreeRayHit *hit,
                          BVHTree_RayCastCallback callback,
                          void *userdata);
+/**
+ * Same as #BLI_bvhtree_ray_cast, but the hit distance is bounded by the element at
+ * \a hint_index from the start, see #BLI_bvhtree_find_nearest_with_hint.
+ *
+ * \param hint_index: Element index passed to \a callback before the traversal, or -1.
+ */
+int BLI_bvhtree_ray_cast_with_hint(const BVHTree *tree,
+                                   const float co[3],
+                                   const float dir[3],
+                                   float radius,
+                                   BVHTreeRayHit *hit,
+                                   BVHTree_RayCastCallback callback,
+                                   void *userdata,
+                                   int hint_index);
 
 /**
  * Calls the callback for every ray intersection
@@ -7,6 +7,7 @@
 #include "BLI_function_ref.hh"
 #include "BLI_generic_key.hh"
 #include "BLI_memory_counter_fwd.hh"
+#include "BLI_string_ref.hh"
 
 namespace blender::memory_cache {
 
@@ -23,13 +24,23 @@ class CachedValue {
    * full.
    */
   virtual void count_memory(MemoryCounter &memory) const = 0;
+
+  /**
+   * Values of the same category share the size limit set with #set_category_size_limit, in
+   * addition to the limit of the entire cache.
+   */
+  virtual StringRefNull category() const
+  {
+    return "";
+  }
 };
 
 /**
  * Returns the value that corresponds to the given key. If it's not cached yet, #compute_fn is
  * called and its result is cached for the next time.
  *
- * If the cache is full, older values may be freed.
+ * If the cache is full, values that have not been used in a while and that are cheap to recompute
+ * compared to their size are freed first. The time it takes to call #compute_fn is used as cost.
  */
 template<typename T>
 std::shared_ptr<const T> get(const GenericKey &key, FunctionRef<std::unique_ptr<T>()> compute_fn);
@@ -46,6 +57,12 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
  */
 void set_approximate_size_limit(int64_t limit_in_bytes);
 
+/**
+ * Set how much memory values of the given category are allowed to use, see
+ * #CachedValue::category. A limit of zero or less removes the limit of the category.
+ */
+void set_category_size_limit(StringRef category, int64_t limit_in_bytes);
+
 /**
  * Remove all elements from the cache. Note that this does not guarantee that no elements are in
  * the cache after the function returned. This is because another thread may have added a new
@@ -51,6 +51,11 @@ void BLI_mempool_clear(BLI_mempool *pool) ATTR_NONNULL(1);
  */
 void BLI_mempool_destroy(BLI_mempool *pool) ATTR_NONNULL(1);
 int BLI_mempool_len(const BLI_mempool *pool) ATTR_NONNULL(1);
+/**
+ * The number of elements that fit into the allocated chunks. Chunks are only freed when the pool
+ * becomes empty, so this stays larger than #BLI_mempool_len after elements have been freed.
+ */
+int BLI_mempool_capacity(const BLI_mempool *pool) ATTR_NONNULL(1);
 void *BLI_mempool_findelem(BLI_mempool *pool, unsigned int index) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1);
 
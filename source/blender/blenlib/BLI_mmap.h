@@ -35,6 +35,15 @@ bool BLI_mmap_read(BLI_mmap_file *file, void *dest, size_t offset, size_t length
 void *BLI_mmap_get_pointer(BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 size_t BLI_mmap_get_length(const BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT;
 
+/* Returns true when an IO error happened while accessing the mapped memory. The memory is
+ * replaced by zeroes in that case. */
+bool BLI_mmap_has_io_error(const BLI_mmap_file *file) ATTR_WARN_UNUSED_RESULT ATTR_NONNULL(1);
+
+/* Adds an owner to the mapping, so that memory returned by #BLI_mmap_get_pointer can outlive
+ * the original owner. Each owner has to call #BLI_mmap_free. */
+void BLI_mmap_add_user(BLI_mmap_file *file) ATTR_NONNULL(1);
+
+/* Removes an owner, the file is unmapped when the last owner is removed. */
 void BLI_mmap_free(BLI_mmap_file *file) ATTR_NONNULL(1);
 
 #ifdef __cplusplus
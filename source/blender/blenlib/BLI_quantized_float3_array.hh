@@ -0,0 +1,89 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Compact storage for large arrays of #float3 values that are only read, like the positions
+ * and normals of scanned or scattered data sets.
+ */
+
+#include <memory>
+
+#include "BLI_array.hh"
+#include "BLI_math_half.hh"
+#include "BLI_math_vector_types.hh"
+#include "BLI_virtual_array.hh"
+
+namespace blender {
+
+/**
+ * An array of #float3 that stores every component with 16 bits, which halves the memory usage
+ * compared to a regular array. The values are decoded on access, #as_varray gives a virtual array
+ * for code that doesn't know about the encoding.
+ */
+class QuantizedFloat3Array {
+ public:
+  enum class Encoding : int8_t {
+    /** Half floats, the precision is relative to the magnitude of every component. */
+    Half,
+    /**
+     * Fixed point values relative to the bounds of the data. The precision is uniform, the
+     * maximum error on every axis is about the size of the bounds divided by 2 * (2^16 - 1).
+     * Non-finite values aren't supported.
+     */
+    FixedPoint,
+  };
+
+ private:
+  Encoding encoding_ = Encoding::Half;
+  Array<ushort3> data_;
+  /** Decoding transform for #Encoding::FixedPoint. */
+  float3 offset_ = float3(0.0f);
+  float3 scale_ = float3(0.0f);
+
+ public:
+  QuantizedFloat3Array() = default;
+
+  static QuantizedFloat3Array encode(Span<float3> values, Encoding encoding);
+
+  int64_t size() const
+  {
+    return data_.size();
+  }
+
+  Encoding encoding() const
+  {
+    return encoding_;
+  }
+
+  float3 operator[](const int64_t index) const
+  {
+    const ushort3 &value = data_[index];
+    if (encoding_ == Encoding::Half) {
+      return float3(math::half_to_float(value.x),
+                    math::half_to_float(value.y),
+                    math::half_to_float(value.z));
+    }
+    return offset_ + float3(value) * scale_;
+  }
+
+  /** Decode the values at the indices in \a mask into the same indices of \a dst. */
+  void decode(const IndexMask &mask, MutableSpan<float3> dst) const;
+  /** Decode all values into \a dst. */
+  void decode(MutableSpan<float3> dst) const;
+
+  /** Approximate number of allocated bytes. */
+  int64_t size_in_bytes() const
+  {
+    return data_.as_span().size_in_bytes();
+  }
+
+  /** A virtual array that decodes the values on access and keeps the data alive. */
+  static VArray<float3> as_varray(std::shared_ptr<const QuantizedFloat3Array> array);
+};
+
+}  // namespace blender
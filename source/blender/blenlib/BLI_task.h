@@ -34,6 +34,13 @@ struct BLI_mempool;
 void BLI_task_scheduler_init(void);
 void BLI_task_scheduler_exit(void);
 int BLI_task_scheduler_num_threads(void);
+/**
+ * Create a separate task arena for every NUMA node, used by #threading::parallel_for_numa.
+ * Has to be called before #BLI_task_scheduler_init, has no effect on systems with a single node.
+ */
+void BLI_task_scheduler_use_numa_set(bool use_numa);
+/** Number of NUMA nodes that tasks are distributed over, 1 when NUMA arenas are not used. */
+int BLI_task_scheduler_numa_nodes_num(void);
 
 /** \} */
 
@@ -72,6 +72,9 @@ void parallel_for_impl(IndexRange range,
                        FunctionRef<void(IndexRange)> function,
                        const TaskSizeHints &size_hints);
 void memory_bandwidth_bound_task_impl(FunctionRef<void()> function);
+void parallel_for_numa_impl(IndexRange range,
+                            int64_t grain_size,
+                            FunctionRef<void(IndexRange)> function);
 }  // namespace detail
 
 /**
@@ -108,6 +111,30 @@ inline void parallel_for(const IndexRange range,
   detail::parallel_for_impl(range, grain_size, function, size_hints);
 }
 
+/**
+ * Same as #parallel_for, but when the task scheduler uses NUMA arenas (see
+ * #BLI_task_scheduler_use_numa_set), the range is split into one contiguous part per node which is
+ * only processed by threads of that node.
+ *
+ * The split only depends on the range, so when large arrays are initialized with this function,
+ * their memory is placed on the node that touched it first and later loops over the same range
+ * using this function stay local to that node.
+ */
+template<typename Function>
+inline void parallel_for_numa(const IndexRange range,
+                              const int64_t grain_size,
+                              const Function &function)
+{
+  if (range.is_empty()) {
+    return;
+  }
+  if (range.size() <= grain_size) {
+    function(range);
+    return;
+  }
+  detail::parallel_for_numa_impl(range, grain_size, function);
+}
+
 /**
  * Move the sub-range boundaries down to the next aligned index. The "global" begin and end
  * remain fixed though.
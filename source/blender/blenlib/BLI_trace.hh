@@ -0,0 +1,131 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup bli
+ *
+ * Process wide timeline of coarse zones (depsgraph evaluation, modifiers, drawing, rendering),
+ * so that stalls across subsystems can be found in a single trace. Recording is off by default
+ * and a disabled zone only costs an atomic load.
+ *
+ * The recorded events are exported in the Chrome trace event format, which can be opened with
+ * `chrome://tracing` or Perfetto. Subsystems with more detailed traces of their own (like the
+ * depsgraph) use the same format, so the files can be compared side by side.
+ */
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+#include "BLI_string_ref.hh"
+
+namespace blender::io::serialize {
+class ArrayValue;
+class DictionaryValue;
+}  // namespace blender::io::serialize
+
+namespace blender::trace {
+
+/**
+ * Small and stable index of the calling thread, starting at zero. Used to group events of a trace
+ * by thread.
+ */
+int current_thread_index();
+
+/**
+ * Builds a trace in the Chrome trace event format. Used by all traces in Blender, so that they can
+ * be opened with the same tools.
+ */
+class ChromeTraceWriter {
+ private:
+  std::unique_ptr<io::serialize::DictionaryValue> root_;
+  io::serialize::ArrayValue *events_;
+
+ public:
+  /** \param process_name: Shown as the name of the timeline in trace viewers. */
+  ChromeTraceWriter(StringRef process_name);
+  ~ChromeTraceWriter();
+
+  /**
+   * Add a complete event. Times are in seconds, relative to the start of the trace.
+   * \return The event, so that an `args` dictionary with more information can be appended.
+   */
+  io::serialize::DictionaryValue &add_event(StringRef name,
+                                            StringRef category,
+                                            int thread_index,
+                                            double start_time,
+                                            double end_time);
+
+  std::string to_json() const;
+};
+
+namespace detail {
+extern std::atomic<bool> is_recording;
+double zone_begin();
+void zone_end(const char *name, const char *category, double start_time);
+}  // namespace detail
+
+/**
+ * Start recording zones. Events of a previous recording are discarded. Must not be called while
+ * zones are being recorded on other threads.
+ */
+void begin();
+/** Stop recording, the recorded events stay available for #to_json. */
+void end();
+
+inline bool is_recording()
+{
+  return detail::is_recording.load(std::memory_order_relaxed);
+}
+
+/** Recorded events in the Chrome trace event format. */
+std::string to_json();
+
+/**
+ * Start recording, and remember the file that #write_exit_file writes the trace to when the
+ * process exits. Used by the `--debug-trace` command line argument.
+ */
+void begin_with_exit_file(const char *filepath);
+/** Write the trace to the file passed to #begin_with_exit_file, if any. */
+void write_exit_file();
+
+/**
+ * Records the time between construction and destruction as a zone on the calling thread. The name
+ * and category have to be static strings, they are not copied.
+ */
+class ScopedZone {
+ private:
+  const char *name_;
+  const char *category_;
+  double start_time_ = -1.0;
+
+ public:
+  ScopedZone(const char *name, const char *category) : name_(name), category_(category)
+  {
+    if (is_recording()) {
+      start_time_ = detail::zone_begin();
+    }
+  }
+
+  ~ScopedZone()
+  {
+    if (start_time_ >= 0.0) {
+      detail::zone_end(name_, category_, start_time_);
+    }
+  }
+
+  ScopedZone(const ScopedZone &other) = delete;
+  ScopedZone &operator=(const ScopedZone &other) = delete;
+};
+
+}  // namespace blender::trace
+
+#define BLI_TRACE_ZONE_CONCAT_(a, b) a##b
+#define BLI_TRACE_ZONE_CONCAT(a, b) BLI_TRACE_ZONE_CONCAT_(a, b)
+
+/** Record the rest of the current scope as a zone, see #blender::trace::ScopedZone. */
+#define BLI_TRACE_ZONE(name, category) \
+  const blender::trace::ScopedZone BLI_TRACE_ZONE_CONCAT(trace_zone_, __LINE__)(name, category)
@@ -55,6 +55,10 @@
 #  define KDOPBVH_THREAD_LEAF_THRESHOLD 1024
 #endif
 
+/* Refitting the bounds of the top level branches is done in parallel above this number of leafs,
+ * otherwise building trees with many leafs is dominated by refitting the root branches. */
+#define KDOPBVH_THREAD_REFIT_THRESHOLD 65536
+
 /* -------------------------------------------------------------------- */
 /** \name Struct Definitions
  * \{ */
@@ -370,20 +374,15 @@ static void create_kdop_hull(
   }
 }
 
-/**
- * \note depends on the fact that the BVH's for each face is already built
- */
-static void refit_kdop_hull(const BVHTree *tree, BVHNode *node, int start, int end)
+static void refit_kdop_hull_range(
+    const BVHTree *tree, float *__restrict bv, BVHNode **nodes, int start, int end)
 {
   float newmin, newmax;
-  float *__restrict bv = node->bv;
   int j;
   axis_t axis_iter;
 
-  node_minmax_init(tree, node);
-
   for (j = start; j < end; j++) {
-    const float *__restrict node_bv = tree->nodes[j]->bv;
+    const float *__restrict node_bv = nodes[j]->bv;
 
     /* for all Axes. */
     for (axis_iter = tree->start_axis; axis_iter < tree->stop_axis; axis_iter++) {
@@ -400,6 +399,77 @@ static void refit_kdop_hull(const BVHTree *tree, BVHNode *node, int start, int e
   }
 }
 
+typedef struct BVHRefitChunk {
+  float bv[26];
+} BVHRefitChunk;
+
+typedef struct BVHRefitData {
+  const BVHTree *tree;
+  int start;
+  int end;
+} BVHRefitData;
+
+/* Number of leafs handled by each parallel refit task. */
+#define KDOPBVH_REFIT_TASK_SIZE 4096
+
+static void refit_kdop_hull_task_cb(void *__restrict userdata,
+                                    const int task,
+                                    const TaskParallelTLS *__restrict tls)
+{
+  const BVHRefitData *data = userdata;
+  BVHRefitChunk *chunk = tls->userdata_chunk;
+  const int start = data->start + task * KDOPBVH_REFIT_TASK_SIZE;
+  const int end = min_ii(start + KDOPBVH_REFIT_TASK_SIZE, data->end);
+  refit_kdop_hull_range(data->tree, chunk->bv, data->tree->nodes, start, end);
+}
+
+static void refit_kdop_hull_reduce(const void *__restrict userdata,
+                                   void *__restrict chunk_join,
+                                   void *__restrict chunk)
+{
+  const BVHRefitData *data = userdata;
+  const BVHTree *tree = data->tree;
+  float *bv_join = ((BVHRefitChunk *)chunk_join)->bv;
+  const float *bv = ((const BVHRefitChunk *)chunk)->bv;
+  for (axis_t axis_iter = tree->start_axis; axis_iter < tree->stop_axis; axis_iter++) {
+    bv_join[2 * axis_iter] = min_ff(bv_join[2 * axis_iter], bv[2 * axis_iter]);
+    bv_join[2 * axis_iter + 1] = max_ff(bv_join[2 * axis_iter + 1], bv[2 * axis_iter + 1]);
+  }
+}
+
+/**
+ * \note depends on the fact that the BVH's for each face is already built
+ */
+static void refit_kdop_hull(const BVHTree *tree, BVHNode *node, int start, int end)
+{
+  node_minmax_init(tree, node);
+
+  if (end - start < KDOPBVH_THREAD_REFIT_THRESHOLD) {
+    refit_kdop_hull_range(tree, node->bv, tree->nodes, start, end);
+    return;
+  }
+
+  BVHRefitData data = {
+      .tree = tree,
+      .start = start,
+      .end = end,
+  };
+  BVHRefitChunk chunk;
+  memcpy(chunk.bv, node->bv, sizeof(float) * tree->axis);
+
+  TaskParallelSettings settings;
+  BLI_parallel_range_settings_defaults(&settings);
+  settings.userdata_chunk = &chunk;
+  settings.userdata_chunk_size = sizeof(chunk);
+  settings.func_reduce = refit_kdop_hull_reduce;
+  BLI_task_parallel_range(0,
+                          (int)divide_ceil_u((uint)(end - start), KDOPBVH_REFIT_TASK_SIZE),
+                          &data,
+                          refit_kdop_hull_task_cb,
+                          &settings);
+  memcpy(node->bv, chunk.bv, sizeof(float) * tree->axis);
+}
+
 /**
  * Only supports x,y,z axis in the moment
  * but we should use a plain and simple function here for speed sake.
@@ -987,14 +1057,28 @@ static void bvhtree_node_inflate(const BVHTree *tree, BVHNode *node, const float
 
 void BLI_bvhtree_insert(BVHTree *tree, int index, const float co[3], int numpoints)
 {
-  BVHNode *node = NULL;
-
   /* insert should only possible as long as tree->branch_num is 0 */
   BLI_assert(tree->branch_num <= 0);
   BLI_assert((size_t)tree->leaf_num < MEM_allocN_len(tree->nodes) / sizeof(*(tree->nodes)));
 
-  node = tree->nodes[tree->leaf_num] = &(tree->nodearray[tree->leaf_num]);
+  const int leaf_index = tree->leaf_num;
   tree->leaf_num++;
+  BLI_bvhtree_set_leaf(tree, leaf_index, index, co, numpoints);
+}
+
+void BLI_bvhtree_add_leafs(BVHTree *tree, int leafs_num)
+{
+  BLI_assert(tree->branch_num <= 0);
+  BLI_assert((size_t)(tree->leaf_num + leafs_num) <=
+             MEM_allocN_len(tree->nodes) / sizeof(*(tree->nodes)));
+  tree->leaf_num += leafs_num;
+}
+
+void BLI_bvhtree_set_leaf(
+    BVHTree *tree, int leaf_index, int index, const float co[3], int numpoints)
+{
+  BLI_assert(leaf_index < tree->leaf_num);
+  BVHNode *node = tree->nodes[leaf_index] = &(tree->nodearray[leaf_index]);
 
   create_kdop_hull(tree, node, co, numpoints, 0);
   node->index = index;
@@ -1712,6 +1796,20 @@ int BLI_bvhtree_find_nearest(const BVHTree *tree,
   return BLI_bvhtree_find_nearest_ex(tree, co, nearest, callback, userdata, 0);
 }
 
+int BLI_bvhtree_find_nearest_with_hint(const BVHTree *tree,
+                                       const float co[3],
+                                       BVHTreeNearest *nearest,
+                                       BVHTree_NearestPointCallback callback,
+                                       void *userdata,
+                                       const int hint_index)
+{
+  /* Without a caller provided result there is nothing to bound the search with. */
+  if (callback && nearest && hint_index != -1) {
+    callback(userdata, hint_index, co, nearest);
+  }
+  return BLI_bvhtree_find_nearest_ex(tree, co, nearest, callback, userdata, 0);
+}
+
 /** \} */
 
 /* -------------------------------------------------------------------- */
@@ -1987,14 +2085,15 @@ static void bvhtree_ray_cast_data_precalc(BVHRayCastData *data, int flag)
 #endif
 }
 
-int BLI_bvhtree_ray_cast_ex(const BVHTree *tree,
-                            const float co[3],
-                            const float dir[3],
-                            float radius,
-                            BVHTreeRayHit *hit,
-                            BVHTree_RayCastCallback callback,
-                            void *userdata,
-                            int flag)
+static int bvhtree_ray_cast_impl(const BVHTree *tree,
+                                 const float co[3],
+                                 const float dir[3],
+                                 float radius,
+                                 BVHTreeRayHit *hit,
+                                 BVHTree_RayCastCallback callback,
+                                 void *userdata,
+                                 int flag,
+                                 const int hint_index)
 {
   BVHRayCastData data;
   BVHNode *root = tree->nodes[tree->leaf_num];
@@ -2020,6 +2119,10 @@ int BLI_bvhtree_ray_cast_ex(const BVHTree *tree,
     data.hit.dist = BVH_RAYCAST_DIST_MAX;
   }
 
+  if (callback && hint_index != -1) {
+    callback(userdata, hint_index, &data.ray, &data.hit);
+  }
+
   if (root) {
     dfs_raycast(&data, root);
     //      iterative_raycast(&data, root);
@@ -2032,6 +2135,18 @@ int BLI_bvhtree_ray_cast_ex(const BVHTree *tree,
   return data.hit.index;
 }
 
+int BLI_bvhtree_ray_cast_ex(const BVHTree *tree,
+                            const float co[3],
+                            const float dir[3],
+                            float radius,
+                            BVHTreeRayHit *hit,
+                            BVHTree_RayCastCallback callback,
+                            void *userdata,
+                            int flag)
+{
+  return bvhtree_ray_cast_impl(tree, co, dir, radius, hit, callback, userdata, flag, -1);
+}
+
 int BLI_bvhtree_ray_cast(const BVHTree *tree,
                          const float co[3],
                          const float dir[3],
@@ -2044,6 +2159,19 @@ int BLI_bvhtree_ray_cast(const BVHTree *tree,
       tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT);
 }
 
+int BLI_bvhtree_ray_cast_with_hint(const BVHTree *tree,
+                                   const float co[3],
+                                   const float dir[3],
+                                   float radius,
+                                   BVHTreeRayHit *hit,
+                                   BVHTree_RayCastCallback callback,
+                                   void *userdata,
+                                   const int hint_index)
+{
+  return bvhtree_ray_cast_impl(
+      tree, co, dir, radius, hit, callback, userdata, BVH_RAYCAST_DEFAULT, hint_index);
+}
+
 float BLI_bvhtree_bb_raycast(const float bv[6],
                              const float light_start[3],
                              const float light_end[3],
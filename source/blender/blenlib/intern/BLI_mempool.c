@@ -549,6 +549,15 @@ int BLI_mempool_len(const BLI_mempool *pool)
   return ret;
 }
 
+int BLI_mempool_capacity(const BLI_mempool *pool)
+{
+  int chunks_num = 0;
+  for (const BLI_mempool_chunk *mpchunk = pool->chunks; mpchunk; mpchunk = mpchunk->next) {
+    chunks_num++;
+  }
+  return chunks_num * (int)pool->pchunk;
+}
+
 void *BLI_mempool_findelem(BLI_mempool *pool, uint index)
 {
   mempool_asan_lock(pool);
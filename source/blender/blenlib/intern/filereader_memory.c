@@ -110,6 +110,14 @@ static void memory_close_mmap(FileReader *reader)
   MEM_freeN(mem);
 }
 
+BLI_mmap_file *BLI_filereader_mmap_file(FileReader *reader)
+{
+  if (reader->read != memory_read_mmap) {
+    return NULL;
+  }
+  return ((MemoryReader *)reader)->mmap;
+}
+
 FileReader *BLI_filereader_new_mmap(int filedes)
 {
   BLI_mmap_file *mmap = BLI_mmap_open(filedes);
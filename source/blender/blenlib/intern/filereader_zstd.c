@@ -11,6 +11,8 @@
 
 #include "BLI_filereader.h"
 #include "BLI_math_base.h"
+#include "BLI_task.h"
+#include "BLI_threads.h"
 
 #ifdef __BIG_ENDIAN__
 #  include "BLI_endian_switch.h"
@@ -18,6 +20,33 @@
 
 #include "MEM_guardedalloc.h"
 
+/* Maximum number of decompressed frames that are kept around when decompressing frames on worker
+ * threads ahead of the consumer. Half of them are used for frames ahead of the current read
+ * position, the others keep recently read frames for short backward seeks. With the 1 MB frames
+ * written by Blender, this bounds the memory usage to 64 MB. */
+#define ZSTD_PREFETCH_SLOTS_MAX 64
+
+typedef enum eZstdFrameSlotState {
+  /* The slot does not contain compressed nor decompressed data yet. */
+  ZSTD_SLOT_EMPTY = 0,
+  /* The compressed data is loaded and a task to decompress it is pushed. */
+  ZSTD_SLOT_QUEUED,
+  /* The frame is being decompressed, either by a worker or by the consumer. */
+  ZSTD_SLOT_RUNNING,
+  /* Decompression finished, `uncompressed_data` is NULL if it failed. */
+  ZSTD_SLOT_DONE,
+} eZstdFrameSlotState;
+
+typedef struct ZstdFrameSlot {
+  int frame;
+  eZstdFrameSlotState state;
+
+  char *compressed_data;
+  size_t compressed_size;
+  char *uncompressed_data;
+  size_t uncompressed_size;
+} ZstdFrameSlot;
+
 typedef struct {
   FileReader reader;
 
@@ -35,6 +64,21 @@ typedef struct {
     char *cached_content;
     int cached_frame;
   } seek;
+
+  /* Decompression of frames ahead of the read position on worker threads,
+   * only used for seekable files. */
+  struct {
+    TaskPool *pool;
+    /* Protects the state of all slots. */
+    ThreadMutex mutex;
+    ThreadCondition cond;
+
+    /* Frame `i` is always stored in slot `i % slots_num`. */
+    ZstdFrameSlot *slots;
+    int slots_num;
+    /* Number of frames to decompress ahead of the read position. */
+    int frames_ahead;
+  } prefetch;
 } ZstdReader;
 
 static bool zstd_read_u32(FileReader *base, uint32_t *val)
@@ -195,6 +239,212 @@ static const char *zstd_ensure_cache(ZstdReader *zstd, int frame)
   return uncompressed_data;
 }
 
+/* -------------------------------------------------------------------- */
+/* Parallel decompression of frames ahead of the read position.
+ *
+ * Frames of the seekable format are independent, so while the consumer reads one frame the
+ * following ones are decompressed on worker threads. Only the consumer thread accesses the base
+ * reader, the workers only decompress data that has already been read.
+ */
+
+static void zstd_slot_free_data(ZstdFrameSlot *slot)
+{
+  MEM_SAFE_FREE(slot->compressed_data);
+  MEM_SAFE_FREE(slot->uncompressed_data);
+}
+
+/* Read the compressed data of the slot's frame, runs on the consumer thread only. */
+static bool zstd_slot_read_compressed(ZstdReader *zstd, ZstdFrameSlot *slot)
+{
+  const int frame = slot->frame;
+  slot->compressed_size = zstd->seek.compressed_ofs[frame + 1] - zstd->seek.compressed_ofs[frame];
+  slot->uncompressed_size = zstd->seek.uncompressed_ofs[frame + 1] -
+                            zstd->seek.uncompressed_ofs[frame];
+  slot->compressed_data = MEM_mallocN(slot->compressed_size, __func__);
+  if (zstd->base->seek(zstd->base, zstd->seek.compressed_ofs[frame], SEEK_SET) < 0 ||
+      zstd->base->read(zstd->base, slot->compressed_data, slot->compressed_size) <
+          slot->compressed_size)
+  {
+    MEM_SAFE_FREE(slot->compressed_data);
+    return false;
+  }
+  return true;
+}
+
+/* Decompress the slot's data, the caller must have set the slot to #ZSTD_SLOT_RUNNING. */
+static void zstd_slot_decompress(ZstdFrameSlot *slot)
+{
+  char *uncompressed_data = MEM_mallocN(slot->uncompressed_size, __func__);
+  size_t res = ZSTD_decompress(
+      uncompressed_data, slot->uncompressed_size, slot->compressed_data, slot->compressed_size);
+  if (ZSTD_isError(res) || res < slot->uncompressed_size) {
+    MEM_SAFE_FREE(uncompressed_data);
+  }
+  MEM_SAFE_FREE(slot->compressed_data);
+  slot->uncompressed_data = uncompressed_data;
+}
+
+static void zstd_prefetch_task(TaskPool *__restrict pool, void *taskdata)
+{
+  ZstdReader *zstd = BLI_task_pool_user_data(pool);
+  ZstdFrameSlot *slot = taskdata;
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  /* The consumer may have needed the frame before this task started, or the slot has been reused
+   * for another frame since. */
+  if (slot->state != ZSTD_SLOT_QUEUED) {
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+    return;
+  }
+  slot->state = ZSTD_SLOT_RUNNING;
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+  zstd_slot_decompress(slot);
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  slot->state = ZSTD_SLOT_DONE;
+  BLI_condition_notify_all(&zstd->prefetch.cond);
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+}
+
+/* Wait until no worker is decompressing into the slot anymore. Expects the mutex to be locked. */
+static void zstd_slot_wait_running(ZstdReader *zstd, ZstdFrameSlot *slot)
+{
+  while (slot->state == ZSTD_SLOT_RUNNING) {
+    BLI_condition_wait(&zstd->prefetch.cond, &zstd->prefetch.mutex);
+  }
+}
+
+/* Push decompression tasks for the frames following the given one. */
+static void zstd_prefetch_schedule(ZstdReader *zstd, const int frame)
+{
+  const int last_frame = min_ii(frame + zstd->prefetch.frames_ahead, zstd->seek.frames_num - 1);
+  for (int i = frame + 1; i <= last_frame; i++) {
+    ZstdFrameSlot *slot = &zstd->prefetch.slots[i % zstd->prefetch.slots_num];
+
+    BLI_mutex_lock(&zstd->prefetch.mutex);
+    if (slot->frame == i && slot->state != ZSTD_SLOT_EMPTY) {
+      BLI_mutex_unlock(&zstd->prefetch.mutex);
+      continue;
+    }
+    if (slot->state == ZSTD_SLOT_RUNNING) {
+      /* Don't block the consumer on an older frame, try again on the next read. */
+      BLI_mutex_unlock(&zstd->prefetch.mutex);
+      break;
+    }
+    /* Reset the state first, so that a stale task for this slot doesn't run. */
+    slot->state = ZSTD_SLOT_EMPTY;
+    slot->frame = i;
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+    zstd_slot_free_data(slot);
+    if (!zstd_slot_read_compressed(zstd, slot)) {
+      /* Let the consumer report the error when it actually needs this frame. */
+      break;
+    }
+
+    BLI_mutex_lock(&zstd->prefetch.mutex);
+    slot->state = ZSTD_SLOT_QUEUED;
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+    BLI_task_pool_push(zstd->prefetch.pool, zstd_prefetch_task, slot, false, NULL);
+  }
+}
+
+/* Same as #zstd_ensure_cache, but uses the frames decompressed ahead on worker threads. */
+static const char *zstd_prefetch_ensure_frame(ZstdReader *zstd, const int frame)
+{
+  ZstdFrameSlot *slot = &zstd->prefetch.slots[frame % zstd->prefetch.slots_num];
+
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  zstd_slot_wait_running(zstd, slot);
+  if (slot->frame != frame) {
+    slot->state = ZSTD_SLOT_EMPTY;
+    slot->frame = frame;
+  }
+
+  if (slot->state == ZSTD_SLOT_EMPTY) {
+    /* Not prefetched (the first frame, or after seeking), decompress it here. */
+    slot->state = ZSTD_SLOT_RUNNING;
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+    zstd_slot_free_data(slot);
+    if (zstd_slot_read_compressed(zstd, slot)) {
+      zstd_slot_decompress(slot);
+    }
+
+    BLI_mutex_lock(&zstd->prefetch.mutex);
+    slot->state = ZSTD_SLOT_DONE;
+  }
+  else if (slot->state == ZSTD_SLOT_QUEUED) {
+    /* The task did not start yet, don't wait for a worker to pick it up. */
+    slot->state = ZSTD_SLOT_RUNNING;
+    BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+    zstd_slot_decompress(slot);
+
+    BLI_mutex_lock(&zstd->prefetch.mutex);
+    slot->state = ZSTD_SLOT_DONE;
+  }
+  const char *data = slot->uncompressed_data;
+  if (data == NULL) {
+    /* Decompressing failed, try again when the frame is requested again. */
+    slot->state = ZSTD_SLOT_EMPTY;
+  }
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+
+  if (data == NULL) {
+    return NULL;
+  }
+
+  zstd_prefetch_schedule(zstd, frame);
+  return data;
+}
+
+static void zstd_prefetch_init(ZstdReader *zstd)
+{
+  const int threads_num = BLI_system_thread_count();
+  if (threads_num < 2 || zstd->seek.frames_num < 2) {
+    return;
+  }
+
+  zstd->prefetch.slots_num = min_ii(threads_num * 2, ZSTD_PREFETCH_SLOTS_MAX);
+  zstd->prefetch.frames_ahead = zstd->prefetch.slots_num / 2;
+  zstd->prefetch.slots = MEM_calloc_arrayN(
+      zstd->prefetch.slots_num, sizeof(ZstdFrameSlot), __func__);
+  for (int i = 0; i < zstd->prefetch.slots_num; i++) {
+    zstd->prefetch.slots[i].frame = -1;
+  }
+  BLI_mutex_init(&zstd->prefetch.mutex);
+  BLI_condition_init(&zstd->prefetch.cond);
+  zstd->prefetch.pool = BLI_task_pool_create(zstd, TASK_PRIORITY_HIGH);
+}
+
+static void zstd_prefetch_free(ZstdReader *zstd)
+{
+  if (zstd->prefetch.slots == NULL) {
+    return;
+  }
+
+  /* Skip the tasks that didn't start yet and wait for the running ones. */
+  BLI_mutex_lock(&zstd->prefetch.mutex);
+  for (int i = 0; i < zstd->prefetch.slots_num; i++) {
+    if (zstd->prefetch.slots[i].state == ZSTD_SLOT_QUEUED) {
+      zstd->prefetch.slots[i].state = ZSTD_SLOT_EMPTY;
+    }
+  }
+  BLI_mutex_unlock(&zstd->prefetch.mutex);
+  BLI_task_pool_work_and_wait(zstd->prefetch.pool);
+  BLI_task_pool_free(zstd->prefetch.pool);
+
+  for (int i = 0; i < zstd->prefetch.slots_num; i++) {
+    zstd_slot_free_data(&zstd->prefetch.slots[i]);
+  }
+  MEM_freeN(zstd->prefetch.slots);
+  BLI_mutex_end(&zstd->prefetch.mutex);
+  BLI_condition_end(&zstd->prefetch.cond);
+}
+
 static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
 {
   ZstdReader *zstd = (ZstdReader *)reader;
@@ -207,7 +457,8 @@ static int64_t zstd_read_seekable(FileReader *reader, void *buffer, size_t size)
       break;
     }
 
-    const char *framedata = zstd_ensure_cache(zstd, frame);
+    const char *framedata = zstd->prefetch.slots ? zstd_prefetch_ensure_frame(zstd, frame) :
+                                                   zstd_ensure_cache(zstd, frame);
     if (framedata == NULL) {
       /* Error while reading the frame, so return as much as we can. */
       break;
@@ -283,6 +534,7 @@ static void zstd_close(FileReader *reader)
 
   ZSTD_freeDCtx(zstd->ctx);
   if (zstd->reader.seek) {
+    zstd_prefetch_free(zstd);
     MEM_freeN(zstd->seek.uncompressed_ofs);
     MEM_freeN(zstd->seek.compressed_ofs);
     /* When an error has occurred this may be NULL, see: #99744. */
@@ -308,6 +560,7 @@ FileReader *BLI_filereader_new_zstd(FileReader *base)
   if (zstd_read_seek_table(zstd)) {
     zstd->reader.read = zstd_read_seekable;
     zstd->reader.seek = zstd_seek;
+    zstd_prefetch_init(zstd);
   }
   else {
     zstd->reader.read = zstd_read;
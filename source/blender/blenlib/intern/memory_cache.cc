@@ -10,9 +10,11 @@
 #include <mutex>
 
 #include "BLI_concurrent_map.hh"
+#include "BLI_map.hh"
 #include "BLI_memory_cache.hh"
 #include "BLI_memory_counter.hh"
 #include "BLI_task.hh"
+#include "BLI_time.h"
 
 namespace blender::memory_cache {
 
@@ -28,6 +30,12 @@ struct StoredValue {
   std::shared_ptr<CachedValue> value;
   /** A logical time that indicates when the value was last used. Lower values are older. */
   int64_t last_use_time = 0;
+  /** Values with a lower priority are removed first, see #compute_priority. */
+  double priority = 0.0;
+  /** How long it took to compute the value in seconds. */
+  double compute_duration = 0.0;
+  /** Memory used by this value on its own, i.e. shared data is counted for every user. */
+  int64_t size_in_bytes = 0;
 };
 
 using CacheMap = ConcurrentMap<std::reference_wrapper<const GenericKey>, StoredValue>;
@@ -42,6 +50,10 @@ struct Cache {
    * not locked.
    */
   std::atomic<int64_t> size_in_bytes = 0;
+  /** Raised to the priority of removed values, see #compute_priority. */
+  std::atomic<double> priority_inflation = 0.0;
+  /** True when a category uses more memory than its limit. */
+  std::atomic<bool> category_limit_exceeded = false;
 
   std::mutex global_mutex;
   /** Amount of memory currently used in the cache. */
@@ -51,6 +63,10 @@ struct Cache {
    * thread-safe iteration.
    */
   Vector<const GenericKey *> keys;
+  /** Limits set with #set_category_size_limit. */
+  Map<std::string, int64_t> category_limits;
+  /** Approximate amount of memory used by the values of each category. */
+  Map<std::string, int64_t> category_sizes;
 };
 
 static Cache &get_cache()
@@ -61,14 +77,36 @@ static Cache &get_cache()
 
 static void try_enforce_limit();
 
-static void set_new_logical_time(const StoredValue &stored_value, const int64_t new_time)
+/**
+ * Values are removed in the order of their priority ("GreedyDual-Size" eviction). Every time a
+ * value is used, its priority is set to the cost of recomputing it per byte, offset by the current
+ * inflation. Since the inflation grows whenever values are removed, values that have not been used
+ * in a while are removed eventually, even when they are expensive. Values with the same cost per
+ * byte are removed in least recently used order.
+ */
+static double compute_priority(const Cache &cache, const StoredValue &stored_value)
+{
+  /* Values that are computed faster than this are considered to be equally cheap, so that timing
+   * noise does not decide which values are removed. */
+  const double min_cost = 0.001;
+  const double cost = std::max(stored_value.compute_duration, min_cost);
+  return cache.priority_inflation.load(std::memory_order_relaxed) +
+         cost / double(std::max<int64_t>(stored_value.size_in_bytes, 1));
+}
+
+static void touch_stored_value(const Cache &cache,
+                               const StoredValue &stored_value,
+                               const int64_t new_time)
 {
   /* Don't want to use `std::atomic` directly in the struct, because that makes it
    * non-movable. Could also use a non-const accessor, but that may degrade performance more.
    * It's not necessary for correctness that the time is exactly the right value. */
   reinterpret_cast<std::atomic<int64_t> *>(const_cast<int64_t *>(&stored_value.last_use_time))
       ->store(new_time, std::memory_order_relaxed);
+  reinterpret_cast<std::atomic<double> *>(const_cast<double *>(&stored_value.priority))
+      ->store(compute_priority(cache, stored_value), std::memory_order_relaxed);
   static_assert(sizeof(int64_t) == sizeof(std::atomic<int64_t>));
+  static_assert(sizeof(double) == sizeof(std::atomic<double>));
 }
 
 std::shared_ptr<CachedValue> get_base(const GenericKey &key,
@@ -82,7 +120,7 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
     /* Fast path when the value is already cached. */
     CacheMap::ConstAccessor accessor;
     if (cache.map.lookup(accessor, std::ref(key))) {
-      set_new_logical_time(accessor->second, new_time);
+      touch_stored_value(cache, accessor->second, new_time);
       return accessor->second.value;
     }
   }
@@ -90,7 +128,9 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
   /* Compute value while no locks are held to avoid potential for dead-locks. Not using a lock also
    * means that the value may be computed more than once, but that's still better than locking all
    * the time. It may be possible to implement something smarter in the future. */
+  const double compute_start = BLI_time_now_seconds();
   std::shared_ptr<CachedValue> result = compute_fn();
+  const double compute_duration = BLI_time_now_seconds() - compute_start;
   /* Result should be valid. Use exception to propagate error if necessary. */
   BLI_assert(result);
 
@@ -111,8 +151,15 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
 
     /* Store the value. Don't move, because we still want to return the value from the function. */
     accessor->second.value = result;
-    /* Set initial logical time for the new cached entry. */
-    set_new_logical_time(accessor->second, new_time);
+    accessor->second.compute_duration = compute_duration;
+    {
+      MemoryCount value_memory;
+      MemoryCounter memory_counter{value_memory};
+      result->count_memory(memory_counter);
+      accessor->second.size_in_bytes = value_memory.total_bytes;
+    }
+    /* Set initial logical time and priority for the new cached entry. */
+    touch_stored_value(cache, accessor->second, new_time);
 
     {
       /* Update global data of the cache. */
@@ -121,6 +168,15 @@ std::shared_ptr<CachedValue> get_base(const GenericKey &key,
       accessor->second.value->count_memory(memory_counter);
       cache.keys.append(&accessor->first.get());
       cache.size_in_bytes = cache.memory.total_bytes;
+
+      const StringRefNull category = result->category();
+      int64_t &category_size = cache.category_sizes.lookup_or_add_as(category, 0);
+      category_size += accessor->second.size_in_bytes;
+      if (const int64_t *category_limit = cache.category_limits.lookup_ptr_as(category)) {
+        if (category_size >= *category_limit) {
+          cache.category_limit_exceeded = true;
+        }
+      }
     }
   }
   /* Potentially free elements from the cache. Note, even if this would free the value we just
@@ -136,6 +192,24 @@ void set_approximate_size_limit(const int64_t limit_in_bytes)
   try_enforce_limit();
 }
 
+void set_category_size_limit(const StringRef category, const int64_t limit_in_bytes)
+{
+  Cache &cache = get_cache();
+  {
+    std::lock_guard lock{cache.global_mutex};
+    if (limit_in_bytes <= 0) {
+      cache.category_limits.remove_as(category);
+      return;
+    }
+    cache.category_limits.add_overwrite_as(category, limit_in_bytes);
+    const int64_t *category_size = cache.category_sizes.lookup_ptr_as(category);
+    if (category_size && *category_size >= limit_in_bytes) {
+      cache.category_limit_exceeded = true;
+    }
+  }
+  try_enforce_limit();
+}
+
 void clear()
 {
   Cache &cache = get_cache();
@@ -150,6 +224,8 @@ void clear()
   cache.keys.clear();
   cache.size_in_bytes = 0;
   cache.memory.reset();
+  cache.category_sizes.clear();
+  cache.category_limit_exceeded = false;
 }
 
 static void try_enforce_limit()
@@ -157,94 +233,85 @@ static void try_enforce_limit()
   Cache &cache = get_cache();
   const int64_t old_size = cache.size_in_bytes.load(std::memory_order_relaxed);
   const int64_t approximate_limit = cache.approximate_limit.load(std::memory_order_relaxed);
-  if (old_size < approximate_limit) {
+  if (old_size < approximate_limit &&
+      !cache.category_limit_exceeded.load(std::memory_order_relaxed))
+  {
     /* Nothing to do, the current cache size is still within the right limits. */
     return;
   }
 
   std::lock_guard lock{cache.global_mutex};
 
-  /* Gather all the keys with their latest usage times. */
-  Vector<std::pair<int64_t, const GenericKey *>> keys_with_time;
+  /* Gather all the keys with their latest priorities. */
+  struct KeyWithPriority {
+    double priority;
+    int64_t last_use_time;
+    const GenericKey *key;
+  };
+  Vector<KeyWithPriority> keys_with_priority;
   for (const GenericKey *key : cache.keys) {
     CacheMap::ConstAccessor accessor;
     if (!cache.map.lookup(accessor, *key)) {
       continue;
     }
-    keys_with_time.append({accessor->second.last_use_time, key});
+    keys_with_priority.append({accessor->second.priority, accessor->second.last_use_time, key});
   }
-  /* Sort the items so that the newest keys come first. */
-  std::sort(keys_with_time.begin(), keys_with_time.end());
-  std::reverse(keys_with_time.begin(), keys_with_time.end());
+  /* Sort the items so that the ones that should be kept the most come first. */
+  std::sort(keys_with_priority.begin(),
+            keys_with_priority.end(),
+            [](const KeyWithPriority &a, const KeyWithPriority &b) {
+              if (a.priority != b.priority) {
+                return a.priority > b.priority;
+              }
+              return a.last_use_time > b.last_use_time;
+            });
 
-  /* Count used memory starting at the most recently touched element. Stop at the element when the
-   * amount became larger than the capacity. */
+  /* Keep the elements with the highest priority that still fit. Undershoot a little bit. This
+   * typically results in more things being freed that have not been used in a while. The benefit
+   * is that we have to do the decision what to free less often than if we were always just freeing
+   * the minimum amount necessary. */
+  const double undershoot_factor = 0.75;
+  Vector<const GenericKey *> keys_to_keep;
+  Vector<const GenericKey *> keys_to_remove;
+  double max_removed_priority = cache.priority_inflation.load(std::memory_order_relaxed);
   cache.memory.reset();
-  std::optional<int> first_bad_index;
+  cache.category_sizes.clear();
   {
     MemoryCounter memory_counter{cache.memory};
-    for (const int i : keys_with_time.index_range()) {
-      const GenericKey &key = *keys_with_time[i].second;
+    for (const KeyWithPriority &item : keys_with_priority) {
       CacheMap::ConstAccessor accessor;
-      if (!cache.map.lookup(accessor, key)) {
+      if (!cache.map.lookup(accessor, *item.key)) {
         continue;
       }
-      accessor->second.value->count_memory(memory_counter);
-      /* Undershoot a little bit. This typically results in more things being freed that have not
-       * been used in a while. The benefit is that we have to do the decision what to free less
-       * often than if we were always just freeing the minimum amount necessary. */
-      if (cache.memory.total_bytes <= approximate_limit * 0.75) {
-        continue;
-      }
-      first_bad_index = i;
-      break;
-    }
-  }
-  if (!first_bad_index) {
-    return;
-  }
+      const StoredValue &stored_value = accessor->second;
+      const StringRefNull category = stored_value.value->category();
+      int64_t &category_size = cache.category_sizes.lookup_or_add_as(category, 0);
+      const int64_t *category_limit = cache.category_limits.lookup_ptr_as(category);
 
-  /* Avoid recounting memory if the last item is not way too large and the overshoot is still ok.
-   * The alternative would be to subtract the last item from the counted memory again, but removing
-   * from #MemoryCount is not implemented yet. */
-  bool need_memory_recount = false;
-  if (cache.memory.total_bytes < approximate_limit * 1.1) {
-    *first_bad_index += 1;
-    if (*first_bad_index == keys_with_time.size()) {
-      return;
+      const bool fits_cache = cache.memory.total_bytes + stored_value.size_in_bytes <=
+                              approximate_limit * undershoot_factor;
+      const bool fits_category = !category_limit || category_size + stored_value.size_in_bytes <=
+                                                        *category_limit * undershoot_factor;
+      if (fits_cache && fits_category) {
+        stored_value.value->count_memory(memory_counter);
+        category_size += stored_value.size_in_bytes;
+        keys_to_keep.append(item.key);
+      }
+      else {
+        max_removed_priority = std::max(max_removed_priority, item.priority);
+        keys_to_remove.append(item.key);
+      }
     }
   }
-  else {
-    need_memory_recount = true;
-  }
 
   /* Remove elements that don't fit anymore. */
-  for (const int i : keys_with_time.index_range().drop_front(*first_bad_index)) {
-    const GenericKey &key = *keys_with_time[i].second;
-    cache.map.remove(key);
-  }
-
-  /* Update keys vector. */
-  cache.keys.clear();
-  for (const int i : keys_with_time.index_range().take_front(*first_bad_index)) {
-    cache.keys.append(keys_with_time[i].second);
-  }
-
-  if (need_memory_recount) {
-    /* Recount memory another time, because the last count does not accurately represent the actual
-     * value. */
-    cache.memory.reset();
-    MemoryCounter memory_counter{cache.memory};
-    for (const int i : keys_with_time.index_range().take_front(*first_bad_index)) {
-      const GenericKey &key = *keys_with_time[i].second;
-      CacheMap::ConstAccessor accessor;
-      if (!cache.map.lookup(accessor, key)) {
-        continue;
-      }
-      accessor->second.value->count_memory(memory_counter);
-    }
+  for (const GenericKey *key : keys_to_remove) {
+    cache.map.remove(*key);
   }
+  cache.keys = std::move(keys_to_keep);
   cache.size_in_bytes = cache.memory.total_bytes;
+  cache.priority_inflation = max_removed_priority;
+  cache.category_limit_exceeded = false;
 }
 
 }  // namespace blender::memory_cache
@@ -2100,10 +2100,15 @@ static void finish_patch_cell_graph(const IMesh &tm,
       std::cout << comp << ": " << components[comp] << "\n";
     }
   }
+  /* The per-component queries below only read the patch and cell graph, the arena is the only
+   * shared state they modify and it is thread-safe. Meshes with many separate parts spend most of
+   * the time here, so handle components in parallel. */
   Array<int> ambient_cell(components.size());
-  for (int comp : components.index_range()) {
-    ambient_cell[comp] = find_ambient_cell(tm, &components[comp], tmtopo, pinfo, arena);
-  }
+  threading::parallel_for(components.index_range(), 1, [&](IndexRange comp_range) {
+    for (int comp : comp_range) {
+      ambient_cell[comp] = find_ambient_cell(tm, &components[comp], tmtopo, pinfo, arena);
+    }
+  });
   if (dbg_level > 0) {
     std::cout << "ambient cells:\n";
     for (int comp : ambient_cell.index_range()) {
@@ -2115,10 +2120,12 @@ static void finish_patch_cell_graph(const IMesh &tm,
   if (tot_components > 1) {
     Array<BoundingBox> comp_bb(tot_components);
     populate_comp_bbs(components, pinfo, tm, comp_bb);
-    for (int comp : components.index_range()) {
-      comp_cont[comp] = find_component_containers(
-          comp, components, ambient_cell, tm, pinfo, tmtopo, comp_bb, arena);
-    }
+    threading::parallel_for(components.index_range(), 1, [&](IndexRange comp_range) {
+      for (int comp : comp_range) {
+        comp_cont[comp] = find_component_containers(
+            comp, components, ambient_cell, tm, pinfo, tmtopo, comp_bb, arena);
+      }
+    });
     if (dbg_level > 0) {
       std::cout << "component containers:\n";
       for (int comp : comp_cont.index_range()) {
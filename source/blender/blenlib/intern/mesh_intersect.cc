@@ -401,7 +401,6 @@ class IMeshArena::IMeshArenaImpl : NonCopyable, NonMovable {
 
   Face *add_face(Span<const Vert *> verts, int orig, Span<int> edge_origs, Span<bool> is_intersect)
   {
-    Face *f = new Face(verts, next_face_id_++, orig, edge_origs, is_intersect);
     if (intersect_use_threading) {
 #  ifdef USE_SPINLOCK
       BLI_spin_lock(&lock_);
@@ -409,6 +408,8 @@ class IMeshArena::IMeshArenaImpl : NonCopyable, NonMovable {
       BLI_mutex_lock(mutex_);
 #  endif
     }
+    /* The id has to be allocated while locked, faces are added from multiple threads. */
+    Face *f = new Face(verts, next_face_id_++, orig, edge_origs, is_intersect);
     allocated_faces_.append(std::unique_ptr<Face>(f));
     if (intersect_use_threading) {
 #  ifdef USE_SPINLOCK
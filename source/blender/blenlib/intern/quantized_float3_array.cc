@@ -0,0 +1,137 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include "BLI_bounds.hh"
+#include "BLI_quantized_float3_array.hh"
+#include "BLI_task.hh"
+
+namespace blender {
+
+static constexpr float fixed_point_max = float(std::numeric_limits<uint16_t>::max());
+
+static uint16_t to_fixed_point(const float value)
+{
+  /* Written such that NaN ends up as zero. */
+  if (!(value > 0.0f)) {
+    return 0;
+  }
+  return uint16_t(std::min(std::round(value), fixed_point_max));
+}
+
+QuantizedFloat3Array QuantizedFloat3Array::encode(const Span<float3> values,
+                                                  const Encoding encoding)
+{
+  QuantizedFloat3Array result;
+  result.encoding_ = encoding;
+  result.data_.reinitialize(values.size());
+  if (values.is_empty()) {
+    return result;
+  }
+  MutableSpan<ushort3> data = result.data_;
+
+  if (encoding == Encoding::Half) {
+    threading::parallel_for(values.index_range(), 4096, [&](const IndexRange range) {
+      math::float_to_half_array(values.slice(range).cast<float>().data(),
+                                data.slice(range).cast<uint16_t>().data(),
+                                size_t(range.size() * 3));
+    });
+    return result;
+  }
+
+  const Bounds<float3> bounds = *bounds::min_max(values);
+  const float3 size = bounds.max - bounds.min;
+  float3 inv_scale;
+  for (const int axis : IndexRange(3)) {
+    result.scale_[axis] = size[axis] > 0.0f ? size[axis] / fixed_point_max : 0.0f;
+    inv_scale[axis] = size[axis] > 0.0f ? fixed_point_max / size[axis] : 0.0f;
+  }
+  result.offset_ = bounds.min;
+  threading::parallel_for(values.index_range(), 4096, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      const float3 value = (values[i] - bounds.min) * inv_scale;
+      data[i] = ushort3(to_fixed_point(value.x), to_fixed_point(value.y), to_fixed_point(value.z));
+    }
+  });
+  return result;
+}
+
+void QuantizedFloat3Array::decode(const IndexMask &mask, MutableSpan<float3> dst) const
+{
+  BLI_assert(dst.size() >= mask.min_array_size());
+  mask.foreach_segment(GrainSize(4096), [&](const IndexMaskSegment segment) {
+    const IndexRange range(segment[0], segment.last() - segment[0] + 1);
+    if (encoding_ == Encoding::Half && range.size() == segment.size()) {
+      /* Contiguous indices can use the faster conversion of many values at once. */
+      math::half_to_float_array(data_.as_span().slice(range).cast<uint16_t>().data(),
+                                dst.slice(range).cast<float>().data(),
+                                size_t(range.size() * 3));
+      return;
+    }
+    for (const int64_t i : segment) {
+      dst[i] = (*this)[i];
+    }
+  });
+}
+
+void QuantizedFloat3Array::decode(MutableSpan<float3> dst) const
+{
+  this->decode(IndexMask(this->size()), dst);
+}
+
+namespace {
+
+class VArrayImpl_For_QuantizedFloat3 final : public VArrayImpl<float3> {
+ private:
+  std::shared_ptr<const QuantizedFloat3Array> array_;
+
+ public:
+  VArrayImpl_For_QuantizedFloat3(std::shared_ptr<const QuantizedFloat3Array> array)
+      : VArrayImpl<float3>(array->size()), array_(std::move(array))
+  {
+  }
+
+ private:
+  float3 get(const int64_t index) const override
+  {
+    return (*array_)[index];
+  }
+
+  void materialize(const IndexMask &mask, float3 *dst) const override
+  {
+    array_->decode(mask, {dst, mask.min_array_size()});
+  }
+
+  void materialize_to_uninitialized(const IndexMask &mask, float3 *dst) const override
+  {
+    array_->decode(mask, {dst, mask.min_array_size()});
+  }
+
+  void materialize_compressed(const IndexMask &mask, float3 *dst) const override
+  {
+    mask.foreach_index_optimized<int64_t>(
+        [&](const int64_t i, const int64_t pos) { dst[pos] = (*array_)[i]; });
+  }
+
+  void materialize_compressed_to_uninitialized(const IndexMask &mask, float3 *dst) const override
+  {
+    this->materialize_compressed(mask, dst);
+  }
+};
+
+}  // namespace
+
+VArray<float3> QuantizedFloat3Array::as_varray(std::shared_ptr<const QuantizedFloat3Array> array)
+{
+  return VArray<float3>::For<VArrayImpl_For_QuantizedFloat3>(std::move(array));
+}
+
+}  // namespace blender
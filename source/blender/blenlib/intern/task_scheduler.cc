@@ -12,7 +12,9 @@
 
 #include "BLI_lazy_threading.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #ifdef WITH_TBB
 /* Need to include at least one header to get the version define. */
@@ -22,6 +24,10 @@
 #    include <tbb/global_control.h>
 #    define WITH_TBB_GLOBAL_CONTROL
 #  endif
+#  if TBB_INTERFACE_VERSION_MAJOR >= 12
+#    include <tbb/info.h>
+#    define WITH_TBB_NUMA
+#  endif
 #endif
 
 /* Task Scheduler */
@@ -30,6 +36,16 @@ static int task_scheduler_num_threads = 1;
 #ifdef WITH_TBB_GLOBAL_CONTROL
 static tbb::global_control *task_scheduler_global_control = nullptr;
 #endif
+static bool task_scheduler_use_numa = false;
+#ifdef WITH_TBB_NUMA
+/** One arena per NUMA node, empty when NUMA aware scheduling is not used. */
+static blender::Vector<tbb::task_arena *> task_scheduler_numa_arenas;
+#endif
+
+void BLI_task_scheduler_use_numa_set(const bool use_numa)
+{
+  task_scheduler_use_numa = use_numa;
+}
 
 void BLI_task_scheduler_init()
 {
@@ -53,10 +69,29 @@ void BLI_task_scheduler_init()
 #else
   task_scheduler_num_threads = BLI_system_thread_count();
 #endif
+
+#ifdef WITH_TBB_NUMA
+  if (task_scheduler_use_numa) {
+    /* Without the TBB bind library, a single node with an invalid id is reported. */
+    const std::vector<tbb::numa_node_id> numa_nodes = tbb::info::numa_nodes();
+    if (numa_nodes.size() > 1) {
+      for (const tbb::numa_node_id numa_node : numa_nodes) {
+        task_scheduler_numa_arenas.append(
+            MEM_new<tbb::task_arena>(__func__, tbb::task_arena::constraints(numa_node)));
+      }
+    }
+  }
+#endif
 }
 
 void BLI_task_scheduler_exit()
 {
+#ifdef WITH_TBB_NUMA
+  for (tbb::task_arena *arena : task_scheduler_numa_arenas) {
+    MEM_delete(arena);
+  }
+  task_scheduler_numa_arenas.clear_and_shrink();
+#endif
 #ifdef WITH_TBB_GLOBAL_CONTROL
   MEM_delete(task_scheduler_global_control);
 #endif
@@ -67,6 +102,15 @@ int BLI_task_scheduler_num_threads()
   return task_scheduler_num_threads;
 }
 
+int BLI_task_scheduler_numa_nodes_num()
+{
+#ifdef WITH_TBB_NUMA
+  return std::max<int>(task_scheduler_numa_arenas.size(), 1);
+#else
+  return 1;
+#endif
+}
+
 void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
 {
 #ifdef WITH_TBB
@@ -76,3 +120,33 @@ void BLI_task_isolate(void (*func)(void *userdata), void *userdata)
   func(userdata);
 #endif
 }
+
+namespace blender::threading::detail {
+
+void parallel_for_numa_impl(const IndexRange range,
+                            const int64_t grain_size,
+                            const FunctionRef<void(IndexRange)> function)
+{
+#ifdef WITH_TBB_NUMA
+  const int64_t nodes_num = task_scheduler_numa_arenas.size();
+  if (nodes_num > 1 && range.size() >= grain_size * nodes_num) {
+    /* Make sure the lazy threading hints are send now, because they shouldn't be send out of an
+     * isolated region. */
+    lazy_threading::send_hint();
+    lazy_threading::ReceiverIsolation isolation;
+    /* The split only depends on the range, so the same indices are processed on the same node
+     * every time. */
+    tbb::parallel_for(int64_t(0), nodes_num, [&](const int64_t node_index) {
+      const int64_t begin = range.size() * node_index / nodes_num;
+      const int64_t end = range.size() * (node_index + 1) / nodes_num;
+      const IndexRange node_range = range.slice(begin, end - begin);
+      task_scheduler_numa_arenas[node_index]->execute(
+          [&]() { parallel_for(node_range, grain_size, function); });
+    });
+    return;
+  }
+#endif
+  parallel_for(range, grain_size, function);
+}
+
+}  // namespace blender::threading::detail
@@ -0,0 +1,181 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup bli
+ */
+
+#include <algorithm>
+#include <cstdio>
+#include <sstream>
+
+#include "BLI_enumerable_thread_specific.hh"
+#include "BLI_fileops.h"
+#include "BLI_serialize.hh"
+#include "BLI_time.h"
+#include "BLI_trace.hh"
+#include "BLI_vector.hh"
+
+namespace blender::trace {
+
+namespace {
+
+struct ZoneEvent {
+  /* Static strings. */
+  const char *name;
+  const char *category;
+  int thread_index;
+  /* In seconds, as returned by #BLI_time_now_seconds. */
+  double start_time;
+  double end_time;
+};
+
+struct TraceData {
+  /* Events are collected per thread, so that recording threads take no lock. */
+  threading::EnumerableThreadSpecific<Vector<ZoneEvent>> events;
+  double start_time = 0.0;
+  std::string exit_filepath;
+};
+
+}  // namespace
+
+static TraceData &get_trace_data()
+{
+  static TraceData data;
+  return data;
+}
+
+int current_thread_index()
+{
+  static std::atomic<int> threads_num = 0;
+  static thread_local int thread_index = threads_num++;
+  return thread_index;
+}
+
+ChromeTraceWriter::ChromeTraceWriter(const StringRef process_name)
+    : root_(std::make_unique<io::serialize::DictionaryValue>())
+{
+  using namespace io::serialize;
+  root_->append_str("displayTimeUnit", "ms");
+  events_ = root_->append_array("traceEvents").get();
+
+  DictionaryValue &process_event = *events_->append_dict();
+  process_event.append_str("name", "process_name");
+  process_event.append_str("ph", "M");
+  process_event.append_int("pid", 1);
+  process_event.append_dict("args")->append_str("name", process_name);
+}
+
+ChromeTraceWriter::~ChromeTraceWriter() = default;
+
+io::serialize::DictionaryValue &ChromeTraceWriter::add_event(const StringRef name,
+                                                             const StringRef category,
+                                                             const int thread_index,
+                                                             const double start_time,
+                                                             const double end_time)
+{
+  /* Complete events, with time stamps and durations in microseconds. */
+  io::serialize::DictionaryValue &event = *events_->append_dict();
+  event.append_str("name", name);
+  event.append_str("cat", category);
+  event.append_str("ph", "X");
+  event.append_double("ts", start_time * 1e6);
+  event.append_double("dur", (end_time - start_time) * 1e6);
+  event.append_int("pid", 1);
+  event.append_int("tid", thread_index);
+  return event;
+}
+
+std::string ChromeTraceWriter::to_json() const
+{
+  std::stringstream stream;
+  io::serialize::JsonFormatter formatter;
+  formatter.serialize(stream, *root_);
+  return stream.str();
+}
+
+namespace detail {
+
+std::atomic<bool> is_recording = false;
+
+double zone_begin()
+{
+  return BLI_time_now_seconds();
+}
+
+void zone_end(const char *name, const char *category, const double start_time)
+{
+  if (!trace::is_recording()) {
+    return;
+  }
+  const double end_time = BLI_time_now_seconds();
+  get_trace_data().events.local().append(
+      {name, category, current_thread_index(), start_time, end_time});
+}
+
+}  // namespace detail
+
+void begin()
+{
+  TraceData &data = get_trace_data();
+  for (Vector<ZoneEvent> &events : data.events) {
+    events.clear();
+  }
+  data.start_time = BLI_time_now_seconds();
+  detail::is_recording = true;
+}
+
+void end()
+{
+  detail::is_recording = false;
+}
+
+std::string to_json()
+{
+  TraceData &data = get_trace_data();
+
+  Vector<ZoneEvent> all_events;
+  for (const Vector<ZoneEvent> &events : data.events) {
+    all_events.extend(events);
+  }
+  std::sort(all_events.begin(), all_events.end(), [](const ZoneEvent &a, const ZoneEvent &b) {
+    return a.start_time < b.start_time;
+  });
+
+  ChromeTraceWriter writer("Blender");
+  for (const ZoneEvent &event : all_events) {
+    /* Zones that started before the recording are clamped to its start. */
+    const double start_time = std::max(event.start_time, data.start_time) - data.start_time;
+    const double end_time = event.end_time - data.start_time;
+    writer.add_event(event.name, event.category, event.thread_index, start_time, end_time);
+  }
+  return writer.to_json();
+}
+
+void begin_with_exit_file(const char *filepath)
+{
+  get_trace_data().exit_filepath = filepath;
+  begin();
+}
+
+void write_exit_file()
+{
+  TraceData &data = get_trace_data();
+  if (data.exit_filepath.empty()) {
+    return;
+  }
+  end();
+  FILE *f = BLI_fopen(data.exit_filepath.c_str(), "w");
+  if (f == nullptr) {
+    fprintf(stderr, "Unable to write trace to \"%s\"\n", data.exit_filepath.c_str());
+    return;
+  }
+  const std::string json_str = to_json();
+  fprintf(f, "%s", json_str.c_str());
+  fclose(f);
+  printf("Trace written to \"%s\"\n", data.exit_filepath.c_str());
+  data.exit_filepath.clear();
+}
+
+}  // namespace blender::trace
@@ -0,0 +1,118 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include <cstring>
+#include <zstd.h>
+
+#include "BLI_filereader.h"
+#include "BLI_rand.hh"
+#include "BLI_threads.h"
+#include "BLI_vector.hh"
+
+namespace blender::tests {
+
+static void append_u32(Vector<char> &data, const uint32_t value)
+{
+  /* The seek table is little endian. */
+  for (int i = 0; i < 4; i++) {
+    data.append(char((value >> (i * 8)) & 0xFF));
+  }
+}
+
+/** Compress in independent frames followed by a seek table, like #ZstdWriteWrap does. */
+static Vector<char> compress_seekable(const Span<char> data, const int64_t frame_size)
+{
+  Vector<char> result;
+  Vector<uint32_t> compressed_sizes;
+  Vector<uint32_t> uncompressed_sizes;
+  for (int64_t start = 0; start < data.size(); start += frame_size) {
+    const int64_t size = std::min(frame_size, data.size() - start);
+    const int64_t offset = result.size();
+    result.resize(offset + ZSTD_compressBound(size));
+    const size_t compressed_size = ZSTD_compress(
+        result.data() + offset, ZSTD_compressBound(size), data.data() + start, size, 1);
+    EXPECT_FALSE(ZSTD_isError(compressed_size));
+    result.resize(offset + compressed_size);
+    compressed_sizes.append(compressed_size);
+    uncompressed_sizes.append(size);
+  }
+
+  const int frames_num = compressed_sizes.size();
+  append_u32(result, 0x184D2A5E);
+  append_u32(result, frames_num * 8 + 9);
+  for (const int i : compressed_sizes.index_range()) {
+    append_u32(result, compressed_sizes[i]);
+    append_u32(result, uncompressed_sizes[i]);
+  }
+  append_u32(result, frames_num);
+  result.append(0);
+  append_u32(result, 0x8F92EAB1);
+  return result;
+}
+
+static void test_zstd_seekable_read(const int threads_num)
+{
+  BLI_system_num_threads_override_set(threads_num);
+  BLI_threadapi_init();
+
+  const int64_t frame_size = 64 * 1024;
+  Vector<char> data(frame_size * 37 - 1234);
+  for (const int64_t i : data.index_range()) {
+    data[i] = char((uint64_t(i) * 2654435761u) >> 13) & 0x3F;
+  }
+  const Vector<char> compressed = compress_seekable(data, frame_size);
+
+  FileReader *reader = BLI_filereader_new_zstd(
+      BLI_filereader_new_memory(compressed.data(), compressed.size()));
+  ASSERT_NE(reader, nullptr);
+  ASSERT_NE(reader->seek, nullptr);
+
+  RandomNumberGenerator rng(42);
+  Vector<char> buffer(data.size());
+
+  /* Mostly sequential reading with short backward seeks, similar to reading blend-files. */
+  int64_t pos = 0;
+  while (pos < data.size()) {
+    const int64_t size = std::min<int64_t>(1 + rng.get_int32(20000), data.size() - pos);
+    ASSERT_EQ(reader->read(reader, buffer.data(), size), size);
+    ASSERT_EQ(memcmp(buffer.data(), data.data() + pos, size), 0);
+    pos += size;
+
+    if (pos > frame_size * 3 && rng.get_int32(4) == 0) {
+      const int64_t back_pos = pos - rng.get_int32(frame_size * 3);
+      reader->seek(reader, back_pos, SEEK_SET);
+      ASSERT_EQ(reader->read(reader, buffer.data(), 100), 100);
+      EXPECT_EQ(memcmp(buffer.data(), data.data() + back_pos, 100), 0);
+      reader->seek(reader, pos, SEEK_SET);
+    }
+  }
+  EXPECT_EQ(reader->read(reader, buffer.data(), 1), 0);
+
+  /* Random access. */
+  for (int i = 0; i < 100; i++) {
+    const int64_t offset = rng.get_int32(data.size() - 1000);
+    reader->seek(reader, offset, SEEK_SET);
+    ASSERT_EQ(reader->read(reader, buffer.data(), 1000), 1000);
+    EXPECT_EQ(memcmp(buffer.data(), data.data() + offset, 1000), 0);
+  }
+
+  reader->close(reader);
+
+  BLI_threadapi_exit();
+  BLI_system_num_threads_override_set(0);
+}
+
+TEST(filereader, ZstdSeekableSingleThreaded)
+{
+  test_zstd_seekable_read(1);
+}
+
+TEST(filereader, ZstdSeekablePrefetch)
+{
+  test_zstd_seekable_read(8);
+}
+
+}  // namespace blender::tests
@@ -68,8 +68,12 @@ static void optimal_check_callback(void *userdata,
  * Note that a small epsilon is added to the BVH nodes bounds, even if we pass in zero.
  * Use rounding to ensure very close nodes don't cause the wrong node to be found as nearest.
  */
-static void find_nearest_points_test(
-    int points_len, float scale, int round, int random_seed, bool optimal = false)
+static void find_nearest_points_test(int points_len,
+                                     float scale,
+                                     int round,
+                                     int random_seed,
+                                     bool optimal = false,
+                                     bool add_leafs = false)
 {
   RNG *rng = BLI_rng_new(random_seed);
   BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
@@ -79,7 +83,18 @@ static void find_nearest_points_test(
 
   for (int i = 0; i < points_len; i++) {
     rng_v3_round(points[i], 3, rng, round, scale);
-    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  if (add_leafs) {
+    /* The order in which the leafs are set shouldn't matter. */
+    BLI_bvhtree_add_leafs(tree, points_len);
+    for (int i = points_len - 1; i >= 0; i--) {
+      BLI_bvhtree_set_leaf(tree, i, i, points[i], 1);
+    }
+  }
+  else {
+    for (int i = 0; i < points_len; i++) {
+      BLI_bvhtree_insert(tree, i, points[i], 1);
+    }
   }
   BLI_bvhtree_balance(tree);
 
@@ -121,6 +136,15 @@ TEST(kdopbvh, FindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12);
 }
+TEST(kdopbvh, FindNearest_70000)
+{
+  /* Enough leafs to refit the bounds of the top level branches in parallel. */
+  find_nearest_points_test(70000, 1.0, 100000, 7);
+}
+TEST(kdopbvh, FindNearestAddLeafs_500)
+{
+  find_nearest_points_test(500, 1.0, 1000, 12, false, true);
+}
 
 TEST(kdopbvh, OptimalFindNearest_1)
 {
@@ -134,3 +158,54 @@ TEST(kdopbvh, OptimalFindNearest_500)
 {
   find_nearest_points_test(500, 1.0, 1000, 12, true);
 }
+
+static void nearest_point_callback(void *userdata,
+                                   int index,
+                                   const float co[3],
+                                   BVHTreeNearest *nearest)
+{
+  float(*points)[3] = (float(*)[3])userdata;
+  const float dist_sq = len_squared_v3v3(co, points[index]);
+  if (dist_sq < nearest->dist_sq) {
+    nearest->index = index;
+    nearest->dist_sq = dist_sq;
+    copy_v3_v3(nearest->co, points[index]);
+  }
+}
+
+TEST(kdopbvh, FindNearestWithHint)
+{
+  const int points_len = 1000;
+  RNG *rng = BLI_rng_new(42);
+  BVHTree *tree = BLI_bvhtree_new(points_len, 0.0, 8, 8);
+  float(*points)[3] = (float(*)[3])MEM_mallocN(sizeof(float[3]) * points_len, __func__);
+  for (int i = 0; i < points_len; i++) {
+    rng_v3_round(points[i], 3, rng, 1000, 1.0f);
+    BLI_bvhtree_insert(tree, i, points[i], 1);
+  }
+  BLI_bvhtree_balance(tree);
+
+  /* Query positions on a path, like the coherent queries in a batch. Hints that are far away
+   * must not change the result either. */
+  int hint_index = -1;
+  for (int i = 0; i < 500; i++) {
+    const float co[3] = {float(i) / 250.0f - 1.0f, 0.3f, -0.2f};
+    BVHTreeNearest expected;
+    expected.index = -1;
+    expected.dist_sq = FLT_MAX;
+    BLI_bvhtree_find_nearest(tree, co, &expected, nearest_point_callback, points);
+
+    BVHTreeNearest nearest;
+    nearest.index = -1;
+    nearest.dist_sq = FLT_MAX;
+    BLI_bvhtree_find_nearest_with_hint(
+        tree, co, &nearest, nearest_point_callback, points, i % 7 == 0 ? 0 : hint_index);
+    EXPECT_EQ(nearest.dist_sq, expected.dist_sq);
+    EXPECT_EQ_ARRAY(nearest.co, expected.co, 3);
+    hint_index = nearest.index;
+  }
+
+  BLI_bvhtree_free(tree);
+  BLI_rng_free(rng);
+  MEM_freeN(points);
+}
@@ -711,6 +711,48 @@ TEST(map, Equality)
   EXPECT_NE(a, b);
 }
 
+static int counting_hash_calls_num = 0;
+struct CountingHash {
+  uint64_t operator()(const StringRef value) const
+  {
+    counting_hash_calls_num++;
+    return get_default_hash(value);
+  }
+};
+using CountingHashMap = Map<std::string,
+                            int,
+                            0,
+                            DefaultProbingStrategy,
+                            CountingHash,
+                            DefaultEquality<std::string>,
+                            HashedMapSlot<std::string, int>>;
+
+TEST(map, HashedSlotDoesNotRehash)
+{
+  CountingHashMap map;
+  for (int i = 0; i < 1000; i++) {
+    map.add_new(std::to_string(i), i);
+  }
+  /* Growing the map reuses the stored hashes. */
+  counting_hash_calls_num = 0;
+  map.reserve(10000);
+  EXPECT_EQ(counting_hash_calls_num, 0);
+
+  for (int i = 0; i < 1000; i++) {
+    EXPECT_EQ(map.lookup(std::to_string(i)), i);
+  }
+  EXPECT_FALSE(map.contains("1000"));
+  for (int i = 0; i < 500; i++) {
+    EXPECT_TRUE(map.remove(std::to_string(i * 2)));
+  }
+  EXPECT_EQ(map.size(), 500);
+  EXPECT_EQ(map.lookup("999"), 999);
+
+  CountingHashMap map_copy = map;
+  EXPECT_EQ(map_copy.lookup("1"), 1);
+  EXPECT_FALSE(map_copy.contains("2"));
+}
+
 /**
  * Set this to 1 to activate the benchmark. It is disabled by default, because it prints a lot.
  */
@@ -2,6 +2,9 @@
  *
  * SPDX-License-Identifier: Apache-2.0 */
 
+#include <chrono>
+#include <thread>
+
 #include "BLI_hash.hh"
 #include "BLI_memory_cache.hh"
 #include "BLI_memory_counter.hh"
@@ -50,6 +53,37 @@ class CachedInt : public memory_cache::CachedValue {
   }
 };
 
+class CachedBytes : public memory_cache::CachedValue {
+ public:
+  int64_t size;
+  std::string category_name;
+
+  CachedBytes(const int64_t size_in_bytes, std::string category = "")
+      : size(size_in_bytes), category_name(std::move(category))
+  {
+  }
+
+  void count_memory(MemoryCounter &memory) const override
+  {
+    memory.add(size);
+  }
+
+  StringRefNull category() const override
+  {
+    return category_name;
+  }
+};
+
+static bool is_cached(const int key)
+{
+  bool newly_computed = false;
+  memory_cache::get<CachedBytes>(GenericIntKey(key), [&]() {
+    newly_computed = true;
+    return std::make_unique<CachedBytes>(0);
+  });
+  return !newly_computed;
+}
+
 TEST(memory_cache, Simple)
 {
   memory_cache::clear();
@@ -80,4 +114,49 @@ TEST(memory_cache, Simple)
   }
 }
 
+TEST(memory_cache, KeepExpensiveValues)
+{
+  memory_cache::clear();
+  memory_cache::set_approximate_size_limit(1000);
+
+  /* Slow to compute, so it should be kept although it is used least recently. */
+  memory_cache::get<CachedBytes>(GenericIntKey(0), []() {
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    return std::make_unique<CachedBytes>(200);
+  });
+  for (int i = 1; i < 20; i++) {
+    memory_cache::get<CachedBytes>(GenericIntKey(i),
+                                   []() { return std::make_unique<CachedBytes>(200); });
+  }
+  EXPECT_TRUE(is_cached(0));
+  EXPECT_TRUE(is_cached(19));
+
+  memory_cache::clear();
+  memory_cache::set_approximate_size_limit(1024 * 1024 * 1024);
+}
+
+TEST(memory_cache, CategoryLimit)
+{
+  memory_cache::clear();
+  memory_cache::set_category_size_limit("test", 500);
+
+  for (int i = 0; i < 10; i++) {
+    memory_cache::get<CachedBytes>(GenericIntKey(i),
+                                   []() { return std::make_unique<CachedBytes>(300, "test"); });
+  }
+  /* Values of other categories are not affected by the limit. */
+  for (int i = 10; i < 20; i++) {
+    memory_cache::get<CachedBytes>(GenericIntKey(i),
+                                   []() { return std::make_unique<CachedBytes>(300); });
+  }
+  for (int i = 10; i < 20; i++) {
+    EXPECT_TRUE(is_cached(i));
+  }
+  EXPECT_TRUE(is_cached(9));
+  EXPECT_FALSE(is_cached(8));
+
+  memory_cache::set_category_size_limit("test", 0);
+  memory_cache::clear();
+}
+
 }  // namespace blender::memory_cache::tests
@@ -0,0 +1,95 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "testing/testing.h"
+
+#include "BLI_math_vector.hh"
+#include "BLI_quantized_float3_array.hh"
+#include "BLI_rand.hh"
+
+namespace blender::tests {
+
+static Array<float3> random_values(const int size, const float scale)
+{
+  RandomNumberGenerator rng(3);
+  Array<float3> values(size);
+  for (float3 &value : values) {
+    value = (float3(rng.get_float(), rng.get_float(), rng.get_float()) - 0.5f) * scale;
+  }
+  return values;
+}
+
+TEST(quantized_float3_array, Empty)
+{
+  const QuantizedFloat3Array array = QuantizedFloat3Array::encode(
+      {}, QuantizedFloat3Array::Encoding::FixedPoint);
+  EXPECT_EQ(array.size(), 0);
+}
+
+TEST(quantized_float3_array, Half)
+{
+  const Array<float3> values = random_values(10000, 100.0f);
+  const QuantizedFloat3Array array = QuantizedFloat3Array::encode(
+      values, QuantizedFloat3Array::Encoding::Half);
+  EXPECT_EQ(array.size(), values.size());
+  EXPECT_EQ(array.size_in_bytes(), values.as_span().size_in_bytes() / 2);
+
+  Array<float3> decoded(values.size());
+  array.decode(decoded);
+  for (const int i : values.index_range()) {
+    for (const int axis : IndexRange(3)) {
+      EXPECT_EQ(decoded[i][axis], math::half_to_float(math::float_to_half(values[i][axis])));
+    }
+    EXPECT_EQ(decoded[i], array[i]);
+  }
+}
+
+TEST(quantized_float3_array, FixedPoint)
+{
+  Array<float3> values = random_values(10000, 100.0f);
+  /* A flat axis should be decoded exactly. */
+  for (float3 &value : values) {
+    value.z = 2.5f;
+  }
+  const QuantizedFloat3Array array = QuantizedFloat3Array::encode(
+      values, QuantizedFloat3Array::Encoding::FixedPoint);
+
+  Array<float3> decoded(values.size());
+  array.decode(decoded);
+  const float max_error = 100.0f / 131070.0f * 1.05f;
+  for (const int i : values.index_range()) {
+    EXPECT_NEAR(decoded[i].x, values[i].x, max_error);
+    EXPECT_NEAR(decoded[i].y, values[i].y, max_error);
+    EXPECT_EQ(decoded[i].z, 2.5f);
+    EXPECT_EQ(decoded[i], array[i]);
+  }
+}
+
+TEST(quantized_float3_array, VArray)
+{
+  const Array<float3> values = random_values(10000, 10.0f);
+  auto array = std::make_shared<QuantizedFloat3Array>(
+      QuantizedFloat3Array::encode(values, QuantizedFloat3Array::Encoding::Half));
+  const VArray<float3> varray = QuantizedFloat3Array::as_varray(array);
+  array.reset();
+  EXPECT_EQ(varray.size(), values.size());
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      values.index_range(), GrainSize(1024), memory, [](const int64_t i) {
+        return i % 3 != 0 || i > 5000;
+      });
+
+  Array<float3> materialized(values.size(), float3(0.0f));
+  varray.materialize(mask, materialized);
+  Array<float3> compressed(mask.size());
+  varray.materialize_compressed(mask, compressed);
+  mask.foreach_index([&](const int64_t i, const int64_t pos) {
+    EXPECT_EQ(materialized[i], varray[i]);
+    EXPECT_EQ(compressed[pos], varray[i]);
+  });
+  EXPECT_EQ(materialized[3], float3(0.0f));
+}
+
+}  // namespace blender::tests
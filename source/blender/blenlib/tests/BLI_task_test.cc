@@ -12,6 +12,7 @@
 
 #include "BLI_utildefines.h"
 
+#include "BLI_array.hh"
 #include "BLI_listbase.h"
 #include "BLI_mempool.h"
 #include "BLI_task.h"
@@ -245,3 +246,39 @@ TEST(task, ParallelInvoke)
                                       [&]() { counter++; });
   EXPECT_EQ(counter, 6);
 }
+
+TEST(task, ParallelForNuma)
+{
+  /* Uses the task scheduler as it is set up for the tests, without NUMA arenas this is the same as
+   * #parallel_for. */
+  std::atomic<int> counter = 0;
+  blender::Array<int> data(ITEMS_NUM, 0);
+  blender::threading::parallel_for_numa(
+      data.index_range(), 64, [&](const blender::IndexRange range) {
+        for (const int64_t i : range) {
+          data[i]++;
+        }
+        counter += range.size();
+      });
+  EXPECT_EQ(counter, ITEMS_NUM);
+  for (const int value : data) {
+    EXPECT_EQ(value, 1);
+  }
+  EXPECT_GE(BLI_task_scheduler_numa_nodes_num(), 1);
+}
+
+TEST(task, ParallelForNumaSmallRange)
+{
+  /* Ranges that are not larger than the grain size are processed at once. */
+  int calls_num = 0;
+  blender::threading::parallel_for_numa(
+      blender::IndexRange(10, 64), 64, [&](const blender::IndexRange range) {
+        EXPECT_EQ(range, blender::IndexRange(10, 64));
+        calls_num++;
+      });
+  EXPECT_EQ(calls_num, 1);
+
+  blender::threading::parallel_for_numa(
+      blender::IndexRange(), 64, [&](const blender::IndexRange /*range*/) { calls_num++; });
+  EXPECT_EQ(calls_num, 1);
+}
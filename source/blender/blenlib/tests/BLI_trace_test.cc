@@ -0,0 +1,66 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_serialize.hh"
+#include "BLI_trace.hh"
+
+#include "testing/testing.h"
+
+namespace blender::trace::tests {
+
+TEST(trace, ZonesOnlyRecordedWhileActive)
+{
+  {
+    BLI_TRACE_ZONE("Before", "test");
+  }
+  begin();
+  EXPECT_TRUE(is_recording());
+  {
+    BLI_TRACE_ZONE("During", "test");
+  }
+  end();
+  EXPECT_FALSE(is_recording());
+  {
+    BLI_TRACE_ZONE("After", "test");
+  }
+
+  const std::string json = to_json();
+  EXPECT_NE(json.find("\"traceEvents\""), std::string::npos);
+  EXPECT_NE(json.find("\"During\""), std::string::npos);
+  EXPECT_EQ(json.find("\"Before\""), std::string::npos);
+  EXPECT_EQ(json.find("\"After\""), std::string::npos);
+}
+
+TEST(trace, BeginDiscardsPreviousEvents)
+{
+  begin();
+  {
+    BLI_TRACE_ZONE("First", "test");
+  }
+  end();
+  begin();
+  end();
+
+  const std::string json = to_json();
+  EXPECT_EQ(json.find("\"First\""), std::string::npos);
+}
+
+TEST(trace, ChromeTraceWriter)
+{
+  ChromeTraceWriter writer("Process");
+  io::serialize::DictionaryValue &event = writer.add_event("Event", "test", 2, 0.5, 0.75);
+  event.append_dict("args")->append_int("value", 42);
+
+  const std::string json = writer.to_json();
+  EXPECT_NE(json.find("\"Process\""), std::string::npos);
+  EXPECT_NE(json.find("\"Event\""), std::string::npos);
+  EXPECT_NE(json.find("\"value\""), std::string::npos);
+}
+
+TEST(trace, CurrentThreadIndexIsStable)
+{
+  EXPECT_EQ(current_thread_index(), current_thread_index());
+}
+
+}  // namespace blender::trace::tests
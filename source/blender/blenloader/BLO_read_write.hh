@@ -357,6 +357,34 @@ const blender::ImplicitSharingInfo *BLO_read_shared(
   return shared_data.sharing_info;
 }
 
+const blender::ImplicitSharingInfo *blo_read_mapped_data(BlendDataReader *reader,
+                                                         const void **ptr_p,
+                                                         size_t size_in_bytes,
+                                                         size_t alignment);
+
+/**
+ * Same as #BLO_read_shared, but for arrays of trivial types without pointers. When reading with
+ * #G_FLAG_READFILE_ZERO_COPY, large arrays can keep pointing into the memory-mapped file, pages
+ * are then only loaded when accessed and copied when written to. Otherwise \a read_fn is called.
+ */
+template<typename T>
+const blender::ImplicitSharingInfo *BLO_read_shared_mapped(
+    BlendDataReader *reader,
+    T **data_ptr,
+    const size_t size_in_bytes,
+    const size_t alignment,
+    blender::FunctionRef<const blender::ImplicitSharingInfo *()> read_fn)
+{
+  return BLO_read_shared(reader, data_ptr, [&]() -> const blender::ImplicitSharingInfo * {
+    if (const blender::ImplicitSharingInfo *sharing_info = blo_read_mapped_data(
+            reader, (const void **)data_ptr, size_in_bytes, alignment))
+    {
+      return sharing_info;
+    }
+    return read_fn();
+  });
+}
+
 int BLO_read_fileversion_get(BlendDataReader *reader);
 bool BLO_read_requires_endian_switch(BlendDataReader *reader);
 bool BLO_read_data_is_undo(BlendDataReader *reader);
@@ -13,6 +13,8 @@
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 
+#include "DNA_ID.h"
+
 namespace blender {
 class ImplicitSharingInfo;
 }
@@ -33,8 +35,13 @@ struct MemFileChunk {
   const char *buf;
   /** Size in bytes. */
   size_t size;
-  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk */
+  /** When true, this chunk is identical to the chunk of the same ID in the previous step, and
+   * its memory is shared with it. */
   bool is_identical;
+  /** When true, this chunk doesn't own the memory, it's shared with a previous #MemFileChunk.
+   * Always set for identical chunks, but also for chunks with the same content as any other
+   * chunk of the previous step, see #MemFileWriteData.reference_chunks_by_hash. */
+  bool is_buf_shared;
   /** When true, this chunk is also identical to the one in the next step (used by undo code to
    * detect unchanged IDs).
    * Defined when writing the next step (i.e. last undo step has those always false). */
@@ -42,6 +49,8 @@ struct MemFileChunk {
   /** Session UID of the ID being currently written (MAIN_ID_SESSION_UID_UNSET when not writing
    * ID-related data). Used to find matching chunks in previous memundo step. */
   uint id_session_uid;
+  /** Hash of the content of #buf. */
+  uint hash;
 };
 
 struct MemFile {
@@ -63,6 +72,12 @@ struct MemFileWriteData {
 
   /** Maps an ID session uid to its first reference MemFileChunk, if existing. */
   blender::Map<uint, MemFileChunk *> id_session_uid_mapping;
+  /**
+   * Maps content hashes to chunks of the reference memfile. Used to share the memory of chunks
+   * that are not found at the same position as in the reference memfile, e.g. because data was
+   * inserted before them.
+   */
+  blender::Map<uint, MemFileChunk *> reference_chunks_by_hash;
 };
 
 struct MemFileUndoData {
@@ -71,6 +86,26 @@ struct MemFileUndoData {
   size_t undo_size;
 };
 
+/**
+ * Statistics about reading a memfile undo step, to find out which data makes undo slow.
+ */
+struct MemFileReadStats {
+  struct IDTypeStats {
+    /** Number of unchanged IDs that were kept from the current main. */
+    int reused_num;
+    /** Number of changed or new IDs that had to be read from the memfile. */
+    int read_num;
+    /** Size of the data read from the memfile for these IDs. */
+    size_t read_size;
+    /** Time spent reading these IDs, in seconds. Does not include lib-linking. */
+    double read_duration;
+  };
+  /** Indexed by #eID_Index. */
+  IDTypeStats id_types[INDEX_ID_MAX];
+  /** Time spent reading the whole memfile, in seconds. */
+  double duration;
+};
+
 /* FileReader-compatible wrapper for reading MemFiles */
 struct UndoReader {
   FileReader reader;
@@ -111,5 +146,9 @@ void BLO_memfile_clear_future(MemFile *memfile);
 /* Utilities. */
 
 Main *BLO_memfile_main_get(MemFile *memfile, Main *bmain, Scene **r_scene);
+/**
+ * Statistics of the last memfile read by #BLO_read_from_memfile.
+ */
+const MemFileReadStats &BLO_memfile_read_stats_last();
 
 FileReader *BLO_memfile_new_filereader(MemFile *memfile, int undo_direction);
@@ -19,6 +19,7 @@
 #include "BLI_linklist.h"
 #include "BLI_path_utils.hh" /* Only for assertions. */
 #include "BLI_string.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 #include "DNA_genfile.h"
@@ -31,6 +32,7 @@
 
 #include "BLO_blend_defs.hh"
 #include "BLO_readfile.hh"
+#include "BLO_undofile.hh"
 
 #include "readfile.hh"
 
@@ -339,6 +341,8 @@ BlendFileData *BLO_read_from_memory(const void *mem,
   return bfd;
 }
 
+static MemFileReadStats memfile_read_stats_last = {};
+
 BlendFileData *BLO_read_from_memfile(Main *oldmain,
                                      const char *filepath,
                                      MemFile *memfile,
@@ -351,9 +355,13 @@ BlendFileData *BLO_read_from_memfile(Main *oldmain,
   BlendFileReadReport bf_reports{};
   bf_reports.reports = reports;
 
+  const double start_time = BLI_time_now_seconds();
+  memfile_read_stats_last = {};
+
   fd = blo_filedata_from_memfile(memfile, params, &bf_reports);
   if (fd) {
     fd->skip_flags = eBLOReadSkip(params->skip_flags);
+    fd->memfile_read_stats = &memfile_read_stats_last;
     STRNCPY(fd->relabase, filepath);
 
     /* Build old ID map for all old IDs. */
@@ -388,9 +396,16 @@ BlendFileData *BLO_read_from_memfile(Main *oldmain,
     blo_filedata_free(fd);
   }
 
+  memfile_read_stats_last.duration = BLI_time_now_seconds() - start_time;
+
   return bfd;
 }
 
+const MemFileReadStats &BLO_memfile_read_stats_last()
+{
+  return memfile_read_stats_last;
+}
+
 void BLO_blendfiledata_free(BlendFileData *bfd)
 {
   if (bfd->main) {
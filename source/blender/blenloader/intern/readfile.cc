@@ -58,6 +58,8 @@
 #include "BLI_map.hh"
 #include "BLI_memarena.h"
 #include "BLI_mempool.h"
+#include "BLI_mmap.h"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
 #include "BLI_time.h"
 
@@ -206,6 +208,55 @@ struct BHeadN {
  */
 #define BHEAD_USE_READ_ON_DEMAND(bhead) ((bhead)->code == BLO_CODE_DATA)
 
+/**
+ * Minimum size of data blocks that are kept backed by the memory-mapped file when reading with
+ * #G_FLAG_READFILE_ZERO_COPY. Smaller blocks are cheap to copy and would only add overhead.
+ */
+#define MAPPED_DATA_SIZE_MIN (64 * 1024)
+
+/**
+ * Shared ownership of the memory-mapped blend-file, used when reading with
+ * #G_FLAG_READFILE_ZERO_COPY. Every array that points into the mapping holds a user, so the file
+ * stays mapped after the #FileData has been freed.
+ */
+class MappedFileSharingInfo : public blender::ImplicitSharingInfo {
+ public:
+  BLI_mmap_file *mmap_file;
+
+  MappedFileSharingInfo(BLI_mmap_file *mmap_file) : mmap_file(mmap_file)
+  {
+    BLI_mmap_add_user(mmap_file);
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    BLI_mmap_free(mmap_file);
+    MEM_delete(this);
+  }
+};
+
+/**
+ * Sharing info for a single array that points into the memory-mapped file. The mapping is
+ * private, so writing to the array only copies the touched pages and never modifies the file.
+ */
+class MappedDataSharingInfo : public blender::ImplicitSharingInfo {
+ public:
+  const MappedFileSharingInfo &file_info;
+
+  MappedDataSharingInfo(const MappedFileSharingInfo &file_info) : file_info(file_info)
+  {
+    file_info.add_user();
+  }
+
+ private:
+  void delete_self_with_data() override
+  {
+    file_info.remove_user_and_delete_if_last();
+    MEM_delete(this);
+  }
+};
+
 /* -------------------------------------------------------------------- */
 /** \name Blend Loader Reporting Wrapper
  * \{ */
@@ -250,6 +301,11 @@ struct NewAddress {
 
 struct OldNewMap {
   blender::Map<const void *, NewAddress> map;
+  /**
+   * Entries of #map whose new addresses still point into the memory-mapped file, with the #BHead
+   * they have been read from. These are not owned, see #datamap_ensure_owned.
+   */
+  blender::Map<const void *, BHead *> mapped_data;
 };
 
 static OldNewMap *oldnewmap_new()
@@ -312,12 +368,13 @@ static void *oldnewmap_liblookup(OldNewMap *onm, const void *addr, const bool is
 static void oldnewmap_clear(OldNewMap *onm)
 {
   /* Free unused data. */
-  for (NewAddress &new_addr : onm->map.values()) {
-    if (new_addr.nr == 0) {
-      MEM_freeN(new_addr.newp);
+  for (const auto item : onm->map.items()) {
+    if (item.value.nr == 0 && !onm->mapped_data.contains(item.key)) {
+      MEM_freeN(item.value.newp);
     }
   }
   onm->map.clear_and_shrink();
+  onm->mapped_data.clear_and_shrink();
 }
 
 static void oldnewmap_free(OldNewMap *onm)
@@ -1265,6 +1322,35 @@ static FileData *blo_filedata_from_file_open(const char *filepath, BlendFileRead
   return blo_filedata_from_file_descriptor(filepath, reports, file);
 }
 
+/**
+ * Prepare the reading modes that access the memory-mapped file directly, see
+ * #G_FLAG_READFILE_ZERO_COPY and #G_FLAG_READFILE_THREADED.
+ */
+static void blo_filedata_mapped_file_init(FileData *fd)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if ((G.f & (G_FLAG_READFILE_ZERO_COPY | G_FLAG_READFILE_THREADED)) == 0) {
+    return;
+  }
+  /* Data that needs endian switching has to be converted in place in the #BHead. */
+  if (fd->flags & (FD_FLAGS_SWITCH_ENDIAN | FD_FLAGS_IS_MEMFILE)) {
+    return;
+  }
+  BLI_mmap_file *mmap_file = BLI_filereader_mmap_file(fd->file);
+  if (mmap_file == nullptr) {
+    return;
+  }
+  if (G.f & G_FLAG_READFILE_ZERO_COPY) {
+    fd->mapped_file = MEM_new<MappedFileSharingInfo>(__func__, mmap_file);
+  }
+  if (G.f & G_FLAG_READFILE_THREADED) {
+    fd->threaded_read_mmap_file = mmap_file;
+  }
+#else
+  UNUSED_VARS(fd);
+#endif
+}
+
 FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *reports)
 {
   FileData *fd = blo_filedata_from_file_open(filepath, reports);
@@ -1272,7 +1358,11 @@ FileData *blo_filedata_from_file(const char *filepath, BlendFileReadReport *repo
     /* needed for library_append and read_libraries */
     STRNCPY(fd->relabase, filepath);
 
-    return blo_decode_and_check(fd, reports->reports);
+    fd = blo_decode_and_check(fd, reports->reports);
+    if (fd != nullptr) {
+      blo_filedata_mapped_file_init(fd);
+    }
+    return fd;
   }
   return nullptr;
 }
@@ -1370,6 +1460,10 @@ void blo_filedata_free(FileData *fd)
     DNA_reconstruct_info_free(fd->reconstruct_info);
   }
 
+  if (fd->mapped_file) {
+    fd->mapped_file->remove_user_and_delete_if_last();
+  }
+
   if (fd->datamap) {
     oldnewmap_free(fd->datamap);
   }
@@ -1395,6 +1489,9 @@ void blo_filedata_free(FileData *fd)
     BLI_ghash_free(fd->bhead_idname_hash, nullptr, nullptr);
   }
 #endif
+  if (fd->library_main_hash) {
+    BLI_ghash_free(fd->library_main_hash, nullptr, nullptr);
+  }
 
   MEM_freeN(fd);
 }
@@ -1449,15 +1546,39 @@ short BLO_version_from_file(const char *filepath)
 /** \name Old/New Pointer Map
  * \{ */
 
+/**
+ * Data that is still backed by the memory-mapped file can only be handed out through
+ * #BLO_read_shared_mapped, all other code expects to own the memory. Read a copy in that case.
+ */
+static void datamap_ensure_owned(FileData *fd, const void *old_address)
+{
+  OldNewMap *onm = fd->datamap;
+  if (onm->mapped_data.is_empty()) {
+    return;
+  }
+  BHead *bhead = onm->mapped_data.pop_default(old_address, nullptr);
+  if (bhead == nullptr) {
+    return;
+  }
+  void *data = read_struct(fd, bhead, "Data from mapped file", INDEX_ID_NULL);
+  if (data == nullptr) {
+    onm->map.remove(old_address);
+    return;
+  }
+  onm->map.lookup(old_address).newp = data;
+}
+
 /* Only direct data-blocks. */
 static void *newdataadr(FileData *fd, const void *adr)
 {
+  datamap_ensure_owned(fd, adr);
   return oldnewmap_lookup_and_inc(fd->datamap, adr, true);
 }
 
 /* Only direct data-blocks. */
 static void *newdataadr_no_us(FileData *fd, const void *adr)
 {
+  datamap_ensure_owned(fd, adr);
   return oldnewmap_lookup_and_inc(fd->datamap, adr, false);
 }
 
@@ -2461,6 +2582,127 @@ static bool direct_link_id(FileData *fd, Main *main, const int tag, ID *id, ID *
   return success;
 }
 
+/**
+ * Get the address of the block data in the memory-mapped file, when the block can be used without
+ * copying it (see #G_FLAG_READFILE_ZERO_COPY).
+ */
+static void *bhead_mapped_data(FileData *fd, BHead *bhead)
+{
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  if (fd->mapped_file == nullptr) {
+    return nullptr;
+  }
+  if (bhead->len < MAPPED_DATA_SIZE_MIN) {
+    return nullptr;
+  }
+  if (fd->compflags[bhead->SDNAnr] != SDNA_CMP_EQUAL) {
+    return nullptr;
+  }
+  const BHeadN *bheadn = BHEADN_FROM_BHEAD(bhead);
+  if (bheadn->has_data) {
+    return nullptr;
+  }
+  BLI_mmap_file *mmap_file = fd->mapped_file->mmap_file;
+  if (size_t(bheadn->file_offset) + size_t(bhead->len) > BLI_mmap_get_length(mmap_file)) {
+    return nullptr;
+  }
+  return POINTER_OFFSET(BLI_mmap_get_pointer(mmap_file), bheadn->file_offset);
+#else
+  UNUSED_VARS(fd, bhead);
+  return nullptr;
+#endif
+}
+
+/**
+ * Thread-safe version of #read_struct, with the allocation name computed in advance. Only
+ * possible when the data can be read from the memory-mapped file directly, since reading through
+ * #FileData.file changes the state of the reader. Endian switching is not supported.
+ */
+static void *read_struct_threadsafe(FileData *fd, BHead *bh, const char *alloc_name)
+{
+  BLI_assert(fd->threaded_read_mmap_file != nullptr);
+  BLI_assert((fd->flags & FD_FLAGS_SWITCH_ENDIAN) == 0);
+  if (bh->len == 0 || fd->compflags[bh->SDNAnr] == SDNA_CMP_REMOVED) {
+    return nullptr;
+  }
+
+  BLI_mmap_file *mmap_file = fd->threaded_read_mmap_file;
+  const void *bh_data = bh + 1;
+#ifdef USE_BHEAD_READ_ON_DEMAND
+  const BHeadN *bheadn = BHEADN_FROM_BHEAD(bh);
+  if (!bheadn->has_data) {
+    if (size_t(bheadn->file_offset) + size_t(bh->len) > BLI_mmap_get_length(mmap_file)) {
+      return nullptr;
+    }
+    bh_data = POINTER_OFFSET(BLI_mmap_get_pointer(mmap_file), bheadn->file_offset);
+  }
+#endif
+
+  void *temp;
+  if (fd->compflags[bh->SDNAnr] == SDNA_CMP_NOT_EQUAL) {
+    temp = DNA_struct_reconstruct(fd->reconstruct_info, bh->SDNAnr, bh->nr, bh_data, alloc_name);
+  }
+  else {
+    const int alignment = DNA_struct_alignment(fd->filesdna, bh->SDNAnr);
+    temp = MEM_mallocN_aligned(bh->len, alignment, alloc_name);
+    memcpy(temp, bh_data, bh->len);
+  }
+
+  if (UNLIKELY(BLI_mmap_has_io_error(mmap_file))) {
+    MEM_SAFE_FREE(temp);
+  }
+  return temp;
+}
+
+/**
+ * Minimum amount of data of a single ID to read it on multiple threads, see
+ * #G_FLAG_READFILE_THREADED.
+ */
+#define THREADED_READ_SIZE_MIN (256 * 1024)
+
+/**
+ * Read the data blocks of an ID. Large blocks are copied from the memory-mapped file and
+ * reconstructed on multiple threads, the creation of the data map remains single threaded.
+ */
+static void read_structs_threaded(FileData *fd,
+                                  const blender::Span<BHead *> bheads,
+                                  const char *allocname,
+                                  const int id_type_index,
+                                  blender::MutableSpan<void *> r_data)
+{
+  using namespace blender;
+  /* #get_alloc_name uses storage that is not thread-safe. */
+  Array<const char *> alloc_names(bheads.size());
+  for (const int64_t i : bheads.index_range()) {
+    alloc_names[i] = get_alloc_name(fd, bheads[i], allocname, id_type_index);
+  }
+
+  threading::parallel_for(bheads.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      r_data[i] = read_struct_threadsafe(fd, bheads[i], alloc_names[i]);
+    }
+  });
+
+  for (const int64_t i : bheads.index_range()) {
+    if (r_data[i] == nullptr && bheads[i]->len != 0 &&
+        fd->compflags[bheads[i]->SDNAnr] != SDNA_CMP_REMOVED)
+    {
+      fd->flags &= ~FD_FLAGS_FILE_OK;
+    }
+  }
+}
+
+static void datamap_insert(FileData *fd, BHead *bhead, void *data)
+{
+  const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
+  if (!is_new) {
+    CLOG_ERROR(&LOG,
+               "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
+               "value (%p) for a given ID.",
+               bhead->old);
+  }
+}
+
 /* Read all data associated with a datablock into datamap. */
 static BHead *read_data_into_datamap(FileData *fd,
                                      BHead *bhead,
@@ -2469,16 +2711,54 @@ static BHead *read_data_into_datamap(FileData *fd,
 {
   bhead = blo_bhead_next(fd, bhead);
 
+  if (fd->threaded_read_mmap_file) {
+    blender::Vector<BHead *, 32> data_bheads;
+    int64_t data_size = 0;
+    while (bhead && bhead->code == BLO_CODE_DATA) {
+      if (void *mapped_data = bhead_mapped_data(fd, bhead)) {
+        if (oldnewmap_insert(fd->datamap, bhead->old, mapped_data, 0)) {
+          fd->datamap->mapped_data.add_overwrite(bhead->old, bhead);
+        }
+      }
+      else {
+        data_bheads.append(bhead);
+        data_size += bhead->len;
+      }
+      bhead = blo_bhead_next(fd, bhead);
+    }
+
+    if (data_size >= THREADED_READ_SIZE_MIN && data_bheads.size() > 1) {
+      blender::Array<void *> data(data_bheads.size());
+      read_structs_threaded(fd, data_bheads, allocname, id_type_index, data);
+      for (const int64_t i : data_bheads.index_range()) {
+        if (data[i]) {
+          datamap_insert(fd, data_bheads[i], data[i]);
+        }
+      }
+    }
+    else {
+      for (BHead *data_bhead : data_bheads) {
+        if (void *data = read_struct(fd, data_bhead, allocname, id_type_index)) {
+          datamap_insert(fd, data_bhead, data);
+        }
+      }
+    }
+    return bhead;
+  }
+
   while (bhead && bhead->code == BLO_CODE_DATA) {
+    if (void *mapped_data = bhead_mapped_data(fd, bhead)) {
+      /* Only read when the data is actually used, see #datamap_ensure_owned. */
+      if (oldnewmap_insert(fd->datamap, bhead->old, mapped_data, 0)) {
+        fd->datamap->mapped_data.add_overwrite(bhead->old, bhead);
+      }
+      bhead = blo_bhead_next(fd, bhead);
+      continue;
+    }
+
     void *data = read_struct(fd, bhead, allocname, id_type_index);
     if (data) {
-      const bool is_new = oldnewmap_insert(fd->datamap, bhead->old, data, 0);
-      if (!is_new) {
-        CLOG_ERROR(&LOG,
-                   "Blendfile corruption: Invalid, or multiple `bhead` with same old address "
-                   "value (%p) for a given ID.",
-                   bhead->old);
-      }
+      datamap_insert(fd, bhead, data);
     }
 
     bhead = blo_bhead_next(fd, bhead);
@@ -2854,6 +3134,33 @@ static bool read_libblock_undo_restore(
   return false;
 }
 
+/* Statistics of the ID type of the block, only when they are gathered for memfile undo. */
+static MemFileReadStats::IDTypeStats *memfile_read_stats_for_bhead(FileData *fd, BHead *bhead)
+{
+  if (fd->memfile_read_stats == nullptr) {
+    return nullptr;
+  }
+  const int id_type_index = BKE_idtype_idcode_to_index(GS(blo_bhead_id_name(fd, bhead)));
+  if (id_type_index < 0) {
+    return nullptr;
+  }
+  return &fd->memfile_read_stats->id_types[id_type_index];
+}
+
+/* Count a data-block that was read, with all blocks of its direct data. */
+static void memfile_read_stats_add_read(FileData *fd,
+                                        MemFileReadStats::IDTypeStats *stats,
+                                        BHead *bhead,
+                                        BHead *bhead_next,
+                                        const double start_time)
+{
+  stats->read_num++;
+  for (; bhead && bhead != bhead_next; bhead = blo_bhead_next(fd, bhead)) {
+    stats->read_size += sizeof(BHead) + size_t(bhead->len);
+  }
+  stats->read_duration += BLI_time_now_seconds() - start_time;
+}
+
 /* This routine reads a datablock and its direct data, and advances bhead to
  * the next datablock. For library linked datablocks, only a placeholder will
  * be generated, to be replaced in read_library_linked_ids.
@@ -2870,12 +3177,19 @@ static BHead *read_libblock(FileData *fd,
 {
   const bool do_partial_undo = (fd->skip_flags & BLO_READ_SKIP_UNDO_OLD_MAIN) == 0;
 
+  MemFileReadStats::IDTypeStats *undo_stats = memfile_read_stats_for_bhead(fd, bhead);
+  const double undo_start_time = undo_stats ? BLI_time_now_seconds() : 0.0;
+  BHead *id_bhead = bhead;
+
   /* First attempt to restore existing datablocks for undo.
    * When datablocks are changed but still exist, we restore them at the old
    * address and inherit recalc flags for the dependency graph. */
   ID *id_old = nullptr;
   if (fd->flags & FD_FLAGS_IS_MEMFILE) {
     if (read_libblock_undo_restore(fd, main, bhead, id_tag, &id_old)) {
+      if (undo_stats) {
+        undo_stats->reused_num++;
+      }
       if (r_id) {
         *r_id = id_old;
       }
@@ -2986,6 +3300,10 @@ static BHead *read_libblock(FileData *fd,
     }
   }
 
+  if (undo_stats) {
+    memfile_read_stats_add_read(fd, undo_stats, id_bhead, bhead, undo_start_time);
+  }
+
   return bhead;
 }
 
@@ -3850,20 +4168,60 @@ static void sort_bhead_old_map(FileData *fd)
   qsort(fd->bheadmap, tot, sizeof(BHeadSort), verg_bheadsort);
 }
 
-static BHead *find_previous_lib(FileData *fd, BHead *bhead)
+/**
+ * Find the #Main of the library a link placeholder belongs to, adding it to #FileData.mainlist
+ * if needed.
+ *
+ * Expanding visits the same placeholders many times when a lot of data is linked, and walking
+ * back to the library block, reading it and comparing its path against every library in
+ * #FileData.mainlist grows quadratically. Since placeholders directly follow their library in
+ * the file, results are cached for both and the walk stops at the first known block.
+ */
+static Main *find_placeholder_library_main(FileData *fd, BHead *bhead)
 {
   /* Skip library data-blocks in undo, see comment in read_libblock. */
   if (fd->flags & FD_FLAGS_IS_MEMFILE) {
     return nullptr;
   }
 
-  for (; bhead; bhead = blo_bhead_prev(fd, bhead)) {
-    if (bhead->code == ID_LI) {
+  if (fd->library_main_hash == nullptr) {
+    fd->library_main_hash = BLI_ghash_ptr_new(__func__);
+  }
+
+  Main *libmain = nullptr;
+  BHead *bhead_iter = bhead;
+  for (; bhead_iter; bhead_iter = blo_bhead_prev(fd, bhead_iter)) {
+    libmain = static_cast<Main *>(BLI_ghash_lookup(fd->library_main_hash, bhead_iter));
+    if (libmain != nullptr) {
+      break;
+    }
+    if (bhead_iter->code == ID_LI) {
+      Library *lib = static_cast<Library *>(
+          read_struct(fd, bhead_iter, "Data for Library ID type", INDEX_ID_NULL));
+      libmain = blo_find_main(fd, lib->filepath, fd->relabase);
+      MEM_freeN(lib);
       break;
     }
   }
+  if (libmain == nullptr) {
+    return nullptr;
+  }
 
-  return bhead;
+  for (BHead *bhead_new = bhead; bhead_new != bhead_iter;
+       bhead_new = blo_bhead_prev(fd, bhead_new))
+  {
+    BLI_ghash_insert(fd->library_main_hash, bhead_new, libmain);
+  }
+  BLI_ghash_reinsert(fd->library_main_hash, bhead_iter, libmain, nullptr, nullptr);
+  return libmain;
+}
+
+static void library_main_hash_clear(FileData *fd)
+{
+  if (fd->library_main_hash) {
+    BLI_ghash_free(fd->library_main_hash, nullptr, nullptr);
+    fd->library_main_hash = nullptr;
+  }
 }
 
 static BHead *find_bhead(FileData *fd, void *old)
@@ -3998,15 +4356,11 @@ static void expand_doit_library(void *fdhandle, Main *mainvar, void *old)
 
   if (bhead->code == ID_LINK_PLACEHOLDER) {
     /* Placeholder link to data-block in another library. */
-    BHead *bheadlib = find_previous_lib(fd, bhead);
-    if (bheadlib == nullptr) {
+    Main *libmain = find_placeholder_library_main(fd, bhead);
+    if (libmain == nullptr) {
       return;
     }
 
-    Library *lib = static_cast<Library *>(
-        read_struct(fd, bheadlib, "Data for Library ID type", INDEX_ID_NULL));
-    Main *libmain = blo_find_main(fd, lib->filepath, fd->relabase);
-
     if (libmain->curlib == nullptr) {
       const char *idname = blo_bhead_id_name(fd, bhead);
 
@@ -4056,12 +4410,12 @@ static void expand_doit_library(void *fdhandle, Main *mainvar, void *old)
       /* Commented because this can print way too much. */
 #if 0
       if (G.debug & G_DEBUG) {
-        printf("expand_doit: already linked: %s lib: %s\n", id->name, lib->filepath);
+        printf("expand_doit: already linked: %s lib: %s\n",
+               id->name,
+               libmain->curlib->filepath);
       }
 #endif
     }
-
-    MEM_freeN(lib);
   }
   else {
     /* Data-block in same library. */
@@ -4250,6 +4604,7 @@ static Main *library_link_begin(Main *mainvar,
   fd->id_tag_extra = id_tag_extra;
 
   fd->mainlist = static_cast<ListBase *>(MEM_callocN(sizeof(ListBase), "FileData.mainlist"));
+  library_main_hash_clear(fd);
 
   /* make mains */
   blo_split_main(fd->mainlist, mainvar);
@@ -4757,6 +5112,14 @@ static void read_libraries(FileData *basefd, ListBase *mainlist)
     }
   }
 
+  /* Cached library mains are not valid anymore once the mainlist is joined. */
+  library_main_hash_clear(basefd);
+  for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
+    if (mainptr->curlib->runtime.filedata) {
+      library_main_hash_clear(mainptr->curlib->runtime.filedata);
+    }
+  }
+
   for (Main *mainptr = mainl->next; mainptr; mainptr = mainptr->next) {
     /* Drop weak links for which no data-block was found.
      * Since this can remap pointers in `libmap` of all libraries, it needs to be performed in its
@@ -5101,6 +5464,31 @@ blender::ImplicitSharingInfoAndData blo_read_shared_impl(
   return shared_data;
 }
 
+const blender::ImplicitSharingInfo *blo_read_mapped_data(BlendDataReader *reader,
+                                                         const void **ptr_p,
+                                                         const size_t size_in_bytes,
+                                                         const size_t alignment)
+{
+  FileData *fd = reader->fd;
+  if (fd->mapped_file == nullptr) {
+    return nullptr;
+  }
+  const BHead *bhead = fd->datamap->mapped_data.lookup_default(*ptr_p, nullptr);
+  if (bhead == nullptr) {
+    return nullptr;
+  }
+  const void *data = fd->datamap->map.lookup(*ptr_p).newp;
+  if (size_t(bhead->len) < size_in_bytes || (uintptr_t(data) % alignment) != 0) {
+    /* Let the regular reading code handle (and report) unexpected data. */
+    return nullptr;
+  }
+  if (BLI_mmap_has_io_error(fd->mapped_file->mmap_file)) {
+    return nullptr;
+  }
+  *ptr_p = data;
+  return MEM_new<MappedDataSharingInfo>(__func__, *fd->mapped_file);
+}
+
 bool BLO_read_data_is_undo(BlendDataReader *reader)
 {
   return (reader->fd->flags & FD_FLAGS_IS_MEMFILE);
@@ -22,6 +22,10 @@
 
 #include "BLO_readfile.hh"
 
+namespace blender {
+class ImplicitSharingInfo;
+}
+class MappedFileSharingInfo;
 struct BlendFileData;
 struct BlendfileLinkAppendContext;
 struct BlendFileReadParams;
@@ -33,6 +37,7 @@ struct IDNameLib_Map;
 struct Key;
 struct Main;
 struct MemFile;
+struct MemFileReadStats;
 struct Object;
 struct OldNewMap;
 struct UserDef;
@@ -108,6 +113,17 @@ struct FileData {
   OldNewMap *datamap;
   OldNewMap *globmap;
 
+  /**
+   * Set when reading with #G_FLAG_READFILE_ZERO_COPY from a memory-mapped file, large arrays read
+   * with #BLO_read_shared_mapped then keep pointing into the mapping instead of being copied.
+   */
+  MappedFileSharingInfo *mapped_file;
+  /**
+   * Set when reading with #G_FLAG_READFILE_THREADED from a memory-mapped file. Data blocks can
+   * then be read from the mapping on multiple threads, without using #file.
+   */
+  BLI_mmap_file *threaded_read_mmap_file;
+
   /**
    * Store mapping from old ID pointers (the values they have in the .blend file) to new ones,
    * typically from value in `bhead->old` to address in memory where the ID was read.
@@ -122,6 +138,11 @@ struct FileData {
 
   /** See: #USE_GHASH_BHEAD. */
   GHash *bhead_idname_hash;
+  /**
+   * Library and link placeholder #BHead's mapped to the #Main of their library in #mainlist, see
+   * #find_placeholder_library_main. Cleared before #mainlist gets joined.
+   */
+  GHash *library_main_hash;
 
   ListBase *mainlist;
   /** Used for undo. */
@@ -142,6 +163,8 @@ struct FileData {
   IDNameLib_Map *new_idmap_uid;
 
   BlendFileReadReport *reports;
+  /** Optional statistics gathered when reading a memfile undo step. */
+  MemFileReadStats *memfile_read_stats;
 
   /** Opaque handle to the storage system used for non-static allocation strings. */
   void *storage_handle;
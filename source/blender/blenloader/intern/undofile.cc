@@ -25,6 +25,7 @@
 #include "DNA_listBase.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_hash_mm2a.hh"
 #include "BLI_implicit_sharing.hh"
 
 #include "BLO_readfile.hh"
@@ -41,7 +42,7 @@
 void BLO_memfile_free(MemFile *memfile)
 {
   while (MemFileChunk *chunk = static_cast<MemFileChunk *>(BLI_pophead(&memfile->chunks))) {
-    if (chunk->is_identical == false) {
+    if (chunk->is_buf_shared == false) {
       MEM_freeN((void *)chunk->buf);
     }
     MEM_freeN(chunk);
@@ -67,7 +68,7 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
 
   /* First, detect all memchunks in second memfile that are not owned by it. */
   LISTBASE_FOREACH (MemFileChunk *, sc, &second->chunks) {
-    if (sc->is_identical) {
+    if (sc->is_buf_shared) {
       buffer_to_second_memchunk.add(sc->buf, sc);
     }
   }
@@ -75,11 +76,13 @@ void BLO_memfile_merge(MemFile *first, MemFile *second)
   /* Now, check all chunks from first memfile (the one we are removing), and if a memchunk owned by
    * it is also used by the second memfile, transfer the ownership. */
   LISTBASE_FOREACH (MemFileChunk *, fc, &first->chunks) {
-    if (!fc->is_identical) {
+    if (!fc->is_buf_shared) {
       if (MemFileChunk *sc = buffer_to_second_memchunk.lookup_default(fc->buf, nullptr)) {
-        BLI_assert(sc->is_identical);
+        BLI_assert(sc->is_buf_shared);
         sc->is_identical = false;
+        sc->is_buf_shared = false;
         fc->is_identical = true;
+        fc->is_buf_shared = true;
       }
       /* Note that if the second memfile does not use that chunk, we assume that the first one
        * fully owns it without sharing it with any other memfile, and hence it should be freed with
@@ -119,6 +122,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
         current_session_uid = mem_chunk->id_session_uid;
         mem_data->id_session_uid_mapping.add_new(current_session_uid, mem_chunk);
       }
+      mem_data->reference_chunks_by_hash.add(mem_chunk->hash, mem_chunk);
     }
   }
 }
@@ -126,6 +130,7 @@ void BLO_memfile_write_init(MemFileWriteData *mem_data,
 void BLO_memfile_write_finalize(MemFileWriteData *mem_data)
 {
   mem_data->id_session_uid_mapping.clear_and_shrink();
+  mem_data->reference_chunks_by_hash.clear_and_shrink();
 }
 
 void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t size)
@@ -138,6 +143,7 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
   curchunk->size = size;
   curchunk->buf = nullptr;
   curchunk->is_identical = false;
+  curchunk->is_buf_shared = false;
   /* This is unsafe in the sense that an app handler or other code that does not
    * perform an undo push may make changes after the last undo push that
    * will then not be undo. Though it's not entirely clear that is wrong behavior. */
@@ -152,12 +158,29 @@ void BLO_memfile_chunk_add(MemFileWriteData *mem_data, const char *buf, size_t s
       if (memcmp(compchunk->buf, buf, size) == 0) {
         curchunk->buf = compchunk->buf;
         curchunk->is_identical = true;
+        curchunk->is_buf_shared = true;
+        curchunk->hash = compchunk->hash;
         compchunk->is_identical_future = true;
       }
     }
     *compchunk_step = static_cast<MemFileChunk *>(compchunk->next);
   }
 
+  if (curchunk->buf == nullptr) {
+    /* Not at the same position, but the same data may still be somewhere else in the reference
+     * memfile. Only share the memory in that case, when the chunk belongs to another ID (or
+     * another part of the same ID) it must not make the ID considered unchanged. */
+    curchunk->hash = BLI_hash_mm2(reinterpret_cast<const uchar *>(buf), size, 0);
+    if (MemFileChunk *refchunk = mem_data->reference_chunks_by_hash.lookup_default(curchunk->hash,
+                                                                                    nullptr))
+    {
+      if (refchunk->size == size && memcmp(refchunk->buf, buf, size) == 0) {
+        curchunk->buf = refchunk->buf;
+        curchunk->is_buf_shared = true;
+      }
+    }
+  }
+
   /* not equal... */
   if (curchunk->buf == nullptr) {
     char *buf_new = static_cast<char *>(MEM_mallocN(size, "Chunk buffer"));
@@ -59,6 +59,7 @@
  */
 
 #include <cerrno>
+#include <cinttypes>
 #include <climits>
 #include <cmath>
 #include <cstdio>
@@ -87,6 +88,7 @@
 #include "DNA_key_types.h"
 #include "DNA_sdna_types.h"
 
+#include "BLI_array.hh"
 #include "BLI_bitmap.h"
 #include "BLI_blenlib.h"
 #include "BLI_endian_defines.h"
@@ -97,7 +99,9 @@
 #include "BLI_math_base.h"
 #include "BLI_mempool.h"
 #include "BLI_set.hh"
+#include "BLI_task.hh"
 #include "BLI_threads.h"
+#include "BLI_vector.hh"
 
 #include "MEM_guardedalloc.h" /* MEM_freeN */
 
@@ -151,6 +155,11 @@ static CLG_LogRef LOG = {"blo.writefile"};
 /** Use if we want to store how many bytes have been written to the file. */
 // #define USE_WRITE_DATA_LEN
 
+#ifdef __linux__
+/** Support #G_FLAG_WRITEFILE_INCREMENTAL, this needs `copy_file_range`. */
+#  define USE_INCREMENTAL_WRITE
+#endif
+
 /* -------------------------------------------------------------------- */
 /** \name Internal Write Wrapper's (Abstracts Compression)
  * \{ */
@@ -204,6 +213,176 @@ bool RawWriteWrap::write(const void *buf, size_t buf_len)
   return ::write(file_handle, buf, buf_len) == buf_len;
 }
 
+/** Collects the written data in memory, used to write data-blocks on multiple threads. */
+class BufferWriteWrap : public WriteWrap {
+ public:
+  BufferWriteWrap()
+  {
+    use_buf = false;
+  }
+
+  bool open(const char * /*filepath*/) override
+  {
+    return true;
+  }
+  bool close() override
+  {
+    return true;
+  }
+  bool write(const void *buf, size_t buf_len) override
+  {
+    data.extend(blender::Span(static_cast<const char *>(buf), int64_t(buf_len)));
+    return true;
+  }
+
+  blender::Vector<char> data;
+};
+
+#ifdef USE_INCREMENTAL_WRITE
+
+/**
+ * Write wrapper for saving over an existing file (see #G_FLAG_WRITEFILE_INCREMENTAL).
+ *
+ * Everything written is compared against the same byte range of the previous file, identical
+ * ranges are copied with `copy_file_range` instead of being written. On network and copy-on-write
+ * file systems this is a server side copy or a reflink, so only the changed parts of the file are
+ * sent. The previous file is usually still in the page cache from loading or the last save.
+ *
+ * Since addresses stored in the file change on every load, this mostly helps repeated saving
+ * within a session, where unchanged data keeps its addresses and its offset in the file.
+ */
+class IncrementalWriteWrap : public WriteWrap {
+ public:
+  IncrementalWriteWrap(const char *filepath_prev) : filepath_prev(filepath_prev) {}
+
+  bool open(const char *filepath) override;
+  bool close() override;
+  bool write(const void *buf, size_t buf_len) override;
+
+ private:
+  bool write_direct(const void *buf, size_t buf_len);
+  bool flush_copy();
+
+  const char *filepath_prev;
+  int file_handle = -1;
+  int file_handle_prev = -1;
+  /** Offset in both files of the data written so far. */
+  int64_t offset = 0;
+  /** Range of the previous file that still has to be copied, it always ends at #offset. */
+  int64_t copy_len = 0;
+  int64_t copied_len = 0;
+  /** Buffer for reading the previous file, allocated on first use. */
+  char *compare_buf = nullptr;
+};
+
+/** Granularity of the comparison with the previous file. */
+#define INCREMENTAL_COMPARE_SIZE (1 << 16)
+
+bool IncrementalWriteWrap::open(const char *filepath)
+{
+  file_handle = BLI_open(filepath, O_BINARY + O_WRONLY + O_CREAT + O_TRUNC, 0666);
+  if (file_handle == -1) {
+    return false;
+  }
+  file_handle_prev = BLI_open(filepath_prev, O_BINARY + O_RDONLY, 0);
+  return true;
+}
+
+bool IncrementalWriteWrap::close()
+{
+  bool ok = flush_copy();
+  if (file_handle_prev != -1) {
+    ::close(file_handle_prev);
+    CLOG_INFO(&LOG,
+              1,
+              "Incremental save: copied %" PRId64 " of %" PRId64 " bytes from previous file",
+              copied_len,
+              offset);
+  }
+  MEM_SAFE_FREE(compare_buf);
+  return (::close(file_handle) != -1) && ok;
+}
+
+bool IncrementalWriteWrap::write_direct(const void *buf, size_t buf_len)
+{
+  if (!flush_copy()) {
+    return false;
+  }
+  offset += buf_len;
+  return ::write(file_handle, buf, buf_len) == buf_len;
+}
+
+bool IncrementalWriteWrap::flush_copy()
+{
+  if (copy_len == 0) {
+    return true;
+  }
+  loff_t offset_prev = offset - copy_len;
+  while (copy_len > 0) {
+    const ssize_t len = copy_file_range(
+        file_handle_prev, &offset_prev, file_handle, nullptr, size_t(copy_len), 0);
+    if (len <= 0) {
+      break;
+    }
+    copy_len -= len;
+    copied_len += len;
+  }
+  if (copy_len == 0) {
+    return true;
+  }
+
+  /* Copying is not supported between these files, write the remaining data normally and stop
+   * comparing. */
+  if (compare_buf == nullptr) {
+    compare_buf = static_cast<char *>(MEM_mallocN(INCREMENTAL_COMPARE_SIZE, __func__));
+  }
+  while (copy_len > 0) {
+    const int64_t len = std::min<int64_t>(copy_len, INCREMENTAL_COMPARE_SIZE);
+    if (::pread(file_handle_prev, compare_buf, len, offset - copy_len) != len ||
+        ::write(file_handle, compare_buf, len) != len)
+    {
+      return false;
+    }
+    copy_len -= len;
+  }
+  ::close(file_handle_prev);
+  file_handle_prev = -1;
+  return true;
+}
+
+bool IncrementalWriteWrap::write(const void *buf, size_t buf_len)
+{
+  if (file_handle_prev == -1) {
+    return write_direct(buf, buf_len);
+  }
+  if (compare_buf == nullptr) {
+    compare_buf = static_cast<char *>(MEM_mallocN(INCREMENTAL_COMPARE_SIZE, __func__));
+  }
+
+  const char *data = static_cast<const char *>(buf);
+  while (buf_len > 0) {
+    const size_t len = std::min<size_t>(buf_len, INCREMENTAL_COMPARE_SIZE);
+    if (::pread(file_handle_prev, compare_buf, len, offset) == len &&
+        memcmp(compare_buf, data, len) == 0)
+    {
+      copy_len += len;
+      offset += len;
+    }
+    else if (!write_direct(data, len)) {
+      return false;
+    }
+    data += len;
+    buf_len -= len;
+    if (file_handle_prev == -1) {
+      /* Copying failed, write the rest without comparing. */
+      return (buf_len == 0) || write_direct(data, buf_len);
+    }
+  }
+  return true;
+}
+
+#endif /* USE_INCREMENTAL_WRITE */
+
 class ZstdWriteWrap : public WriteWrap {
   WriteWrap &base_wrap;
 
@@ -1288,6 +1467,39 @@ static int write_id_direct_linked_data_process_cb(LibraryIDLinkCallbackData *cb_
   return IDWALK_RET_NOP;
 }
 
+/**
+ * Write IDs of a type flagged with #IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE in parallel, each into
+ * its own buffer. The buffers are then written in order, so the result is the same as when
+ * writing the IDs one after the other.
+ */
+static void write_ids_threaded(WriteData *wd, const IDTypeInfo *id_type, blender::Span<ID *> ids)
+{
+  using namespace blender;
+  BLI_assert(!wd->use_memfile);
+
+  Array<BufferWriteWrap> buffers(ids.size());
+  threading::parallel_for(ids.index_range(), 1, [&](const IndexRange range) {
+    BLO_Write_IDBuffer *id_buffer = BLO_write_allocate_id_buffer();
+    id_buffer_init_for_id_type(id_buffer, id_type);
+    for (const int i : range) {
+      WriteData *id_wd = writedata_new(&buffers[i]);
+      BlendWriter writer = {id_wd};
+      mywrite_id_begin(id_wd, ids[i]);
+      id_buffer_init_from_id(id_buffer, ids[i], false);
+      id_type->blend_write(&writer, static_cast<ID *>(id_buffer->temp_id), ids[i]);
+      mywrite_id_end(id_wd, ids[i]);
+      writedata_free(id_wd);
+    }
+    BLO_write_destroy_id_buffer(&id_buffer);
+  });
+
+  for (const BufferWriteWrap &buffer : buffers) {
+    if (!buffer.data.is_empty()) {
+      mywrite(wd, buffer.data.data(), size_t(buffer.data.size()));
+    }
+  }
+}
+
 /**
  * When #MemFile arguments are non-null, this is a file-safe to memory.
  *
@@ -1382,6 +1594,10 @@ static bool write_file_handle(Main *mainvar,
    * if needed, without duplicating whole code. */
   Main *bmain = mainvar;
   BLO_Write_IDBuffer *id_buffer = BLO_write_allocate_id_buffer();
+  /* IDs waiting to be written by #write_ids_threaded. Their number is limited to bound the
+   * memory used by the buffers. */
+  blender::Vector<ID *> threaded_ids;
+  const int threaded_ids_max = BLI_system_thread_count() * 2;
   do {
     ListBase *lbarray[INDEX_ID_MAX];
     int a = set_listbasepointers(bmain, lbarray);
@@ -1395,6 +1611,10 @@ static bool write_file_handle(Main *mainvar,
       const IDTypeInfo *id_type = BKE_idtype_get_info_from_id(id);
       id_buffer_init_for_id_type(id_buffer, id_type);
 
+      const bool use_threads = !wd->use_memfile && BLI_system_thread_count() > 1 &&
+                               (id_type->flags & IDTYPE_FLAGS_BLEND_WRITE_THREADSAFE) &&
+                               id_type->blend_write != nullptr;
+
       for (; id; id = static_cast<ID *>(id->next)) {
         /* We should never attempt to write non-regular IDs
          * (i.e. all kind of temp/runtime ones). */
@@ -1454,6 +1674,19 @@ static bool write_file_handle(Main *mainvar,
                                       IDWALK_READONLY | IDWALK_INCLUDE_UI);
         }
 
+        if (use_threads && !do_override) {
+          threaded_ids.append(id);
+          if (threaded_ids.size() >= threaded_ids_max) {
+            write_ids_threaded(wd, id_type, threaded_ids);
+            threaded_ids.clear();
+          }
+          continue;
+        }
+        if (!threaded_ids.is_empty()) {
+          write_ids_threaded(wd, id_type, threaded_ids);
+          threaded_ids.clear();
+        }
+
         if (do_override) {
           BKE_lib_override_library_operations_store_start(bmain, override_storage, id);
         }
@@ -1473,6 +1706,11 @@ static bool write_file_handle(Main *mainvar,
         mywrite_id_end(wd, id);
       }
 
+      if (!threaded_ids.is_empty()) {
+        write_ids_threaded(wd, id_type, threaded_ids);
+        threaded_ids.clear();
+      }
+
       mywrite_flush(wd);
     }
   } while ((bmain != override_storage) && (bmain = override_storage));
@@ -1768,13 +2006,20 @@ bool BLO_write_file(Main *mainvar,
                     ReportList *reports)
 {
   RawWriteWrap raw_wrap;
+  WriteWrap *base_wrap = &raw_wrap;
+#ifdef USE_INCREMENTAL_WRITE
+  IncrementalWriteWrap incremental_wrap(filepath);
+  if ((G.f & G_FLAG_WRITEFILE_INCREMENTAL) && BLI_exists(filepath)) {
+    base_wrap = &incremental_wrap;
+  }
+#endif
 
   if (write_flags & G_FILE_COMPRESS) {
-    ZstdWriteWrap zstd_wrap(raw_wrap);
+    ZstdWriteWrap zstd_wrap(*base_wrap);
     return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, zstd_wrap);
   }
 
-  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, raw_wrap);
+  return BLO_write_file_impl(mainvar, filepath, write_flags, params, reports, *base_wrap);
 }
 
 bool BLO_write_file_mem(Main *mainvar, MemFile *compare, MemFile *current, int write_flags)
@@ -0,0 +1,68 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include "testing/testing.h"
+
+#include "BLI_vector.hh"
+
+#include "BLO_undofile.hh"
+
+namespace blender::blenloader::tests {
+
+static MemFileChunk *chunk_at(MemFile &memfile, const int index)
+{
+  return static_cast<MemFileChunk *>(BLI_findlink(&memfile.chunks, index));
+}
+
+static void memfile_write(MemFile &memfile, MemFile *reference, const Span<Vector<char>> chunks)
+{
+  MemFileWriteData mem_data;
+  BLO_memfile_write_init(&mem_data, &memfile, reference);
+  for (const Vector<char> &chunk : chunks) {
+    BLO_memfile_chunk_add(&mem_data, chunk.data(), size_t(chunk.size()));
+  }
+  BLO_memfile_write_finalize(&mem_data);
+}
+
+TEST(undofile, ChunkSharedByContent)
+{
+  const Vector<char> a(1000, 'a');
+  const Vector<char> b(1000, 'b');
+  const Vector<char> c(500, 'c');
+
+  MemFile first = {};
+  memfile_write(first, nullptr, {a, b});
+  EXPECT_EQ(first.size, 2000);
+
+  /* Inserting a chunk in front shifts the others, their memory is still shared. */
+  MemFile second = {};
+  memfile_write(second, &first, {c, a, b});
+  EXPECT_EQ(second.size, 500);
+  EXPECT_FALSE(chunk_at(second, 0)->is_buf_shared);
+  EXPECT_TRUE(chunk_at(second, 1)->is_buf_shared);
+  EXPECT_TRUE(chunk_at(second, 2)->is_buf_shared);
+  /* Data found at another position is not considered unchanged. */
+  EXPECT_FALSE(chunk_at(second, 1)->is_identical);
+  EXPECT_FALSE(chunk_at(second, 2)->is_identical);
+  EXPECT_EQ(chunk_at(second, 1)->buf, chunk_at(first, 0)->buf);
+
+  /* Chunks at the same position are identical. */
+  MemFile third = {};
+  memfile_write(third, &second, {c, a, a});
+  EXPECT_EQ(third.size, 0);
+  EXPECT_TRUE(chunk_at(third, 0)->is_identical);
+  EXPECT_TRUE(chunk_at(third, 1)->is_identical);
+  EXPECT_FALSE(chunk_at(third, 2)->is_identical);
+  EXPECT_TRUE(chunk_at(third, 2)->is_buf_shared);
+
+  /* Removing the oldest steps transfers ownership of the memory still in use. */
+  BLO_memfile_merge(&first, &second);
+  EXPECT_FALSE(chunk_at(second, 1)->is_buf_shared);
+  BLO_memfile_merge(&second, &third);
+  EXPECT_FALSE(chunk_at(third, 0)->is_buf_shared);
+  EXPECT_EQ(memcmp(chunk_at(third, 2)->buf, a.data(), a.size()), 0);
+  BLO_memfile_free(&third);
+}
+
+}  // namespace blender::blenloader::tests
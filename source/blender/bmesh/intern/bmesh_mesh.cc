@@ -1297,6 +1297,114 @@ void BM_mesh_rebuild(BMesh *bm,
   }
 }
 
+static void bm_customdata_pack(BMesh *bm, CustomData *data, const char htype)
+{
+  if (data->pool == nullptr) {
+    return;
+  }
+  BLI_mempool *pool_src = data->pool;
+  data->pool = nullptr;
+  CustomData_bmesh_init_pool(data, BM_mesh_elem_count(bm, htype), htype);
+
+  const auto move_block = [&](BMHeader &head) {
+    if (head.data) {
+      void *block = BLI_mempool_alloc(data->pool);
+      memcpy(block, head.data, data->totsize);
+      head.data = block;
+    }
+  };
+
+  BMIter iter;
+  switch (htype) {
+    case BM_VERT: {
+      BMVert *v;
+      BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
+        move_block(v->head);
+      }
+      break;
+    }
+    case BM_EDGE: {
+      BMEdge *e;
+      BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
+        move_block(e->head);
+      }
+      break;
+    }
+    case BM_LOOP: {
+      BMFace *f;
+      BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
+        BMLoop *l_iter, *l_first;
+        l_iter = l_first = BM_FACE_FIRST_LOOP(f);
+        do {
+          move_block(l_iter->head);
+        } while ((l_iter = l_iter->next) != l_first);
+      }
+      break;
+    }
+    case BM_FACE: {
+      BMFace *f;
+      BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
+        move_block(f->head);
+      }
+      break;
+    }
+  }
+
+  /* The blocks were moved, don't free the data they reference. */
+  BLI_mempool_destroy(pool_src);
+}
+
+void BM_mesh_pack(BMesh *bm)
+{
+  const BMAllocTemplate allocsize = BMALLOC_TEMPLATE_FROM_BM(bm);
+
+  BLI_mempool *vpool_dst = nullptr;
+  BLI_mempool *epool_dst = nullptr;
+  BLI_mempool *lpool_dst = nullptr;
+  BLI_mempool *fpool_dst = nullptr;
+  bm_mempool_init_ex(
+      &allocsize, bm->use_toolflags, &vpool_dst, &epool_dst, &lpool_dst, &fpool_dst);
+
+  /* Recreate the tool flag pools too, instead of allocating new flags from the fragmented ones. */
+  const bool had_toolflags = bm->vtoolflagpool != nullptr;
+  if (had_toolflags) {
+    BM_mesh_elem_toolflags_clear(bm);
+  }
+
+  BMeshCreateParams params = {};
+  params.use_toolflags = bm->use_toolflags;
+  BM_mesh_rebuild(bm, &params, vpool_dst, epool_dst, lpool_dst, fpool_dst);
+
+  if (had_toolflags) {
+    BM_mesh_elem_toolflags_ensure(bm);
+  }
+
+  bm_customdata_pack(bm, &bm->vdata, BM_VERT);
+  bm_customdata_pack(bm, &bm->edata, BM_EDGE);
+  bm_customdata_pack(bm, &bm->ldata, BM_LOOP);
+  bm_customdata_pack(bm, &bm->pdata, BM_FACE);
+}
+
+/** Packing small meshes is cheap, but the difference isn't noticeable either. */
+static constexpr int pack_min_capacity = 1 << 16;
+
+static bool bm_mempool_is_fragmented(const BLI_mempool *pool)
+{
+  if (pool == nullptr) {
+    return false;
+  }
+  const int capacity = BLI_mempool_capacity(pool);
+  return capacity >= pack_min_capacity && BLI_mempool_len(pool) < capacity / 2;
+}
+
+bool BM_mesh_is_fragmented(const BMesh *bm)
+{
+  return bm_mempool_is_fragmented(bm->vpool) || bm_mempool_is_fragmented(bm->epool) ||
+         bm_mempool_is_fragmented(bm->lpool) || bm_mempool_is_fragmented(bm->fpool) ||
+         bm_mempool_is_fragmented(bm->vdata.pool) || bm_mempool_is_fragmented(bm->edata.pool) ||
+         bm_mempool_is_fragmented(bm->ldata.pool) || bm_mempool_is_fragmented(bm->pdata.pool);
+}
+
 void BM_mesh_toolflags_set(BMesh *bm, bool use_toolflags)
 {
   if (bm->use_toolflags == use_toolflags) {
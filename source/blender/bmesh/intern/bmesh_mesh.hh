@@ -171,6 +171,20 @@ void BM_mesh_rebuild(BMesh *bm,
                      BLI_mempool *lpool,
                      BLI_mempool *fpool);
 
+/**
+ * Move all elements and their custom data blocks into new memory pools, in iteration order.
+ * After many elements have been removed, the remaining elements are spread over mostly empty
+ * memory chunks. Packing them improves the cache locality of everything iterating over the mesh.
+ * The order and indices of the elements don't change, tool flags are cleared.
+ *
+ * \warning All pointers to elements and custom data blocks become invalid.
+ */
+void BM_mesh_pack(BMesh *bm);
+/**
+ * Whether enough of the element memory is unused that it's worth calling #BM_mesh_pack.
+ */
+bool BM_mesh_is_fragmented(const BMesh *bm);
+
 struct BMAllocTemplate {
   int totvert, totedge, totloop, totface;
 };
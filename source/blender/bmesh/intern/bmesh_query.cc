@@ -16,11 +16,14 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
+#include "BLI_atomic_disjoint_set.hh"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
 
 #include "BKE_customdata.hh"
@@ -2469,6 +2472,103 @@ int BM_mesh_calc_edge_groups_as_arrays(
   return STACK_SIZE(groups);
 }
 
+void BM_mesh_vert_shell_regions_calc(BMesh *bm,
+                                     const blender::Span<bool> seed_verts,
+                                     blender::MutableSpan<bool> r_edges)
+{
+  using namespace blender;
+  BLI_assert(seed_verts.size() == bm->totvert);
+  BLI_assert(r_edges.size() == bm->totedge);
+  BM_mesh_elem_index_ensure(bm, BM_VERT);
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+  const Span<BMEdge *> edges(bm->etable, bm->totedge);
+
+  AtomicDisjointSet vert_sets(bm->totvert);
+  threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const BMEdge *e : edges.slice(range)) {
+      if (!BM_elem_flag_test(e, BM_ELEM_HIDDEN)) {
+        vert_sets.join(BM_elem_index_get(e->v1), BM_elem_index_get(e->v2));
+      }
+    }
+  });
+
+  /* Writing the same value from multiple threads is fine. */
+  Array<bool> set_has_seed(bm->totvert, false);
+  threading::parallel_for(seed_verts.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (seed_verts[i]) {
+        set_has_seed[vert_sets.find_root(i)] = true;
+      }
+    }
+  });
+
+  threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      const BMEdge *e = edges[i];
+      r_edges[i] = !BM_elem_flag_test(e, BM_ELEM_HIDDEN) &&
+                   set_has_seed[vert_sets.find_root(BM_elem_index_get(e->v1))];
+    }
+  });
+}
+
+void BM_mesh_face_island_regions_calc(BMesh *bm,
+                                      const blender::Span<bool> seed_faces,
+                                      const short walk_edge_oflag,
+                                      blender::MutableSpan<bool> r_faces)
+{
+  using namespace blender;
+  BLI_assert(seed_faces.size() == bm->totface);
+  BLI_assert(r_faces.size() == bm->totface);
+  BM_mesh_elem_index_ensure(bm, BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_EDGE | BM_FACE);
+  const Span<BMEdge *> edges(bm->etable, bm->totedge);
+  const Span<BMFace *> faces(bm->ftable, bm->totface);
+
+  AtomicDisjointSet face_sets(bm->totface);
+  threading::parallel_for(edges.index_range(), 4096, [&](const IndexRange range) {
+    for (BMEdge *e : edges.slice(range)) {
+      if (e->l == nullptr || BM_elem_flag_test(e, BM_ELEM_HIDDEN)) {
+        continue;
+      }
+      if (walk_edge_oflag && !BMO_edge_flag_test(bm, e, walk_edge_oflag)) {
+        continue;
+      }
+      /* All the visible faces around the edge are connected. */
+      int first_face = -1;
+      BMLoop *l_iter = e->l;
+      do {
+        if (BM_elem_flag_test(l_iter->f, BM_ELEM_HIDDEN)) {
+          continue;
+        }
+        const int face = BM_elem_index_get(l_iter->f);
+        if (first_face == -1) {
+          first_face = face;
+        }
+        else {
+          face_sets.join(first_face, face);
+        }
+      } while ((l_iter = l_iter->radial_next) != e->l);
+    }
+  });
+
+  /* Writing the same value from multiple threads is fine. */
+  Array<bool> set_has_seed(bm->totface, false);
+  threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      if (seed_faces[i] && !BM_elem_flag_test(faces[i], BM_ELEM_HIDDEN)) {
+        set_has_seed[face_sets.find_root(i)] = true;
+      }
+    }
+  });
+
+  threading::parallel_for(faces.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      r_faces[i] = !BM_elem_flag_test(faces[i], BM_ELEM_HIDDEN) &&
+                   set_has_seed[face_sets.find_root(i)];
+    }
+  });
+}
+
 float bmesh_subd_falloff_calc(const int falloff, float val)
 {
   switch (falloff) {
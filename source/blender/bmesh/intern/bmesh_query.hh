@@ -769,6 +769,32 @@ int BM_mesh_calc_edge_groups_as_arrays(BMesh *bm,
                                        int (**r_groups)[3]) ATTR_WARN_UNUSED_RESULT
     ATTR_NONNULL(1, 2, 3, 4, 5);
 
+/**
+ * Find the edges connected to \a seed_verts over edges that aren't hidden. This is the region
+ * the #BMW_VERT_SHELL walker visits when it is started from every seed and tests hidden elements,
+ * but the regions are found in parallel instead of walking them.
+ *
+ * \param seed_verts: The vertices to start from, by index, length of `bm->totvert`.
+ * \param r_edges: Set to true for every edge in a region containing a seed,
+ * by index, length of `bm->totedge`.
+ */
+void BM_mesh_vert_shell_regions_calc(BMesh *bm,
+                                     blender::Span<bool> seed_verts,
+                                     blender::MutableSpan<bool> r_edges);
+/**
+ * Find the faces connected to \a seed_faces like the #BMW_ISLAND walker does when testing hidden
+ * elements: over edges that aren't hidden, between faces that aren't hidden. Runs in parallel
+ * instead of walking the islands.
+ *
+ * \param walk_edge_oflag: Optional tool flag of the edges that may be stepped over, like the
+ * walker's edge mask. Edges without the flag delimit the islands. 0 to step over all edges.
+ * \param r_faces: Set to true for every face in an island containing a seed, by index.
+ */
+void BM_mesh_face_island_regions_calc(BMesh *bm,
+                                      blender::Span<bool> seed_faces,
+                                      short walk_edge_oflag,
+                                      blender::MutableSpan<bool> r_faces);
+
 /* Not really any good place to put this. */
 float bmesh_subd_falloff_calc(int falloff, float val) ATTR_WARN_UNUSED_RESULT;
 
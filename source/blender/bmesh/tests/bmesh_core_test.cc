@@ -4,6 +4,9 @@
 
 #include "testing/testing.h"
 
+#include "MEM_guardedalloc.h"
+
+#include "BLI_array.hh"
 #include "BLI_math_vector.h"
 #include "BLI_utildefines.h"
 #include "bmesh.hh"
@@ -42,3 +45,136 @@ TEST(bmesh_core, BMVertCreate)
   EXPECT_EQ(BM_mesh_elem_count(bm, BM_VERT), 3);
   BM_mesh_free(bm);
 }
+
+TEST(bmesh_core, BMeshPack)
+{
+  BMeshCreateParams bmesh_create_params{};
+  bmesh_create_params.use_toolflags = true;
+  BMesh *bm = BM_mesh_create(&bm_mesh_allocsize_default, &bmesh_create_params);
+  BM_data_layer_add(bm, &bm->vdata, CD_PROP_FLOAT);
+
+  const int verts_num = 100000;
+  BMVert **verts = static_cast<BMVert **>(MEM_mallocN(sizeof(BMVert *) * verts_num, __func__));
+  for (int i = 0; i < verts_num; i++) {
+    const float co[3] = {float(i), 0.0f, 0.0f};
+    verts[i] = BM_vert_create(bm, co, nullptr, BM_CREATE_NOP);
+    BM_elem_float_data_set(&bm->vdata, verts[i], CD_PROP_FLOAT, float(i));
+  }
+  EXPECT_FALSE(BM_mesh_is_fragmented(bm));
+
+  /* Remove most vertices, only every fourth one remains. */
+  for (int i = 0; i < verts_num; i++) {
+    if (i % 4 != 0) {
+      BM_vert_kill(bm, verts[i]);
+    }
+  }
+  MEM_freeN(verts);
+  EXPECT_TRUE(BM_mesh_is_fragmented(bm));
+
+  BM_mesh_pack(bm);
+  EXPECT_FALSE(BM_mesh_is_fragmented(bm));
+  EXPECT_EQ(bm->totvert, verts_num / 4);
+
+  /* The order and the data of the remaining vertices is unchanged. */
+  BMIter iter;
+  BMVert *v;
+  int i;
+  BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
+    EXPECT_EQ(v->co[0], float(i * 4));
+    EXPECT_EQ(BM_elem_float_data_get(&bm->vdata, v, CD_PROP_FLOAT), float(i * 4));
+  }
+  EXPECT_EQ(i, verts_num / 4);
+  BM_mesh_free(bm);
+}
+
+/**
+ * A strip of quads along X, with a seam on the edge between faces \a seam_face and
+ * `seam_face + 1` (none when -1). Edges that aren't seams get \a walk_oflag.
+ */
+static BMesh *create_quad_strip(const int faces_num, const int seam_face, const short walk_oflag)
+{
+  BMeshCreateParams bmesh_create_params{};
+  bmesh_create_params.use_toolflags = true;
+  BMesh *bm = BM_mesh_create(&bm_mesh_allocsize_default, &bmesh_create_params);
+
+  blender::Array<BMVert *> bottom(faces_num + 1);
+  blender::Array<BMVert *> top(faces_num + 1);
+  for (const int i : bottom.index_range()) {
+    const float co_bottom[3] = {float(i), 0.0f, 0.0f};
+    const float co_top[3] = {float(i), 1.0f, 0.0f};
+    bottom[i] = BM_vert_create(bm, co_bottom, nullptr, BM_CREATE_NOP);
+    top[i] = BM_vert_create(bm, co_top, nullptr, BM_CREATE_NOP);
+  }
+  for (const int i : blender::IndexRange(faces_num)) {
+    BMVert *quad[4] = {bottom[i], bottom[i + 1], top[i + 1], top[i]};
+    BM_face_create_verts(bm, quad, 4, nullptr, BM_CREATE_NOP, true);
+  }
+  if (seam_face != -1) {
+    BMEdge *seam = BM_edge_exists(bottom[seam_face + 1], top[seam_face + 1]);
+    BM_elem_flag_enable(seam, BM_ELEM_SEAM);
+  }
+
+  BMIter iter;
+  BMEdge *e;
+  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
+    BMO_edge_flag_set(bm, e, walk_oflag, !BM_elem_flag_test(e, BM_ELEM_SEAM));
+  }
+  return bm;
+}
+
+static void expect_face_islands_match_walker(BMesh *bm, const int seed_face, const short oflag)
+{
+  BM_mesh_elem_table_ensure(bm, BM_FACE);
+  blender::Array<bool> seed_faces(bm->totface, false);
+  seed_faces[seed_face] = true;
+  blender::Array<bool> faces(bm->totface, false);
+  BM_mesh_face_island_regions_calc(bm, seed_faces, oflag, faces);
+
+  blender::Array<bool> faces_walked(bm->totface, false);
+  BMWalker walker;
+  BMW_init(&walker,
+           bm,
+           BMW_ISLAND,
+           BMW_MASK_NOP,
+           oflag,
+           BMW_MASK_NOP,
+           BMW_FLAG_TEST_HIDDEN,
+           BMW_NIL_LAY);
+  BMFace *f;
+  for (f = static_cast<BMFace *>(BMW_begin(&walker, BM_face_at_index(bm, seed_face))); f;
+       f = static_cast<BMFace *>(BMW_step(&walker)))
+  {
+    faces_walked[BM_elem_index_get(f)] = true;
+  }
+  BMW_end(&walker);
+
+  for (const int i : faces.index_range()) {
+    EXPECT_EQ(faces[i], faces_walked[i]) << "face " << i;
+  }
+}
+
+TEST(bmesh_core, FaceIslandRegionsSeamDelimit)
+{
+  const short walk_oflag = 1;
+  {
+    /* Seam between the second and third face: the island stops at the seam. */
+    BMesh *bm = create_quad_strip(4, 1, walk_oflag);
+    expect_face_islands_match_walker(bm, 0, walk_oflag);
+    BM_mesh_elem_table_ensure(bm, BM_FACE);
+    blender::Array<bool> seed_faces(bm->totface, false);
+    seed_faces[0] = true;
+    blender::Array<bool> faces(bm->totface, false);
+    BM_mesh_face_island_regions_calc(bm, seed_faces, walk_oflag, faces);
+    EXPECT_TRUE(faces[0]);
+    EXPECT_TRUE(faces[1]);
+    EXPECT_FALSE(faces[2]);
+    EXPECT_FALSE(faces[3]);
+    BM_mesh_free(bm);
+  }
+  {
+    /* Without seams, every face is walked to. */
+    BMesh *bm = create_quad_strip(4, -1, walk_oflag);
+    expect_face_islands_match_walker(bm, 3, walk_oflag);
+    BM_mesh_free(bm);
+  }
+}
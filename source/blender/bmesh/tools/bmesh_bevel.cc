@@ -15,11 +15,13 @@
 #include "DNA_modifier_types.h"
 
 #include "BLI_alloca.h"
+#include "BLI_enumerable_thread_specific.hh"
 #include "BLI_math_geom.h"
 #include "BLI_math_matrix.h"
 #include "BLI_math_rotation.h"
 #include "BLI_math_vector.h"
 #include "BLI_memarena.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -35,6 +37,7 @@
 
 #include "./intern/bmesh_private.hh"
 
+using blender::IndexRange;
 using blender::Vector;
 
 // #define BEVEL_DEBUG_TIME
@@ -280,6 +283,10 @@ struct BevVert {
   BMEdge **wire_edges;
   /** Mesh structure for replacing vertex. */
   VMesh *vmesh;
+  /** The subdivided vertex mesh used by #bevel_build_rings, see #calculate_vmesh. */
+  VMesh *vmesh_adj;
+  /** Result of #pipe_test, computed with #vmesh_adj. */
+  BoundVert *vpipe;
 };
 
 /**
@@ -5332,6 +5339,26 @@ static void snap_edges_for_vmesh_vert(int i,
   }
 }
 
+/**
+ * Calculate the subdivided vertex mesh for #bevel_build_rings. This doesn't create any geometry,
+ * so it can be done for all vertices in parallel.
+ */
+static VMesh *rings_adj_vmesh(BevelParams *bp, BevVert *bv, BoundVert *vpipe)
+{
+  if (bp->pro_super_r == PRO_SQUARE_R && bv->selcount >= 3 && bv->vmesh->seg % 2 == 0 &&
+      bp->profile_type != BEVEL_PROFILE_CUSTOM)
+  {
+    return square_out_adj_vmesh(bp, bv);
+  }
+  if (vpipe) {
+    return pipe_adj_vmesh(bp, bv, vpipe);
+  }
+  if (tri_corner_test(bp, bv) == 1) {
+    return tri_corner_adj_vmesh(bp, bv);
+  }
+  return adj_vmesh(bp, bv);
+}
+
 /**
  * Given that the boundary is built and the boundary #BMVert's have been made,
  * calculate the positions of the interior mesh points for the M_ADJ pattern,
@@ -5347,26 +5374,15 @@ static void bevel_build_rings(BevelParams *bp, BMesh *bm, BevVert *bv, BoundVert
   int odd = ns % 2;
   BLI_assert(n_bndv >= 3 && ns > 1);
 
-  VMesh *vm1;
-  if (bp->pro_super_r == PRO_SQUARE_R && bv->selcount >= 3 && !odd &&
-      bp->profile_type != BEVEL_PROFILE_CUSTOM)
+  VMesh *vm1 = bv->vmesh_adj;
+  BLI_assert(vm1 != nullptr);
+  /* The PRO_SQUARE_IN_R profile has boundary edges that merge
+   * and no internal ring polys except possibly center ngon. */
+  if (vpipe == nullptr && bp->pro_super_r == PRO_SQUARE_IN_R &&
+      bp->profile_type != BEVEL_PROFILE_CUSTOM && tri_corner_test(bp, bv) == 1)
   {
-    vm1 = square_out_adj_vmesh(bp, bv);
-  }
-  else if (vpipe) {
-    vm1 = pipe_adj_vmesh(bp, bv, vpipe);
-  }
-  else if (tri_corner_test(bp, bv) == 1) {
-    vm1 = tri_corner_adj_vmesh(bp, bv);
-    /* The PRO_SQUARE_IN_R profile has boundary edges that merge
-     * and no internal ring polys except possibly center ngon. */
-    if (bp->pro_super_r == PRO_SQUARE_IN_R && bp->profile_type != BEVEL_PROFILE_CUSTOM) {
-      build_square_in_vmesh(bp, bm, bv, vm1);
-      return;
-    }
-  }
-  else {
-    vm1 = adj_vmesh(bp, bv);
+    build_square_in_vmesh(bp, bm, bv, vm1);
+    return;
   }
 
   /* Copy final vmesh into bv->vmesh, make BMVerts and BMFaces. */
@@ -5896,12 +5912,14 @@ static void bevel_vert_two_edges(BevelParams *bp, BMesh *bm, BevVert *bv)
   }
 }
 
-/* Given that the boundary is built, now make the actual BMVerts
- * for the boundary and the interior of the vertex mesh. */
-static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
+/**
+ * The part of #build_vmesh that only calculates positions and doesn't modify the BMesh, so that it
+ * can run for all vertices in parallel. It allocates the vertex mesh, calculates the profiles and
+ * the subdivided mesh for #bevel_build_rings.
+ */
+static void calculate_vmesh(BevelParams *bp, BevVert *bv)
 {
   VMesh *vm = bv->vmesh;
-  float co[3];
 
   int n = vm->count;
   int ns = vm->seg;
@@ -5913,15 +5931,11 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
   /* Special case: just two beveled edges welded together. */
   const bool weld = (bv->selcount == 2) && (vm->count == 2);
   BoundVert *weld1 = nullptr; /* Will hold two BoundVerts involved in weld. */
-  BoundVert *weld2 = nullptr;
 
-  /* Make (i, 0, 0) mesh verts for all i boundverts. */
   BoundVert *bndv = vm->boundstart;
   do {
     int i = bndv->index;
     copy_v3_v3(mesh_vert(vm, i, 0, 0)->co, bndv->nv.co); /* Mesh NewVert to boundary NewVert. */
-    create_mesh_bmvert(bm, vm, i, 0, 0, bv->v);          /* Create BMVert for that NewVert. */
-    bndv->nv.v = mesh_vert(vm, i, 0, 0)->v; /* Use the BMVert for the BoundVert's NewVert. */
 
     /* Find boundverts and move profile planes if this is a weld case. */
     if (weld && bndv->ebev) {
@@ -5929,7 +5943,7 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
         weld1 = bndv;
       }
       else { /* Get the last of the two BoundVerts. */
-        weld2 = bndv;
+        BoundVert *weld2 = bndv;
         set_profile_params(bp, bv, weld1);
         set_profile_params(bp, bv, weld2);
         move_weld_profile_planes(bv, weld1, weld2);
@@ -5941,6 +5955,48 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
    * profile calculation here, the last point before actual mesh verts are created. */
   calculate_vm_profiles(bp, bv, vm);
 
+  /* Make sure the pipe case ADJ mesh is used for both the "Grid Fill" (ADJ) and cutoff options. */
+  if (ELEM(vm->count, 3, 4) && bp->seg > 1) {
+    bv->vpipe = pipe_test(bv);
+  }
+  /* The weld case is changed to #M_NONE when building. */
+  if ((vm->mesh_kind == M_ADJ || bv->vpipe) && !weld) {
+    bv->vmesh_adj = rings_adj_vmesh(bp, bv, bv->vpipe);
+  }
+}
+
+/* Given that the boundary is built, now make the actual BMVerts
+ * for the boundary and the interior of the vertex mesh. */
+static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
+{
+  VMesh *vm = bv->vmesh;
+  float co[3];
+
+  int n = vm->count;
+  int ns = vm->seg;
+
+  /* Special case: just two beveled edges welded together. */
+  const bool weld = (bv->selcount == 2) && (vm->count == 2);
+  BoundVert *weld1 = nullptr; /* Will hold two BoundVerts involved in weld. */
+  BoundVert *weld2 = nullptr;
+
+  /* Make (i, 0, 0) mesh verts for all i boundverts. */
+  BoundVert *bndv = vm->boundstart;
+  do {
+    int i = bndv->index;
+    create_mesh_bmvert(bm, vm, i, 0, 0, bv->v); /* Create BMVert for that NewVert. */
+    bndv->nv.v = mesh_vert(vm, i, 0, 0)->v;     /* Use the BMVert for the BoundVert's NewVert. */
+
+    if (weld && bndv->ebev) {
+      if (!weld1) {
+        weld1 = bndv;
+      }
+      else {
+        weld2 = bndv;
+      }
+    }
+  } while ((bndv = bndv->next) != vm->boundstart);
+
   /* Create new vertices and place them based on the profiles. */
   /* Copy other ends to (i, 0, ns) for all i, and fill in profiles for edges. */
   bndv = vm->boundstart;
@@ -6000,13 +6056,9 @@ static void build_vmesh(BevelParams *bp, BMesh *bm, BevVert *bv)
   }
 
   /* Make sure the pipe case ADJ mesh is used for both the "Grid Fill" (ADJ) and cutoff options. */
-  BoundVert *vpipe = nullptr;
-  if (ELEM(vm->count, 3, 4) && bp->seg > 1) {
-    /* Result is passed to bevel_build_rings to avoid overhead. */
-    vpipe = pipe_test(bv);
-    if (vpipe) {
-      vm->mesh_kind = M_ADJ;
-    }
+  BoundVert *vpipe = bv->vpipe;
+  if (vpipe) {
+    vm->mesh_kind = M_ADJ;
   }
 
   switch (vm->mesh_kind) {
@@ -7825,15 +7877,35 @@ void BM_mesh_bevel(BMesh *bm,
     }
   }
 
-  /* Build the meshes around vertices, now that positions are final. */
+  /* Build the meshes around vertices, now that positions are final. Calculating the vertex meshes
+   * is independent for every vertex, only creating the geometry has to be done serially. */
+  Vector<BevVert *> bevverts;
   BM_ITER_MESH (v, &iter, bm, BM_VERTS_OF_MESH) {
     if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
       bv = find_bevvert(&bp, v);
       if (bv) {
-        build_vmesh(&bp, bm, bv);
+        bevverts.append(bv);
       }
     }
   }
+  blender::threading::EnumerableThreadSpecific<MemArena *> thread_arenas(
+      []() -> MemArena * { return nullptr; });
+  blender::threading::parallel_for(bevverts.index_range(), 64, [&](const IndexRange range) {
+    /* The memory arena isn't thread-safe, each thread allocates from its own one. */
+    MemArena *&arena = thread_arenas.local();
+    if (arena == nullptr) {
+      arena = BLI_memarena_new(MEM_SIZE_OPTIMAL(1 << 16), __func__);
+      BLI_memarena_use_calloc(arena);
+    }
+    BevelParams bp_local = bp;
+    bp_local.mem_arena = arena;
+    for (const int i : range) {
+      calculate_vmesh(&bp_local, bevverts[i]);
+    }
+  });
+  for (BevVert *bevvert : bevverts) {
+    build_vmesh(&bp, bm, bevvert);
+  }
 
   /* Build polygons for edges. */
   if (bp.affect_type != BEVEL_AFFECT_VERTICES) {
@@ -7905,6 +7977,11 @@ void BM_mesh_bevel(BMesh *bm,
   BLI_ghash_free(bp.vert_hash, nullptr, nullptr);
   BLI_ghash_free(bp.face_hash, nullptr, nullptr);
   BLI_memarena_free(bp.mem_arena);
+  for (MemArena *arena : thread_arenas) {
+    if (arena != nullptr) {
+      BLI_memarena_free(arena);
+    }
+  }
 
 #ifdef BEVEL_DEBUG_TIME
   double end_time = BLI_time_now_seconds();
@@ -8,11 +8,13 @@
  * BMesh decimator that uses an edge collapse method.
  */
 
+#include <algorithm>
 #include <cstddef>
 
 #include "MEM_guardedalloc.h"
 
 #include "BLI_alloca.h"
+#include "BLI_array.hh"
 #include "BLI_heap.h"
 #include "BLI_linklist.h"
 #include "BLI_math_geom.h"
@@ -21,7 +23,9 @@
 #include "BLI_polyfill_2d.h"
 #include "BLI_polyfill_2d_beautify.h"
 #include "BLI_quadric.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines_stack.h"
+#include "BLI_vector.hh"
 
 #include "BKE_customdata.hh"
 
@@ -66,62 +70,98 @@ ENUM_OPERATORS(CD_UseFlag, CD_DO_LOOP)
 /* BMesh Helper Functions
  * ********************** */
 
-/**
- * \param vquadrics: must be calloc'd
- */
-static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
+static void bm_decim_face_quadric(BMFace *f, Quadric *r_q)
 {
-  BMIter iter;
-  BMFace *f;
-  BMEdge *e;
-
-  BM_ITER_MESH (f, &iter, bm, BM_FACES_OF_MESH) {
-    BMLoop *l_first;
-    BMLoop *l_iter;
-
-    float center[3];
-    double plane_db[4];
-    Quadric q;
+  float center[3];
+  double plane_db[4];
 
-    BM_face_calc_center_median(f, center);
-    copy_v3db_v3fl(plane_db, f->no);
-    plane_db[3] = -dot_v3db_v3fl(plane_db, center);
+  BM_face_calc_center_median(f, center);
+  copy_v3db_v3fl(plane_db, f->no);
+  plane_db[3] = -dot_v3db_v3fl(plane_db, center);
 
-    BLI_quadric_from_plane(&q, plane_db);
+  BLI_quadric_from_plane(r_q, plane_db);
+}
 
-    l_iter = l_first = BM_FACE_FIRST_LOOP(f);
-    do {
-      BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(l_iter->v)], &q);
-    } while ((l_iter = l_iter->next) != l_first);
+/**
+ * \return false when the edge isn't a boundary or its plane is degenerate.
+ */
+static bool bm_decim_boundary_edge_quadric(BMEdge *e, Quadric *r_q)
+{
+  if (LIKELY(!BM_edge_is_boundary(e))) {
+    return false;
   }
+  float edge_vector[3];
+  float edge_plane[3];
+  double edge_plane_db[4];
+  sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
 
-  /* boundary edges */
-  BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
-    if (UNLIKELY(BM_edge_is_boundary(e))) {
-      float edge_vector[3];
-      float edge_plane[3];
-      double edge_plane_db[4];
-      sub_v3_v3v3(edge_vector, e->v2->co, e->v1->co);
-      f = e->l->f;
-
-      cross_v3_v3v3(edge_plane, edge_vector, f->no);
-      copy_v3db_v3fl(edge_plane_db, edge_plane);
+  cross_v3_v3v3(edge_plane, edge_vector, e->l->f->no);
+  copy_v3db_v3fl(edge_plane_db, edge_plane);
 
-      if (normalize_v3_db(edge_plane_db) > double(FLT_EPSILON)) {
-        Quadric q;
-        float center[3];
+  if (normalize_v3_db(edge_plane_db) <= double(FLT_EPSILON)) {
+    return false;
+  }
+  float center[3];
+  mid_v3_v3v3(center, e->v1->co, e->v2->co);
 
-        mid_v3_v3v3(center, e->v1->co, e->v2->co);
+  edge_plane_db[3] = -dot_v3db_v3fl(edge_plane_db, center);
+  BLI_quadric_from_plane(r_q, edge_plane_db);
+  BLI_quadric_mul(r_q, BOUNDARY_PRESERVE_WEIGHT);
+  return true;
+}
 
-        edge_plane_db[3] = -dot_v3db_v3fl(edge_plane_db, center);
-        BLI_quadric_from_plane(&q, edge_plane_db);
-        BLI_quadric_mul(&q, BOUNDARY_PRESERVE_WEIGHT);
+/**
+ * \param vquadrics: must be calloc'd
+ */
+static void bm_decim_build_quadrics(BMesh *bm, Quadric *vquadrics)
+{
+  using namespace blender;
+  BM_mesh_elem_index_ensure(bm, BM_EDGE | BM_FACE);
+  BM_mesh_elem_table_ensure(bm, BM_VERT | BM_FACE);
+
+  Array<Quadric> face_quadrics(bm->totface);
+  threading::parallel_for(IndexRange(bm->totface), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      bm_decim_face_quadric(BM_face_at_index(bm, i), &face_quadrics[i]);
+    }
+  });
+
+  /* Every vertex sums the quadrics of its faces and then of its boundary edges, in index order.
+   * This gives the same result as looping over all faces and boundary edges of the mesh. */
+  threading::parallel_for(IndexRange(bm->totvert), 1024, [&](const IndexRange range) {
+    Vector<int, 32> face_indices;
+    Vector<std::pair<int, Quadric>, 4> edge_quadrics;
+    for (const int i : range) {
+      BMVert *v = BM_vert_at_index(bm, i);
+      Quadric *q = &vquadrics[i];
+      BMIter iter;
+
+      face_indices.clear();
+      BMLoop *l;
+      BM_ITER_ELEM (l, &iter, v, BM_LOOPS_OF_VERT) {
+        face_indices.append(BM_elem_index_get(l->f));
+      }
+      std::sort(face_indices.begin(), face_indices.end());
+      for (const int face_index : face_indices) {
+        BLI_quadric_add_qu_qu(q, &face_quadrics[face_index]);
+      }
 
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v1)], &q);
-        BLI_quadric_add_qu_qu(&vquadrics[BM_elem_index_get(e->v2)], &q);
+      edge_quadrics.clear();
+      BMEdge *e;
+      BM_ITER_ELEM (e, &iter, v, BM_EDGES_OF_VERT) {
+        Quadric edge_q;
+        if (UNLIKELY(bm_decim_boundary_edge_quadric(e, &edge_q))) {
+          edge_quadrics.append({BM_elem_index_get(e), edge_q});
+        }
+      }
+      std::sort(edge_quadrics.begin(), edge_quadrics.end(), [](const auto &a, const auto &b) {
+        return a.first < b.first;
+      });
+      for (const auto &item : edge_quadrics) {
+        BLI_quadric_add_qu_qu(q, &item.second);
       }
     }
-  }
+  });
 }
 
 static void bm_decim_calc_target_co_db(BMEdge *e, double optimize_co[3], const Quadric *vquadrics)
@@ -227,19 +267,21 @@ static float bm_decim_build_edge_cost_single__topology(BMEdge *e)
 
 #endif /* USE_TOPOLOGY_FALLBACK */
 
-static void bm_decim_build_edge_cost_single(BMEdge *e,
-                                            const Quadric *vquadrics,
-                                            const float *vweights,
-                                            const float vweight_factor,
-                                            Heap *eheap,
-                                            HeapNode **eheap_table)
+/**
+ * \return false when the edge can't be collapsed.
+ */
+static bool bm_decim_calc_edge_cost(BMEdge *e,
+                                    const Quadric *vquadrics,
+                                    const float *vweights,
+                                    const float vweight_factor,
+                                    float *r_cost)
 {
   float cost;
 
   if (UNLIKELY(vweights && ((vweights[BM_elem_index_get(e->v1)] == 0.0f) ||
                             (vweights[BM_elem_index_get(e->v2)] == 0.0f))))
   {
-    goto clear;
+    return false;
   }
 
   /* Check we can collapse, some edges we better not touch. */
@@ -249,7 +291,7 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else if (BM_edge_is_manifold(e)) {
@@ -258,11 +300,11 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
     else {
       /* Only collapse triangles. */
-      goto clear;
+      return false;
     }
   }
   else {
-    goto clear;
+    return false;
   }
   /* End sanity check. */
 
@@ -315,10 +357,23 @@ static void bm_decim_build_edge_cost_single(BMEdge *e,
     }
   }
 
-  BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
-  return;
+  *r_cost = cost;
+  return true;
+}
+
+static void bm_decim_build_edge_cost_single(BMEdge *e,
+                                            const Quadric *vquadrics,
+                                            const float *vweights,
+                                            const float vweight_factor,
+                                            Heap *eheap,
+                                            HeapNode **eheap_table)
+{
+  float cost;
+  if (bm_decim_calc_edge_cost(e, vquadrics, vweights, vweight_factor, &cost)) {
+    BLI_heap_insert_or_update(eheap, &eheap_table[BM_elem_index_get(e)], cost, e);
+    return;
+  }
 
-clear:
   if (eheap_table[BM_elem_index_get(e)]) {
     BLI_heap_remove(eheap, eheap_table[BM_elem_index_get(e)]);
   }
@@ -340,14 +395,25 @@ static void bm_decim_build_edge_cost(BMesh *bm,
                                      Heap *eheap,
                                      HeapNode **eheap_table)
 {
-  BMIter iter;
-  BMEdge *e;
-  uint i;
+  using namespace blender;
+  BM_mesh_elem_table_ensure(bm, BM_EDGE);
+
+  /* The costs are independent, only inserting them into the heap has to be done in order. */
+  Array<float> costs(bm->totedge);
+  Array<bool> collapsible(bm->totedge);
+  threading::parallel_for(IndexRange(bm->totedge), 1024, [&](const IndexRange range) {
+    for (const int i : range) {
+      collapsible[i] = bm_decim_calc_edge_cost(
+          BM_edge_at_index(bm, i), vquadrics, vweights, vweight_factor, &costs[i]);
+    }
+  });
 
-  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
+  for (const int i : IndexRange(bm->totedge)) {
     /* keep sanity check happy */
     eheap_table[i] = nullptr;
-    bm_decim_build_edge_cost_single(e, vquadrics, vweights, vweight_factor, eheap, eheap_table);
+    if (collapsible[i]) {
+      eheap_table[i] = BLI_heap_insert(eheap, costs[i], BM_edge_at_index(bm, i));
+    }
   }
 }
 
@@ -4,6 +4,7 @@
 
 #include "COM_FullFrameExecutionModel.h"
 
+#include "BLI_set.hh"
 #include "BLI_string.h"
 
 #include "BLT_translation.hh"
@@ -157,28 +158,37 @@ void FullFrameExecutionModel::render_operations()
 }
 
 /**
- * Returns all dependencies from inputs to outputs. A dependency may be repeated when
- * several operations depend on it.
+ * Returns all dependencies from inputs to outputs, in depth-first post-order. Compared to
+ * rendering the dependencies level by level, each input branch is finished before the next one
+ * starts, so its intermediate buffers are freed earlier and fewer full-frame buffers are alive at
+ * the same time.
  */
 static Vector<NodeOperation *> get_operation_dependencies(NodeOperation *operation)
 {
-  /* Get dependencies from outputs to inputs. */
   Vector<NodeOperation *> dependencies;
-  Vector<NodeOperation *> next_outputs;
-  next_outputs.append(operation);
-  while (next_outputs.size() > 0) {
-    Vector<NodeOperation *> outputs(next_outputs);
-    next_outputs.clear();
-    for (NodeOperation *output : outputs) {
-      for (int i = 0; i < output->get_number_of_input_sockets(); i++) {
-        next_outputs.append(output->get_input_operation(i));
+  Set<NodeOperation *> visited_operations = {operation};
+
+  /* Operations with the index of their next input to visit. Iterative because node trees can be
+   * deep. */
+  Vector<std::pair<NodeOperation *, int>> stack;
+  stack.append({operation, 0});
+  while (!stack.is_empty()) {
+    NodeOperation *current = stack.last().first;
+    const int input_index = stack.last().second;
+    if (input_index < current->get_number_of_input_sockets()) {
+      stack.last().second++;
+      NodeOperation *input = current->get_input_operation(input_index);
+      if (visited_operations.add(input)) {
+        stack.append({input, 0});
       }
+      continue;
     }
-    dependencies.extend(next_outputs);
-  }
 
-  /* Reverse to get dependencies from inputs to outputs. */
-  std::reverse(dependencies.begin(), dependencies.end());
+    stack.remove_last();
+    if (current != operation) {
+      dependencies.append(current);
+    }
+  }
 
   return dependencies;
 }
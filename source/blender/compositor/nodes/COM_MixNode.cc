@@ -26,6 +26,18 @@ void MixNode::convert_to_operations(NodeConverter &converter,
   bool use_alpha_premultiply = (this->get_bnode()->custom2 & 1) != 0;
   bool use_clamp = (this->get_bnode()->custom2 & 2) != 0;
 
+  /* The second color doesn't contribute anything if the factor is zero, so pass the first color
+   * through like the Switch node does, such that the operations linked to the second color are
+   * pruned from the graph. */
+  if (!value_socket->is_linked() && value_socket->get_editor_value_float() == 0.0f &&
+      color1Socket->is_linked() && !use_clamp)
+  {
+    NodeOperationOutput *result = converter.add_input_proxy(color1Socket, false);
+    converter.map_output_socket(output_socket, result);
+    converter.add_preview(result);
+    return;
+  }
+
   MixBaseOperation *convert_prog;
   switch (editor_node->custom1) {
     case MA_RAMP_ADD:
@@ -2,8 +2,19 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <cmath>
+#include <complex>
+
+#if defined(WITH_FFTW3)
+#  include <fftw3.h>
+#endif
+
+#include "BLI_fftw.hh"
+#include "BLI_index_range.hh"
+#include "BLI_math_base.hh"
 #include "BLI_math_vector.h"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 
 #include "COM_BokehBlurOperation.h"
 #include "COM_ConstantOperation.h"
@@ -29,6 +40,7 @@ BokehBlurOperation::BokehBlurOperation()
   sizeavailable_ = false;
 
   extend_bounds_ = false;
+  use_frequency_domain_ = false;
 }
 
 void BokehBlurOperation::init_data()
@@ -96,10 +108,212 @@ void BokehBlurOperation::get_area_of_interest(const int input_idx,
   }
 }
 
+/* Returns true if convolving in the frequency domain is expected to be faster than the direct
+ * convolution. The direct convolution does a multiply-add per kernel texel per pixel, while the
+ * frequency domain convolution does four forward and four backward transforms for the image and
+ * four forward transforms for the kernels, each costing roughly 2.5 * N * log2(N) operations. */
+[[maybe_unused]] static bool is_frequency_domain_faster(const int2 area_size,
+                                                        const int2 spatial_size,
+                                                        const int radius)
+{
+  const double direct_cost = double(area_size.x) * area_size.y * math::square(radius * 2.0 + 1.0);
+  const double spatial_pixels_count = double(spatial_size.x) * spatial_size.y;
+  const double frequency_cost = 12.0 * 2.5 * spatial_pixels_count *
+                                std::log2(spatial_pixels_count);
+  return frequency_cost < direct_cost;
+}
+
+void BokehBlurOperation::update_memory_buffer_started(MemoryBuffer *output,
+                                                      const rcti &area,
+                                                      Span<MemoryBuffer *> inputs)
+{
+  use_frequency_domain_ = false;
+
+#if defined(WITH_FFTW3)
+  const float max_dim = std::max(this->get_width(), this->get_height());
+  const int radius = size_ * max_dim / 100.0f;
+  if (radius == 0 || output->is_a_single_elem() || inputs[IMAGE_INPUT_INDEX]->is_a_single_elem())
+  {
+    return;
+  }
+
+  const int2 area_size = int2(BLI_rcti_size_x(&area), BLI_rcti_size_y(&area));
+  const int2 spatial_size = fftw::optimal_size_for_real_transform(area_size + radius * 2);
+  if (!is_frequency_domain_faster(area_size, spatial_size, radius)) {
+    return;
+  }
+
+  convolve_in_frequency_domain(output, area, inputs, radius);
+  use_frequency_domain_ = true;
+#else
+  UNUSED_VARS(output, area, inputs);
+#endif
+}
+
+void BokehBlurOperation::convolve_in_frequency_domain(MemoryBuffer *output,
+                                                      const rcti &area,
+                                                      Span<MemoryBuffer *> inputs,
+                                                      const int radius)
+{
+#if defined(WITH_FFTW3)
+  fftw::initialize_float();
+
+  const MemoryBuffer *image_input = inputs[IMAGE_INPUT_INDEX];
+  const MemoryBuffer *bokeh_input = inputs[BOKEH_INPUT_INDEX];
+  const MemoryBuffer *bounding_input = inputs[BOUNDING_BOX_INPUT_INDEX];
+  const int2 bokeh_size = int2(bokeh_input->get_width(), bokeh_input->get_height());
+
+  /* Since we will be doing a circular convolution, pad the area by the radius on all sides such
+   * that the kernel doesn't wrap around to the other side of the area. The padding is filled with
+   * the clamped image to match the boundary handling of the direct convolution. */
+  const int2 area_size = int2(BLI_rcti_size_x(&area), BLI_rcti_size_y(&area));
+  const int2 area_offset = int2(area.xmin, area.ymin) - radius;
+  const int2 spatial_size = fftw::optimal_size_for_real_transform(area_size + radius * 2);
+
+  /* See the fog glow glare operation for the layout of the real to complex transforms. */
+  const int2 frequency_size = int2(spatial_size.x / 2 + 1, spatial_size.y);
+
+  const int channels_count = 4;
+  const int64_t spatial_pixels_per_channel = int64_t(spatial_size.x) * spatial_size.y;
+  const int64_t frequency_pixels_per_channel = int64_t(frequency_size.x) * frequency_size.y;
+  const int64_t spatial_pixels_count = spatial_pixels_per_channel * channels_count;
+  const int64_t frequency_pixels_count = frequency_pixels_per_channel * channels_count;
+
+  /* Each channel has its own kernel, since the bokeh image is a color image. */
+  float *kernel_spatial_domain = fftwf_alloc_real(spatial_pixels_count);
+  std::complex<float> *kernel_frequency_domain = reinterpret_cast<std::complex<float> *>(
+      fftwf_alloc_complex(frequency_pixels_count));
+  float *image_spatial_domain = fftwf_alloc_real(spatial_pixels_count);
+  std::complex<float> *image_frequency_domain = reinterpret_cast<std::complex<float> *>(
+      fftwf_alloc_complex(frequency_pixels_count));
+
+  fftwf_plan forward_plan = fftwf_plan_dft_r2c_2d(
+      spatial_size.y,
+      spatial_size.x,
+      image_spatial_domain,
+      reinterpret_cast<fftwf_complex *>(image_frequency_domain),
+      FFTW_ESTIMATE);
+  fftwf_plan backward_plan = fftwf_plan_dft_c2r_2d(
+      spatial_size.y,
+      spatial_size.x,
+      reinterpret_cast<fftwf_complex *>(image_frequency_domain),
+      image_spatial_domain,
+      FFTW_ESTIMATE);
+
+  /* Compute the kernels in planar format, that is, RRRR...GGGG...BBBB...AAAA. The direct
+   * convolution is a correlation, so the kernel is mirrored and then offset with wrap around such
+   * that it is centered at the zero point, which is the expected format for doing circular
+   * convolutions in the frequency domain. */
+  std::fill_n(kernel_spatial_domain, spatial_pixels_count, 0.0f);
+  double4 kernel_sum = double4(0.0);
+  for (int yi = -radius; yi <= radius; ++yi) {
+    for (int xi = -radius; xi <= radius; ++xi) {
+      const float2 normalized_texel = (float2(xi, yi) + radius + 0.5f) / (radius * 2.0f + 1.0f);
+      const float2 weight_texel = (1.0f - normalized_texel) * float2(bokeh_size - 1);
+      const float4 weight = bokeh_input->get_elem(int(weight_texel.x), int(weight_texel.y));
+      const int64_t base_index = mod_i(-xi, spatial_size.x) +
+                                 int64_t(mod_i(-yi, spatial_size.y)) * spatial_size.x;
+      for (const int64_t channel : IndexRange(channels_count)) {
+        kernel_spatial_domain[base_index + spatial_pixels_per_channel * channel] = weight[channel];
+        kernel_sum[channel] += weight[channel];
+      }
+    }
+  }
+
+  threading::parallel_for(IndexRange(spatial_size.y), 1, [&](const IndexRange sub_y_range) {
+    for (const int64_t y : sub_y_range) {
+      for (const int64_t x : IndexRange(spatial_size.x)) {
+        const float *color = image_input->get_elem_clamped(area_offset.x + x, area_offset.y + y);
+        const int64_t base_index = x + y * spatial_size.x;
+        for (const int64_t channel : IndexRange(channels_count)) {
+          image_spatial_domain[base_index + spatial_pixels_per_channel * channel] = color[channel];
+        }
+      }
+    }
+  });
+
+  threading::parallel_for(IndexRange(channels_count), 1, [&](const IndexRange sub_range) {
+    for (const int64_t channel : sub_range) {
+      fftwf_execute_dft_r2c(forward_plan,
+                            kernel_spatial_domain + spatial_pixels_per_channel * channel,
+                            reinterpret_cast<fftwf_complex *>(kernel_frequency_domain) +
+                                frequency_pixels_per_channel * channel);
+      fftwf_execute_dft_r2c(forward_plan,
+                            image_spatial_domain + spatial_pixels_per_channel * channel,
+                            reinterpret_cast<fftwf_complex *>(image_frequency_domain) +
+                                frequency_pixels_per_channel * channel);
+    }
+  });
+  fftwf_free(kernel_spatial_domain);
+
+  /* Multiply the kernels and the image in the frequency domain to perform the convolution, taking
+   * into account the scale of the unnormalized FFT as well as the normalization of the kernels,
+   * which is done by the direct convolution by dividing by the accumulated weights. */
+  const float spatial_scale = float(spatial_size.x) * spatial_size.y;
+  threading::parallel_for(IndexRange(frequency_size.y), 1, [&](const IndexRange sub_y_range) {
+    for (const int64_t channel : IndexRange(channels_count)) {
+      const float normalization_scale = spatial_scale * float(kernel_sum[channel]);
+      for (const int64_t y : sub_y_range) {
+        for (const int64_t x : IndexRange(frequency_size.x)) {
+          const int64_t index = x + y * frequency_size.x + frequency_pixels_per_channel * channel;
+          if (normalization_scale == 0.0f) {
+            image_frequency_domain[index] = 0.0f;
+            continue;
+          }
+          image_frequency_domain[index] *= kernel_frequency_domain[index] / normalization_scale;
+        }
+      }
+    }
+  });
+
+  threading::parallel_for(IndexRange(channels_count), 1, [&](const IndexRange sub_range) {
+    for (const int64_t channel : sub_range) {
+      fftwf_execute_dft_c2r(backward_plan,
+                            reinterpret_cast<fftwf_complex *>(image_frequency_domain) +
+                                frequency_pixels_per_channel * channel,
+                            image_spatial_domain + spatial_pixels_per_channel * channel);
+    }
+  });
+
+  /* Copy the result to the output, passing through the pixels outside of the bounding box. */
+  threading::parallel_for(IndexRange(area_size.y), 1, [&](const IndexRange sub_y_range) {
+    for (const int64_t y : sub_y_range) {
+      for (const int64_t x : IndexRange(area_size.x)) {
+        const int output_x = area.xmin + x;
+        const int output_y = area.ymin + y;
+        float *output_color = output->get_elem(output_x, output_y);
+        if (*bounding_input->get_elem(output_x, output_y) <= 0.0f) {
+          image_input->read_elem(output_x, output_y, output_color);
+          continue;
+        }
+
+        const int64_t base_index = (x + radius) + (y + radius) * spatial_size.x;
+        for (const int64_t channel : IndexRange(channels_count)) {
+          output_color[channel] =
+              image_spatial_domain[base_index + spatial_pixels_per_channel * channel];
+        }
+      }
+    }
+  });
+
+  fftwf_destroy_plan(forward_plan);
+  fftwf_destroy_plan(backward_plan);
+  fftwf_free(image_spatial_domain);
+  fftwf_free(image_frequency_domain);
+  fftwf_free(kernel_frequency_domain);
+#else
+  UNUSED_VARS(output, area, inputs, radius);
+#endif
+}
+
 void BokehBlurOperation::update_memory_buffer_partial(MemoryBuffer *output,
                                                       const rcti &area,
                                                       Span<MemoryBuffer *> inputs)
 {
+  if (use_frequency_domain_) {
+    return;
+  }
+
   const float max_dim = std::max(this->get_width(), this->get_height());
   const int radius = size_ * max_dim / 100.0f;
 
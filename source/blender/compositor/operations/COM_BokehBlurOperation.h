@@ -16,6 +16,15 @@ class BokehBlurOperation : public MultiThreadedOperation {
 
   bool extend_bounds_;
 
+  /* True if the current pass was already computed in the frequency domain, in which case the
+   * partial updates have nothing left to do. */
+  bool use_frequency_domain_;
+
+  void convolve_in_frequency_domain(MemoryBuffer *output,
+                                    const rcti &area,
+                                    Span<MemoryBuffer *> inputs,
+                                    int radius);
+
  public:
   BokehBlurOperation();
 
@@ -35,6 +44,9 @@ class BokehBlurOperation : public MultiThreadedOperation {
   void determine_canvas(const rcti &preferred_area, rcti &r_area) override;
 
   void get_area_of_interest(int input_idx, const rcti &output_area, rcti &r_input_area) override;
+  void update_memory_buffer_started(MemoryBuffer *output,
+                                    const rcti &area,
+                                    Span<MemoryBuffer *> inputs) override;
   void update_memory_buffer_partial(MemoryBuffer *output,
                                     const rcti &area,
                                     Span<MemoryBuffer *> inputs) override;
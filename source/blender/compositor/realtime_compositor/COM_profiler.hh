@@ -35,7 +35,10 @@ class Profiler {
   /* Set the evaluation time of the node identified by the given node instance key. */
   void set_node_evaluation_time(bNodeInstanceKey node_instance_key, timeit::Nanoseconds time);
 
-  /* Finalize profiling by computing node group times. This should be called after evaluation. */
+  /* Finalize profiling by computing node group times. This should be called after evaluation.
+   * The times are also logged to the "compositor.profiler" log, which can be enabled using the
+   * --log command line argument, for instance, to inspect compositor performance in background
+   * renders. */
   void finalize(const bNodeTree &node_tree);
 
  private:
@@ -44,6 +47,10 @@ class Profiler {
    * The time is returned since the method is called recursively. */
   timeit::Nanoseconds accumulate_node_group_times(const bNodeTree &node_tree,
                                                   bNodeInstanceKey instance_key);
+
+  /* Logs the evaluation time of every evaluated node inside the given tree recursively, indenting
+   * the nodes of node groups by the given depth. */
+  void log_node_times(const bNodeTree &node_tree, bNodeInstanceKey instance_key, int depth) const;
 };
 
 }  // namespace blender::realtime_compositor
@@ -23,7 +23,9 @@ using namespace nodes::derived_node_tree_types;
  * Get the origin socket of the given node input. If the input is not linked, the socket itself is
  * returned. If the input is linked, the socket that is linked to it is returned, which could
  * either be an input or an output. An input socket is returned when the given input is connected
- * to an unlinked input of a group input node.
+ * to an unlinked input of a group input node. Inputs that are not used by their node given its
+ * current settings, like the unselected input of a Switch node, are considered unlinked, such
+ * that the branches linked to them are not evaluated.
  */
 DSocket get_input_origin_socket(DInputSocket input);
 
@@ -2,6 +2,10 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <chrono>
+
+#include "CLG_log.h"
+
 #include "BLI_timeit.hh"
 
 #include "DNA_node_types.h"
@@ -15,6 +19,8 @@
 
 namespace blender::realtime_compositor {
 
+static CLG_LogRef LOG = {"compositor.profiler"};
+
 Map<bNodeInstanceKey, timeit::Nanoseconds> &Profiler::get_nodes_evaluation_times()
 {
   return nodes_evaluation_times_;
@@ -63,10 +69,42 @@ timeit::Nanoseconds Profiler::accumulate_node_group_times(const bNodeTree &node_
   return tree_evaluation_time;
 }
 
+void Profiler::log_node_times(const bNodeTree &node_tree,
+                              bNodeInstanceKey instance_key,
+                              const int depth) const
+{
+  for (const bNode *node : node_tree.all_nodes()) {
+    const bNodeInstanceKey node_instance_key = bke::node_instance_key(
+        instance_key, &node_tree, node);
+    const timeit::Nanoseconds *time = nodes_evaluation_times_.lookup_ptr(node_instance_key);
+    if (!time) {
+      continue;
+    }
+
+    CLOG_INFO(&LOG,
+              1,
+              "%*s%s: %.3f ms",
+              depth * 2,
+              "",
+              node->name,
+              std::chrono::duration<double, std::milli>(*time).count());
+
+    const bNodeTree *child_tree = reinterpret_cast<bNodeTree *>(node->id);
+    if (node->is_group() && child_tree) {
+      this->log_node_times(*child_tree, node_instance_key, depth + 1);
+    }
+  }
+}
+
 void Profiler::finalize(const bNodeTree &node_tree)
 {
   /* Compute the evaluation time of all node groups starting from the root tree. */
   this->accumulate_node_group_times(node_tree, bke::NODE_INSTANCE_KEY_BASE);
+
+  if (CLOG_CHECK(&LOG, 1)) {
+    CLOG_INFO(&LOG, 1, "Node evaluation times of \"%s\":", node_tree.id.name + 2);
+    this->log_node_times(node_tree, bke::NODE_INSTANCE_KEY_BASE, 1);
+  }
 }
 
 }  // namespace blender::realtime_compositor
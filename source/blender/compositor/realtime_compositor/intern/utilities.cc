@@ -9,6 +9,9 @@
 
 #include "DNA_node_types.h"
 
+#include "BKE_node.hh"
+#include "BKE_node_runtime.hh"
+
 #include "NOD_derived_node_tree.hh"
 #include "NOD_node_declaration.hh"
 
@@ -24,10 +27,38 @@ namespace blender::realtime_compositor {
 using namespace nodes::derived_node_tree_types;
 using TargetSocketPathInfo = DOutputSocket::TargetSocketPathInfo;
 
+/* Returns true if the given input is not needed to compute the outputs of its node given the
+ * settings of the node and the values of its unlinked inputs. Such inputs are treated as if they
+ * were unlinked, so the branches linked to them are never scheduled nor evaluated. */
+static bool is_input_unused(DInputSocket input)
+{
+  const bNode &node = *input.node();
+  switch (node.type) {
+    case CMP_NODE_SWITCH:
+      /* Only the input selected by the check option is passed through. */
+      return input->identifier != StringRef(node.custom1 ? "On" : "Off");
+    case CMP_NODE_MIX_RGB: {
+      /* The second color doesn't contribute anything if the factor is zero. This is only done if
+       * the first color is linked, since the output would otherwise take the domain of the second
+       * color. The first color is still needed even if the factor is one, because it has the
+       * highest domain priority. */
+      if (input->identifier != StringRef("Image_001")) {
+        return false;
+      }
+      const bNodeSocket &factor = node.input_by_identifier("Fac");
+      return !factor.is_logically_linked() &&
+             factor.default_value_typed<bNodeSocketValueFloat>()->value == 0.0f &&
+             node.input_by_identifier("Image").is_logically_linked();
+    }
+    default:
+      return false;
+  }
+}
+
 DSocket get_input_origin_socket(DInputSocket input)
 {
-  /* The input is unlinked. Return the socket itself. */
-  if (!input->is_logically_linked()) {
+  /* The input is unlinked or unused by its node. Return the socket itself. */
+  if (!input->is_logically_linked() || is_input_unused(input)) {
     return input;
   }
 
@@ -73,6 +104,9 @@ bool is_output_linked_to_node_conditioned(DOutputSocket output, FunctionRef<bool
   bool condition_satisfied = false;
   output.foreach_target_socket(
       [&](DInputSocket target, const TargetSocketPathInfo & /*path_info*/) {
+        if (is_input_unused(target)) {
+          return;
+        }
         if (condition(target.node())) {
           condition_satisfied = true;
           return;
@@ -87,6 +121,9 @@ int number_of_inputs_linked_to_output_conditioned(DOutputSocket output,
   int count = 0;
   output.foreach_target_socket(
       [&](DInputSocket target, const TargetSocketPathInfo & /*path_info*/) {
+        if (is_input_unused(target)) {
+          return;
+        }
         if (condition(target)) {
           count++;
         }
@@ -30,6 +30,8 @@
 
 #pragma once
 
+#include "BLI_span.hh"
+
 #include "DNA_ID.h"
 
 /* Dependency Graph */
@@ -192,6 +194,18 @@ void DEG_evaluate_on_framechange(
     float frame,
     DepsgraphEvaluateSyncWriteback sync_writeback = DEG_EVALUATE_SYNC_WRITEBACK_NO);
 
+/**
+ * Evaluate every graph at its own frame, in parallel. The graphs are typically created with
+ * #DEG_graph_new for the same view layer, and share all original data. This allows exporters and
+ * renderers to evaluate multiple frames at once when frames are independent of each other.
+ *
+ * \note None of the graphs can be active, nothing is written back to original data. Frame change
+ * handlers are not run, and data which depends on the previous frame (like simulations and
+ * physics caches) is not supported. Recalc flags are cleared after evaluation.
+ */
+void DEG_evaluate_on_framechange_multiple(blender::Span<Depsgraph *> graphs,
+                                          blender::Span<float> frames);
+
 /**
  * Data changed recalculation entry point.
  * Evaluate all nodes tagged for updating.
@@ -52,6 +52,34 @@ void DEG_debug_stats_gnuplot(const Depsgraph *graph,
                              const char *label,
                              const char *output_filename);
 
+/* ************************************************ */
+/* Evaluation Trace */
+
+/**
+ * Start recording every evaluated operation with its thread and timing, discarding events of a
+ * previous trace.
+ */
+void DEG_debug_trace_begin(Depsgraph *graph);
+/** Stop recording, the recorded events stay available for #DEG_debug_trace_to_json. */
+void DEG_debug_trace_end(Depsgraph *graph);
+bool DEG_debug_trace_is_active(const Depsgraph *graph);
+
+/**
+ * Recorded events in the Chrome trace event format, which can be viewed with
+ * `chrome://tracing` or https://ui.perfetto.dev.
+ */
+std::string DEG_debug_trace_to_json(const Depsgraph &graph);
+
+/* ************************************************ */
+/* Memory Report */
+
+/**
+ * Human readable report of the geometry memory used by the original and evaluated data of every
+ * ID in the graph, largest first. The total counts data that is implicitly shared between IDs (or
+ * between original and evaluated data) only once.
+ */
+std::string DEG_debug_memory_report(const Depsgraph &graph);
+
 /* ************************************************ */
 
 /** Compare two dependency graphs. */
@@ -0,0 +1,69 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#include "intern/builder/deg_builder_critical_path.h"
+
+#include "BLI_vector.hh"
+
+#include "intern/node/deg_node.hh"
+#include "intern/node/deg_node_operation.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/depsgraph_relation.hh"
+
+namespace blender::deg {
+
+static bool is_critical_path_relation(const Relation *rel)
+{
+  /* Cyclic relations are ignored during evaluation as well, without them the graph is acyclic. */
+  return rel->from->type == NodeType::OPERATION && rel->to->type == NodeType::OPERATION &&
+         (rel->flag & RELATION_FLAG_CYCLIC) == 0;
+}
+
+void deg_graph_calculate_critical_path(Depsgraph *graph)
+{
+  /* Process operations after all of their children, starting at the ones without children. The
+   * custom flags store the number of children which are not processed yet. */
+  Vector<OperationNode *> stack;
+  for (OperationNode *node : graph->operations) {
+    node->critical_path_length = 0;
+    node->custom_flags = 0;
+    for (const Relation *rel : node->outlinks) {
+      if (is_critical_path_relation(rel)) {
+        node->custom_flags++;
+      }
+    }
+    if (node->custom_flags == 0) {
+      stack.append(node);
+    }
+  }
+
+  while (!stack.is_empty()) {
+    OperationNode *node = stack.pop_last();
+    uint32_t children_length = 0;
+    for (const Relation *rel : node->outlinks) {
+      if (is_critical_path_relation(rel)) {
+        const OperationNode *child = static_cast<const OperationNode *>(rel->to);
+        children_length = std::max(children_length, child->critical_path_length);
+      }
+    }
+    /* No-op operations are skipped during evaluation, they don't make the chain longer. */
+    node->critical_path_length = children_length + (node->is_noop() ? 0 : 1);
+
+    for (Relation *rel : node->inlinks) {
+      if (is_critical_path_relation(rel)) {
+        OperationNode *parent = static_cast<OperationNode *>(rel->from);
+        if (--parent->custom_flags == 0) {
+          stack.append(parent);
+        }
+      }
+    }
+  }
+}
+
+}  // namespace blender::deg
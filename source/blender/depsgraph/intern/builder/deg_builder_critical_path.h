@@ -0,0 +1,19 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ */
+
+#pragma once
+
+namespace blender::deg {
+
+struct Depsgraph;
+
+/* Calculate the length of the longest chain of dependent operations starting at every operation,
+ * used to evaluate the operations which delay the end of the evaluation the most first. */
+void deg_graph_calculate_critical_path(Depsgraph *graph);
+
+}  // namespace blender::deg
@@ -415,6 +415,7 @@ void DepsgraphNodeBuilder::begin_build()
   /* Make sure graph has no nodes left from previous state. */
   graph_->clear_all_nodes();
   graph_->operations.clear();
+  graph_->schedule_cache.clear();
   graph_->entry_tags.clear();
 }
 
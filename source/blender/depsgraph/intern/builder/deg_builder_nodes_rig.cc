@@ -16,6 +16,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_blenlib.h"
+#include "BLI_set.hh"
 #include "BLI_string.h"
 #include "BLI_utildefines.h"
 
@@ -42,6 +43,30 @@
 
 namespace blender::deg {
 
+/**
+ * Bones that may be modified by an IK or Spline IK solver after their pose parent operation. This
+ * is conservative: all parents of a bone with such a constraint are included, whatever the chain
+ * length is, since the chain length can be animated.
+ */
+static Set<const bPoseChannel *> pose_solver_chain_pchans(const Object *object)
+{
+  Set<const bPoseChannel *> pchans;
+  LISTBASE_FOREACH (const bPoseChannel *, pchan, &object->pose->chanbase) {
+    LISTBASE_FOREACH (const bConstraint *, con, &pchan->constraints) {
+      if (!ELEM(con->type, CONSTRAINT_TYPE_KINEMATIC, CONSTRAINT_TYPE_SPLINEIK)) {
+        continue;
+      }
+      for (const bPoseChannel *chain = pchan; chain != nullptr; chain = chain->parent) {
+        if (!pchans.add(chain)) {
+          break;
+        }
+      }
+      break;
+    }
+  }
+  return pchans;
+}
+
 void DepsgraphNodeBuilder::build_pose_constraints(Object *object,
                                                   bPoseChannel *pchan,
                                                   int pchan_index)
@@ -208,6 +233,7 @@ void DepsgraphNodeBuilder::build_rig(Object *object)
       [object_cow](::Depsgraph *depsgraph) { BKE_pose_eval_done(depsgraph, object_cow); });
   op_node->set_as_exit();
   /* Bones. */
+  const Set<const bPoseChannel *> solver_chain_pchans = pose_solver_chain_pchans(object);
   int pchan_index = 0;
   LISTBASE_FOREACH (bPoseChannel *, pchan, &object->pose->chanbase) {
     /* Node for bone evaluation. */
@@ -215,24 +241,48 @@ void DepsgraphNodeBuilder::build_rig(Object *object)
         &object->id, NodeType::BONE, pchan->name, OperationCode::BONE_LOCAL);
     op_node->set_as_entry();
 
-    add_operation_node(&object->id,
-                       NodeType::BONE,
-                       pchan->name,
-                       OperationCode::BONE_POSE_PARENT,
-                       [scene_cow, object_cow, pchan_index](::Depsgraph *depsgraph) {
-                         BKE_pose_eval_bone(depsgraph, scene_cow, object_cow, pchan_index);
-                       });
+    /* Most bones of big rigs have no constraints and are not in an IK chain. Nothing modifies
+     * their pose matrix after the pose parent operation, so the bone done step is done right
+     * away, keeping the bone done operation as a noop for the relations. This halves the number
+     * of operations that are scheduled for such bones. */
+    const bool is_simple_bone = BLI_listbase_is_empty(&pchan->constraints) &&
+                                !solver_chain_pchans.contains(pchan);
+    if (is_simple_bone) {
+      add_operation_node(&object->id,
+                         NodeType::BONE,
+                         pchan->name,
+                         OperationCode::BONE_POSE_PARENT,
+                         [scene_cow, object_cow, pchan_index](::Depsgraph *depsgraph) {
+                           BKE_pose_eval_bone_and_done(
+                               depsgraph, scene_cow, object_cow, pchan_index);
+                         });
+    }
+    else {
+      add_operation_node(&object->id,
+                         NodeType::BONE,
+                         pchan->name,
+                         OperationCode::BONE_POSE_PARENT,
+                         [scene_cow, object_cow, pchan_index](::Depsgraph *depsgraph) {
+                           BKE_pose_eval_bone(depsgraph, scene_cow, object_cow, pchan_index);
+                         });
+    }
 
     /* NOTE: Dedicated noop for easier relationship construction. */
     add_operation_node(&object->id, NodeType::BONE, pchan->name, OperationCode::BONE_READY);
 
-    op_node = add_operation_node(&object->id,
-                                 NodeType::BONE,
-                                 pchan->name,
-                                 OperationCode::BONE_DONE,
-                                 [object_cow, pchan_index](::Depsgraph *depsgraph) {
-                                   BKE_pose_bone_done(depsgraph, object_cow, pchan_index);
-                                 });
+    if (is_simple_bone) {
+      op_node = add_operation_node(
+          &object->id, NodeType::BONE, pchan->name, OperationCode::BONE_DONE);
+    }
+    else {
+      op_node = add_operation_node(&object->id,
+                                   NodeType::BONE,
+                                   pchan->name,
+                                   OperationCode::BONE_DONE,
+                                   [object_cow, pchan_index](::Depsgraph *depsgraph) {
+                                     BKE_pose_bone_done(depsgraph, object_cow, pchan_index);
+                                   });
+    }
 
     /* B-Bone shape computation - the real last step if present. */
     if (check_pchan_has_bbone(object, pchan)) {
@@ -20,6 +20,7 @@
 
 #include "BLI_blenlib.h"
 #include "BLI_span.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_action_types.h"
@@ -3459,8 +3460,15 @@ void DepsgraphRelationBuilder::build_vfont(VFont *vfont)
 
 void DepsgraphRelationBuilder::build_copy_on_write_relations()
 {
+  /* Relations within an ID only modify nodes of that ID, so IDs are handled in parallel. Relations
+   * between IDs modify nodes of multiple IDs and are added afterwards. */
+  threading::parallel_for(graph_->id_nodes.index_range(), 64, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      build_copy_on_write_relations(graph_->id_nodes[i]);
+    }
+  });
   for (IDNode *id_node : graph_->id_nodes) {
-    build_copy_on_write_relations(id_node);
+    build_copy_on_write_data_relations(id_node);
   }
 }
 
@@ -3602,6 +3610,15 @@ void DepsgraphRelationBuilder::build_copy_on_write_relations(IDNode *id_node)
      * evaluation step needs geometry, it will have transitive dependency
      * to Mesh copy-on-evaluation already. */
   }
+}
+
+void DepsgraphRelationBuilder::build_copy_on_write_data_relations(IDNode *id_node)
+{
+  ID *id_orig = id_node->id_orig;
+  if (!deg_eval_copy_is_needed(GS(id_orig->name))) {
+    return;
+  }
+  OperationKey copy_on_write_key(id_orig, NodeType::COPY_ON_EVAL, OperationCode::COPY_ON_EVAL);
   /* TODO(sergey): This solves crash for now, but causes too many
    * updates potentially. */
   if (GS(id_orig->name) == ID_OB) {
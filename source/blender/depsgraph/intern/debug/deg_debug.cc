@@ -8,15 +8,22 @@
 
 #include "intern/debug/deg_debug.h"
 
+#include <algorithm>
+
 #include "BLI_console.h"
 #include "BLI_hash.h"
 #include "BLI_string.h"
+#include "BLI_time.h"
 #include "BLI_time_utildefines.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_global.hh"
 
 #include "intern/depsgraph.hh"
+#include "intern/node/deg_node_component.hh"
+#include "intern/node/deg_node_id.hh"
+#include "intern/node/deg_node_operation.hh"
 
 namespace blender::deg {
 
@@ -55,6 +62,55 @@ void DepsgraphDebug::end_graph_evaluation()
   }
 }
 
+void DepsgraphDebug::trace_begin()
+{
+  for (Vector<DepsgraphTraceEvent> &events : trace_events_) {
+    events.clear();
+  }
+  trace_start_time_ = BLI_time_now_seconds();
+  is_tracing_ = true;
+}
+
+void DepsgraphDebug::trace_end()
+{
+  is_tracing_ = false;
+}
+
+bool DepsgraphDebug::is_tracing() const
+{
+  return is_tracing_;
+}
+
+void DepsgraphDebug::trace_record(const OperationNode &operation_node,
+                                  const double start_time,
+                                  const double end_time)
+{
+  const ComponentNode *component_node = operation_node.owner;
+  DepsgraphTraceEvent event;
+  event.id_name = component_node->owner->name;
+  event.component_name = component_node->name;
+  event.component_type = nodeTypeAsString(component_node->type);
+  event.operation_name = operation_node.identifier();
+  event.thread_index = trace::current_thread_index();
+  event.start_time = start_time - trace_start_time_;
+  event.end_time = end_time - trace_start_time_;
+  trace_events_.local().append(std::move(event));
+}
+
+Vector<DepsgraphTraceEvent> DepsgraphDebug::trace_events() const
+{
+  Vector<DepsgraphTraceEvent> result;
+  for (const Vector<DepsgraphTraceEvent> &events : trace_events_) {
+    result.extend(events);
+  }
+  std::sort(result.begin(),
+            result.end(),
+            [](const DepsgraphTraceEvent &a, const DepsgraphTraceEvent &b) {
+              return a.start_time < b.start_time;
+            });
+  return result;
+}
+
 bool terminal_do_color()
 {
   return (G.debug & G_DEBUG_DEPSGRAPH_PRETTY) != 0;
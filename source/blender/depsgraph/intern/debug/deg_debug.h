@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "BLI_enumerable_thread_specific.hh"
+
 #include "intern/depsgraph_type.hh"
 
 #include "BKE_global.hh"
@@ -16,6 +18,22 @@
 
 namespace blender::deg {
 
+struct OperationNode;
+
+/* Evaluation of a single operation, recorded while an evaluation trace is captured.
+ * Names are copied, so that the trace survives relations updates of the graph. */
+struct DepsgraphTraceEvent {
+  string id_name;
+  string component_name;
+  string operation_name;
+  /* Static string of the component type. */
+  const char *component_type;
+  int thread_index;
+  /* In seconds, relative to the start of the trace. */
+  double start_time;
+  double end_time;
+};
+
 class DepsgraphDebug {
  public:
   DepsgraphDebug();
@@ -25,6 +43,15 @@ class DepsgraphDebug {
   void begin_graph_evaluation();
   void end_graph_evaluation();
 
+  /* Evaluation trace, capturing every evaluated operation until the trace is ended. */
+  void trace_begin();
+  void trace_end();
+  bool is_tracing() const;
+  /* Thread-safe, called from the evaluation threads. Times are the absolute time in seconds. */
+  void trace_record(const OperationNode &operation_node, double start_time, double end_time);
+  /* All recorded events, sorted by their start time. */
+  Vector<DepsgraphTraceEvent> trace_events() const;
+
   /* NOTE: Corresponds to G_DEBUG_DEPSGRAPH_* flags. */
   int flags;
 
@@ -40,6 +67,11 @@ class DepsgraphDebug {
    * Is initialized from begin_graph_evaluation() when time debug is enabled.
    */
   double graph_evaluation_start_time_;
+
+  bool is_tracing_ = false;
+  double trace_start_time_ = 0.0;
+  /* Events of every thread, avoiding locks while evaluating. */
+  mutable threading::EnumerableThreadSpecific<Vector<DepsgraphTraceEvent>> trace_events_;
 };
 
 #define DEG_DEBUG_PRINTF(depsgraph, type, ...) \
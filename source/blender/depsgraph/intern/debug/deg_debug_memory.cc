@@ -0,0 +1,146 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Attribution of geometry memory to the IDs of a dependency graph.
+ */
+
+#include <algorithm>
+#include <optional>
+#include <sstream>
+
+#include "MEM_guardedalloc.h"
+
+#include "BLI_memory_counter.hh"
+#include "BLI_string.h"
+#include "BLI_vector.hh"
+
+#include "BKE_geometry_set.hh"
+#include "BKE_geometry_set_instances.hh"
+
+#include "DNA_ID.h"
+#include "DNA_object_types.h"
+
+#include "DEG_depsgraph_debug.hh"
+
+#include "intern/depsgraph.hh"
+#include "intern/eval/deg_eval_copy_on_write.h"
+#include "intern/node/deg_node_id.hh"
+
+namespace deg = blender::deg;
+
+namespace blender::deg {
+namespace {
+
+struct IDMemoryEntry {
+  const IDNode *id_node;
+  int64_t original_bytes;
+  int64_t evaluated_bytes;
+};
+
+/* Geometry stored directly in the ID, without taking ownership of it. */
+std::optional<bke::GeometrySet> geometry_of_id(ID *id)
+{
+  using namespace bke;
+  switch (GS(id->name)) {
+    case ID_ME:
+      return GeometrySet::from_mesh(reinterpret_cast<Mesh *>(id),
+                                    GeometryOwnershipType::ReadOnly);
+    case ID_CV:
+      return GeometrySet::from_curves(reinterpret_cast<Curves *>(id),
+                                      GeometryOwnershipType::ReadOnly);
+    case ID_PT:
+      return GeometrySet::from_pointcloud(reinterpret_cast<PointCloud *>(id),
+                                          GeometryOwnershipType::ReadOnly);
+    case ID_VO:
+      return GeometrySet::from_volume(reinterpret_cast<Volume *>(id),
+                                      GeometryOwnershipType::ReadOnly);
+    case ID_GP:
+      return GeometrySet::from_grease_pencil(reinterpret_cast<GreasePencil *>(id),
+                                             GeometryOwnershipType::ReadOnly);
+    default:
+      return std::nullopt;
+  }
+}
+
+/* Count the geometry once for the ID on its own, and once into the shared total, where data that
+ * is shared with other IDs is only counted the first time. */
+int64_t count_geometry(const bke::GeometrySet &geometry, MemoryCount &total)
+{
+  MemoryCount count;
+  MemoryCounter counter{count};
+  geometry.count_memory(counter);
+  MemoryCounter total_counter{total};
+  geometry.count_memory(total_counter);
+  return count.total_bytes;
+}
+
+std::string format_bytes(const int64_t bytes)
+{
+  char str[BLI_STR_FORMAT_INT64_BYTE_UNIT_SIZE];
+  BLI_str_format_byte_unit(str, bytes, false);
+  return str;
+}
+
+}  // namespace
+}  // namespace blender::deg
+
+std::string DEG_debug_memory_report(const Depsgraph &graph)
+{
+  using namespace blender;
+  const deg::Depsgraph &deg_graph = reinterpret_cast<const deg::Depsgraph &>(graph);
+
+  MemoryCount total;
+  Vector<deg::IDMemoryEntry> entries;
+  for (const deg::IDNode *id_node : deg_graph.id_nodes) {
+    int64_t original_bytes = 0;
+    int64_t evaluated_bytes = 0;
+    if (std::optional<bke::GeometrySet> geometry = deg::geometry_of_id(id_node->id_orig)) {
+      original_bytes = deg::count_geometry(*geometry, total);
+    }
+    ID *id_eval = id_node->id_cow;
+    if (id_eval != id_node->id_orig && deg::deg_eval_copy_is_expanded(id_eval)) {
+      if (GS(id_eval->name) == ID_OB) {
+        const Object &object_eval = *reinterpret_cast<const Object *>(id_eval);
+        const bke::GeometrySet geometry = bke::object_get_evaluated_geometry_set(object_eval);
+        evaluated_bytes = deg::count_geometry(geometry, total);
+      }
+      else if (std::optional<bke::GeometrySet> geometry = deg::geometry_of_id(id_eval)) {
+        evaluated_bytes = deg::count_geometry(*geometry, total);
+      }
+    }
+    if (original_bytes > 0 || evaluated_bytes > 0) {
+      entries.append({id_node, original_bytes, evaluated_bytes});
+    }
+  }
+
+  std::sort(entries.begin(), entries.end(), [](const auto &a, const auto &b) {
+    return a.original_bytes + a.evaluated_bytes > b.original_bytes + b.evaluated_bytes;
+  });
+
+  int64_t original_sum = 0;
+  int64_t evaluated_sum = 0;
+  std::stringstream ss;
+  ss << "Geometry memory by ID (estimate, data shared between IDs is included in every row)\n";
+  ss << "Original     Evaluated    ID\n";
+  for (const deg::IDMemoryEntry &entry : entries) {
+    char row[256];
+    SNPRINTF(row,
+             "%-12s %-12s %s\n",
+             deg::format_bytes(entry.original_bytes).c_str(),
+             deg::format_bytes(entry.evaluated_bytes).c_str(),
+             entry.id_node->id_orig->name);
+    ss << row;
+    original_sum += entry.original_bytes;
+    evaluated_sum += entry.evaluated_bytes;
+  }
+  ss << "Total: " << deg::format_bytes(total.total_bytes) << " (original "
+     << deg::format_bytes(original_sum) << ", evaluated " << deg::format_bytes(evaluated_sum)
+     << ", before deduplicating implicitly shared data)\n";
+  ss << "Guarded allocator in use: " << deg::format_bytes(int64_t(MEM_get_memory_in_use()))
+     << ", peak: " << deg::format_bytes(int64_t(MEM_get_peak_memory())) << "\n";
+  return ss.str();
+}
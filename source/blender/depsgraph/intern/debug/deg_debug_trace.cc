@@ -0,0 +1,60 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup depsgraph
+ *
+ * Export of recorded evaluation traces to the Chrome trace event format.
+ */
+
+#include "BLI_serialize.hh"
+#include "BLI_trace.hh"
+
+#include "DEG_depsgraph_debug.hh"
+
+#include "intern/debug/deg_debug.h"
+#include "intern/depsgraph.hh"
+
+namespace deg = blender::deg;
+
+void DEG_debug_trace_begin(Depsgraph *graph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
+  deg_graph->debug.trace_begin();
+}
+
+void DEG_debug_trace_end(Depsgraph *graph)
+{
+  deg::Depsgraph *deg_graph = reinterpret_cast<deg::Depsgraph *>(graph);
+  deg_graph->debug.trace_end();
+}
+
+bool DEG_debug_trace_is_active(const Depsgraph *graph)
+{
+  const deg::Depsgraph *deg_graph = reinterpret_cast<const deg::Depsgraph *>(graph);
+  return deg_graph->debug.is_tracing();
+}
+
+std::string DEG_debug_trace_to_json(const Depsgraph &graph)
+{
+  using namespace blender::io::serialize;
+  const deg::Depsgraph &deg_graph = reinterpret_cast<const deg::Depsgraph &>(graph);
+
+  const std::string process_name = deg_graph.debug.name.empty() ? "Depsgraph" :
+                                                                  deg_graph.debug.name;
+  blender::trace::ChromeTraceWriter writer(process_name);
+  for (const deg::DepsgraphTraceEvent &event : deg_graph.debug.trace_events()) {
+    DictionaryValue &trace_event = writer.add_event(event.id_name + " " + event.operation_name,
+                                                    event.component_type,
+                                                    event.thread_index,
+                                                    event.start_time,
+                                                    event.end_time);
+    DictionaryValue &args = *trace_event.append_dict("args");
+    args.append_str("id", event.id_name);
+    args.append_str("component", event.component_type);
+    args.append_str("component_name", event.component_name);
+    args.append_str("operation", event.operation_name);
+  }
+  return writer.to_json();
+}
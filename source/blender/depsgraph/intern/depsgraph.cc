@@ -63,7 +63,8 @@ Depsgraph::Depsgraph(Main *bmain, Scene *scene, ViewLayer *view_layer, eEvaluati
       is_evaluating(false),
       is_render_pipeline_depsgraph(false),
       use_editors_update(false),
-      update_count(0)
+      update_count(0),
+      eval_arena(MEM_arena_new("Depsgraph evaluation"))
 {
   BLI_spin_init(&lock);
   memset(id_type_updated, 0, sizeof(id_type_updated));
@@ -78,6 +79,7 @@ Depsgraph::~Depsgraph()
 {
   clear_id_nodes();
   delete time_source;
+  MEM_arena_free(eval_arena);
   BLI_spin_end(&lock);
 }
 
@@ -43,6 +43,22 @@ struct OperationNode;
 struct Relation;
 struct TimeSourceNode;
 
+/* Operations which were tagged for update in the previous evaluation, along with their number of
+ * pending parents. When the same operations are tagged again, which is typical for animation
+ * playback, the scheduling state is restored from here instead of being computed from the
+ * relations of the whole graph. */
+struct EvaluationScheduleCache {
+  /* Tagged operations in the order of #Depsgraph::operations. */
+  Vector<OperationNode *> operations;
+  Vector<uint32_t> num_links_pending;
+
+  void clear()
+  {
+    operations.clear_and_shrink();
+    num_links_pending.clear_and_shrink();
+  }
+};
+
 /* Dependency Graph object */
 struct Depsgraph {
   using OperationNodes = Vector<OperationNode *>;
@@ -125,6 +141,9 @@ struct Depsgraph {
   /* All operation nodes, sorted in order of single-thread traversal order. */
   OperationNodes operations;
 
+  /* Only valid while the operations and visibility of nodes are unchanged. */
+  EvaluationScheduleCache schedule_cache;
+
   /* Spin lock for threading-critical operations.
    * Mainly used by graph evaluation. */
   SpinLock lock;
@@ -178,6 +197,9 @@ struct Depsgraph {
   /* The number of times this graph has been evaluated. */
   uint64_t update_count;
 
+  /* Memory for temporary data of a single evaluation, cleared when the next evaluation starts. */
+  MEM_Arena *eval_arena;
+
   /**
    * Stores functions that can be called after depsgraph evaluation to writeback some changes to
    * original data. Also see `DEG_depsgraph_writeback_sync.hh`.
@@ -311,6 +311,11 @@ void DEG_graph_relations_update(Depsgraph *graph)
     /* Graph is up to date, nothing to do. */
     return;
   }
+  /* NOTE: The graph is always rebuilt from scratch. Relations of an ID are added by the builders
+   * of the IDs depending on it, and the builders are driven by a recursive traversal with shared
+   * visited state, so there is no set of nodes and relations owned by a single ID which could be
+   * rebuilt and spliced into the existing graph. Evaluated copies of IDs and update tags are
+   * preserved by #DepsgraphNodeBuilder::begin_build(). */
   DEG_graph_build_from_view_layer(graph);
 }
 
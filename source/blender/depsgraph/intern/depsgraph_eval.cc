@@ -11,6 +11,7 @@
 #include "MEM_guardedalloc.h"
 
 #include "BLI_listbase.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BKE_scene.hh"
@@ -19,9 +20,14 @@
 #include "DNA_scene_types.h"
 
 #include "DEG_depsgraph.hh"
+#include "DEG_depsgraph_build.hh"
 #include "DEG_depsgraph_query.hh"
 #include "DEG_depsgraph_writeback_sync.hh"
 
+#ifdef WITH_PYTHON
+#  include "BPY_extern.hh"
+#endif
+
 #include "intern/eval/deg_eval.h"
 #include "intern/eval/deg_eval_flush.h"
 
@@ -92,3 +98,36 @@ void DEG_evaluate_on_framechange(Depsgraph *graph,
   deg_graph->ctime = BKE_scene_frame_to_ctime(scene, frame);
   deg_flush_updates_and_refresh(deg_graph, sync_writeback);
 }
+
+void DEG_evaluate_on_framechange_multiple(const blender::Span<Depsgraph *> graphs,
+                                          const blender::Span<float> frames)
+{
+  using namespace blender;
+  BLI_assert(graphs.size() == frames.size());
+
+  /* Building relations accesses original data, so is done on the calling thread. */
+  for (Depsgraph *graph : graphs) {
+    BLI_assert(!DEG_is_active(graph));
+    DEG_graph_relations_update(graph);
+  }
+
+#ifdef WITH_PYTHON
+  /* Evaluation in other threads might need the GIL for drivers, while this thread waits. */
+  BPy_BEGIN_ALLOW_THREADS;
+#endif
+
+  threading::parallel_for(graphs.index_range(), 1, [&](const IndexRange range) {
+    for (const int64_t i : range) {
+      /* Avoid this thread picking up the evaluation of another graph while it waits for the
+       * tasks of its own graph. */
+      threading::isolate_task([&]() {
+        DEG_evaluate_on_framechange(graphs[i], frames[i], DEG_EVALUATE_SYNC_WRITEBACK_NO);
+        DEG_ids_clear_recalc(graphs[i], false);
+      });
+    }
+  });
+
+#ifdef WITH_PYTHON
+  BPy_END_ALLOW_THREADS;
+#endif
+}
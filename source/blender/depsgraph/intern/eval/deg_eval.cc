@@ -10,12 +10,16 @@
 
 #include "intern/eval/deg_eval.h"
 
+#include <algorithm>
+
 #include "BLI_compiler_attrs.h"
 #include "BLI_function_ref.hh"
 #include "BLI_gsqueue.h"
 #include "BLI_task.h"
 #include "BLI_time.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
+#include "BLI_vector.hh"
 
 #include "BKE_global.hh"
 
@@ -80,9 +84,15 @@ enum class EvaluationStage {
 struct DepsgraphEvalState {
   Depsgraph *graph;
   bool do_stats;
+  bool do_trace;
   EvaluationStage stage;
   bool need_update_pending_parents = true;
   bool need_single_thread_pass = false;
+  /* Use and update #Depsgraph::schedule_cache. */
+  bool use_schedule_cache = false;
+  /* Operations which are considered for scheduling. Is all operations of the graph, or only the
+   * tagged ones when the schedule cache is used, all others are up to date anyway. */
+  Span<OperationNode *> operations_to_schedule;
 };
 
 void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_node)
@@ -92,10 +102,16 @@ void evaluate_node(const DepsgraphEvalState *state, OperationNode *operation_nod
   /* Sanity checks. */
   BLI_assert_msg(!operation_node->is_noop(), "NOOP nodes should not actually be scheduled");
   /* Perform operation. */
-  if (state->do_stats) {
+  if (state->do_stats || state->do_trace) {
     const double start_time = BLI_time_now_seconds();
     operation_node->evaluate(depsgraph);
-    operation_node->stats.current_time += BLI_time_now_seconds() - start_time;
+    const double end_time = BLI_time_now_seconds();
+    if (state->do_stats) {
+      operation_node->stats.current_time += end_time - start_time;
+    }
+    if (state->do_trace) {
+      state->graph->debug.trace_record(*operation_node, start_time, end_time);
+    }
   }
   else {
     operation_node->evaluate(depsgraph);
@@ -113,14 +129,33 @@ void deg_task_run_func(TaskPool *pool, void *taskdata)
   void *userdata_v = BLI_task_pool_user_data(pool);
   DepsgraphEvalState *state = (DepsgraphEvalState *)userdata_v;
 
-  /* Evaluate node. */
   OperationNode *operation_node = reinterpret_cast<OperationNode *>(taskdata);
-  evaluate_node(state, operation_node);
+  Vector<OperationNode *, 16, ArenaAllocator> ready_children(
+      ArenaAllocator(state->graph->eval_arena));
+  while (operation_node) {
+    /* Evaluate node. */
+    evaluate_node(state, operation_node);
 
-  /* Schedule children. */
-  schedule_children(state, operation_node, [&](OperationNode *node) {
-    BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
-  });
+    /* Schedule children. The one on the longest chain of operations is evaluated by this thread
+     * right away, so that the critical path does not wait in the task queue. */
+    ready_children.clear();
+    schedule_children(
+        state, operation_node, [&](OperationNode *node) { ready_children.append(node); });
+    operation_node = nullptr;
+    for (OperationNode *node : ready_children) {
+      if (operation_node == nullptr ||
+          node->critical_path_length > operation_node->critical_path_length)
+      {
+        if (operation_node) {
+          BLI_task_pool_push(pool, deg_task_run_func, operation_node, false, nullptr);
+        }
+        operation_node = node;
+      }
+      else {
+        BLI_task_pool_push(pool, deg_task_run_func, node, false, nullptr);
+      }
+    }
+  }
 }
 
 bool check_operation_node_visible(const DepsgraphEvalState *state, OperationNode *op_node)
@@ -173,14 +208,56 @@ void calculate_pending_parents_for_node(const DepsgraphEvalState *state, Operati
   }
 }
 
+/* Same result as calculating pending parents of all operations, but reuses the result of the
+ * previous evaluation when the same set of operations is tagged for update. */
+void calculate_pending_parents_cached(DepsgraphEvalState *state)
+{
+  Depsgraph *graph = state->graph;
+  EvaluationScheduleCache &cache = graph->schedule_cache;
+
+  Vector<OperationNode *> tagged_operations;
+  for (OperationNode *node : graph->operations) {
+    if (node->flag & DEPSOP_FLAG_NEEDS_UPDATE) {
+      tagged_operations.append(node);
+    }
+  }
+
+  if (tagged_operations == cache.operations) {
+    /* Operations which are not tagged are never scheduled, so their state does not matter. */
+    for (const int64_t i : cache.operations.index_range()) {
+      OperationNode *node = cache.operations[i];
+      node->num_links_pending = cache.num_links_pending[i];
+      node->scheduled = false;
+    }
+  }
+  else {
+    for (OperationNode *node : graph->operations) {
+      calculate_pending_parents_for_node(state, node);
+    }
+    cache.operations = std::move(tagged_operations);
+    cache.num_links_pending.clear();
+    cache.num_links_pending.reserve(cache.operations.size());
+    for (const OperationNode *node : cache.operations) {
+      cache.num_links_pending.append(node->num_links_pending);
+    }
+  }
+
+  state->operations_to_schedule = cache.operations;
+}
+
 void calculate_pending_parents_if_needed(DepsgraphEvalState *state)
 {
   if (!state->need_update_pending_parents) {
     return;
   }
 
-  for (OperationNode *node : state->graph->operations) {
-    calculate_pending_parents_for_node(state, node);
+  if (state->use_schedule_cache) {
+    calculate_pending_parents_cached(state);
+  }
+  else {
+    for (OperationNode *node : state->graph->operations) {
+      calculate_pending_parents_for_node(state, node);
+    }
   }
 
   state->need_update_pending_parents = false;
@@ -286,7 +363,7 @@ void schedule_node(DepsgraphEvalState *state,
 void schedule_graph(DepsgraphEvalState *state,
                     const FunctionRef<void(OperationNode *node)> schedule_fn)
 {
-  for (OperationNode *node : state->graph->operations) {
+  for (OperationNode *node : state->operations_to_schedule) {
     schedule_node(state, node, false, schedule_fn);
   }
 }
@@ -317,9 +394,18 @@ void evaluate_graph_threaded_stage(DepsgraphEvalState *state,
 
   calculate_pending_parents_if_needed(state);
 
-  schedule_graph(state, [&](OperationNode *node) {
+  /* Start with the operations on the longest chains. */
+  Vector<OperationNode *, 16, ArenaAllocator> ready_nodes(
+      ArenaAllocator(state->graph->eval_arena));
+  schedule_graph(state, [&](OperationNode *node) { ready_nodes.append(node); });
+  std::stable_sort(ready_nodes.begin(),
+                   ready_nodes.end(),
+                   [](const OperationNode *a, const OperationNode *b) {
+                     return a->critical_path_length > b->critical_path_length;
+                   });
+  for (OperationNode *node : ready_nodes) {
     BLI_task_pool_push(task_pool, deg_task_run_func, node, false, nullptr);
-  });
+  }
   BLI_task_pool_work_and_wait(task_pool);
 }
 
@@ -386,6 +472,8 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
     return;
   }
 
+  BLI_TRACE_ZONE("Depsgraph Evaluation", "depsgraph");
+
   graph->update_count++;
 
   graph->debug.begin_graph_evaluation();
@@ -396,12 +484,23 @@ void deg_evaluate_on_refresh(Depsgraph *graph)
 #endif
 
   graph->is_evaluating = true;
+  /* Nothing uses temporary data of the previous evaluation anymore. */
+  MEM_arena_clear(graph->eval_arena);
   depsgraph_ensure_view_layer(graph);
 
   /* Set up evaluation state. */
   DepsgraphEvalState state;
   state.graph = graph;
   state.do_stats = graph->debug.do_time_debug();
+  state.do_trace = graph->debug.is_tracing();
+  state.operations_to_schedule = graph->operations;
+  /* Changes in visibility affect which operations are to be evaluated, so only rely on the cached
+   * scheduling state while the visibility of nodes can not change. */
+  state.use_schedule_cache = !graph->has_animated_visibility &&
+                             !graph->need_update_nodes_visibility;
+  if (!state.use_schedule_cache) {
+    graph->schedule_cache.clear();
+  }
 
   /* Prepare all nodes for evaluation. */
   initialize_execution(&state, graph);
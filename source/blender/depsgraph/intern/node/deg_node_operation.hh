@@ -282,6 +282,10 @@ struct OperationNode : public Node {
   uint32_t num_links_pending;
   bool scheduled;
 
+  /* Number of operations in the longest chain of dependent operations starting at this one,
+   * including itself. Operations with longer chains are evaluated first. */
+  uint32_t critical_path_length;
+
   /* Identifier for the operation being performed. */
   OperationCode opcode;
   int name_tag;
@@ -166,8 +166,38 @@ static void eevee_render_to_image(void *vedata,
   RE_GetViewPlane(render, &view_rect, &rect);
   rcti visible_rect = rect;
 
-  instance->init(size, &rect, &visible_rect, engine, depsgraph, camera_original_ob, layer);
-  instance->render_frame(engine, layer, viewname);
+  const SceneEEVEE &scene_eevee = DRW_context_state_get()->scene->eevee;
+  const int tile_size = (scene_eevee.flag & SCE_EEVEE_RENDER_TILES) ?
+                            max_ii(scene_eevee.render_tile_size, 1) :
+                            INT_MAX;
+  if (BLI_rcti_size_x(&rect) <= tile_size && BLI_rcti_size_y(&rect) <= tile_size) {
+    instance->init(size, &rect, &visible_rect, engine, depsgraph, camera_original_ob, layer);
+    instance->render_frame(engine, layer, viewname);
+  }
+  else {
+    /* Render the tiles one after another to limit the size of the render buffers. Each tile is
+     * rendered like a render region, including its overscan. */
+    const int2 tiles_len = math::divide_ceil(int2(BLI_rcti_size_x(&rect), BLI_rcti_size_y(&rect)),
+                                             int2(tile_size));
+    const int2 rect_min = int2(rect.xmin, rect.ymin);
+    for (const int tile_index : IndexRange(tiles_len.x * tiles_len.y)) {
+      if (RE_engine_test_break(engine)) {
+        break;
+      }
+      const int2 tile_min = rect_min +
+                            int2(tile_index % tiles_len.x, tile_index / tiles_len.x) * tile_size;
+      rcti tile_rect;
+      BLI_rcti_init(&tile_rect,
+                    tile_min.x,
+                    min_ii(tile_min.x + tile_size, rect.xmax),
+                    tile_min.y,
+                    min_ii(tile_min.y + tile_size, rect.ymax));
+
+      instance->init(size, &tile_rect, &tile_rect, engine, depsgraph, camera_original_ob, layer);
+      instance->render_frame(engine, layer, viewname, tile_min - rect_min);
+      RE_engine_update_progress(engine, float(tile_index + 1) / float(tiles_len.x * tiles_len.y));
+    }
+  }
 
   EEVEE_Data *ved = static_cast<EEVEE_Data *>(vedata);
   delete ved->instance;
@@ -426,7 +426,45 @@ void Instance::render_sample()
   motion_blur.step();
 }
 
-void Instance::render_read_result(RenderLayer *render_layer, const char *view_name)
+void Instance::render_store_pass(RenderPass *render_pass,
+                                 float *result,
+                                 const int2 &tile_offset)
+{
+  const int2 extent = film.get_data().extent;
+
+  BLI_mutex_lock(&render->update_render_passes_mutex);
+  if (extent == int2(render_pass->rectx, render_pass->recty)) {
+    /* WORKAROUND: We use texture read to avoid using a frame-buffer to get the render result.
+     * However, on some implementation, we need a buffer with a few extra bytes for the read to
+     * happen correctly (see #GLTexture::read()). So we need a custom memory allocation. */
+    /* Avoid `memcpy()`, replace the pointer directly. */
+    RE_pass_set_buffer_data(render_pass, result);
+  }
+  else {
+    /* Only a tile of the render layer was rendered. */
+    ImBuf *ibuf = RE_RenderPassEnsureImBuf(render_pass);
+    if (ibuf->float_buffer.data == nullptr) {
+      RE_pass_set_buffer_data(
+          render_pass,
+          MEM_cnew_array<float>(
+              size_t(render_pass->rectx) * render_pass->recty * render_pass->channels, __func__));
+    }
+    float *pass_data = ibuf->float_buffer.data;
+    const int64_t row_len = int64_t(extent.x) * render_pass->channels;
+    for (const int y : IndexRange(extent.y)) {
+      const int64_t pass_offset = (int64_t(tile_offset.y + y) * render_pass->rectx +
+                                   tile_offset.x) *
+                                  render_pass->channels;
+      memcpy(pass_data + pass_offset, result + y * row_len, sizeof(float) * row_len);
+    }
+    MEM_freeN(result);
+  }
+  BLI_mutex_unlock(&render->update_render_passes_mutex);
+}
+
+void Instance::render_read_result(RenderLayer *render_layer,
+                                  const char *view_name,
+                                  const int2 &tile_offset)
 {
   eViewLayerEEVEEPassType pass_bits = film.enabled_passes_get();
 
@@ -446,13 +484,7 @@ void Instance::render_read_result(RenderLayer *render_layer, const char *view_na
       float *result = film.read_pass(pass_type, pass_offset);
 
       if (result) {
-        BLI_mutex_lock(&render->update_render_passes_mutex);
-        /* WORKAROUND: We use texture read to avoid using a frame-buffer to get the render result.
-         * However, on some implementation, we need a buffer with a few extra bytes for the read to
-         * happen correctly (see #GLTexture::read()). So we need a custom memory allocation. */
-        /* Avoid `memcpy()`, replace the pointer directly. */
-        RE_pass_set_buffer_data(rp, result);
-        BLI_mutex_unlock(&render->update_render_passes_mutex);
+        render_store_pass(rp, result, tile_offset);
       }
     }
   }
@@ -469,13 +501,7 @@ void Instance::render_read_result(RenderLayer *render_layer, const char *view_na
     float *result = film.read_aov(aov);
 
     if (result) {
-      BLI_mutex_lock(&render->update_render_passes_mutex);
-      /* WORKAROUND: We use texture read to avoid using a frame-buffer to get the render result.
-       * However, on some implementation, we need a buffer with a few extra bytes for the read to
-       * happen correctly (see #GLTexture::read()). So we need a custom memory allocation. */
-      /* Avoid #memcpy(), replace the pointer directly. */
-      RE_pass_set_buffer_data(rp, result);
-      BLI_mutex_unlock(&render->update_render_passes_mutex);
+      render_store_pass(rp, result, tile_offset);
     }
   }
 
@@ -501,7 +527,10 @@ void Instance::render_read_result(RenderLayer *render_layer, const char *view_na
 /** \name Interface
  * \{ */
 
-void Instance::render_frame(RenderEngine *engine, RenderLayer *render_layer, const char *view_name)
+void Instance::render_frame(RenderEngine *engine,
+                            RenderLayer *render_layer,
+                            const char *view_name,
+                            const int2 &tile_offset)
 {
   /* TODO: Break on RE_engine_test_break(engine) */
   while (!sampling.finished()) {
@@ -539,7 +568,7 @@ void Instance::render_frame(RenderEngine *engine, RenderLayer *render_layer, con
     if (G.background == false && first_read) {
       /* Allow to preview the first sample. */
       /* TODO(fclem): Might want to not do this during animation render to avoid too much stall. */
-      this->render_read_result(render_layer, view_name);
+      this->render_read_result(render_layer, view_name, tile_offset);
       first_read = false;
       DRW_render_context_disable(render->re);
       /* Allow the 2D viewport to grab the ticket mutex to display the render. */
@@ -550,7 +579,7 @@ void Instance::render_frame(RenderEngine *engine, RenderLayer *render_layer, con
 
   this->film.cryptomatte_sort();
 
-  this->render_read_result(render_layer, view_name);
+  this->render_read_result(render_layer, view_name, tile_offset);
 
   if (!info_.empty()) {
     RE_engine_set_error_message(
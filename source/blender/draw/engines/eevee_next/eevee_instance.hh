@@ -208,7 +208,14 @@ class Instance {
   /* Render. */
 
   void render_sync();
-  void render_frame(RenderEngine *engine, RenderLayer *render_layer, const char *view_name);
+  /**
+   * \param tile_offset: Position of the film inside the render layer, when rendering tiles of the
+   * render layer one after another.
+   */
+  void render_frame(RenderEngine *engine,
+                    RenderLayer *render_layer,
+                    const char *view_name,
+                    const int2 &tile_offset = int2(0));
   void store_metadata(RenderResult *render_result);
 
   /* Viewport. */
@@ -359,7 +366,10 @@ class Instance {
                                  RenderEngine *engine,
                                  Depsgraph *depsgraph);
   void render_sample();
-  void render_read_result(RenderLayer *render_layer, const char *view_name);
+  void render_read_result(RenderLayer *render_layer,
+                          const char *view_name,
+                          const int2 &tile_offset);
+  void render_store_pass(RenderPass *render_pass, float *result, const int2 &tile_offset);
 
   void mesh_sync(Object *ob, ObjectHandle &ob_handle);
 
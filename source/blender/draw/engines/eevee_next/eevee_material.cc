@@ -155,6 +155,8 @@ void MaterialModule::begin_sync()
 
   material_map_.clear();
   shader_map_.clear();
+  shadow_updated_materials_.clear();
+  material_array_instance_.is_reusable = false;
 }
 
 MaterialPass MaterialModule::material_pass_get(Object *ob,
@@ -215,13 +217,15 @@ MaterialPass MaterialModule::material_pass_get(Object *ob,
                                   (blender_mat->displacement_method != MA_DISPLACEMENT_BUMP);
     const bool has_volume = GPU_material_has_volume_output(matpass.gpumat);
 
-    if (((pipeline_type == MAT_PIPE_SHADOW) && (is_transparent || has_displacement)) || has_volume)
-    {
-      /* WORKAROUND: This is to avoid lingering shadows from default material.
-       * Ideally, we should tag the caster object to update only the needed areas but that's a bit
-       * more involved. */
+    if (has_volume) {
+      /* WORKAROUND: This is to avoid lingering shadows from default material. */
       inst_.shadows.reset();
     }
+    else if ((pipeline_type == MAT_PIPE_SHADOW) && (is_transparent || has_displacement)) {
+      /* Avoid lingering shadows from the default material. Only the areas covered by the
+       * casters using this material are updated, see #ShadowModule::sync_object. */
+      shadow_updated_materials_.add(matpass.gpumat);
+    }
   }
 
   if (is_volume || (is_forward && is_transparent)) {
@@ -385,6 +389,8 @@ Material &MaterialModule::material_sync(Object *ob,
     else {
       mat.shadow = MaterialPass();
     }
+    mat.has_shadow_update = mat.shadow.gpumat != nullptr &&
+                            shadow_updated_materials_.contains(mat.shadow.gpumat);
 
     mat.is_alpha_blend_transparent = use_forward_pipeline &&
                                      GPU_material_flag_get(mat.shading.gpumat,
@@ -438,11 +444,23 @@ Material &MaterialModule::material_sync(Object *ob,
 
 MaterialArray &MaterialModule::material_array_get(Object *ob, bool has_motion)
 {
+  const DupliObject *dupli = DRW_object_get_dupli(ob);
+  auto &instance = material_array_instance_;
+  if (dupli && instance.is_reusable && instance.data == ob->data &&
+      instance.dupli_object == dupli->ob && instance.has_motion == has_motion &&
+      instance.visibility_flag == ob->visibility_flag)
+  {
+    material_array_.is_reused = true;
+    return material_array_;
+  }
+
   material_array_.materials.clear();
   material_array_.gpu_materials.clear();
+  material_array_.is_reused = false;
 
   const int materials_len = DRW_cache_object_material_count_get(ob);
 
+  bool needs_sub_pass_per_object = false;
   for (auto i : IndexRange(materials_len)) {
     ::Material *blender_mat = material_from_slot(ob, i);
     Material &mat = material_sync(ob, blender_mat, to_material_geometry(ob), has_motion);
@@ -450,7 +468,15 @@ MaterialArray &MaterialModule::material_array_get(Object *ob, bool has_motion)
      * (i.e: because of its container growing) */
     material_array_.materials.append(mat);
     material_array_.gpu_materials.append(mat.shading.gpumat);
+    /* See #material_sync. */
+    needs_sub_pass_per_object |= mat.is_alpha_blend_transparent || mat.has_volume;
   }
+
+  instance.data = static_cast<const ID *>(ob->data);
+  instance.dupli_object = dupli ? dupli->ob : nullptr;
+  instance.has_motion = has_motion;
+  instance.visibility_flag = ob->visibility_flag;
+  instance.is_reusable = dupli && !needs_sub_pass_per_object;
   return material_array_;
 }
 
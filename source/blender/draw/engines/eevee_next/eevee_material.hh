@@ -11,6 +11,7 @@
 #include "DRW_render.hh"
 
 #include "BLI_map.hh"
+#include "BLI_set.hh"
 #include "BLI_vector.hh"
 #include "GPU_material.hh"
 
@@ -325,6 +326,8 @@ struct Material {
   bool has_transparent_shadows;
   bool has_surface;
   bool has_volume;
+  /** The shadow shader was updated in a way that changes the shadow of the casters. */
+  bool has_shadow_update;
   MaterialPass shadow;
   MaterialPass shading;
   MaterialPass prepass;
@@ -341,6 +344,11 @@ struct Material {
 struct MaterialArray {
   Vector<Material> materials;
   Vector<GPUMaterial *> gpu_materials;
+  /**
+   * True when the materials of the previous call were reused, because the object is another
+   * instance of the same data.
+   */
+  bool is_reused = false;
 };
 
 class MaterialModule {
@@ -356,8 +364,24 @@ class MaterialModule {
 
   Map<MaterialKey, Material> material_map_;
   Map<ShaderKey, PassMain::Sub *> shader_map_;
+  /**
+   * Shadow shaders that finished compiling during this sync. The compilation flag is consumed by
+   * the first material using the shader, so it is kept here for the other ones.
+   */
+  Set<const GPUMaterial *> shadow_updated_materials_;
 
   MaterialArray material_array_;
+  /**
+   * The instance #material_array_ was built for. Instances of the same data are usually synced
+   * one after another, they can reuse it unless some material needs a sub-pass per object.
+   */
+  struct {
+    const ID *data = nullptr;
+    const Object *dupli_object = nullptr;
+    bool has_motion = false;
+    short visibility_flag = 0;
+    bool is_reusable = false;
+  } material_array_instance_;
 
   DefaultSurfaceNodeTree default_surface_ntree_;
 
@@ -750,7 +750,8 @@ void ShadowModule::sync_object(const Object *ob,
                                const ObjectHandle &handle,
                                const ResourceHandle &resource_handle,
                                bool is_alpha_blend,
-                               bool has_transparent_shadows)
+                               bool has_transparent_shadows,
+                               bool has_shadow_update)
 {
   bool is_shadow_caster = !(ob->visibility_flag & OB_HIDE_SHADOW);
   if (!is_shadow_caster && !is_alpha_blend) {
@@ -761,8 +762,10 @@ void ShadowModule::sync_object(const Object *ob,
   shadow_ob.used = true;
   const bool is_initialized = shadow_ob.resource_handle.raw != 0;
   const bool has_jittered_transparency = has_transparent_shadows && data_.use_jitter;
-  if (is_shadow_caster && (handle.recalc || !is_initialized || has_jittered_transparency)) {
-    if (handle.recalc && is_initialized) {
+  /* Only tag the pages touched by the caster bounds, not the whole shadow maps. */
+  const bool is_updated = handle.recalc || has_shadow_update;
+  if (is_shadow_caster && (is_updated || !is_initialized || has_jittered_transparency)) {
+    if (is_updated && is_initialized) {
       past_casters_updated_.append(shadow_ob.resource_handle.raw);
     }
 
@@ -348,7 +348,8 @@ class ShadowModule {
                    const ObjectHandle &handle,
                    const ResourceHandle &resource_handle,
                    bool is_alpha_blend,
-                   bool has_transparent_shadows);
+                   bool has_transparent_shadows,
+                   bool has_shadow_update);
   void end_sync();
 
   void set_lights_data();
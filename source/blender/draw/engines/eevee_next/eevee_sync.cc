@@ -102,8 +102,18 @@ void SyncModule::sync_mesh(Object *ob,
 
   MaterialArray &material_array = inst_.materials.material_array_get(ob, has_motion);
 
-  gpu::Batch **mat_geom = DRW_cache_object_surface_material_get(
-      ob, material_array.gpu_materials.data(), material_array.gpu_materials.size());
+  /* The batches only depend on the data and the materials, requesting them again is redundant
+   * but expensive when syncing many instances. */
+  gpu::Batch **mat_geom;
+  if (material_array.is_reused && last_mesh_data_ == ob->data) {
+    mat_geom = last_mesh_batches_;
+  }
+  else {
+    mat_geom = DRW_cache_object_surface_material_get(
+        ob, material_array.gpu_materials.data(), material_array.gpu_materials.size());
+    last_mesh_data_ = static_cast<const ID *>(ob->data);
+    last_mesh_batches_ = mat_geom;
+  }
 
   if (mat_geom == nullptr) {
     return;
@@ -116,6 +126,7 @@ void SyncModule::sync_mesh(Object *ob,
 
   bool is_alpha_blend = false;
   bool has_transparent_shadows = false;
+  bool has_shadow_update = false;
   bool has_volume = false;
   float inflate_bounds = 0.0f;
   for (auto i : material_array.gpu_materials.index_range()) {
@@ -151,9 +162,13 @@ void SyncModule::sync_mesh(Object *ob,
 
     is_alpha_blend = is_alpha_blend || material.is_alpha_blend_transparent;
     has_transparent_shadows = has_transparent_shadows || material.has_transparent_shadows;
+    has_shadow_update = has_shadow_update || material.has_shadow_update;
 
     ::Material *mat = GPU_material_get_material(gpu_material);
-    inst_.cryptomatte.sync_material(mat);
+    if (!material_array.is_reused) {
+      /* Already registered by the previous instance. */
+      inst_.cryptomatte.sync_material(mat);
+    }
 
     if (GPU_material_has_displacement_output(gpu_material)) {
       inflate_bounds = math::max(inflate_bounds, mat->inflate_bounds);
@@ -170,7 +185,8 @@ void SyncModule::sync_mesh(Object *ob,
 
   inst_.manager->extract_object_attributes(res_handle, ob_ref, material_array.gpu_materials);
 
-  inst_.shadows.sync_object(ob, ob_handle, res_handle, is_alpha_blend, has_transparent_shadows);
+  inst_.shadows.sync_object(
+      ob, ob_handle, res_handle, is_alpha_blend, has_transparent_shadows, has_shadow_update);
   inst_.cryptomatte.sync_object(ob, res_handle);
 }
 
@@ -193,6 +209,7 @@ bool SyncModule::sync_sculpt(Object *ob,
 
   bool is_alpha_blend = false;
   bool has_transparent_shadows = false;
+  bool has_shadow_update = false;
   bool has_volume = false;
   float inflate_bounds = 0.0f;
   for (SculptBatch &batch :
@@ -229,6 +246,7 @@ bool SyncModule::sync_sculpt(Object *ob,
 
     is_alpha_blend = is_alpha_blend || material.is_alpha_blend_transparent;
     has_transparent_shadows = has_transparent_shadows || material.has_transparent_shadows;
+    has_shadow_update = has_shadow_update || material.has_shadow_update;
 
     GPUMaterial *gpu_material = material_array.gpu_materials[batch.material_slot];
     ::Material *mat = GPU_material_get_material(gpu_material);
@@ -252,7 +270,8 @@ bool SyncModule::sync_sculpt(Object *ob,
 
   inst_.manager->extract_object_attributes(res_handle, ob_ref, material_array.gpu_materials);
 
-  inst_.shadows.sync_object(ob, ob_handle, res_handle, is_alpha_blend, has_transparent_shadows);
+  inst_.shadows.sync_object(
+      ob, ob_handle, res_handle, is_alpha_blend, has_transparent_shadows, has_shadow_update);
   inst_.cryptomatte.sync_object(ob, res_handle);
 
   return true;
@@ -325,7 +344,8 @@ void SyncModule::sync_point_cloud(Object *ob,
                             ob_handle,
                             res_handle,
                             material.is_alpha_blend_transparent,
-                            material.has_transparent_shadows);
+                            material.has_transparent_shadows,
+                            material.has_shadow_update);
 }
 
 /** \} */
@@ -472,7 +492,8 @@ void SyncModule::sync_curves(Object *ob,
                             ob_handle,
                             res_handle,
                             material.is_alpha_blend_transparent,
-                            material.has_transparent_shadows);
+                            material.has_transparent_shadows,
+                            material.has_shadow_update);
 }
 
 /** \} */
@@ -155,6 +155,10 @@ class SyncModule {
 
   Map<ObjectKey, ObjectHandle> ob_handles = {};
 
+  /** Surface batches of the last synced mesh, reused for the next instance of the same data. */
+  const ID *last_mesh_data_ = nullptr;
+  gpu::Batch **last_mesh_batches_ = nullptr;
+
  public:
   SyncModule(Instance &inst) : inst_(inst){};
   ~SyncModule(){};
@@ -225,7 +225,8 @@ class Instance {
                  gpu::Batch *batch,
                  ResourceHandle handle,
                  const MaterialTexture *texture = nullptr,
-                 bool show_missing_texture = false)
+                 bool show_missing_texture = false,
+                 Span<IndexRange> tri_ranges = {})
   {
     resources.material_buf.append(material);
     int material_index = resources.material_buf.size() - 1;
@@ -235,13 +236,63 @@ class Instance {
     }
 
     draw_to_mesh_pass(ob_ref, material.is_transparent(), [&](MeshPass &mesh_pass) {
-      mesh_pass.get_subpass(eGeometryType::MESH, texture).draw(batch, handle, material_index);
+      PassMain::Sub &sub_pass = mesh_pass.get_subpass(eGeometryType::MESH, texture);
+      if (tri_ranges.is_empty()) {
+        sub_pass.draw(batch, handle, material_index);
+        return;
+      }
+      for (const IndexRange tris : tri_ranges) {
+        sub_pass.draw(batch, 1, tris.size() * 3, tris.start() * 3, handle, material_index);
+      }
     });
   }
 
+  /**
+   * Ranges of the surface triangles of a large mesh that are in the view, or nothing when the
+   * whole surface has to be drawn. Culling the clusters on the CPU is only valid because the
+   * mesh passes are only drawn for the default view.
+   */
+  Vector<IndexRange> visible_tri_ranges(ObjectRef &ob_ref)
+  {
+    if (DRW_state_is_image_render()) {
+      return {};
+    }
+    const Span<Bounds<float3>> clusters = DRW_cache_mesh_surface_clusters_get(ob_ref.object);
+    if (clusters.is_empty()) {
+      return {};
+    }
+    const Mesh &mesh = *static_cast<const Mesh *>(ob_ref.object->data);
+    const IndexRange all_tris(poly_to_tri_count(mesh.faces_num, mesh.corners_num));
+    const DRWView *view = DRW_view_default_get();
+    float4x4 object_to_world = ob_ref.object->object_to_world();
+
+    Vector<IndexRange> ranges;
+    for (const int cluster : clusters.index_range()) {
+      Bounds<float3> bounds = clusters[cluster];
+      if (!DRW_culling_min_max_test(view, object_to_world.ptr(), bounds.min, bounds.max)) {
+        continue;
+      }
+      const IndexRange tris = IndexRange(cluster * DRW_MESH_SURFACE_CLUSTER_TRIS,
+                                         DRW_MESH_SURFACE_CLUSTER_TRIS)
+                                  .intersect(all_tris);
+      if (!ranges.is_empty() && ranges.last().one_after_last() == tris.start()) {
+        ranges.last() = IndexRange::from_begin_end(ranges.last().start(), tris.one_after_last());
+      }
+      else {
+        ranges.append(tris);
+      }
+    }
+    if (ranges.is_empty() || ranges.first() == all_tris) {
+      /* Let the per object culling handle these. */
+      return {};
+    }
+    return ranges;
+  }
+
   void mesh_sync(ObjectRef &ob_ref, ResourceHandle handle, const ObjectState &object_state)
   {
     bool has_transparent_material = false;
+    const Vector<IndexRange> tri_ranges = visible_tri_ranges(ob_ref);
 
     if (object_state.use_per_material_batches) {
       const int material_count = DRW_cache_object_material_count_get(ob_ref.object);
@@ -270,7 +321,13 @@ class Instance {
             texture = MaterialTexture(ob_ref.object, material_slot);
           }
 
-          draw_mesh(ob_ref, mat, batches[i], handle, &texture, object_state.show_missing_texture);
+          draw_mesh(ob_ref,
+                    mat,
+                    batches[i],
+                    handle,
+                    &texture,
+                    object_state.show_missing_texture,
+                    tri_ranges);
         }
       }
     }
@@ -295,7 +352,8 @@ class Instance {
         Material mat = get_material(ob_ref, object_state.color_type);
         has_transparent_material = has_transparent_material || mat.is_transparent();
 
-        draw_mesh(ob_ref, mat, batch, handle, &object_state.image_paint_override);
+        draw_mesh(
+            ob_ref, mat, batch, handle, &object_state.image_paint_override, false, tri_ranges);
       }
     }
 
@@ -2880,6 +2880,13 @@ blender::gpu::Batch *DRW_cache_mesh_surface_get(Object *ob)
   return DRW_mesh_batch_cache_get_surface(*static_cast<Mesh *>(ob->data));
 }
 
+blender::Span<blender::Bounds<blender::float3>> DRW_cache_mesh_surface_clusters_get(Object *ob)
+{
+  using namespace blender::draw;
+  BLI_assert(ob->type == OB_MESH);
+  return DRW_mesh_batch_cache_get_surface_clusters(*ob, *static_cast<Mesh *>(ob->data));
+}
+
 blender::gpu::Batch *DRW_cache_mesh_surface_edges_get(Object *ob)
 {
   using namespace blender::draw;
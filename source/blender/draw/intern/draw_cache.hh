@@ -8,7 +8,9 @@
 
 #pragma once
 
+#include "BLI_bounds_types.hh"
 #include "BLI_math_matrix_types.hh"
+#include "BLI_span.hh"
 
 #include "BKE_volume_grid_fwd.hh"
 
@@ -161,6 +163,14 @@ blender::gpu::Batch *DRW_cache_mesh_loose_edges_get(Object *ob);
 blender::gpu::Batch *DRW_cache_mesh_edge_detection_get(Object *ob, bool *r_is_manifold);
 blender::gpu::Batch *DRW_cache_mesh_surface_get(Object *ob);
 blender::gpu::Batch *DRW_cache_mesh_surface_edges_get(Object *ob);
+/** Number of triangles in the clusters of #DRW_cache_mesh_surface_clusters_get. */
+constexpr int DRW_MESH_SURFACE_CLUSTER_TRIS = 4096;
+/**
+ * Object space bounds of consecutive groups of #DRW_MESH_SURFACE_CLUSTER_TRIS triangles in the
+ * index buffer of the surface batches, allowing to only draw the ranges that are in view.
+ * Empty when the mesh is small or the triangles are reordered for drawing.
+ */
+blender::Span<blender::Bounds<blender::float3>> DRW_cache_mesh_surface_clusters_get(Object *ob);
 /**
  * Return list of batches with length equal to `max(1, totcol)`.
  */
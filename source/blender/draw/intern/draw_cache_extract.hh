@@ -8,6 +8,8 @@
 
 #pragma once
 
+#include "BLI_bit_vector.hh"
+#include "BLI_bounds_types.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_utildefines.h"
 
@@ -275,6 +277,15 @@ struct MeshBatchCache {
   bool no_loose_wire;
 
   eV3DShadingColorType color_type;
+
+  /**
+   * Vertices that moved since the final position buffer was uploaded, the buffer is updated
+   * partially before the next extraction. Empty when the buffer is up to date.
+   */
+  BitVector<> pos_changed_verts;
+
+  /** Bounds of the triangle clusters, see #DRW_mesh_batch_cache_get_surface_clusters. */
+  std::optional<Array<Bounds<float3>>> surface_clusters;
 };
 
 #define MBC_EDITUV \
@@ -28,6 +28,9 @@ struct Volume;
 struct bGPdata;
 struct GreasePencil;
 
+#include "BLI_bounds_types.hh"
+#include "BLI_math_vector_types.hh"
+
 #include "BKE_mesh.h"
 
 namespace blender::draw {
@@ -41,6 +44,7 @@ void DRW_curve_batch_cache_validate(Curve *cu);
 void DRW_curve_batch_cache_free(Curve *cu);
 
 void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode);
+void DRW_mesh_batch_cache_tag_positions_changed(Mesh *mesh, const IndexMask &changed_verts);
 void DRW_mesh_batch_cache_validate(Object &object, Mesh &mesh);
 void DRW_mesh_batch_cache_free(void *batch_cache);
 
@@ -195,6 +199,8 @@ blender::gpu::Batch *DRW_mesh_batch_cache_get_loose_edges(Mesh &mesh);
 blender::gpu::Batch *DRW_mesh_batch_cache_get_edge_detection(Mesh &mesh, bool *r_is_manifold);
 blender::gpu::Batch *DRW_mesh_batch_cache_get_surface(Mesh &mesh);
 blender::gpu::Batch *DRW_mesh_batch_cache_get_surface_edges(Object &object, Mesh &mesh);
+blender::Span<blender::Bounds<blender::float3>> DRW_mesh_batch_cache_get_surface_clusters(
+    Object &object, Mesh &mesh);
 blender::gpu::Batch **DRW_mesh_batch_cache_get_surface_shaded(Object &object,
                                                               Mesh &mesh,
                                                               GPUMaterial **gpumat_array,
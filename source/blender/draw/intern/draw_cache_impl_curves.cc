@@ -172,6 +172,8 @@ static void clear_edit_data(CurvesBatchCache *cache)
 static void clear_final_data(CurvesEvalFinalCache &final_cache)
 {
   GPU_VERTBUF_DISCARD_SAFE(final_cache.proc_buf);
+  /* References the vertex buffer of #proc_hairs, free it first. */
+  GPU_BATCH_DISCARD_SAFE(final_cache.proc_hairs_thinned);
   GPU_BATCH_DISCARD_SAFE(final_cache.proc_hairs);
   for (const int j : IndexRange(GPU_MAX_ATTR)) {
     GPU_VERTBUF_DISCARD_SAFE(final_cache.attributes_buf[j]);
@@ -1071,6 +1071,18 @@ static void grease_pencil_geom_batch_ensure(Object &object,
   const Vector<ed::greasepencil::DrawingInfo> drawings =
       ed::greasepencil::retrieve_visible_drawings(scene, grease_pencil, true);
 
+  /* Ensure the derived data of all drawings in parallel. The caches live on the drawings, so they
+   * are shared between frames and only recomputed when the strokes change. Computing them here
+   * avoids evaluating each drawing serially in the loops below, which is slow for objects with
+   * many small drawings (e.g. many layers or onion skinning). */
+  threading::parallel_for_each(drawings, [&](const ed::greasepencil::DrawingInfo &info) {
+    const bke::CurvesGeometry &curves = info.drawing.strokes();
+    curves.ensure_can_interpolate_to_evaluated();
+    curves.ensure_evaluated_lengths();
+    info.drawing.triangles();
+    info.drawing.texture_matrices();
+  });
+
   /* First, count how many vertices and triangles are needed for the whole object. Also record the
    * offsets into the curves for the vertices and triangles. */
   int total_verts_num = 0;
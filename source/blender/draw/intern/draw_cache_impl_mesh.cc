@@ -19,10 +19,12 @@
 #include "BLI_map.hh"
 #include "BLI_math_bits.h"
 #include "BLI_math_vector.h"
+#include "BLI_math_vector.hh"
 #include "BLI_span.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
 #include "BLI_task.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_mesh_types.h"
@@ -50,6 +52,7 @@
 #include "bmesh.hh"
 
 #include "GPU_batch.hh"
+#include "GPU_context.hh"
 #include "GPU_material.hh"
 
 #include "DRW_render.hh"
@@ -57,6 +60,7 @@
 #include "ED_mesh.hh"
 #include "ED_uvedit.hh"
 
+#include "draw_cache.hh"
 #include "draw_cache_extract.hh"
 #include "draw_cache_inline.hh"
 #include "draw_subdivision.hh"
@@ -721,6 +725,49 @@ static void mesh_batch_cache_discard_uvedit_select(MeshBatchCache &cache)
   mesh_batch_cache_discard_batch(cache, batch_map);
 }
 
+/**
+ * Discard the buffers that depend on vertex positions, keeping the ones that only depend on the
+ * topology and the other attributes.
+ */
+static void mesh_batch_cache_discard_deformed(MeshBatchCache &cache)
+{
+  FOREACH_MESH_BUFFER_CACHE (cache, mbc) {
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.pos);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.vnor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.tan);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edge_fac);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.mesh_analysis);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_area);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.edituv_stretch_angle);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_pos);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.fdots_nor);
+    GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.skin_roots);
+    /* Generic attributes can reference the positions too. */
+    for (int i = 0; i < cache.attr_used.num_requests; i++) {
+      if (STREQ(cache.attr_used.requests[i].attribute_name, "position")) {
+        GPU_VERTBUF_DISCARD_SAFE(mbc->buff.vbo.attr[i]);
+      }
+    }
+  }
+  DRWBatchFlag batch_map = BATCH_MAP(vbo.pos,
+                                     vbo.nor,
+                                     vbo.vnor,
+                                     vbo.tan,
+                                     vbo.edge_fac,
+                                     vbo.mesh_analysis,
+                                     vbo.edituv_stretch_area,
+                                     vbo.edituv_stretch_angle,
+                                     vbo.fdots_pos,
+                                     vbo.fdots_nor);
+  batch_map |= BATCH_MAP(vbo.skin_roots);
+  mesh_batch_cache_discard_batch(cache, batch_map);
+
+  cache.tot_area = 0.0f;
+  cache.tot_uv_area = 0.0f;
+  cache.surface_clusters.reset();
+}
+
 void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
 {
   if (!mesh->runtime->batch_cache) {
@@ -754,6 +801,9 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
     case BKE_MESH_BATCH_DIRTY_ALL:
       cache.is_dirty = true;
       break;
+    case BKE_MESH_BATCH_DIRTY_DEFORM:
+      mesh_batch_cache_discard_deformed(cache);
+      break;
     case BKE_MESH_BATCH_DIRTY_SHADING:
       mesh_batch_cache_discard_shaded_tri(cache);
       mesh_batch_cache_discard_uvedit(cache);
@@ -774,6 +824,32 @@ void DRW_mesh_batch_cache_dirty_tag(Mesh *mesh, eMeshBatchDirtyMode mode)
   }
 }
 
+void DRW_mesh_batch_cache_tag_positions_changed(Mesh *mesh, const IndexMask &changed_verts)
+{
+  if (!mesh->runtime->batch_cache || changed_verts.is_empty()) {
+    return;
+  }
+  MeshBatchCache &cache = *static_cast<MeshBatchCache *>(mesh->runtime->batch_cache);
+  gpu::VertBuf *pos = cache.final.buff.vbo.pos;
+  /* Partial updates of vertex buffers aren't supported by the Vulkan backend yet. */
+  if (pos == nullptr || DRW_vbo_requested(pos) || GPU_backend_get_type() == GPU_BACKEND_VULKAN) {
+    mesh_batch_cache_discard_deformed(cache);
+    return;
+  }
+
+  /* Keep the position buffer, only the changed vertices are uploaded again. The other buffers
+   * and the batches are still rebuilt. */
+  cache.final.buff.vbo.pos = nullptr;
+  mesh_batch_cache_discard_deformed(cache);
+  cache.final.buff.vbo.pos = pos;
+
+  if (cache.pos_changed_verts.size() != mesh->verts_num) {
+    cache.pos_changed_verts.clear();
+    cache.pos_changed_verts.resize(mesh->verts_num, false);
+  }
+  changed_verts.set_bits(cache.pos_changed_verts);
+}
+
 static void mesh_buffer_list_clear(MeshBufferList *mbuflist)
 {
   gpu::VertBuf **vbos = (gpu::VertBuf **)&mbuflist->vbo;
@@ -903,6 +979,54 @@ gpu::Batch *DRW_mesh_batch_cache_get_surface(Mesh &mesh)
   return cache.batch.surface;
 }
 
+/** Meshes with fewer triangles are drawn whole, culling them per object is enough. */
+static constexpr int surface_clusters_min_tris = DRW_MESH_SURFACE_CLUSTER_TRIS * 64;
+
+static Array<Bounds<float3>> mesh_calc_surface_clusters(const Object &object, const Mesh &mesh)
+{
+  /* The clusters are ranges in the triangle index buffer, only support the case where it is a
+   * direct copy of the mesh triangulation (see #extract_tris_mesh). */
+  if (mesh.runtime->edit_mesh || mesh.runtime->wrapper_type != ME_WRAPPER_TYPE_MDATA ||
+      BKE_subsurf_modifier_has_gpu_subdiv(&mesh) || mesh_render_mat_len_get(object, mesh) != 1 ||
+      mesh.attributes().contains(".hide_poly"))
+  {
+    return {};
+  }
+  const Span<int3> corner_tris = mesh.corner_tris();
+  if (corner_tris.size() < surface_clusters_min_tris) {
+    return {};
+  }
+  const Span<float3> positions = mesh.vert_positions();
+  const Span<int> corner_verts = mesh.corner_verts();
+
+  Array<Bounds<float3>> clusters(
+      divide_ceil_ul(corner_tris.size(), DRW_MESH_SURFACE_CLUSTER_TRIS));
+  threading::parallel_for(clusters.index_range(), 16, [&](const IndexRange range) {
+    for (const int cluster : range) {
+      const Span<int3> tris = corner_tris.slice_safe(
+          int64_t(cluster) * DRW_MESH_SURFACE_CLUSTER_TRIS, DRW_MESH_SURFACE_CLUSTER_TRIS);
+      Bounds<float3> bounds(positions[corner_verts[tris.first()[0]]]);
+      for (const int3 &tri : tris) {
+        for (const int corner : {tri[0], tri[1], tri[2]}) {
+          bounds.min = math::min(bounds.min, positions[corner_verts[corner]]);
+          bounds.max = math::max(bounds.max, positions[corner_verts[corner]]);
+        }
+      }
+      clusters[cluster] = bounds;
+    }
+  });
+  return clusters;
+}
+
+Span<Bounds<float3>> DRW_mesh_batch_cache_get_surface_clusters(Object &object, Mesh &mesh)
+{
+  MeshBatchCache &cache = *mesh_batch_cache_get(mesh);
+  if (!cache.surface_clusters) {
+    cache.surface_clusters = mesh_calc_surface_clusters(object, mesh);
+  }
+  return *cache.surface_clusters;
+}
+
 gpu::Batch *DRW_mesh_batch_cache_get_loose_edges(Mesh &mesh)
 {
   MeshBatchCache &cache = *mesh_batch_cache_get(mesh);
@@ -1327,6 +1451,26 @@ static void drw_mesh_batch_cache_check_available(TaskGraph &task_graph, Mesh &me
 }
 #endif
 
+/**
+ * Apply the changes tagged with #DRW_mesh_batch_cache_tag_positions_changed to the final position
+ * buffer, or extract it again when it can't be updated partially.
+ */
+static void mesh_batch_cache_update_positions(MeshBatchCache &cache, const Mesh &mesh)
+{
+  if (cache.pos_changed_verts.is_empty()) {
+    return;
+  }
+  gpu::VertBuf *pos = cache.final.buff.vbo.pos;
+  if (pos && !DRW_vbo_requested(pos)) {
+    if (cache.pos_changed_verts.size() != mesh.verts_num ||
+        !extract_positions_update(mesh, cache.final.loose_geom, cache.pos_changed_verts, *pos))
+    {
+      GPU_vertbuf_clear(pos);
+    }
+  }
+  cache.pos_changed_verts.clear_and_shrink();
+}
+
 void DRW_mesh_batch_cache_create_requested(TaskGraph &task_graph,
                                            Object &ob,
                                            Mesh &mesh,
@@ -1920,6 +2064,8 @@ void DRW_mesh_batch_cache_create_requested(TaskGraph &task_graph,
     mesh_batch_cache_free_subdiv_cache(cache);
   }
 
+  mesh_batch_cache_update_positions(cache, mesh);
+
   mesh_buffer_cache_create_requested(task_graph,
                                      cache,
                                      cache.final,
@@ -16,10 +16,12 @@
 #include "BKE_attribute.hh"
 #include "BKE_curves.hh"
 #include "BKE_customdata.hh"
+#include "BKE_scene.hh"
 
 #include "GPU_batch.hh"
 #include "GPU_capabilities.hh"
 #include "GPU_compute.hh"
+#include "GPU_index_buffer.hh"
 #include "GPU_material.hh"
 #include "GPU_shader.hh"
 #include "GPU_texture.hh"
@@ -218,6 +220,50 @@ static int attribute_index_in_material(GPUMaterial *gpu_material, const char *na
   return -1;
 }
 
+/**
+ * Strand thinning following the child particles percentage of the scene simplify settings. An
+ * evenly spread subset of the curves is drawn and their radius is scaled to keep the same
+ * coverage.
+ */
+static gpu::Batch *drw_curves_batch_get(const Scene &scene,
+                                        CurvesEvalCache &cache,
+                                        float &r_radius_scale)
+{
+  r_radius_scale = 1.0f;
+  CurvesEvalFinalCache &final_cache = cache.final;
+  const int curves_num = max_ii(
+      get_render_child_particle_number(&scene.r, cache.curves_num, DRW_state_is_scene_render()),
+      1);
+  if (curves_num >= cache.curves_num || final_cache.proc_hairs->elem == nullptr) {
+    return final_cache.proc_hairs;
+  }
+
+  if (final_cache.proc_hairs_thinned == nullptr ||
+      final_cache.proc_hairs_thinned_curves_num != curves_num)
+  {
+    GPU_BATCH_DISCARD_SAFE(final_cache.proc_hairs_thinned);
+    const GPUPrimType prim_type = final_cache.proc_hairs->prim_type;
+    /* The indices of each curve are contiguous, with an additional restart index for strips, see
+     * #GPU_indexbuf_build_curves_on_device. */
+    const uint indices_per_curve = final_cache.proc_hairs->elem->index_len_get() /
+                                   uint(cache.curves_num);
+    const uint verts_per_curve = indices_per_curve -
+                                 (ELEM(prim_type, GPU_PRIM_LINE_STRIP, GPU_PRIM_TRI_STRIP) ? 1 : 0);
+    /* Picking curves with a fixed stride instead of the first ones keeps the drawn subset spread
+     * over the whole object, since curves that are close in the index order are often close in
+     * space too. */
+    const float curve_stride = float(cache.curves_num) / float(curves_num);
+    gpu::IndexBuf *ibo = GPU_indexbuf_build_curves_on_device(
+        prim_type, uint(curves_num), verts_per_curve, curve_stride);
+    final_cache.proc_hairs_thinned = GPU_batch_create_ex(
+        prim_type, final_cache.proc_hairs->verts[0], ibo, GPU_BATCH_OWNS_INDEX);
+    final_cache.proc_hairs_thinned_curves_num = curves_num;
+  }
+
+  r_radius_scale = float(cache.curves_num) / float(curves_num);
+  return final_cache.proc_hairs_thinned;
+}
+
 DRWShadingGroup *DRW_shgroup_curves_create_sub(Object *object,
                                                DRWShadingGroup *shgrp_parent,
                                                GPUMaterial *gpu_material)
@@ -323,6 +369,11 @@ DRWShadingGroup *DRW_shgroup_curves_create_sub(Object *object,
 
   DRW_shgroup_uniform_block(shgrp, "drw_curves", curves_infos);
 
+  float radius_scale;
+  gpu::Batch *geom = drw_curves_batch_get(*scene, *curves_cache, radius_scale);
+  hair_rad_root *= radius_scale;
+  hair_rad_tip *= radius_scale;
+
   DRW_shgroup_uniform_int(shgrp, "hairStrandsRes", &curves_cache->final.resolution, 1);
   DRW_shgroup_uniform_int_copy(shgrp, "hairThicknessRes", thickness_res);
   DRW_shgroup_uniform_float_copy(shgrp, "hairRadShape", hair_rad_shape);
@@ -337,7 +388,6 @@ DRWShadingGroup *DRW_shgroup_curves_create_sub(Object *object,
   }
   /* TODO(fclem): Until we have a better way to cull the curves and render with orco, bypass
    * culling test. */
-  gpu::Batch *geom = curves_cache->final.proc_hairs;
   DRW_shgroup_call_no_cull(shgrp, geom, object);
 
   return shgrp;
@@ -566,6 +616,11 @@ gpu::Batch *curves_sub_pass_setup_implementation(PassT &sub_ps,
 
   sub_ps.bind_ubo("drw_curves", curves_infos);
 
+  float radius_scale;
+  gpu::Batch *geom = drw_curves_batch_get(*scene, *curves_cache, radius_scale);
+  hair_rad_root *= radius_scale;
+  hair_rad_tip *= radius_scale;
+
   sub_ps.push_constant("hairStrandsRes", &curves_cache->final.resolution, 1);
   sub_ps.push_constant("hairThicknessRes", thickness_res);
   sub_ps.push_constant("hairRadShape", hair_rad_shape);
@@ -574,7 +629,7 @@ gpu::Batch *curves_sub_pass_setup_implementation(PassT &sub_ps,
   sub_ps.push_constant("hairRadTip", hair_rad_tip);
   sub_ps.push_constant("hairCloseTip", hair_close_tip);
 
-  return curves_cache->final.proc_hairs;
+  return geom;
 }
 
 gpu::Batch *curves_sub_pass_setup(PassMain::Sub &ps,
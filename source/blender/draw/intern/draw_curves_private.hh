@@ -41,6 +41,13 @@ struct CurvesEvalFinalCache {
 
   /** Just contains a huge index buffer used to draw the final curves. */
   gpu::Batch *proc_hairs;
+  /**
+   * Same as #proc_hairs, but with an index buffer that only draws #proc_hairs_thinned_curves_num
+   * evenly spread curves. Used when the scene simplify settings reduce the number of drawn
+   * strands.
+   */
+  gpu::Batch *proc_hairs_thinned;
+  int proc_hairs_thinned_curves_num;
 
   /** Points per curve, at least 2. */
   int resolution;
@@ -17,6 +17,7 @@
 #include "BLI_string.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_trace.hh"
 
 #include "BLF_api.hh"
 
@@ -716,21 +717,19 @@ static void drw_duplidata_load(Object *ob)
     DST.dupli_ghash = BLI_ghash_new(dupli_key_hash, dupli_key_cmp, __func__);
   }
 
-  DupliKey *key = static_cast<DupliKey *>(MEM_callocN(sizeof(DupliKey), __func__));
-  key->ob = dupli->ob;
-  key->ob_data = dupli->ob_data;
-
-  void **value;
-  if (!BLI_ghash_ensure_p(DST.dupli_ghash, key, &value)) {
+  /* Only allocate a key for new entries, instances with alternating data are common. */
+  DupliKey lookup_key = {dupli->ob, dupli->ob_data};
+  void **value = BLI_ghash_lookup_p(DST.dupli_ghash, &lookup_key);
+  if (value == nullptr) {
+    DupliKey *key = static_cast<DupliKey *>(MEM_mallocN(sizeof(DupliKey), __func__));
+    *key = lookup_key;
+    BLI_ghash_ensure_p(DST.dupli_ghash, key, &value);
     *value = MEM_callocN(sizeof(void *) * g_registered_engines.len, __func__);
 
     /* TODO: Meh a bit out of place but this is nice as it is
      * only done once per instance type. */
     drw_batch_cache_validate(ob);
   }
-  else {
-    MEM_freeN(key);
-  }
   DST.dupli_datas = *(void ***)value;
 }
 
@@ -1662,6 +1661,7 @@ void DRW_draw_render_loop_ex(Depsgraph *depsgraph,
                              const bContext *evil_C)
 {
   using namespace blender::draw;
+  BLI_TRACE_ZONE("Draw Viewport", "draw");
   Scene *scene = DEG_get_evaluated_scene(depsgraph);
   ViewLayer *view_layer = DEG_get_evaluated_view_layer(depsgraph);
   RegionView3D *rv3d = static_cast<RegionView3D *>(region->regiondata);
@@ -3099,6 +3099,7 @@ void DRW_engines_register()
 
     BKE_mesh_batch_cache_dirty_tag_cb = DRW_mesh_batch_cache_dirty_tag;
     BKE_mesh_batch_cache_free_cb = DRW_mesh_batch_cache_free;
+    BKE_mesh_batch_cache_tag_positions_changed_cb = DRW_mesh_batch_cache_tag_positions_changed;
 
     BKE_lattice_batch_cache_dirty_tag_cb = DRW_lattice_batch_cache_dirty_tag;
     BKE_lattice_batch_cache_free_cb = DRW_lattice_batch_cache_free;
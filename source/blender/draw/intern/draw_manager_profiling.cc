@@ -26,6 +26,7 @@
 #include "UI_resources.hh"
 
 #include "draw_manager_profiling.hh"
+#include "draw_texture_pool.hh"
 
 #define MAX_TIMER_NAME 32
 #define MAX_NESTED_TIMER 8
@@ -290,8 +291,9 @@ void DRW_stats_draw(const rcti *rect)
   /* ------------------------------------------ */
 
   /* Memory Stats */
-  uint tex_mem = GPU_texture_memory_usage_get();
-  uint vbo_mem = GPU_vertbuf_get_memory_usage();
+  size_t tex_mem = GPU_texture_memory_usage_get();
+  size_t vbo_mem = GPU_vertbuf_get_memory_usage();
+  size_t pool_mem = DRW_texture_pool_memory_usage_get(DST.vmempool->texture_pool);
 
   STRNCPY(stat_string, "GPU Memory");
   draw_stat(rect, 0, v, stat_string, sizeof(stat_string));
@@ -301,6 +303,10 @@ void DRW_stats_draw(const rcti *rect)
   draw_stat(rect, 1, v, stat_string, sizeof(stat_string));
   SNPRINTF(stat_string, "%.2fMB", double(tex_mem) / 1000000.0);
   draw_stat_5row(rect, 1, v++, stat_string, sizeof(stat_string));
+  STRNCPY(stat_string, "Texture Pool");
+  draw_stat(rect, 2, v, stat_string, sizeof(stat_string));
+  SNPRINTF(stat_string, "%.2fMB", double(pool_mem) / 1000000.0);
+  draw_stat_5row(rect, 1, v++, stat_string, sizeof(stat_string));
   STRNCPY(stat_string, "Meshes");
   draw_stat(rect, 1, v, stat_string, sizeof(stat_string));
   SNPRINTF(stat_string, "%.2fMB", double(vbo_mem) / 1000000.0);
@@ -9,8 +9,10 @@
  * Embeds GPU meshes inside of bke::pbvh::Tree nodes, used by mesh sculpt mode.
  */
 
+#include "BLI_function_ref.hh"
 #include "BLI_map.hh"
 #include "BLI_math_vector_types.hh"
+#include "BLI_task.h"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -1800,6 +1802,56 @@ BLI_NOINLINE static void flush_vbo_data(const Span<gpu::VertBuf *> vbos,
   node_mask.foreach_index([&](const int i) { GPU_vertbuf_use(vbos[i]); });
 }
 
+/** Don't split smaller updates, the overhead of the extra tasks isn't worth it. */
+static constexpr int64_t fill_batch_min_nodes = 64;
+static constexpr int64_t fill_batches_max = 8;
+
+/**
+ * Filling the buffers is multi-threaded, but they can only be uploaded from the draw thread.
+ * Larger updates like the ones during sculpt strokes are split into batches, so that a batch is
+ * filled on worker threads while the previous one is uploaded.
+ */
+static void fill_and_flush_vbo_data(const Span<gpu::VertBuf *> vbos,
+                                    const IndexMask &node_mask,
+                                    const FunctionRef<void(const IndexMask &)> fill_fn)
+{
+  const int64_t batches_num = std::min(node_mask.size() / fill_batch_min_nodes, fill_batches_max);
+  if (batches_num < 2) {
+    fill_fn(node_mask);
+    flush_vbo_data(vbos, node_mask);
+    return;
+  }
+
+  struct FillTaskData {
+    FunctionRef<void(const IndexMask &)> fill_fn;
+    IndexMask batch;
+  };
+  FillTaskData task_data{fill_fn, {}};
+  TaskPool *task_pool = BLI_task_pool_create(nullptr, TASK_PRIORITY_HIGH);
+
+  const int64_t batch_size = divide_ceil_ul(node_mask.size(), batches_num);
+  IndexMask prev_batch;
+  for (int64_t start = 0; start < node_mask.size(); start += batch_size) {
+    task_data.batch = node_mask.slice(start, std::min(batch_size, node_mask.size() - start));
+    BLI_task_pool_push(
+        task_pool,
+        [](TaskPool *__restrict /*pool*/, void *taskdata) {
+          const FillTaskData &data = *static_cast<const FillTaskData *>(taskdata);
+          data.fill_fn(data.batch);
+        },
+        &task_data,
+        false,
+        nullptr);
+    /* Upload the previous batch while the current one is being filled. */
+    flush_vbo_data(vbos, prev_batch);
+    BLI_task_pool_work_and_wait(task_pool);
+    prev_batch = task_data.batch;
+  }
+  flush_vbo_data(vbos, prev_batch);
+
+  BLI_task_pool_free(task_pool);
+}
+
 Span<gpu::VertBuf *> DrawCacheImpl::ensure_attribute_data(const Object &object,
                                                           const OrigMeshData &orig_mesh_data,
                                                           const AttributeRequest &attr,
@@ -1831,17 +1883,23 @@ Span<gpu::VertBuf *> DrawCacheImpl::ensure_attribute_data(const Object &object,
   switch (pbvh.type()) {
     case bke::pbvh::Type::Mesh: {
       ensure_vbos_allocated_mesh(object, format, mask, vbos);
-      fill_vbos_mesh(object, orig_mesh_data, mask, attr, vbos);
+      fill_and_flush_vbo_data(vbos, mask, [&](const IndexMask &batch) {
+        fill_vbos_mesh(object, orig_mesh_data, batch, attr, vbos);
+      });
       break;
     }
     case bke::pbvh::Type::Grids: {
       ensure_vbos_allocated_grids(object, format, use_flat_layout_, mask, vbos);
-      fill_vbos_grids(object, orig_mesh_data, use_flat_layout_, mask, attr, vbos);
+      fill_and_flush_vbo_data(vbos, mask, [&](const IndexMask &batch) {
+        fill_vbos_grids(object, orig_mesh_data, use_flat_layout_, batch, attr, vbos);
+      });
       break;
     }
     case bke::pbvh::Type::BMesh: {
       ensure_vbos_allocated_bmesh(object, format, mask, vbos);
-      fill_vbos_bmesh(object, orig_mesh_data, mask, attr, vbos);
+      fill_and_flush_vbo_data(vbos, mask, [&](const IndexMask &batch) {
+        fill_vbos_bmesh(object, orig_mesh_data, batch, attr, vbos);
+      });
       break;
     }
   }
@@ -1850,8 +1908,6 @@ Span<gpu::VertBuf *> DrawCacheImpl::ensure_attribute_data(const Object &object,
    * avoid unnecessary processing in subsequent redraws. */
   dirty_mask.foreach_index_optimized<int>([&](const int i) { data.dirty_nodes[i].reset(); });
 
-  flush_vbo_data(vbos, mask);
-
   return vbos;
 }
 
@@ -184,6 +184,23 @@ void DRW_texture_pool_give_texture_ownership(DRWTexturePool *pool, GPUTexture *t
   pool->tmp_tex_acquired.append(tex);
 }
 
+size_t DRW_texture_pool_memory_usage_get(const DRWTexturePool *pool)
+{
+  size_t memory_usage = 0;
+  for (const DRWTexturePoolHandle &handle : pool->handles) {
+    if (handle.texture) {
+      memory_usage += GPU_texture_memory_size(handle.texture);
+    }
+  }
+  for (GPUTexture *tex : pool->tmp_tex_acquired) {
+    memory_usage += GPU_texture_memory_size(tex);
+  }
+  for (const ReleasedTexture &tex : pool->tmp_tex_released) {
+    memory_usage += GPU_texture_memory_size(tex.texture);
+  }
+  return memory_usage;
+}
+
 void DRW_texture_pool_reset(DRWTexturePool *pool)
 {
   /** Defer deallocation enough cycles to avoid interleaved calls to different DRW_draw/DRW_render
@@ -57,6 +57,11 @@ void DRW_texture_pool_take_texture_ownership(DRWTexturePool *pool, GPUTexture *t
  */
 void DRW_texture_pool_give_texture_ownership(DRWTexturePool *pool, GPUTexture *tex);
 
+/**
+ * Returns the memory size in bytes of all the textures owned by the pool, in use or not.
+ */
+size_t DRW_texture_pool_memory_usage_get(const DRWTexturePool *pool);
+
 /**
  * Resets the user bits for each texture in the pool and delete unused ones.
  */
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include "BLI_bit_span.hh"
 #include "BLI_math_matrix_types.hh"
 #include "BLI_math_vector_types.hh"
 #include "BLI_task.hh"
@@ -258,6 +259,14 @@ void extract_mesh_loose_edge_data(const Span<T> vert_data,
 }
 
 void extract_positions(const MeshRenderData &mr, gpu::VertBuf &vbo);
+/**
+ * Update the vertices in \a changed_verts in a position buffer that was extracted from a mesh with
+ * the same topology. The caller has to extract the whole buffer again if this returns false.
+ */
+bool extract_positions_update(const Mesh &mesh,
+                              const MeshExtractLooseGeom &loose_geom,
+                              BitSpan changed_verts,
+                              gpu::VertBuf &vbo);
 void extract_positions_subdiv(const DRWSubdivCache &subdiv_cache,
                               const MeshRenderData &mr,
                               gpu::VertBuf &vbo,
@@ -7,6 +7,7 @@
  */
 
 #include "BLI_array_utils.hh"
+#include "BLI_index_mask.hh"
 
 #include "extract_mesh.hh"
 
@@ -85,6 +86,91 @@ void extract_positions(const MeshRenderData &mr, gpu::VertBuf &vbo)
   }
 }
 
+/**
+ * Re-upload the elements of the position buffer in \a elements whose vertex changed. Nearby
+ * changed elements are combined into one upload, to avoid the overhead of many tiny uploads.
+ */
+template<typename ElemToVertFn>
+static void update_changed_positions(const Span<float3> positions,
+                                     const BitSpan changed_verts,
+                                     const IndexRange elements,
+                                     const ElemToVertFn &elem_to_vert,
+                                     gpu::VertBuf &vbo)
+{
+  constexpr int64_t max_gap = 64;
+  IndexMaskMemory memory;
+  const IndexMask changed = IndexMask::from_predicate(
+      IndexRange(elements.size()), GrainSize(4096), memory, [&](const int64_t i) {
+        return changed_verts[elem_to_vert(i)].test();
+      });
+
+  Vector<IndexRange> ranges;
+  changed.foreach_range([&](const IndexRange range) {
+    if (!ranges.is_empty() && range.start() - ranges.last().one_after_last() <= max_gap) {
+      ranges.last() = IndexRange::from_begin_end(ranges.last().start(), range.one_after_last());
+    }
+    else {
+      ranges.append(range);
+    }
+  });
+
+  Vector<float3> data;
+  for (const IndexRange range : ranges) {
+    data.resize(range.size());
+    for (const int64_t i : range.index_range()) {
+      data[i] = positions[elem_to_vert(range[i])];
+    }
+    GPU_vertbuf_update_sub(&vbo,
+                           (elements.start() + range.start()) * sizeof(float3),
+                           range.size() * sizeof(float3),
+                           data.data());
+  }
+}
+
+bool extract_positions_update(const Mesh &mesh,
+                              const MeshExtractLooseGeom &loose_geom,
+                              const BitSpan changed_verts,
+                              gpu::VertBuf &vbo)
+{
+  const Span<float3> positions = mesh.vert_positions();
+  const Span<int2> edges = mesh.edges();
+  const Span<int> corner_verts = mesh.corner_verts();
+  const Span<int> loose_edges = loose_geom.edges;
+  const Span<int> loose_verts = loose_geom.verts;
+  /* The loose geometry isn't necessarily cached, the buffer size only matches if it is. */
+  if (GPU_vertbuf_get_vertex_len(&vbo) !=
+      corner_verts.size() + loose_edges.size() * 2 + loose_verts.size())
+  {
+    return false;
+  }
+
+  /* Make sure buffer is active for sending the changed data. */
+  GPU_vertbuf_use(&vbo);
+
+  const IndexRange corners_range(corner_verts.size());
+  const IndexRange loose_edge_range = corners_range.after(loose_edges.size() * 2);
+  const IndexRange loose_vert_range = loose_edge_range.after(loose_verts.size());
+  update_changed_positions(
+      positions,
+      changed_verts,
+      corners_range,
+      [&](const int64_t i) { return corner_verts[i]; },
+      vbo);
+  update_changed_positions(
+      positions,
+      changed_verts,
+      loose_edge_range,
+      [&](const int64_t i) { return edges[loose_edges[i / 2]][i % 2]; },
+      vbo);
+  update_changed_positions(
+      positions,
+      changed_verts,
+      loose_vert_range,
+      [&](const int64_t i) { return loose_verts[i]; },
+      vbo);
+  return true;
+}
+
 static const GPUVertFormat &get_normals_format()
 {
   static GPUVertFormat format = {0};
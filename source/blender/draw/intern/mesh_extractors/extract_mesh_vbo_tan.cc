@@ -8,6 +8,7 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_array_utils.hh"
 #include "BLI_string.h"
 
 #include "BKE_editmesh.hh"
@@ -93,9 +94,7 @@ static void extract_tan_init_common(const MeshRenderData &mr,
       }
     }
     else {
-      for (int v = 0; v < mr.verts_num; v++) {
-        copy_v3_v3(orco_allocated[v], mr.vert_positions[v]);
-      }
+      array_utils::copy(mr.vert_positions, orco_allocated.as_mutable_span());
     }
     /* TODO: This is not thread-safe. Draw extraction should not modify the mesh. */
     BKE_mesh_orco_verts_transform(const_cast<Mesh *>(mr.mesh), orco_allocated, false);
@@ -163,6 +162,53 @@ static void extract_tan_init_common(const MeshRenderData &mr,
   *r_tan_len = tan_len;
 }
 
+template<typename GPUType> static GPUType convert_tangent(const float4 &tangent);
+template<> short4 convert_tangent(const float4 &tangent)
+{
+  short4 result;
+  normal_float_to_short_v3(result, tangent);
+  result[3] = (tangent[3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
+  return result;
+}
+template<> GPUPackedNormal convert_tangent(const float4 &tangent)
+{
+  GPUPackedNormal result = GPU_normal_convert_i10_v3(tangent);
+  result.w = (tangent[3] > 0.0f) ? 1 : -2;
+  return result;
+}
+
+template<typename GPUType>
+static void convert_tangents(const float (*layer_data)[4], MutableSpan<GPUType> dst)
+{
+  const Span<float4> src(reinterpret_cast<const float4 *>(layer_data), dst.size());
+  threading::parallel_for(src.index_range(), 2048, [&](const IndexRange range) {
+    for (const int corner : range) {
+      dst[corner] = convert_tangent<GPUType>(src[corner]);
+    }
+  });
+}
+
+template<typename GPUType>
+static void extract_tangents_data(const MeshRenderData &mr,
+                                  CustomData &corner_data,
+                                  const char (*tangent_names)[MAX_CUSTOMDATA_LAYER_NAME],
+                                  const int tan_len,
+                                  const bool use_orco_tan,
+                                  MutableSpan<GPUType> vbo_data)
+{
+  /* The layers are stored one after the other. */
+  for (int i = 0; i < tan_len; i++) {
+    const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
+        &corner_data, CD_TANGENT, tangent_names[i]);
+    convert_tangents(layer_data, vbo_data.slice(mr.corners_num * i, mr.corners_num));
+  }
+  if (use_orco_tan) {
+    const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
+        &corner_data, CD_TANGENT, 0);
+    convert_tangents(layer_data, vbo_data.slice(mr.corners_num * tan_len, mr.corners_num));
+  }
+}
+
 void extract_tangents(const MeshRenderData &mr,
                       const MeshBatchCache &cache,
                       const bool use_hq,
@@ -192,48 +238,12 @@ void extract_tangents(const MeshRenderData &mr,
   GPU_vertbuf_data_alloc(vbo, v_len);
 
   if (use_hq) {
-    short4 *tan_data = vbo.data<short4>().data();
-    for (int i = 0; i < tan_len; i++) {
-      const char *name = tangent_names[i];
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
-          &corner_data, CD_TANGENT, name);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        normal_float_to_short_v3(*tan_data, layer_data[corner]);
-        (*tan_data)[3] = (layer_data[corner][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
-    }
-    if (use_orco_tan) {
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
-          &corner_data, CD_TANGENT, 0);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        normal_float_to_short_v3(*tan_data, layer_data[corner]);
-        (*tan_data)[3] = (layer_data[corner][3] > 0.0f) ? SHRT_MAX : SHRT_MIN;
-        tan_data++;
-      }
-    }
+    extract_tangents_data(
+        mr, corner_data, tangent_names, tan_len, use_orco_tan, vbo.data<short4>());
   }
   else {
-    GPUPackedNormal *tan_data = vbo.data<GPUPackedNormal>().data();
-    for (int i = 0; i < tan_len; i++) {
-      const char *name = tangent_names[i];
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_named(
-          &corner_data, CD_TANGENT, name);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = GPU_normal_convert_i10_v3(layer_data[corner]);
-        tan_data->w = (layer_data[corner][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
-    }
-    if (use_orco_tan) {
-      const float(*layer_data)[4] = (const float(*)[4])CustomData_get_layer_n(
-          &corner_data, CD_TANGENT, 0);
-      for (int corner = 0; corner < mr.corners_num; corner++) {
-        *tan_data = GPU_normal_convert_i10_v3(layer_data[corner]);
-        tan_data->w = (layer_data[corner][3] > 0.0f) ? 1 : -2;
-        tan_data++;
-      }
-    }
+    extract_tangents_data(
+        mr, corner_data, tangent_names, tan_len, use_orco_tan, vbo.data<GPUPackedNormal>());
   }
 
   CustomData_free(&corner_data, mr.corners_num);
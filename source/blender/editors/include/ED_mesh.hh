@@ -117,6 +117,11 @@ struct EDBMUpdate_Params {
   uint calc_looptris : 1;
   uint calc_normals : 1;
   uint is_destructive : 1;
+  /**
+   * Move the elements into new memory if many of them were removed, see #BM_mesh_pack.
+   * Only for operators that don't keep any pointers to elements after the update.
+   */
+  uint pack_fragmented : 1;
 };
 
 /**
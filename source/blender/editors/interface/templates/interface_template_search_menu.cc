@@ -11,6 +11,7 @@
 
 #include <cstdio>
 #include <cstring>
+#include <memory>
 
 #include "MEM_guardedalloc.h"
 
@@ -122,6 +123,11 @@ struct MenuSearch_Data {
   ListBase items;
   /** Use for all small allocations. */
   MemArena *memarena;
+  /**
+   * Search index over #items, built on the first update. The items don't change while the menu
+   * is open, so this avoids normalizing all of them again for every typed character.
+   */
+  std::unique_ptr<blender::ui::string_search::StringSearch<MenuSearch_Item>> search;
 
   /** Use for context menu, to fake a button to create a context menu. */
   struct {
@@ -1003,13 +1009,14 @@ static void menu_search_update_fn(const bContext * /*C*/,
 {
   MenuSearch_Data *data = (MenuSearch_Data *)arg;
 
-  blender::ui::string_search::StringSearch<MenuSearch_Item> search;
-
-  LISTBASE_FOREACH (MenuSearch_Item *, item, &data->items) {
-    search.add(item->drawwstr_full, item, item->weight);
+  if (!data->search) {
+    data->search = std::make_unique<blender::ui::string_search::StringSearch<MenuSearch_Item>>();
+    LISTBASE_FOREACH (MenuSearch_Item *, item, &data->items) {
+      data->search->add(item->drawwstr_full, item, item->weight);
+    }
   }
 
-  const blender::Vector<MenuSearch_Item *> filtered_items = search.query(str);
+  const blender::Vector<MenuSearch_Item *> filtered_items = data->search->query(str);
 
   for (MenuSearch_Item *item : filtered_items) {
     if (!UI_search_item_add(items, item->drawwstr_full, item, item->icon, item->state, 0)) {
@@ -69,6 +69,7 @@
 /** use #BMesh operator flags for a few operators. */
 #define BMO_ELE_TAG 1
 
+using blender::Array;
 using blender::float3;
 using blender::Span;
 using blender::Vector;
@@ -3349,6 +3350,25 @@ static void select_linked_delimit_end(BMEditMesh *em)
   BM_mesh_elem_toolflags_clear(bm);
 }
 
+/**
+ * Select all edges in the regions connected to the seed vertices (by index), the same as walking
+ * from every seed with #BMW_VERT_SHELL.
+ */
+static void select_linked_vert_shells(BMesh *bm, const Span<bool> seed_verts)
+{
+  Array<bool> edges_linked(bm->totedge);
+  BM_mesh_vert_shell_regions_calc(bm, seed_verts, edges_linked);
+
+  BMIter iter;
+  BMEdge *e;
+  int i;
+  BM_ITER_MESH_INDEX (e, &iter, bm, BM_EDGES_OF_MESH, i) {
+    if (edges_linked[i]) {
+      BM_edge_select_set(bm, e, true);
+    }
+  }
+}
+
 static int edbm_select_linked_exec(bContext *C, wmOperator *op)
 {
   Scene *scene = CTX_data_scene(C);
@@ -3382,12 +3402,12 @@ static int edbm_select_linked_exec(bContext *C, wmOperator *op)
     if (em->selectmode & SCE_SELECT_VERTEX) {
       BMVert *v;
 
-      BM_ITER_MESH (v, &iter, em->bm, BM_VERTS_OF_MESH) {
-        BM_elem_flag_set(v, BM_ELEM_TAG, BM_elem_flag_test(v, BM_ELEM_SELECT));
-      }
-
-      /* Exclude all delimited verts. */
       if (delimit) {
+        BM_ITER_MESH (v, &iter, em->bm, BM_VERTS_OF_MESH) {
+          BM_elem_flag_set(v, BM_ELEM_TAG, BM_elem_flag_test(v, BM_ELEM_SELECT));
+        }
+
+        /* Exclude all delimited verts. */
         BMEdge *e;
         BM_ITER_MESH (e, &iter, em->bm, BM_EDGES_OF_MESH) {
           if (!BMO_edge_flag_test(bm, e, BMO_ELE_TAG)) {
@@ -3399,18 +3419,16 @@ static int edbm_select_linked_exec(bContext *C, wmOperator *op)
             }
           }
         }
-      }
 
-      BMW_init(&walker,
-               em->bm,
-               delimit ? BMW_LOOP_SHELL_WIRE : BMW_VERT_SHELL,
-               BMW_MASK_NOP,
-               delimit ? BMO_ELE_TAG : BMW_MASK_NOP,
-               BMW_MASK_NOP,
-               BMW_FLAG_TEST_HIDDEN,
-               BMW_NIL_LAY);
+        BMW_init(&walker,
+                 em->bm,
+                 BMW_LOOP_SHELL_WIRE,
+                 BMW_MASK_NOP,
+                 BMO_ELE_TAG,
+                 BMW_MASK_NOP,
+                 BMW_FLAG_TEST_HIDDEN,
+                 BMW_NIL_LAY);
 
-      if (delimit) {
         BM_ITER_MESH (v, &iter, em->bm, BM_VERTS_OF_MESH) {
           if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
             BMElem *ele_walk;
@@ -3430,21 +3448,18 @@ static int edbm_select_linked_exec(bContext *C, wmOperator *op)
             }
           }
         }
+
+        BMW_end(&walker);
       }
       else {
-        BM_ITER_MESH (v, &iter, em->bm, BM_VERTS_OF_MESH) {
-          if (BM_elem_flag_test(v, BM_ELEM_TAG)) {
-            BMEdge *e_walk;
-            BMW_ITER (e_walk, &walker, v) {
-              BM_edge_select_set(em->bm, e_walk, true);
-              BM_elem_flag_disable(e_walk, BM_ELEM_TAG);
-            }
-          }
+        Array<bool> seed_verts(bm->totvert);
+        int i;
+        BM_ITER_MESH_INDEX (v, &iter, bm, BM_VERTS_OF_MESH, i) {
+          seed_verts[i] = BM_elem_flag_test(v, BM_ELEM_SELECT);
         }
+        select_linked_vert_shells(bm, seed_verts);
       }
 
-      BMW_end(&walker);
-
       EDBM_selectmode_flush(em);
     }
     else if (em->selectmode & SCE_SELECT_EDGE) {
@@ -3460,23 +3475,16 @@ static int edbm_select_linked_exec(bContext *C, wmOperator *op)
                             (BMO_edge_flag_test(bm, e, BMO_ELE_TAG) ||
                              !BM_edge_is_any_face_flag_test(e, BM_ELEM_SELECT))));
         }
-      }
-      else {
-        BM_ITER_MESH (e, &iter, em->bm, BM_EDGES_OF_MESH) {
-          BM_elem_flag_set(e, BM_ELEM_TAG, BM_elem_flag_test(e, BM_ELEM_SELECT));
-        }
-      }
 
-      BMW_init(&walker,
-               em->bm,
-               delimit ? BMW_LOOP_SHELL_WIRE : BMW_VERT_SHELL,
-               BMW_MASK_NOP,
-               delimit ? BMO_ELE_TAG : BMW_MASK_NOP,
-               BMW_MASK_NOP,
-               BMW_FLAG_TEST_HIDDEN,
-               BMW_NIL_LAY);
+        BMW_init(&walker,
+                 em->bm,
+                 BMW_LOOP_SHELL_WIRE,
+                 BMW_MASK_NOP,
+                 BMO_ELE_TAG,
+                 BMW_MASK_NOP,
+                 BMW_FLAG_TEST_HIDDEN,
+                 BMW_NIL_LAY);
 
-      if (delimit) {
         BM_ITER_MESH (e, &iter, em->bm, BM_EDGES_OF_MESH) {
           if (BM_elem_flag_test(e, BM_ELEM_TAG)) {
             BMElem *ele_walk;
@@ -3496,50 +3504,40 @@ static int edbm_select_linked_exec(bContext *C, wmOperator *op)
             }
           }
         }
+
+        BMW_end(&walker);
       }
       else {
-        BM_ITER_MESH (e, &iter, em->bm, BM_EDGES_OF_MESH) {
-          if (BM_elem_flag_test(e, BM_ELEM_TAG)) {
-            BMEdge *e_walk;
-            BMW_ITER (e_walk, &walker, e) {
-              BM_edge_select_set(em->bm, e_walk, true);
-              BM_elem_flag_disable(e_walk, BM_ELEM_TAG);
-            }
+        /* Any vertex of a selected edge is in the same region as the edge. */
+        BM_mesh_elem_index_ensure(bm, BM_VERT);
+        Array<bool> seed_verts(bm->totvert, false);
+        BM_ITER_MESH (e, &iter, bm, BM_EDGES_OF_MESH) {
+          if (BM_elem_flag_test(e, BM_ELEM_SELECT) && !BM_elem_flag_test(e, BM_ELEM_HIDDEN)) {
+            seed_verts[BM_elem_index_get(e->v1)] = true;
           }
         }
+        select_linked_vert_shells(bm, seed_verts);
       }
 
-      BMW_end(&walker);
-
       EDBM_selectmode_flush(em);
     }
     else {
       BMFace *f;
 
-      BM_ITER_MESH (f, &iter, em->bm, BM_FACES_OF_MESH) {
-        BM_elem_flag_set(f, BM_ELEM_TAG, BM_elem_flag_test(f, BM_ELEM_SELECT));
-      }
-
-      BMW_init(&walker,
-               bm,
-               BMW_ISLAND,
-               BMW_MASK_NOP,
-               delimit ? BMO_ELE_TAG : BMW_MASK_NOP,
-               BMW_MASK_NOP,
-               BMW_FLAG_TEST_HIDDEN,
-               BMW_NIL_LAY);
-
-      BM_ITER_MESH (f, &iter, em->bm, BM_FACES_OF_MESH) {
-        if (BM_elem_flag_test(f, BM_ELEM_TAG)) {
-          BMFace *f_walk;
-          BMW_ITER (f_walk, &walker, f) {
-            BM_face_select_set(bm, f_walk, true);
-            BM_elem_flag_disable(f_walk, BM_ELEM_TAG);
-          }
-        }
+      Array<bool> seed_faces(bm->totface);
+      int i;
+      BM_ITER_MESH_INDEX (f, &iter, bm, BM_FACES_OF_MESH, i) {
+        seed_faces[i] = BM_elem_flag_test(f, BM_ELEM_SELECT);
       }
 
-      BMW_end(&walker);
+      Array<bool> faces_linked(bm->totface);
+      BM_mesh_face_island_regions_calc(bm, seed_faces, delimit ? BMO_ELE_TAG : 0, faces_linked);
+
+      BM_ITER_MESH_INDEX (f, &iter, bm, BM_FACES_OF_MESH, i) {
+        if (faces_linked[i]) {
+          BM_face_select_set(bm, f, true);
+        }
+      }
     }
 
     if (delimit) {
@@ -512,6 +512,7 @@ static int edbm_delete_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
 
     DEG_id_tag_update(static_cast<ID *>(obedit->data), ID_RECALC_SELECT);
@@ -642,6 +643,7 @@ static int edbm_delete_loose_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
   }
 
@@ -5715,6 +5717,7 @@ static int edbm_dissolve_verts_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
   }
 
@@ -5779,6 +5782,7 @@ static int edbm_dissolve_edges_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
   }
 
@@ -5842,6 +5846,7 @@ static int edbm_dissolve_faces_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
   }
 
@@ -6171,6 +6176,7 @@ static int edbm_delete_edgeloop_exec(bContext *C, wmOperator *op)
     params.calc_looptris = true;
     params.calc_normals = false;
     params.is_destructive = true;
+    params.pack_fragmented = true;
     EDBM_update(static_cast<Mesh *>(obedit->data), &params);
   }
 
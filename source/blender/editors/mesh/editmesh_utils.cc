@@ -1658,6 +1658,15 @@ void EDBM_update(Mesh *mesh, const EDBMUpdate_Params *params)
   /* Order of calling isn't important. */
   DEG_id_tag_update(&mesh->id, ID_RECALC_GEOMETRY);
   WM_main_add_notifier(NC_GEOM | ND_DATA, &mesh->id);
+  BKE_editmesh_eval_cache_clear(em);
+
+  /* The loop triangles reference loops, so they have to be recalculated after packing. Custom
+   * normal spaces reference loops too, they are rare enough to just skip packing. */
+  if (params->pack_fragmented && params->is_destructive && params->calc_looptris &&
+      em->bm->lnor_spacearr == nullptr && BM_mesh_is_fragmented(em->bm))
+  {
+    BM_mesh_pack(em->bm);
+  }
 
   if (params->calc_normals && params->calc_looptris) {
     /* Calculating both has some performance gains. */
@@ -6910,6 +6910,9 @@ void calc_brush_texture_factors(const SculptSession &ss,
   }
 
   for (const int i : verts.index_range()) {
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     float texture_value;
     float4 texture_rgba;
     /* NOTE: This is not a thread-safe call. */
@@ -6934,6 +6937,9 @@ void calc_brush_texture_factors(const SculptSession &ss,
   }
 
   for (const int i : positions.index_range()) {
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     float texture_value;
     float4 texture_rgba;
     /* NOTE: This is not a thread-safe call. */
@@ -666,6 +666,12 @@ void calc_vert_factors(const Depsgraph &depsgraph,
     const int vert = verts[i];
     const float3 &normal = orig_normals.is_empty() ? vert_normals[vert] : orig_normals[i];
 
+    /* Most vertices of a node are usually outside of the brush radius. The per-vertex tests
+     * below can be very expensive and can't change their factor anymore. */
+    if (factors[i] == 0.0f) {
+      continue;
+    }
+
     /* Since brush normal mode depends on the current mirror symmetry pass
      * it is not folded into the factor cache (when it exists). */
     if ((ss.cache || ss.filter_cache) &&
@@ -767,6 +773,9 @@ void calc_face_factors(const Depsgraph &depsgraph,
   const VArraySpan face_sets = *attributes.lookup<int>(".sculpt_face_set", bke::AttrDomain::Face);
   const VArraySpan hide_poly = *attributes.lookup<bool>(".hide_poly", bke::AttrDomain::Face);
   for (const int i : face_indices.index_range()) {
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const Span<int> face_verts = corner_verts.slice(faces[face_indices[i]]);
     float sum = 0.0f;
     for (const int vert : face_verts) {
@@ -894,6 +903,9 @@ void calc_grids_factors(const Depsgraph &depsgraph,
     for (const int offset : IndexRange(key.grid_area)) {
       const int node_vert = node_start + offset;
       const int vert = grids_start + offset;
+      if (factors[node_vert] == 0.0f) {
+        continue;
+      }
       const float3 &normal = orig_normals.is_empty() ? subdiv_ccg.normals[vert] :
                                                        orig_normals[node_vert];
 
@@ -1007,6 +1019,9 @@ void calc_vert_factors(const Depsgraph &depsgraph,
   int i = 0;
   for (BMVert *vert : verts) {
     BLI_SCOPED_DEFER([&]() { i++; });
+    if (factors[i] == 0.0f) {
+      continue;
+    }
     const int vert_i = BM_elem_index_get(vert);
     const float3 normal = orig_normals.is_empty() ? float3(vert->no) : orig_normals[i];
 
@@ -14,7 +14,9 @@
 #include "BLI_math_matrix.h"
 #include "BLI_math_matrix.hh"
 #include "BLI_math_rotation.h"
+#include "BLI_math_bits.h"
 #include "BLI_math_vector.hh"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -1305,6 +1307,95 @@ static void calc_constraint_factors(const Depsgraph &depsgraph,
   }
 }
 
+/**
+ * Add the constraints created since the last update to the first group that doesn't contain
+ * another constraint affecting the same vertices. Only 64 groups fit into the per-vertex bits,
+ * but meshes rarely need more than a few dozen.
+ */
+static void update_constraint_groups(SimulationData &cloth_sim)
+{
+  if (cloth_sim.vert_constraint_groups.is_empty()) {
+    cloth_sim.vert_constraint_groups = Array<uint64_t>(cloth_sim.pos.size(), 0);
+  }
+  const Span<LengthConstraint> constraints = cloth_sim.length_constraints;
+  MutableSpan<uint64_t> vert_groups = cloth_sim.vert_constraint_groups;
+  for (const int i : constraints.index_range().drop_front(cloth_sim.grouped_constraints_num)) {
+    const int v1 = constraints[i].elem_index_a;
+    const int v2 = constraints[i].elem_index_b;
+    const uint64_t used_groups = vert_groups[v1] | vert_groups[v2];
+    if (used_groups == std::numeric_limits<uint64_t>::max()) {
+      cloth_sim.ungrouped_constraints.append(i);
+      continue;
+    }
+    const int group = bitscan_forward_uint64(~used_groups);
+    if (group == cloth_sim.constraint_groups.size()) {
+      cloth_sim.constraint_groups.append({});
+    }
+    cloth_sim.constraint_groups[group].append(i);
+    vert_groups[v1] |= uint64_t(1) << group;
+    vert_groups[v2] |= uint64_t(1) << group;
+  }
+  cloth_sim.grouped_constraints_num = constraints.size();
+}
+
+static void satisfy_constraint(const LengthConstraint &constraint,
+                               const Brush *brush,
+                               const Span<float> factors,
+                               SimulationData &cloth_sim)
+{
+  if (cloth_sim.node_state[constraint.node] != SCULPT_CLOTH_NODE_ACTIVE) {
+    /* Skip all constraints that were created for inactive nodes. */
+    return;
+  }
+
+  const int v1 = constraint.elem_index_a;
+  const int v2 = constraint.elem_index_b;
+
+  const float3 v1_to_v2 = float3(constraint.elem_position_b) - float3(constraint.elem_position_a);
+  const float current_distance = math::length(v1_to_v2);
+  float3 correction_vector;
+
+  const float constraint_distance = constraint.length +
+                                    (cloth_sim.length_constraint_tweak[v1] * 0.5f) +
+                                    (cloth_sim.length_constraint_tweak[v2] * 0.5f);
+
+  if (current_distance > 0.0f) {
+    correction_vector = v1_to_v2 * CLOTH_SOLVER_DISPLACEMENT_FACTOR *
+                        (1.0f - (constraint_distance / current_distance));
+  }
+  else {
+    correction_vector = v1_to_v2 * CLOTH_SOLVER_DISPLACEMENT_FACTOR;
+  }
+
+  const float3 correction_vector_half = correction_vector * 0.5f;
+
+  const float factor_v1 = factors[v1];
+  const float factor_v2 = factors[v2];
+
+  float deformation_strength = 1.0f;
+  if (constraint.type == SCULPT_CLOTH_CONSTRAINT_DEFORMATION) {
+    deformation_strength = (cloth_sim.deformation_strength[v1] +
+                            cloth_sim.deformation_strength[v2]) *
+                           0.5f;
+  }
+
+  if (constraint.type == SCULPT_CLOTH_CONSTRAINT_SOFTBODY) {
+    const float softbody_plasticity = brush ? brush->cloth_constraint_softbody_strength : 0.0f;
+    cloth_sim.pos[v1] += correction_vector_half *
+                         (1.0f * factor_v1 * constraint.strength * softbody_plasticity);
+    cloth_sim.softbody_pos[v1] += correction_vector_half * -1.0f * factor_v1 *
+                                  constraint.strength * (1.0f - softbody_plasticity);
+  }
+  else {
+    cloth_sim.pos[v1] += correction_vector_half * 1.0f * factor_v1 * constraint.strength *
+                         deformation_strength;
+    if (v1 != v2) {
+      cloth_sim.pos[v2] += correction_vector_half * -1.0f * factor_v2 * constraint.strength *
+                           deformation_strength;
+    }
+  }
+}
+
 static void cloth_brush_satisfy_constraints(const Depsgraph &depsgraph,
                                             const Object &object,
                                             const Brush *brush,
@@ -1318,60 +1409,19 @@ static void cloth_brush_satisfy_constraints(const Depsgraph &depsgraph,
   Array<float> factors(SCULPT_vertex_count_get(object));
   calc_constraint_factors(depsgraph, object, brush, sim_location, cloth_sim.init_pos, factors);
 
-  for (int constraint_it = 0; constraint_it < CLOTH_SIMULATION_ITERATIONS; constraint_it++) {
-    for (const LengthConstraint &constraint : cloth_sim.length_constraints) {
-      if (cloth_sim.node_state[constraint.node] != SCULPT_CLOTH_NODE_ACTIVE) {
-        /* Skip all constraints that were created for inactive nodes. */
-        continue;
-      }
-
-      const int v1 = constraint.elem_index_a;
-      const int v2 = constraint.elem_index_b;
-
-      const float3 v1_to_v2 = float3(constraint.elem_position_b) -
-                              float3(constraint.elem_position_a);
-      const float current_distance = math::length(v1_to_v2);
-      float3 correction_vector;
-
-      const float constraint_distance = constraint.length +
-                                        (cloth_sim.length_constraint_tweak[v1] * 0.5f) +
-                                        (cloth_sim.length_constraint_tweak[v2] * 0.5f);
-
-      if (current_distance > 0.0f) {
-        correction_vector = v1_to_v2 * CLOTH_SOLVER_DISPLACEMENT_FACTOR *
-                            (1.0f - (constraint_distance / current_distance));
-      }
-      else {
-        correction_vector = v1_to_v2 * CLOTH_SOLVER_DISPLACEMENT_FACTOR;
-      }
-
-      const float3 correction_vector_half = correction_vector * 0.5f;
-
-      const float factor_v1 = factors[v1];
-      const float factor_v2 = factors[v2];
-
-      float deformation_strength = 1.0f;
-      if (constraint.type == SCULPT_CLOTH_CONSTRAINT_DEFORMATION) {
-        deformation_strength = (cloth_sim.deformation_strength[v1] +
-                                cloth_sim.deformation_strength[v2]) *
-                               0.5f;
-      }
+  update_constraint_groups(cloth_sim);
 
-      if (constraint.type == SCULPT_CLOTH_CONSTRAINT_SOFTBODY) {
-        const float softbody_plasticity = brush ? brush->cloth_constraint_softbody_strength : 0.0f;
-        cloth_sim.pos[v1] += correction_vector_half *
-                             (1.0f * factor_v1 * constraint.strength * softbody_plasticity);
-        cloth_sim.softbody_pos[v1] += correction_vector_half * -1.0f * factor_v1 *
-                                      constraint.strength * (1.0f - softbody_plasticity);
-      }
-      else {
-        cloth_sim.pos[v1] += correction_vector_half * 1.0f * factor_v1 * constraint.strength *
-                             deformation_strength;
-        if (v1 != v2) {
-          cloth_sim.pos[v2] += correction_vector_half * -1.0f * factor_v2 * constraint.strength *
-                               deformation_strength;
+  const Span<LengthConstraint> constraints = cloth_sim.length_constraints;
+  for (int constraint_it = 0; constraint_it < CLOTH_SIMULATION_ITERATIONS; constraint_it++) {
+    for (const Span<int> group : cloth_sim.constraint_groups) {
+      threading::parallel_for(group.index_range(), 1024, [&](const IndexRange range) {
+        for (const int i : group.slice(range)) {
+          satisfy_constraint(constraints[i], brush, factors, cloth_sim);
         }
-      }
+      });
+    }
+    for (const int i : cloth_sim.ungrouped_constraints) {
+      satisfy_constraint(constraints[i], brush, factors, cloth_sim);
     }
   }
 }
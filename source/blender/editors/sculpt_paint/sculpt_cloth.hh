@@ -77,6 +77,19 @@ struct SimulationData {
   Vector<LengthConstraint> length_constraints;
   Array<float> length_constraint_tweak;
 
+  /**
+   * Indices of the length constraints, grouped such that no two constraints in a group affect the
+   * same vertex. The constraints of a group can be solved in parallel. The groups persist for the
+   * whole simulation, new constraints are added to them before solving.
+   */
+  Vector<Vector<int>> constraint_groups;
+  /** Constraints that didn't fit into any group, they are solved serially. */
+  Vector<int> ungrouped_constraints;
+  /** For every vertex, a bit for each group that contains a constraint affecting the vertex. */
+  Array<uint64_t> vert_constraint_groups;
+  /** The number of constraints from the start of #length_constraints that are in groups. */
+  int grouped_constraints_num = 0;
+
   /* Position anchors for deformation brushes. These positions are modified by the brush and the
    * final positions of the simulated vertices are updated with constraints that use these points
    * as targets. */
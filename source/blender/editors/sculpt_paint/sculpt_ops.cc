@@ -29,7 +29,9 @@
 #include "BKE_brush.hh"
 #include "BKE_ccg.hh"
 #include "BKE_context.hh"
+#include "BKE_customdata.hh"
 #include "BKE_layer.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_mesh.hh"
 #include "BKE_mesh_mirror.hh"
@@ -50,6 +52,8 @@
 #include "WM_toolsystem.hh"
 #include "WM_types.hh"
 
+#include "GEO_reorder.hh"
+
 #include "ED_image.hh"
 #include "ED_object.hh"
 #include "ED_screen.hh"
@@ -154,10 +158,86 @@ static void SCULPT_OT_set_persistent_base(wmOperatorType *ot)
 /** \name Optimize Operator
  * \{ */
 
-static int optimize_exec(bContext *C, wmOperator * /*op*/)
+/**
+ * Reorder the faces of the mesh to match the order of the BVH leaf nodes, and the vertices to
+ * match the order of the nodes that own them. That way the data used by each node is close
+ * together in memory, which improves cache locality when evaluating brushes.
+ */
+static void reorder_mesh_to_match_pbvh(const Scene &scene, Object &ob, wmOperator &op)
+{
+  Mesh &mesh = *static_cast<Mesh *>(ob.data);
+  if (mesh.key || CustomData_has_layer(&mesh.corner_data, CD_CUSTOMLOOPNORMAL) ||
+      CustomData_has_layer(&mesh.corner_data, CD_MDISPS))
+  {
+    BKE_report(op.reports,
+               RPT_WARNING,
+               "Meshes with shape keys, custom normals or multires data can't be reordered");
+    return;
+  }
+
+  const bke::pbvh::Tree pbvh = bke::pbvh::Tree::from_mesh(mesh);
+  Vector<const bke::pbvh::MeshNode *> leaves;
+  for (const bke::pbvh::MeshNode &node : pbvh.nodes<bke::pbvh::MeshNode>()) {
+    if (node.flag_ & PBVH_Leaf) {
+      leaves.append(&node);
+    }
+  }
+  /* The faces of all leaves are slices of a single array that is ordered by the tree traversal,
+   * while the nodes themselves are stored in a different order. */
+  std::sort(leaves.begin(), leaves.end(), [](const auto *a, const auto *b) {
+    return a->faces().data() < b->faces().data();
+  });
+
+  Array<int> face_order(mesh.faces_num);
+  Array<int> vert_order(mesh.verts_num);
+  Array<bool> vert_added(mesh.verts_num, false);
+  int faces_num = 0;
+  int verts_num = 0;
+  for (const bke::pbvh::MeshNode *node : leaves) {
+    face_order.as_mutable_span().slice(faces_num, node->faces().size()).copy_from(node->faces());
+    faces_num += node->faces().size();
+    for (const int vert : node->verts()) {
+      vert_order[verts_num++] = vert;
+      vert_added[vert] = true;
+    }
+  }
+  BLI_assert(faces_num == mesh.faces_num);
+  /* Vertices that aren't used by any face. */
+  for (const int vert : vert_added.index_range()) {
+    if (!vert_added[vert]) {
+      vert_order[verts_num++] = vert;
+    }
+  }
+
+  Mesh *faces_reordered = geometry::reorder_mesh(mesh, face_order, bke::AttrDomain::Face, {});
+  Mesh *result = geometry::reorder_mesh(
+      *faces_reordered, vert_order, bke::AttrDomain::Point, {});
+  BKE_id_free(nullptr, faces_reordered);
+
+  undo::geometry_begin(scene, ob, &op);
+  BKE_mesh_nomain_to_mesh(result, &mesh, &ob);
+  undo::geometry_end(ob);
+  BKE_mesh_batch_cache_dirty_tag(&mesh, BKE_MESH_BATCH_DIRTY_ALL);
+}
+
+static int optimize_exec(bContext *C, wmOperator *op)
 {
+  const Scene &scene = *CTX_data_scene(C);
   Object &ob = *CTX_data_active_object(C);
 
+  if (RNA_boolean_get(op->ptr, "reorder_mesh")) {
+    const bke::pbvh::Tree *pbvh = bke::object::pbvh_get(ob);
+    if (pbvh && pbvh->type() == bke::pbvh::Type::Mesh) {
+      reorder_mesh_to_match_pbvh(scene, ob, *op);
+      islands::invalidate(*ob.sculpt);
+    }
+    else {
+      BKE_report(op->reports,
+                 RPT_WARNING,
+                 "Reordering isn't supported with multires or dynamic topology");
+    }
+  }
+
   BKE_sculptsession_free_pbvh(ob);
   DEG_id_tag_update(&ob.id, ID_RECALC_GEOMETRY);
 
@@ -180,6 +260,13 @@ static void SCULPT_OT_optimize(wmOperatorType *ot)
   ot->poll = SCULPT_mode_poll;
 
   ot->flag = OPTYPE_REGISTER | OPTYPE_UNDO;
+
+  RNA_def_boolean(ot->srna,
+                  "reorder_mesh",
+                  false,
+                  "Reorder Mesh",
+                  "Also reorder the vertices and faces of the mesh to match the BVH, to make "
+                  "sculpting faster by keeping the data of each part of the mesh close together");
 }
 
 /** \} */
@@ -513,6 +600,8 @@ void object_sculpt_mode_exit(Main &bmain, Depsgraph &depsgraph, Scene &scene, Ob
   /* Leave sculpt mode. */
   ob.mode &= ~mode_flag;
 
+  /* Keep the BVH tree to make entering sculpt mode again faster. */
+  BKE_sculptsession_release_pbvh(ob);
   BKE_sculptsession_free(&ob);
 
   paint_cursor_delete_textures();
@@ -30,6 +30,7 @@
 #include "sculpt_undo.hh"
 
 #include <mutex>
+#include <zstd.h>
 
 #include "MEM_guardedalloc.h"
 
@@ -39,6 +40,7 @@
 #include "BLI_listbase.h"
 #include "BLI_map.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "BLI_vector.hh"
 
@@ -123,6 +125,18 @@ namespace blender::ed::sculpt_paint::undo {
 
 #define NO_ACTIVE_LAYER bke::AttrDomain::Auto
 
+/**
+ * A zstd compressed copy of one of the arrays of an undo node. The arrays are only accessed
+ * again when the step is undone or redone, so they are stored compressed after the undo step is
+ * finished and decompressed on demand. That allows keeping many more steps within the undo memory
+ * limit.
+ */
+struct CompressedArray {
+  Array<std::byte, 0> data;
+  /** Size of the uncompressed array in bytes. */
+  int64_t size_in_bytes = 0;
+};
+
 struct Node {
   Array<float3, 0> position;
   Array<float3, 0> normal;
@@ -154,6 +168,18 @@ struct Node {
   Array<int, 0> face_sets;
 
   Vector<int> face_indices;
+
+  /**
+   * Storage of the larger arrays above while the undo step isn't applied. The corresponding
+   * uncompressed arrays are empty in the mean time. See #compress_step_data.
+   */
+  struct {
+    CompressedArray position;
+    CompressedArray col;
+    CompressedArray mask;
+    CompressedArray loop_col;
+    CompressedArray face_sets;
+  } compressed;
 };
 
 struct SculptAttrRef {
@@ -1663,6 +1689,102 @@ void push_begin(const Scene &scene, Object &ob, const wmOperator *op)
   push_begin_ex(scene, ob, op->type->name);
 }
 
+/** Compressing smaller arrays isn't worth the overhead. */
+static constexpr int64_t compress_min_size = 4096;
+
+/**
+ * The bytes of the 4 byte components are split into separate planes before compression. The
+ * sign and exponent bytes of nearby float values are mostly equal, so the planes compress much
+ * better than the interleaved values.
+ */
+template<typename T> static void compress_array(Array<T, 0> &array, CompressedArray &r_compressed)
+{
+  static_assert(sizeof(T) % 4 == 0);
+  const int64_t size = array.as_span().size_in_bytes();
+  if (size < compress_min_size) {
+    return;
+  }
+  const int64_t values_num = size / 4;
+  const std::byte *src = reinterpret_cast<const std::byte *>(array.data());
+  Array<std::byte> planes(size, NoInitialization());
+  for (const int64_t i : IndexRange(values_num)) {
+    for (const int byte : IndexRange(4)) {
+      planes[byte * values_num + i] = src[i * 4 + byte];
+    }
+  }
+
+  Array<std::byte> buffer(ZSTD_compressBound(size), NoInitialization());
+  /* The fastest level, compression happens when finishing every stroke. */
+  const size_t compressed_size = ZSTD_compress(
+      buffer.data(), buffer.size(), planes.data(), planes.size(), 1);
+  if (ZSTD_isError(compressed_size) || int64_t(compressed_size) >= size) {
+    return;
+  }
+  r_compressed.data = buffer.as_span().take_front(compressed_size);
+  r_compressed.size_in_bytes = size;
+  array = {};
+}
+
+template<typename T>
+static void decompress_array(CompressedArray &compressed, Array<T, 0> &r_array)
+{
+  if (compressed.data.is_empty()) {
+    return;
+  }
+  const int64_t size = compressed.size_in_bytes;
+  const int64_t values_num = size / 4;
+  Array<std::byte> planes(size, NoInitialization());
+  const size_t decompressed_size = ZSTD_decompress(
+      planes.data(), planes.size(), compressed.data.data(), compressed.data.size());
+  BLI_assert(!ZSTD_isError(decompressed_size) && int64_t(decompressed_size) == size);
+  UNUSED_VARS_NDEBUG(decompressed_size);
+
+  r_array.reinitialize(size / sizeof(T));
+  std::byte *dst = reinterpret_cast<std::byte *>(r_array.data());
+  for (const int64_t i : IndexRange(values_num)) {
+    for (const int byte : IndexRange(4)) {
+      dst[i * 4 + byte] = planes[byte * values_num + i];
+    }
+  }
+  compressed = {};
+}
+
+template<typename Fn> static void foreach_compressible_array(Node &node, const Fn &fn)
+{
+  fn(node.position, node.compressed.position);
+  fn(node.col, node.compressed.col);
+  fn(node.mask, node.compressed.mask);
+  fn(node.loop_col, node.compressed.loop_col);
+  fn(node.face_sets, node.compressed.face_sets);
+}
+
+/**
+ * Compress the data of all nodes in parallel. This must be done again after the step has been
+ * applied with #decompress_step_data, since restoring swaps the stored values with the current
+ * values.
+ */
+static void compress_step_data(StepData &step_data)
+{
+  threading::parallel_for(step_data.nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      foreach_compressible_array(
+          *step_data.nodes[i],
+          [](auto &array, CompressedArray &compressed) { compress_array(array, compressed); });
+    }
+  });
+}
+
+static void decompress_step_data(StepData &step_data)
+{
+  threading::parallel_for(step_data.nodes.index_range(), 1, [&](const IndexRange range) {
+    for (const int i : range) {
+      foreach_compressible_array(
+          *step_data.nodes[i],
+          [](auto &array, CompressedArray &compressed) { decompress_array(compressed, array); });
+    }
+  });
+}
+
 static size_t node_size_in_bytes(const Node &node)
 {
   size_t size = sizeof(Node);
@@ -1679,9 +1801,29 @@ static size_t node_size_in_bytes(const Node &node)
   size += node.grid_hidden.all_bits().size() / 8;
   size += node.face_sets.as_span().size_in_bytes();
   size += node.face_indices.as_span().size_in_bytes();
+  size += node.compressed.position.data.as_span().size_in_bytes();
+  size += node.compressed.col.data.as_span().size_in_bytes();
+  size += node.compressed.mask.data.as_span().size_in_bytes();
+  size += node.compressed.loop_col.data.as_span().size_in_bytes();
+  size += node.compressed.face_sets.data.as_span().size_in_bytes();
   return size;
 }
 
+static size_t step_data_size_in_bytes(const StepData &step_data)
+{
+  return threading::parallel_reduce(
+      step_data.nodes.index_range(),
+      16,
+      size_t(0),
+      [&](const IndexRange range, size_t size) {
+        for (const int i : range) {
+          size += node_size_in_bytes(*step_data.nodes[i]);
+        }
+        return size;
+      },
+      std::plus<size_t>());
+}
+
 void push_end_ex(Object &ob, const bool use_nested_undo)
 {
   StepData *step_data = get_step_data();
@@ -1698,17 +1840,8 @@ void push_end_ex(Object &ob, const bool use_nested_undo)
     unode->normal = {};
   }
 
-  step_data->undo_size = threading::parallel_reduce(
-      step_data->nodes.index_range(),
-      16,
-      0,
-      [&](const IndexRange range, size_t size) {
-        for (const int i : range) {
-          size += node_size_in_bytes(*step_data->nodes[i]);
-        }
-        return size;
-      },
-      std::plus<size_t>());
+  compress_step_data(*step_data);
+  step_data->undo_size = step_data_size_in_bytes(*step_data);
 
   /* We could remove this and enforce all callers run in an operator using 'OPTYPE_UNDO'. */
   wmWindowManager *wm = static_cast<wmWindowManager *>(G_MAIN->wm.first);
@@ -1815,7 +1948,11 @@ static void step_decode_undo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoS
 {
   BLI_assert(us->step.is_applied == true);
 
+  decompress_step_data(us->data);
   restore_list(C, depsgraph, us->data);
+  compress_step_data(us->data);
+  us->data.undo_size = step_data_size_in_bytes(us->data);
+  us->step.data_size = us->data.undo_size;
   us->step.is_applied = false;
 }
 
@@ -1823,7 +1960,11 @@ static void step_decode_redo_impl(bContext *C, Depsgraph *depsgraph, SculptUndoS
 {
   BLI_assert(us->step.is_applied == false);
 
+  decompress_step_data(us->data);
   restore_list(C, depsgraph, us->data);
+  compress_step_data(us->data);
+  us->data.undo_size = step_data_size_in_bytes(us->data);
+  us->step.data_size = us->data.undo_size;
   us->step.is_applied = true;
 }
 
@@ -33,8 +33,14 @@ static IndexMask apply_filter_operation(const VArray<T> &data,
                                         const IndexMask &mask,
                                         IndexMaskMemory &memory)
 {
-  return IndexMask::from_predicate(
-      mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(data[i]); });
+  IndexMask result;
+  /* Filters are evaluated for every row of the geometry, so avoid a virtual call per element
+   * when the data is stored in a span (which is the case for most attributes). */
+  devirtualize_varray(data, [&](const auto data) {
+    result = IndexMask::from_predicate(
+        mask, GrainSize(1024), memory, [&](const int64_t i) { return check_fn(data[i]); });
+  });
+  return result;
 }
 
 static IndexMask apply_row_filter(const SpreadsheetRowFilter &row_filter,
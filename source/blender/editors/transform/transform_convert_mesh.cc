@@ -2100,6 +2100,14 @@ static void recalcData_mesh(TransInfo *t)
     DEG_id_tag_update(static_cast<ID *>(tc->obedit->data), ID_RECALC_GEOMETRY);
 
     mesh_partial_update(t, tc, &partial_state);
+
+    /* Allow the evaluation to reuse the previously converted mesh, unless custom data
+     * correction changed more than the positions. */
+    const TransCustomDataMesh *tcmd = static_cast<const TransCustomDataMesh *>(
+        tc->custom.type.data);
+    if (tcmd == nullptr || tcmd->cd_layer_correct == nullptr) {
+      BKE_editmesh_from_object(tc->obedit)->eval_cache_positions_only = true;
+    }
   }
 }
 
@@ -2126,6 +2134,7 @@ static void special_aftertrans_update__mesh(bContext * /*C*/, TransInfo *t)
     FOREACH_TRANS_DATA_CONTAINER (t, tc) {
       BMEditMesh *em = BKE_editmesh_from_object(tc->obedit);
       BMesh *bm = em->bm;
+      BKE_editmesh_eval_cache_clear(em);
       char hflag;
       bool has_face_sel = (bm->totfacesel != 0);
 
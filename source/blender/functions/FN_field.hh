@@ -492,6 +492,34 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
                                 const FieldContext &context,
                                 Span<GVMutableArray> dst_varrays = {});
 
+/**
+ * Evaluates fields with a different backend than the multi-function procedure executor, e.g.
+ * with a compute shader on the GPU. It is used for the fields that depend on the index, after
+ * the field inputs have been evaluated on the CPU.
+ */
+class ExternalFieldEvaluator {
+ public:
+  virtual ~ExternalFieldEvaluator() = default;
+
+  /**
+   * Either evaluate all fields and put the results into  r_varrays, or return false to
+   * evaluate them on the CPU as usual.
+   *
+   * \param get_input: Gives the already evaluated virtual array for a field input.
+   */
+  virtual bool try_evaluate(ResourceScope &scope,
+                            Span<GFieldRef> fields,
+                            const IndexMask &mask,
+                            FunctionRef<const GVArray &(const FieldInput &)> get_input,
+                            MutableSpan<GVArray> r_varrays) const = 0;
+};
+
+/**
+ * Set the evaluator that is tried before evaluating fields on the CPU. Null by default.
+ * The evaluator has to stay alive until it is unset again.
+ */
+void set_external_field_evaluator(const ExternalFieldEvaluator *evaluator);
+
 /* -------------------------------------------------------------------- */
 /** \name Utility functions for simple field creation and evaluation
  * \{ */
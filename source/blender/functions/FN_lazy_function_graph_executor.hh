@@ -11,6 +11,8 @@
  * another #Graph again).
  */
 
+#include <chrono>
+
 #include "BLI_vector.hh"
 #include "BLI_vector_set.hh"
 
@@ -29,6 +31,14 @@ class GraphExecutorLogger {
                                 GPointer value,
                                 const Context &context) const;
 
+  /**
+   * Called before a node is executed with the time it was waiting to be executed since it has
+   * been scheduled. A long queue time with few threads in use indicates a lack of parallelism.
+   */
+  virtual void log_node_queue_time(const FunctionNode &node,
+                                   std::chrono::nanoseconds duration,
+                                   const Context &context) const;
+
   virtual void log_before_node_execute(const FunctionNode &node,
                                        const Params &params,
                                        const Context &context) const;
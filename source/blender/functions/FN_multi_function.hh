@@ -114,6 +114,11 @@ class MultiFunction : NonCopyable, NonMovable {
      * memory usage.
      */
     bool allocates_array = false;
+    /**
+     * Maximum number of indices that are processed at once when #allocates_array is true. Smaller
+     * values make it more likely that the allocated arrays stay in the CPU cache.
+     */
+    int64_t max_grain_size = 10000;
     /**
      * Tells the caller that every execution takes about the same time. This helps making a more
      * educated guess about a good grain size.
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <atomic>
+
 #include "BLI_array_utils.hh"
 #include "BLI_map.hh"
 #include "BLI_multi_value_map.hh"
@@ -278,6 +280,121 @@ static void build_multi_function_procedure_for_fields(mf::Procedure &procedure,
   BLI_assert(procedure.validate());
 }
 
+/**
+ * Evaluate the procedure in chunks, for outputs that have to be written into virtual arrays which
+ * are not spans. The results of each chunk are copied into the destination while they are still
+ * in the CPU cache, instead of materializing the full array first. Outputs with a span are passed
+ * in #output_spans, all others in #output_varrays.
+ */
+static void evaluate_procedure_in_chunks(const mf::ProcedureExecutor &procedure_executor,
+                                         const IndexMask &mask,
+                                         const Span<GVArray> inputs,
+                                         const Span<GMutableSpan> output_spans,
+                                         const MutableSpan<GVMutableArray> output_varrays)
+{
+  const int64_t grain_size = procedure_executor.execution_hints().max_grain_size;
+  threading::parallel_for(mask.index_range(), grain_size, [&](const IndexRange range) {
+    const IndexMask sliced_mask = mask.slice(range);
+    const IndexRange input_range = IndexRange::from_begin_end_inclusive(sliced_mask.first(),
+                                                                        sliced_mask.last());
+    IndexMaskMemory memory;
+    const IndexMask shifted_mask = mask.slice_and_shift(range, -input_range.start(), memory);
+
+    mf::ParamsBuilder mf_params{procedure_executor, &shifted_mask};
+    mf::ContextBuilder mf_context;
+    for (const GVArray &varray : inputs) {
+      mf_params.add_readonly_single_input(varray.slice(input_range));
+    }
+
+    LinearAllocator<> allocator;
+    Array<GMutableSpan> chunk_outputs(output_spans.size());
+    for (const int i : output_spans.index_range()) {
+      if (output_varrays[i]) {
+        const CPPType &type = output_varrays[i].type();
+        void *buffer = allocator.allocate(type.size() * input_range.size(), type.alignment());
+        chunk_outputs[i] = GMutableSpan(type, buffer, input_range.size());
+      }
+      else {
+        chunk_outputs[i] = output_spans[i].slice(input_range);
+      }
+      mf_params.add_uninitialized_single_output(chunk_outputs[i]);
+    }
+
+    procedure_executor.call(shifted_mask, mf_params, mf_context);
+
+    for (const int i : output_spans.index_range()) {
+      if (output_varrays[i]) {
+        shifted_mask.foreach_index([&](const int64_t index) {
+          output_varrays[i].set_by_relocate(index + input_range.start(), chunk_outputs[i][index]);
+        });
+      }
+    }
+  });
+}
+
+static std::atomic<const ExternalFieldEvaluator *> external_field_evaluator = nullptr;
+
+void set_external_field_evaluator(const ExternalFieldEvaluator *evaluator)
+{
+  external_field_evaluator.store(evaluator);
+}
+
+/**
+ * Try to evaluate the varying fields with the external evaluator. On success, the results are
+ * copied into the destination arrays if there are any.
+ */
+static bool try_evaluate_fields_externally(
+    ResourceScope &scope,
+    const FieldTreeInfo &field_tree_info,
+    const Span<GVArray> field_context_inputs,
+    const Span<GFieldRef> varying_fields_to_evaluate,
+    const Span<int> varying_field_indices,
+    const IndexMask &mask,
+    const FunctionRef<GVMutableArray(int)> get_dst_varray,
+    MutableSpan<GVArray> r_varrays,
+    MutableSpan<bool> is_output_written_to_dst)
+{
+  const ExternalFieldEvaluator *evaluator = external_field_evaluator.load();
+  if (evaluator == nullptr) {
+    return false;
+  }
+  Array<GVArray> results(varying_fields_to_evaluate.size());
+  const bool success = evaluator->try_evaluate(
+      scope,
+      varying_fields_to_evaluate,
+      mask,
+      [&](const FieldInput &field_input) -> const GVArray & {
+        return field_context_inputs[field_tree_info.deduplicated_field_inputs.index_of(
+            field_input)];
+      },
+      results);
+  if (!success) {
+    return false;
+  }
+  for (const int i : varying_fields_to_evaluate.index_range()) {
+    const int out_index = varying_field_indices[i];
+    GVMutableArray dst_varray = get_dst_varray(out_index);
+    if (!dst_varray) {
+      r_varrays[out_index] = std::move(results[i]);
+      continue;
+    }
+    if (dst_varray.is_span()) {
+      array_utils::copy(results[i], mask, dst_varray.get_internal_span());
+    }
+    else {
+      const CPPType &type = dst_varray.type();
+      BUFFER_FOR_CPP_TYPE_VALUE(type, buffer);
+      mask.foreach_index([&](const int64_t index) {
+        results[i].get_to_uninitialized(index, buffer);
+        dst_varray.set_by_relocate(index, buffer);
+      });
+    }
+    r_varrays[out_index] = dst_varray;
+    is_output_written_to_dst[out_index] = true;
+  }
+  return true;
+}
+
 Vector<GVArray> evaluate_fields(ResourceScope &scope,
                                 Span<GFieldRef> fields_to_evaluate,
                                 const IndexMask &mask,
@@ -366,20 +483,28 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
   }
 
   /* Evaluate varying fields if necessary. */
-  if (!varying_fields_to_evaluate.is_empty()) {
+  if (!varying_fields_to_evaluate.is_empty() &&
+      !try_evaluate_fields_externally(scope,
+                                      field_tree_info,
+                                      field_context_inputs,
+                                      varying_fields_to_evaluate,
+                                      varying_field_indices,
+                                      mask,
+                                      get_dst_varray,
+                                      r_varrays,
+                                      is_output_written_to_dst))
+  {
     /* Build the procedure for those fields. */
     mf::Procedure procedure;
     build_multi_function_procedure_for_fields(
         procedure, scope, field_tree_info, varying_fields_to_evaluate);
     mf::ProcedureExecutor procedure_executor{procedure};
 
-    mf::ParamsBuilder mf_params{procedure_executor, &mask};
-    mf::ContextBuilder mf_context;
-
-    /* Provide inputs to the procedure executor. */
-    for (const GVArray &varray : field_context_inputs) {
-      mf_params.add_readonly_single_input(varray);
-    }
+    /* Outputs which are written into spans, and into destination virtual arrays that are not
+     * spans. */
+    Array<GMutableSpan> output_spans(varying_fields_to_evaluate.size());
+    Array<GVMutableArray> output_varrays(varying_fields_to_evaluate.size());
+    bool has_output_varrays = false;
 
     for (const int i : varying_fields_to_evaluate.index_range()) {
       const GFieldRef &field = varying_fields_to_evaluate[i];
@@ -388,8 +513,17 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
 
       /* Try to get an existing virtual array that the result should be written into. */
       GVMutableArray dst_varray = get_dst_varray(out_index);
+      if (dst_varray && !dst_varray.is_span()) {
+        /* Write the result into the destination chunk by chunk. */
+        output_varrays[i] = dst_varray;
+        output_spans[i] = GMutableSpan(type);
+        has_output_varrays = true;
+        r_varrays[out_index] = dst_varray;
+        is_output_written_to_dst[out_index] = true;
+        continue;
+      }
       void *buffer;
-      if (!dst_varray || !dst_varray.is_span()) {
+      if (!dst_varray) {
         /* Allocate a new buffer for the computed result. */
         buffer = scope.linear_allocator().allocate(type.size() * array_size, type.alignment());
 
@@ -409,12 +543,27 @@ Vector<GVArray> evaluate_fields(ResourceScope &scope,
         is_output_written_to_dst[out_index] = true;
       }
 
-      /* Pass output buffer to the procedure executor. */
-      const GMutableSpan span{type, buffer, array_size};
-      mf_params.add_uninitialized_single_output(span);
+      output_spans[i] = GMutableSpan(type, buffer, array_size);
     }
 
-    procedure_executor.call_auto(mask, mf_params, mf_context);
+    if (has_output_varrays) {
+      evaluate_procedure_in_chunks(
+          procedure_executor, mask, field_context_inputs, output_spans, output_varrays);
+    }
+    else {
+      mf::ParamsBuilder mf_params{procedure_executor, &mask};
+      mf::ContextBuilder mf_context;
+
+      /* Provide inputs and output buffers to the procedure executor. */
+      for (const GVArray &varray : field_context_inputs) {
+        mf_params.add_readonly_single_input(varray);
+      }
+      for (const GMutableSpan &span : output_spans) {
+        mf_params.add_uninitialized_single_output(span);
+      }
+
+      procedure_executor.call_auto(mask, mf_params, mf_context);
+    }
   }
 
   /* Evaluate constant fields if necessary. */
@@ -41,6 +41,7 @@
  * starts again.
  */
 
+#include <chrono>
 #include <mutex>
 #include <sstream>
 
@@ -184,6 +185,11 @@ struct NodeState {
    * Custom storage of the node.
    */
   void *storage = nullptr;
+  /**
+   * When the node was scheduled the last time. Only set when there is a logger, which is told how
+   * long the node had to wait until it was executed.
+   */
+  std::chrono::steady_clock::time_point schedule_time;
 };
 
 /**
@@ -741,6 +747,9 @@ class Executor {
     switch (locked_node.node_state.schedule_state) {
       case NodeScheduleState::NotScheduled: {
         locked_node.node_state.schedule_state = NodeScheduleState::Scheduled;
+        if (self_.logger_ != nullptr) {
+          locked_node.node_state.schedule_time = std::chrono::steady_clock::now();
+        }
         const FunctionNode &node = static_cast<const FunctionNode &>(locked_node.node);
         if (this->use_multi_threading()) {
           std::lock_guard lock{current_task.mutex};
@@ -1122,13 +1131,17 @@ class Executor {
     }
 
     const Span<const InputSocket *> targets = from_socket.targets();
+    /* The value is moved into the last target that uses it, all other targets get a copy. When
+     * a copy is still referenced while another node modifies its value, the data has to be
+     * copied (e.g. a geometry that is passed from one repeat zone iteration to the next). Whether
+     * a target uses the value is only known once its node is locked, so passing the value to a
+     * target is delayed until it is known that there are no other users. */
+    const InputSocket *pending_target = nullptr;
     for (const InputSocket *target_socket : targets) {
-      const Node &target_node = target_socket->node();
-      NodeState &node_state = *node_states_[target_node.index_in_graph()];
-      const int input_index = target_socket->index();
-      InputState &input_state = node_state.inputs[input_index];
-      const bool is_last_target = target_socket == targets.last();
 #ifndef NDEBUG
+      const Node &target_node = target_socket->node();
+      const InputState &input_state =
+          node_states_[target_node.index_in_graph()]->inputs[target_socket->index()];
       if (input_state.value != nullptr) {
         if (self_.logger_ != nullptr) {
           self_.logger_->dump_when_input_is_set_twice(*target_socket, from_socket, local_context);
@@ -1136,54 +1149,109 @@ class Executor {
         BLI_assert_unreachable();
       }
 #endif
-      BLI_assert(!input_state.was_ready_for_execution);
       BLI_assert(target_socket->type() == type);
       BLI_assert(target_socket->origin() == &from_socket);
 
       if (self_.logger_ != nullptr) {
         self_.logger_->log_socket_value(*target_socket, value_to_forward, local_context);
       }
-      if (target_node.is_interface()) {
-        /* Forward the value to the outside of the graph. */
-        const int graph_output_index =
-            self_.graph_output_index_by_socket_index_[target_socket->index()];
-        if (graph_output_index != -1 &&
-            params_->get_output_usage(graph_output_index) != ValueUsage::Unused)
-        {
-          void *dst_buffer = params_->get_output_data_ptr(graph_output_index);
-          if (is_last_target) {
-            type.move_construct(value_to_forward.get(), dst_buffer);
-          }
-          else {
-            type.copy_construct(value_to_forward.get(), dst_buffer);
-          }
-          params_->output_set(graph_output_index);
-        }
+      if (targets.size() == 1) {
+        /* Avoid locking the target node twice in the common case. */
+        this->forward_value_to_target(
+            *target_socket, value_to_forward, true, current_task, local_data);
+        break;
+      }
+      if (!this->target_uses_value(*target_socket, current_task, local_data)) {
         continue;
       }
-      this->with_locked_node(
-          target_node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
-            if (input_state.usage == ValueUsage::Unused) {
-              return;
-            }
-            if (is_last_target) {
-              /* No need to make a copy if this is the last target. */
-              this->forward_value_to_input(
-                  locked_node, input_state, value_to_forward, current_task);
-              value_to_forward = {};
-            }
-            else {
-              void *buffer = local_data.allocator->allocate(type.size(), type.alignment());
-              type.copy_construct(value_to_forward.get(), buffer);
-              this->forward_value_to_input(locked_node, input_state, {type, buffer}, current_task);
-            }
-          });
+      if (pending_target != nullptr) {
+        this->forward_value_to_target(
+            *pending_target, value_to_forward, false, current_task, local_data);
+      }
+      pending_target = target_socket;
+    }
+    if (pending_target != nullptr) {
+      this->forward_value_to_target(
+          *pending_target, value_to_forward, true, current_task, local_data);
     }
     if (value_to_forward.get() != nullptr) {
       value_to_forward.destruct();
     }
   }
 
+  bool target_uses_value(const InputSocket &target_socket,
+                         CurrentTask &current_task,
+                         const LocalData &local_data)
+  {
+    const Node &target_node = target_socket.node();
+    if (target_node.is_interface()) {
+      const int graph_output_index =
+          self_.graph_output_index_by_socket_index_[target_socket.index()];
+      return graph_output_index != -1 &&
+             params_->get_output_usage(graph_output_index) != ValueUsage::Unused;
+    }
+    NodeState &node_state = *node_states_[target_node.index_in_graph()];
+    const InputState &input_state = node_state.inputs[target_socket.index()];
+    bool is_used = false;
+    this->with_locked_node(
+        target_node, node_state, current_task, local_data, [&](LockedNode & /*locked_node*/) {
+          is_used = input_state.usage != ValueUsage::Unused;
+        });
+    return is_used;
+  }
+
+  /**
+   * Pass the value to the target socket if it still uses it. When moving, the value is reset
+   * once it has been passed on.
+   */
+  void forward_value_to_target(const InputSocket &target_socket,
+                               GMutablePointer &value_to_forward,
+                               const bool move,
+                               CurrentTask &current_task,
+                               const LocalData &local_data)
+  {
+    const CPPType &type = *value_to_forward.type();
+    const Node &target_node = target_socket.node();
+    if (target_node.is_interface()) {
+      /* Forward the value to the outside of the graph. */
+      const int graph_output_index =
+          self_.graph_output_index_by_socket_index_[target_socket.index()];
+      if (graph_output_index != -1 &&
+          params_->get_output_usage(graph_output_index) != ValueUsage::Unused)
+      {
+        void *dst_buffer = params_->get_output_data_ptr(graph_output_index);
+        if (move) {
+          type.move_construct(value_to_forward.get(), dst_buffer);
+        }
+        else {
+          type.copy_construct(value_to_forward.get(), dst_buffer);
+        }
+        params_->output_set(graph_output_index);
+      }
+      return;
+    }
+    NodeState &node_state = *node_states_[target_node.index_in_graph()];
+    InputState &input_state = node_state.inputs[target_socket.index()];
+    this->with_locked_node(
+        target_node, node_state, current_task, local_data, [&](LockedNode &locked_node) {
+          BLI_assert(!input_state.was_ready_for_execution);
+          if (input_state.usage == ValueUsage::Unused) {
+            return;
+          }
+          if (move) {
+            /* No need to make a copy if this is the last target. */
+            this->forward_value_to_input(
+                locked_node, input_state, value_to_forward, current_task);
+            value_to_forward = {};
+          }
+          else {
+            void *buffer = local_data.allocator->allocate(type.size(), type.alignment());
+            type.copy_construct(value_to_forward.get(), buffer);
+            this->forward_value_to_input(locked_node, input_state, {type, buffer}, current_task);
+          }
+        });
+  }
+
   void forward_value_to_input(LockedNode &locked_node,
                               InputState &input_state,
                               GMutablePointer value,
@@ -1431,6 +1499,8 @@ inline void Executor::execute_node(const FunctionNode &node,
   Context fn_context(node_state.storage, context_->user_data, local_data.local_user_data);
 
   if (self_.logger_ != nullptr) {
+    self_.logger_->log_node_queue_time(
+        node, std::chrono::steady_clock::now() - node_state.schedule_time, fn_context);
     self_.logger_->log_before_node_execute(node, node_params, fn_context);
   }
 
@@ -1555,6 +1625,13 @@ void GraphExecutorLogger::log_socket_value(const Socket &socket,
   UNUSED_VARS(socket, value, context);
 }
 
+void GraphExecutorLogger::log_node_queue_time(const FunctionNode &node,
+                                              const std::chrono::nanoseconds duration,
+                                              const Context &context) const
+{
+  UNUSED_VARS(node, duration, context);
+}
+
 void GraphExecutorLogger::log_before_node_execute(const FunctionNode &node,
                                                   const Params &params,
                                                   const Context &context) const
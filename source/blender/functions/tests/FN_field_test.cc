@@ -5,6 +5,7 @@
 #include "testing/testing.h"
 
 #include "BLI_cpp_type.hh"
+#include "BLI_math_vector_types.hh"
 #include "FN_field.hh"
 #include "FN_multi_function_builder.hh"
 #include "FN_multi_function_test_common.hh"
@@ -123,6 +124,42 @@ TEST(field, InputAndFunction)
   EXPECT_EQ(result[8], 16);
 }
 
+static int get_x(const int2 &value)
+{
+  return value.x;
+}
+
+static void set_x(int2 &value, const int x)
+{
+  value.x = x;
+}
+
+TEST(field, NonSpanDestination)
+{
+  GField index_field{std::make_shared<IndexFieldInput>()};
+
+  auto add_fn = mf::build::SI2_SO<int, int, int>("add", [](int a, int b) { return a + b; });
+  GField output_field{FieldOperation::Create(add_fn, {index_field, index_field}), 0};
+
+  /* Large enough to be evaluated in multiple chunks. */
+  const int size = 100000;
+  Array<int2> values(size, int2(-1));
+
+  IndexMaskMemory memory;
+  const IndexMask mask = IndexMask::from_predicate(
+      IndexRange(size), GrainSize(4096), memory, [](const int64_t i) { return i % 3 != 0; });
+
+  FieldContext context;
+  FieldEvaluator evaluator{context, &mask};
+  evaluator.add_with_destination(
+      output_field, VMutableArray<int>::ForDerivedSpan<int2, get_x, set_x>(values));
+  evaluator.evaluate();
+  for (const int i : values.index_range()) {
+    EXPECT_EQ(values[i].x, i % 3 != 0 ? i * 2 : -1);
+    EXPECT_EQ(values[i].y, -1);
+  }
+}
+
 TEST(field, TwoFunctions)
 {
   GField index_field{std::make_shared<IndexFieldInput>()};
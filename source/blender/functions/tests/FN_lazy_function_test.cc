@@ -179,4 +179,83 @@ TEST(lazy_function, GraphWithCycle)
   EXPECT_EQ(result, 10 * 2 * 5);
 }
 
+class MakeStringFunction : public LazyFunction {
+ private:
+  const char **r_data_;
+
+ public:
+  MakeStringFunction(const char **r_data) : r_data_(r_data)
+  {
+    debug_name_ = "Make String";
+    outputs_.append_as("String", CPPType::get<std::string>());
+  }
+
+  void execute_impl(Params &params, const Context & /*context*/) const override
+  {
+    /* Long enough to not use the small string optimization. */
+    std::string str(1000, 'a');
+    *r_data_ = str.data();
+    params.set_output(0, std::move(str));
+  }
+};
+
+class CheckStringDataFunction : public LazyFunction {
+ private:
+  const char **data_;
+
+ public:
+  CheckStringDataFunction(const char **data) : data_(data)
+  {
+    debug_name_ = "Check String Data";
+    inputs_.append_as("String", CPPType::get<std::string>());
+    outputs_.append_as("Is Same Data", CPPType::get<bool>());
+  }
+
+  void execute_impl(Params &params, const Context & /*context*/) const override
+  {
+    const std::string &str = params.get_input<std::string>(0);
+    params.set_output(0, str.data() == *data_);
+  }
+};
+
+TEST(lazy_function, MoveIntoLastUsedTarget)
+{
+  const char *data = nullptr;
+  const MakeStringFunction make_fn{&data};
+  const CheckStringDataFunction check_fn{&data};
+
+  Graph graph;
+  FunctionNode &make_node = graph.add_function(make_fn);
+  FunctionNode &check_node = graph.add_function(check_fn);
+  GraphOutputSocket &check_output = graph.add_output(CPPType::get<bool>());
+  GraphOutputSocket &string_output = graph.add_output(CPPType::get<std::string>());
+
+  graph.add_link(make_node.output(0), check_node.input(0));
+  graph.add_link(make_node.output(0), string_output);
+  graph.add_link(check_node.output(0), check_output);
+  graph.update_node_indices();
+
+  GraphExecutor executor_fn{
+      graph, {}, {&check_output, &string_output}, nullptr, nullptr, nullptr};
+
+  /* The string output is not used, so the value should be moved into the other target instead of
+   * being copied. */
+  bool is_same_data = false;
+  std::string unused_str;
+  Array<GMutablePointer> outputs = {&is_same_data, &unused_str};
+  Array<ValueUsage> output_usages = {ValueUsage::Used, ValueUsage::Unused};
+  Array<bool> set_outputs(2, false);
+  BasicParams params{executor_fn, {}, outputs, {}, output_usages, set_outputs};
+
+  LinearAllocator<> allocator;
+  void *storage = executor_fn.init_storage(allocator);
+  const Context context{storage, nullptr, nullptr};
+  executor_fn.execute(params, context);
+  executor_fn.destruct_storage(storage);
+
+  EXPECT_TRUE(set_outputs[0]);
+  EXPECT_FALSE(set_outputs[1]);
+  EXPECT_TRUE(is_same_data);
+}
+
 }  // namespace blender::fn::lazy_function::tests
@@ -0,0 +1,32 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+#include "BLI_index_mask.hh"
+#include "BLI_math_vector_types.hh"
+
+/** \file
+ * \ingroup geo
+ */
+
+namespace blender::geometry {
+
+/**
+ * Find the selected points that are within \a merge_distance of another selected point. This
+ * gives the same result as #BLI_kdtree_3d_calc_duplicates_fast with index order: points are
+ * visited in ascending index order and every point that hasn't been merged yet claims all
+ * unclaimed points in range. Large inputs are searched in parallel with a uniform grid.
+ *
+ * \param r_duplicates: Aligned with \a positions, the values of selected points must be
+ * initialized to -1. Merged points are set to the index of their target, targets that claimed
+ * any point are set to their own index, other values are unchanged.
+ * \returns The number of merged points.
+ */
+int calc_duplicates_by_distance(Span<float3> positions,
+                                const IndexMask &selection,
+                                float merge_distance,
+                                MutableSpan<int> r_duplicates);
+
+}  // namespace blender::geometry
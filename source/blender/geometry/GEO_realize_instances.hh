@@ -70,4 +70,18 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                    const RealizeInstancesOptions &options,
                                    const VariedDepthOptions &varied_depth_option);
 
+/**
+ * Same as #realize_instances, but the realized mesh is passed to \a fn in chunks of at most
+ * \a max_chunk_faces_num faces instead of being joined, so that consumers which process the
+ * result piece by piece (e.g. exporters) don't need memory for the entire mesh. Every chunk is
+ * freed before the next one is created, unless \a fn keeps a reference to it. A chunk only has
+ * more faces when a single instance is larger.
+ *
+ * All other geometry types are realized as usual and passed to \a fn in a last geometry set.
+ */
+void realize_instances_chunked(bke::GeometrySet geometry_set,
+                               const RealizeInstancesOptions &options,
+                               int64_t max_chunk_faces_num,
+                               FunctionRef<void(bke::GeometrySet chunk)> fn);
+
 }  // namespace blender::geometry
@@ -0,0 +1,255 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <algorithm>
+
+#include "BLI_array_utils.hh"
+#include "BLI_bounds.hh"
+#include "BLI_kdtree.h"
+#include "BLI_math_vector.hh"
+#include "BLI_offset_indices.hh"
+#include "BLI_sort.hh"
+#include "BLI_task.hh"
+#include "BLI_vector.hh"
+
+#include "GEO_calc_duplicates.hh"
+
+namespace blender::geometry {
+
+/** Building the grid is not worth it compared to the serial KD tree search for fewer points. */
+static constexpr int64_t grid_min_points_num = 16384;
+/** The coordinates of a cell on each axis are packed into 21 bits of its key. */
+static constexpr int grid_axis_bits = 21;
+static constexpr int64_t grid_max_cells_per_axis = int64_t(1) << grid_axis_bits;
+/** Number of points that share one list of neighbors. */
+static constexpr int64_t chunk_size = 4096;
+/**
+ * Average number of other points in the same cell above which the KD tree is used instead. The
+ * neighbor lists grow with the number of points in range, so dense clusters would use a lot of
+ * memory and time.
+ */
+static constexpr int64_t grid_max_points_per_cell_avg = 32;
+
+static int calc_duplicates_kdtree(const Span<float3> positions,
+                                  const IndexMask &selection,
+                                  const float merge_distance,
+                                  MutableSpan<int> r_duplicates)
+{
+  KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
+  selection.foreach_index([&](const int64_t i) { BLI_kdtree_3d_insert(tree, i, positions[i]); });
+  BLI_kdtree_3d_balance(tree);
+  const int duplicates_num = BLI_kdtree_3d_calc_duplicates_fast(
+      tree, merge_distance, true, r_duplicates.data());
+  BLI_kdtree_3d_free(tree);
+  return duplicates_num;
+}
+
+namespace {
+
+/**
+ * A uniform grid with cells as large as the merge distance, so the points in range of a point are
+ * in a small block of cells around it. Only the occupied cells are stored, as runs of equal keys in
+ * the sorted key array.
+ */
+struct PointGrid {
+  float3 min;
+  float inv_cell_size;
+  int3 dims;
+  Array<uint64_t> sorted_keys;
+  Array<int> sorted_points;
+
+  int3 cell_of(const float3 &position) const
+  {
+    int3 cell;
+    for (const int axis : IndexRange(3)) {
+      const float coord = (position[axis] - this->min[axis]) * this->inv_cell_size;
+      /* Written such that NaN coordinates end up in a valid cell too. */
+      if (!(coord >= 0.0f)) {
+        cell[axis] = 0;
+      }
+      else if (!(coord < float(this->dims[axis]))) {
+        cell[axis] = this->dims[axis] - 1;
+      }
+      else {
+        cell[axis] = int(coord);
+      }
+    }
+    return cell;
+  }
+
+  static uint64_t key_of(const int3 &cell)
+  {
+    return uint64_t(cell.x) | (uint64_t(cell.y) << grid_axis_bits) |
+           (uint64_t(cell.z) << (grid_axis_bits * 2));
+  }
+
+  /**
+   * The points in the cells from \a x_begin to \a x_end (inclusive) of a row. Since the x
+   * coordinate is stored in the lowest bits of the key, the cells of a row are contiguous.
+   */
+  Span<int> row_points(const int x_begin, const int x_end, const int y, const int z) const
+  {
+    const uint64_t *begin = std::lower_bound(
+        this->sorted_keys.begin(), this->sorted_keys.end(), key_of({x_begin, y, z}));
+    const uint64_t *end = std::upper_bound(begin, this->sorted_keys.end(), key_of({x_end, y, z}));
+    return this->sorted_points.as_span().slice(begin - this->sorted_keys.begin(), end - begin);
+  }
+};
+
+/** The points in range with a smaller index, for every point of a chunk. */
+struct ChunkNeighbors {
+  Vector<int> offsets;
+  Vector<int> indices;
+};
+
+}  // namespace
+
+static std::optional<PointGrid> build_grid(const Span<float3> points, const float merge_distance)
+{
+  const Bounds<float3> bounds = *bounds::min_max(points);
+  const float cell_size = merge_distance;
+  const float3 extent = (bounds.max - bounds.min) / cell_size;
+  /* Also handles non-finite positions. */
+  if (!(math::reduce_max(extent) < float(grid_max_cells_per_axis - 1))) {
+    return std::nullopt;
+  }
+
+  PointGrid grid;
+  grid.min = bounds.min;
+  grid.inv_cell_size = 1.0f / cell_size;
+  grid.dims = int3(extent) + int3(1);
+
+  Array<uint64_t> keys(points.size());
+  threading::parallel_for(points.index_range(), 4096, [&](const IndexRange range) {
+    for (const int i : range) {
+      keys[i] = PointGrid::key_of(grid.cell_of(points[i]));
+    }
+  });
+
+  grid.sorted_points.reinitialize(points.size());
+  array_utils::fill_index_range<int>(grid.sorted_points);
+  parallel_sort(grid.sorted_points.begin(),
+                grid.sorted_points.end(),
+                [&](const int a, const int b) { return keys[a] < keys[b]; });
+
+  grid.sorted_keys.reinitialize(points.size());
+  array_utils::gather(
+      keys.as_span(), grid.sorted_points.as_span(), grid.sorted_keys.as_mutable_span());
+  return grid;
+}
+
+/**
+ * Check if the neighbor lists would become too large. Searching a cell visits the points of the
+ * surrounding cells as well, but that work is bounded by a constant factor of the sum of the squared
+ * point counts of every cell.
+ */
+static bool grid_is_too_dense(const PointGrid &grid)
+{
+  const Span<uint64_t> keys = grid.sorted_keys;
+  const int64_t max_work = keys.size() * grid_max_points_per_cell_avg;
+  int64_t work = 0;
+  int64_t run_start = 0;
+  for (const int64_t i : keys.index_range().drop_front(1)) {
+    if (keys[i] != keys[run_start]) {
+      work += (i - run_start) * (i - run_start);
+      run_start = i;
+    }
+  }
+  work += (keys.size() - run_start) * (keys.size() - run_start);
+  return work > max_work;
+}
+
+static void find_lower_neighbors(const PointGrid &grid,
+                                 const Span<float3> points,
+                                 const float merge_distance,
+                                 const IndexRange range,
+                                 ChunkNeighbors &r_neighbors)
+{
+  const float range_sq = square_f(merge_distance);
+  /* The cells to search are found with the same rounding as the cells of the points, which
+   * accounts for the precision of the cell coordinates far from the grid origin. The distance is
+   * padded for the rounding of the distance check itself. */
+  const float3 search_distance(merge_distance * 1.0001f);
+  r_neighbors.offsets.reserve(range.size() + 1);
+  r_neighbors.offsets.append(0);
+  for (const int i : range) {
+    const float3 &position = points[i];
+    const int3 cell_min = grid.cell_of(position - search_distance);
+    const int3 cell_max = grid.cell_of(position + search_distance);
+    for (int z = cell_min.z; z <= cell_max.z; z++) {
+      for (int y = cell_min.y; y <= cell_max.y; y++) {
+        for (const int other : grid.row_points(cell_min.x, cell_max.x, y, z)) {
+          if (other < i && math::distance_squared(position, points[other]) <= range_sq) {
+            r_neighbors.indices.append(other);
+          }
+        }
+      }
+    }
+    r_neighbors.offsets.append(r_neighbors.indices.size());
+  }
+}
+
+int calc_duplicates_by_distance(const Span<float3> positions,
+                                const IndexMask &selection,
+                                const float merge_distance,
+                                MutableSpan<int> r_duplicates)
+{
+  if (selection.size() < grid_min_points_num || !(merge_distance > 0.0f)) {
+    return calc_duplicates_kdtree(positions, selection, merge_distance, r_duplicates);
+  }
+
+  /* Work with indices into the selection, they are in the same order as the source indices. */
+  Array<int> src_indices(selection.size());
+  selection.to_indices<int>(src_indices);
+  Array<float3> points(selection.size());
+  array_utils::gather(positions, src_indices.as_span(), points.as_mutable_span());
+
+  const std::optional<PointGrid> grid = build_grid(points, merge_distance);
+  if (!grid || grid_is_too_dense(*grid)) {
+    return calc_duplicates_kdtree(positions, selection, merge_distance, r_duplicates);
+  }
+
+  /* The spatial searches are independent, so they can run in parallel. Only the points with a
+   * smaller index are relevant, since those are visited first. */
+  const IndexRange all_points = points.index_range();
+  Array<ChunkNeighbors> chunks(divide_ceil_ul(points.size(), chunk_size));
+  threading::parallel_for(chunks.index_range(), 1, [&](const IndexRange range) {
+    for (const int chunk : range) {
+      const IndexRange chunk_points = all_points.drop_front(chunk * chunk_size).take_front(
+          chunk_size);
+      find_lower_neighbors(*grid, points, merge_distance, chunk_points, chunks[chunk]);
+    }
+  });
+
+  /* Choosing the targets depends on the choices for the previous points, but it only has to look
+   * at the neighbors that were found above. A point is merged into the first target in range,
+   * and becomes a target itself when there is none. */
+  Array<bool> is_target(points.size(), false);
+  int duplicates_num = 0;
+  for (const int chunk : chunks.index_range()) {
+    const OffsetIndices<int> offsets = chunks[chunk].offsets.as_span();
+    const Span<int> neighbors = chunks[chunk].indices;
+    const int chunk_start = chunk * chunk_size;
+    for (const int local_i : offsets.index_range()) {
+      const int i = chunk_start + local_i;
+      int target = -1;
+      for (const int other : neighbors.slice(offsets[local_i])) {
+        if (is_target[other] && (target == -1 || other < target)) {
+          target = other;
+        }
+      }
+      if (target == -1) {
+        is_target[i] = true;
+        continue;
+      }
+      const int src_target = src_indices[target];
+      r_duplicates[src_indices[i]] = src_target;
+      r_duplicates[src_target] = src_target;
+      duplicates_num++;
+    }
+  }
+  return duplicates_num;
+}
+
+}  // namespace blender::geometry
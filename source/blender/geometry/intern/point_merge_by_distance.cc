@@ -3,7 +3,6 @@
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
 #include "BLI_array_utils.hh"
-#include "BLI_kdtree.h"
 #include "BLI_offset_indices.hh"
 #include "BLI_task.hh"
 
@@ -12,6 +11,7 @@
 #include "BKE_attribute_math.hh"
 #include "BKE_pointcloud.hh"
 
+#include "GEO_calc_duplicates.hh"
 #include "GEO_point_merge_by_distance.hh"
 #include "GEO_randomize.hh"
 
@@ -26,20 +26,9 @@ PointCloud *point_merge_by_distance(const PointCloud &src_points,
   const Span<float3> positions = src_points.positions();
   const int src_size = positions.size();
 
-  /* Create the KD tree based on only the selected points, to speed up merge detection and
-   * balancing. */
-  KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
-  selection.foreach_index_optimized<int64_t>(
-      [&](const int64_t i, const int64_t pos) { BLI_kdtree_3d_insert(tree, pos, positions[i]); });
-  BLI_kdtree_3d_balance(tree);
-
-  /* Find the duplicates in the KD tree. Because the tree only contains the selected points, the
-   * resulting indices are indices into the selection, rather than indices of the source point
-   * cloud. */
-  Array<int> selection_merge_indices(selection.size(), -1);
-  const int duplicate_count = BLI_kdtree_3d_calc_duplicates_fast(
-      tree, merge_distance, false, selection_merge_indices.data());
-  BLI_kdtree_3d_free(tree);
+  Array<int> duplicates(src_size, -1);
+  const int duplicate_count = calc_duplicates_by_distance(
+      positions, selection, merge_distance, duplicates);
 
   /* Create the new point cloud and add it to a temporary component for the attribute API. */
   const int dst_size = src_size - duplicate_count;
@@ -47,16 +36,14 @@ PointCloud *point_merge_by_distance(const PointCloud &src_points,
   bke::MutableAttributeAccessor dst_attributes = dst_pointcloud->attributes_for_write();
 
   /* By default, every point is just "merged" with itself. Then fill in the results of the merge
-   * finding, converting from indices into the selection to indices into the full input point
-   * cloud. */
+   * finding. */
   Array<int> merge_indices(src_size);
   array_utils::fill_index_range<int>(merge_indices);
 
-  selection.foreach_index([&](const int src_index, const int pos) {
-    const int merge_index = selection_merge_indices[pos];
+  selection.foreach_index([&](const int src_index) {
+    const int merge_index = duplicates[src_index];
     if (merge_index != -1) {
-      const int src_merge_index = selection[merge_index];
-      merge_indices[src_index] = src_merge_index;
+      merge_indices[src_index] = merge_index;
     }
   });
 
@@ -1179,6 +1179,25 @@ static void execute_realize_pointcloud_task(
       dst_attribute_writers);
 }
 
+/**
+ * The single geometry code paths below copy the original geometry with all its attributes. Remove
+ * the ones that are not used afterwards, so that they are not kept alive or processed by later
+ * operations on the result.
+ */
+static void remove_skipped_attributes(const bke::AttributeFilter &attribute_filter,
+                                      bke::MutableAttributeAccessor attributes)
+{
+  Vector<std::string> names_to_remove;
+  attributes.foreach_attribute([&](const bke::AttributeIter &iter) {
+    if (!iter.is_builtin && attribute_filter.allow_skip(iter.name)) {
+      names_to_remove.append(iter.name);
+    }
+  });
+  for (const StringRef name : names_to_remove) {
+    attributes.remove(name);
+  }
+}
+
 static void add_instance_attributes_to_single_geometry(
     const OrderedAttributes &ordered_attributes,
     const AttributeFallbacksArray &attribute_fallbacks,
@@ -1216,6 +1235,7 @@ static void execute_realize_pointcloud_tasks(const RealizeInstancesOptions &opti
       transform_positions(task.transform, new_points->positions_for_write());
       new_points->tag_positions_changed();
     }
+    remove_skipped_attributes(options.attribute_filter, new_points->attributes_for_write());
     add_instance_attributes_to_single_geometry(
         ordered_attributes, task.attribute_fallbacks, new_points->attributes_for_write());
     r_realized_geometry.replace_pointcloud(new_points);
@@ -1545,6 +1565,7 @@ static void execute_realize_mesh_tasks(const RealizeInstancesOptions &options,
       transform_positions(task.transform, new_mesh->vert_positions_for_write());
       new_mesh->tag_positions_changed();
     }
+    remove_skipped_attributes(options.attribute_filter, new_mesh->attributes_for_write());
     add_instance_attributes_to_single_geometry(
         ordered_attributes, task.attribute_fallbacks, new_mesh->attributes_for_write());
     r_realized_geometry.replace_mesh(new_mesh);
@@ -1885,6 +1906,8 @@ static void execute_realize_curve_tasks(const RealizeInstancesOptions &options,
     if (!skip_transform(task.transform)) {
       new_curves->geometry.wrap().transform(task.transform);
     }
+    remove_skipped_attributes(options.attribute_filter,
+                              new_curves->geometry.wrap().attributes_for_write());
     add_instance_attributes_to_single_geometry(ordered_attributes,
                                                task.attribute_fallbacks,
                                                new_curves->geometry.wrap().attributes_for_write());
@@ -2136,6 +2159,7 @@ static void transform_grease_pencil_layers(Span<bke::greasepencil::Layer *> laye
 }
 
 static void execute_realize_grease_pencil_tasks(
+    const RealizeInstancesOptions &options,
     const AllGreasePencilsInfo &all_grease_pencils_info,
     const Span<RealizeGreasePencilTask> tasks,
     const OrderedAttributes &ordered_attributes,
@@ -2151,6 +2175,7 @@ static void execute_realize_grease_pencil_tasks(
     if (!skip_transform(task.transform)) {
       transform_grease_pencil_layers(new_gp->layers_for_write(), task.transform);
     }
+    remove_skipped_attributes(options.attribute_filter, new_gp->attributes_for_write());
     add_instance_attributes_to_single_geometry(
         ordered_attributes, task.attribute_fallbacks, new_gp->attributes_for_write());
     r_realized_geometry.replace_grease_pencil(new_gp);
@@ -2287,9 +2312,18 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
   return realize_instances(geometry_set, options, all_instances);
 }
 
-bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
-                                   const RealizeInstancesOptions &options,
-                                   const VariedDepthOptions &varied_depth_option)
+/**
+ * Realizes the mesh tasks into the result geometry. Exists so that meshes can be realized in
+ * chunks without changing how all other geometry types are handled.
+ */
+using RealizeMeshTasksFn = FunctionRef<void(const AllMeshesInfo &all_meshes_info,
+                                            Span<RealizeMeshTask> tasks,
+                                            bke::GeometrySet &r_realized_geometry)>;
+
+static bke::GeometrySet realize_instances_impl(bke::GeometrySet geometry_set,
+                                               const RealizeInstancesOptions &options,
+                                               const VariedDepthOptions &varied_depth_option,
+                                               const RealizeMeshTasksFn realize_mesh_tasks)
 {
   /* The algorithm works in three steps:
    * 1. Preprocess each unique geometry that is instanced (e.g. each `Mesh`).
@@ -2363,18 +2397,14 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
                                      gather_info.r_tasks.pointcloud_tasks,
                                      all_pointclouds_info.attributes,
                                      new_geometry_set);
-    execute_realize_mesh_tasks(options,
-                               all_meshes_info,
-                               gather_info.r_tasks.mesh_tasks,
-                               all_meshes_info.attributes,
-                               all_meshes_info.materials,
-                               new_geometry_set);
+    realize_mesh_tasks(all_meshes_info, gather_info.r_tasks.mesh_tasks, new_geometry_set);
     execute_realize_curve_tasks(options,
                                 all_curves_info,
                                 gather_info.r_tasks.curve_tasks,
                                 all_curves_info.attributes,
                                 new_geometry_set);
-    execute_realize_grease_pencil_tasks(all_grease_pencils_info,
+    execute_realize_grease_pencil_tasks(options,
+                                        all_grease_pencils_info,
                                         gather_info.r_tasks.grease_pencil_tasks,
                                         all_grease_pencils_info.attributes,
                                         new_geometry_set);
@@ -2387,6 +2417,100 @@ bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
   return new_geometry_set;
 }
 
+bke::GeometrySet realize_instances(bke::GeometrySet geometry_set,
+                                   const RealizeInstancesOptions &options,
+                                   const VariedDepthOptions &varied_depth_option)
+{
+  return realize_instances_impl(
+      std::move(geometry_set),
+      options,
+      varied_depth_option,
+      [&](const AllMeshesInfo &all_meshes_info,
+          const Span<RealizeMeshTask> tasks,
+          bke::GeometrySet &r_realized_geometry) {
+        execute_realize_mesh_tasks(options,
+                                   all_meshes_info,
+                                   tasks,
+                                   all_meshes_info.attributes,
+                                   all_meshes_info.materials,
+                                   r_realized_geometry);
+      });
+}
+
+/**
+ * Split the mesh tasks into consecutive groups with at most \a max_chunk_faces_num faces. A
+ * group only contains more faces when a single instance is larger than that.
+ */
+static Vector<IndexRange> split_mesh_tasks_into_chunks(const Span<RealizeMeshTask> tasks,
+                                                      const int64_t max_chunk_faces_num)
+{
+  Vector<IndexRange> chunks;
+  int64_t chunk_start = 0;
+  int64_t chunk_faces_num = 0;
+  for (const int64_t i : tasks.index_range()) {
+    const int64_t faces_num = tasks[i].mesh_info->mesh->faces_num;
+    if (i > chunk_start && chunk_faces_num + faces_num > max_chunk_faces_num) {
+      chunks.append(IndexRange::from_begin_end(chunk_start, i));
+      chunk_start = i;
+      chunk_faces_num = 0;
+    }
+    chunk_faces_num += faces_num;
+  }
+  if (chunk_start < tasks.size()) {
+    chunks.append(IndexRange::from_begin_end(chunk_start, tasks.size()));
+  }
+  return chunks;
+}
+
+void realize_instances_chunked(bke::GeometrySet geometry_set,
+                               const RealizeInstancesOptions &options,
+                               const int64_t max_chunk_faces_num,
+                               const FunctionRef<void(bke::GeometrySet chunk)> fn)
+{
+  BLI_assert(max_chunk_faces_num > 0);
+  if (!geometry_set.has_instances()) {
+    fn(std::move(geometry_set));
+    return;
+  }
+
+  VariedDepthOptions all_instances;
+  all_instances.depths = VArray<int>::ForSingle(VariedDepthOptions::MAX_DEPTH,
+                                                geometry_set.get_instances()->instances_num());
+  all_instances.selection = IndexMask(geometry_set.get_instances()->instances_num());
+
+  bke::GeometrySet remaining_geometry = realize_instances_impl(
+      std::move(geometry_set),
+      options,
+      all_instances,
+      [&](const AllMeshesInfo &all_meshes_info,
+          const Span<RealizeMeshTask> tasks,
+          bke::GeometrySet & /*r_realized_geometry*/) {
+        for (const IndexRange chunk : split_mesh_tasks_into_chunks(tasks, max_chunk_faces_num)) {
+          /* Offsets of the tasks are relative to the joined mesh, make them relative to the
+           * start of the chunk instead. */
+          Array<RealizeMeshTask> chunk_tasks(tasks.slice(chunk));
+          const MeshElementStartIndices chunk_start = chunk_tasks.first().start_indices;
+          for (RealizeMeshTask &task : chunk_tasks) {
+            task.start_indices.vertex -= chunk_start.vertex;
+            task.start_indices.edge -= chunk_start.edge;
+            task.start_indices.face -= chunk_start.face;
+            task.start_indices.loop -= chunk_start.loop;
+          }
+          bke::GeometrySet chunk_geometry;
+          execute_realize_mesh_tasks(options,
+                                     all_meshes_info,
+                                     chunk_tasks,
+                                     all_meshes_info.attributes,
+                                     all_meshes_info.materials,
+                                     chunk_geometry);
+          fn(std::move(chunk_geometry));
+        }
+      });
+  if (!remaining_geometry.is_empty()) {
+    fn(std::move(remaining_geometry));
+  }
+}
+
 /** \} */
 
 }  // namespace blender::geometry
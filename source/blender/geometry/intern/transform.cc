@@ -29,9 +29,11 @@
 
 namespace blender::geometry {
 
+/* Positions are often the largest arrays of a geometry. Splitting the loops by NUMA node processes
+ * the same part of the array on the same node every time the geometry is transformed. */
 static void translate_positions(MutableSpan<float3> positions, const float3 &translation)
 {
-  threading::parallel_for(positions.index_range(), 2048, [&](const IndexRange range) {
+  threading::parallel_for_numa(positions.index_range(), 2048, [&](const IndexRange range) {
     for (float3 &position : positions.slice(range)) {
       position += translation;
     }
@@ -40,7 +42,7 @@ static void translate_positions(MutableSpan<float3> positions, const float3 &tra
 
 static void transform_positions(MutableSpan<float3> positions, const float4x4 &matrix)
 {
-  threading::parallel_for(positions.index_range(), 1024, [&](const IndexRange range) {
+  threading::parallel_for_numa(positions.index_range(), 1024, [&](const IndexRange range) {
     for (float3 &position : positions.slice(range)) {
       position = math::transform_point(matrix, position);
     }
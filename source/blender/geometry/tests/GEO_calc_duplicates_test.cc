@@ -0,0 +1,125 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BLI_array.hh"
+#include "BLI_kdtree.h"
+#include "BLI_math_vector.hh"
+#include "BLI_rand.hh"
+
+#include "GEO_calc_duplicates.hh"
+
+#include "testing/testing.h"
+
+namespace blender::geometry::tests {
+
+static Array<float3> random_positions(const int size, const float scale)
+{
+  RandomNumberGenerator rng(42);
+  Array<float3> positions(size);
+  for (float3 &position : positions) {
+    position = float3(rng.get_float(), rng.get_float(), rng.get_float()) * scale;
+  }
+  return positions;
+}
+
+static int calc_duplicates_kdtree(const Span<float3> positions,
+                                  const IndexMask &selection,
+                                  const float merge_distance,
+                                  MutableSpan<int> r_duplicates)
+{
+  KDTree_3d *tree = BLI_kdtree_3d_new(selection.size());
+  selection.foreach_index([&](const int64_t i) { BLI_kdtree_3d_insert(tree, i, positions[i]); });
+  BLI_kdtree_3d_balance(tree);
+  const int duplicates_num = BLI_kdtree_3d_calc_duplicates_fast(
+      tree, merge_distance, true, r_duplicates.data());
+  BLI_kdtree_3d_free(tree);
+  return duplicates_num;
+}
+
+TEST(calc_duplicates, MatchesKDTree)
+{
+  const Array<float3> positions = random_positions(100000, 10.0f);
+  const IndexMask selection(positions.size());
+
+  Array<int> expected(positions.size(), -1);
+  const int expected_num = calc_duplicates_kdtree(positions, selection, 0.05f, expected);
+  EXPECT_GT(expected_num, 0);
+
+  Array<int> result(positions.size(), -1);
+  const int result_num = calc_duplicates_by_distance(positions, selection, 0.05f, result);
+  EXPECT_EQ(result_num, expected_num);
+  EXPECT_EQ_ARRAY(expected.data(), result.data(), positions.size());
+}
+
+TEST(calc_duplicates, MatchesKDTreeSelection)
+{
+  const Array<float3> positions = random_positions(100000, 10.0f);
+  IndexMaskMemory memory;
+  const IndexMask selection = IndexMask::from_predicate(
+      positions.index_range(), GrainSize(4096), memory, [](const int64_t i) {
+        return i % 3 != 0;
+      });
+
+  Array<int> expected(positions.size(), -1);
+  const int expected_num = calc_duplicates_kdtree(positions, selection, 0.05f, expected);
+
+  Array<int> result(positions.size(), -1);
+  const int result_num = calc_duplicates_by_distance(positions, selection, 0.05f, result);
+  EXPECT_EQ(result_num, expected_num);
+  EXPECT_EQ_ARRAY(expected.data(), result.data(), positions.size());
+}
+
+TEST(calc_duplicates, Clustered)
+{
+  /* Many points in range of each other, the targets depend on the order of the points. */
+  Array<float3> positions = random_positions(50000, 1.0f);
+  for (float3 &position : positions) {
+    position = math::floor(position * 20.0f) / 20.0f;
+  }
+  const IndexMask selection(positions.size());
+
+  Array<int> expected(positions.size(), -1);
+  const int expected_num = calc_duplicates_kdtree(positions, selection, 0.06f, expected);
+
+  Array<int> result(positions.size(), -1);
+  const int result_num = calc_duplicates_by_distance(positions, selection, 0.06f, result);
+  EXPECT_EQ(result_num, expected_num);
+  EXPECT_EQ_ARRAY(expected.data(), result.data(), positions.size());
+}
+
+TEST(calc_duplicates, FarFromOrigin)
+{
+  /* Many cells along one axis and far from the origin, where the cell coordinates are rounded. */
+  Array<float3> positions = random_positions(100000, 1.0f);
+  for (float3 &position : positions) {
+    position = float3(10000.0f + position.x * 1000.0f, position.y * 0.05f, position.z * 0.05f);
+  }
+  const IndexMask selection(positions.size());
+
+  Array<int> expected(positions.size(), -1);
+  const int expected_num = calc_duplicates_kdtree(positions, selection, 0.01f, expected);
+  EXPECT_GT(expected_num, 0);
+
+  Array<int> result(positions.size(), -1);
+  const int result_num = calc_duplicates_by_distance(positions, selection, 0.01f, result);
+  EXPECT_EQ(result_num, expected_num);
+  EXPECT_EQ_ARRAY(expected.data(), result.data(), positions.size());
+}
+
+TEST(calc_duplicates, Dense)
+{
+  /* All points are in range of each other, which uses the KD tree instead of the grid. */
+  const Array<float3> positions = random_positions(20000, 0.01f);
+  const IndexMask selection(positions.size());
+
+  Array<int> expected(positions.size(), -1);
+  const int expected_num = calc_duplicates_kdtree(positions, selection, 0.05f, expected);
+
+  Array<int> result(positions.size(), -1);
+  const int result_num = calc_duplicates_by_distance(positions, selection, 0.05f, result);
+  EXPECT_EQ(result_num, expected_num);
+  EXPECT_EQ_ARRAY(expected.data(), result.data(), positions.size());
+}
+
+}  // namespace blender::geometry::tests
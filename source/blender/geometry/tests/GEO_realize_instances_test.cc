@@ -0,0 +1,66 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BKE_geometry_set.hh"
+#include "BKE_idtype.hh"
+#include "BKE_instances.hh"
+#include "BKE_mesh.hh"
+
+#include "BLI_math_matrix.hh"
+
+#include "GEO_realize_instances.hh"
+
+#include "testing/testing.h"
+
+namespace blender::geometry::tests {
+
+static Mesh *create_triangle_mesh()
+{
+  Mesh *mesh = BKE_mesh_new_nomain(3, 3, 1, 3);
+  mesh->vert_positions_for_write().copy_from(
+      {float3(0.0f, 0.0f, 0.0f), float3(1.0f, 0.0f, 0.0f), float3(0.0f, 1.0f, 0.0f)});
+  mesh->edges_for_write().copy_from({int2(0, 1), int2(1, 2), int2(2, 0)});
+  mesh->face_offsets_for_write().copy_from({0, 3});
+  mesh->corner_verts_for_write().copy_from({0, 1, 2});
+  mesh->corner_edges_for_write().copy_from({0, 1, 2});
+  return mesh;
+}
+
+static bke::GeometrySet create_instanced_triangles(const int instances_num)
+{
+  bke::Instances *instances = new bke::Instances();
+  const int handle = instances->add_reference(
+      bke::InstanceReference(bke::GeometrySet::from_mesh(create_triangle_mesh())));
+  for (const int i : IndexRange(instances_num)) {
+    instances->add_instance(handle, math::from_location<float4x4>(float3(i, 0.0f, 0.0f)));
+  }
+  return bke::GeometrySet::from_instances(instances);
+}
+
+TEST(realize_instances, ChunkedMatchesJoined)
+{
+  BKE_idtype_init();
+  const bke::GeometrySet geometry = create_instanced_triangles(10);
+
+  const bke::GeometrySet joined = realize_instances(geometry, {});
+  const Span<float3> joined_positions = joined.get_mesh()->vert_positions();
+
+  Vector<float3> chunked_positions;
+  Vector<int> chunk_faces_nums;
+  realize_instances_chunked(geometry, {}, 3, [&](bke::GeometrySet chunk) {
+    const Mesh *mesh = chunk.get_mesh();
+    ASSERT_NE(mesh, nullptr);
+    chunk_faces_nums.append(mesh->faces_num);
+    chunked_positions.extend(mesh->vert_positions());
+    /* Indices have to be relative to the chunk. */
+    for (const int vert : mesh->corner_verts()) {
+      EXPECT_LT(vert, mesh->verts_num);
+    }
+  });
+
+  EXPECT_EQ(chunk_faces_nums.as_span(), Span<int>({3, 3, 3, 1}));
+  EXPECT_EQ(chunked_positions.as_span(), joined_positions);
+}
+
+}  // namespace blender::geometry::tests
@@ -216,9 +216,15 @@ void GPU_indexbuf_build_in_place_from_memory(blender::gpu::IndexBuf *ibo,
 
 void GPU_indexbuf_bind_as_ssbo(blender::gpu::IndexBuf *elem, int binding);
 
+/**
+ * Build the index buffer of \a curves_num curves with \a verts_per_curve vertices each on the GPU.
+ * The indices of each curve are contiguous. With a \a curve_stride larger than one, the curves of
+ * the buffer refer to evenly spread curves of a larger buffer, to draw a subset of them.
+ */
 blender::gpu::IndexBuf *GPU_indexbuf_build_curves_on_device(GPUPrimType prim_type,
                                                             uint curves_num,
-                                                            uint verts_per_curve);
+                                                            uint verts_per_curve,
+                                                            float curve_stride = 1.0f);
 
 /* Upload data to the GPU (if not built on the device) and bind the buffer to its default target.
  */
@@ -1057,7 +1057,13 @@ const char *GPU_texture_format_name(eGPUTextureFormat format);
  * \note that does not mean all of the textures are inside VRAM. Drivers can swap the texture
  * memory back and forth depending on usage.
  */
-unsigned int GPU_texture_memory_usage_get();
+size_t GPU_texture_memory_usage_get();
+
+/**
+ * Returns the memory size of the storage of \a texture in bytes, including its mipmaps.
+ * Texture views share the storage of their source and return 0.
+ */
+size_t GPU_texture_memory_size(const GPUTexture *texture);
 
 /**
  * Update sampler states depending on user settings.
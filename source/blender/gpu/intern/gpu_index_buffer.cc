@@ -249,7 +249,8 @@ void GPU_indexbuf_set_tri_restart(GPUIndexBufBuilder *builder, uint elem)
 
 IndexBuf *GPU_indexbuf_build_curves_on_device(GPUPrimType prim_type,
                                               uint curves_num,
-                                              uint verts_per_curve)
+                                              uint verts_per_curve,
+                                              const float curve_stride)
 {
   uint64_t dispatch_x_dim = verts_per_curve;
   if (ELEM(prim_type, GPU_PRIM_LINE_STRIP, GPU_PRIM_TRI_STRIP)) {
@@ -287,6 +288,7 @@ IndexBuf *GPU_indexbuf_build_curves_on_device(GPUPrimType prim_type,
   }
   GPU_shader_uniform_1i(shader, "elements_per_curve", dispatch_x_dim / resolution);
   GPU_shader_uniform_1i(shader, "ncurves", curves_num);
+  GPU_shader_uniform_1f(shader, "curve_stride", curve_stride);
   GPU_indexbuf_bind_as_ssbo(ibo, GPU_shader_get_ssbo_binding(shader, "out_indices"));
   GPU_compute_dispatch(shader, grid_x, grid_y, grid_z);
 
@@ -23,6 +23,8 @@ namespace blender::gpu {
 /** \name Creation & Deletion
  * \{ */
 
+size_t Texture::memory_usage = 0;
+
 Texture::Texture(const char *name)
 {
   if (name) {
@@ -52,6 +54,22 @@ Texture::~Texture()
     *this->py_ref = nullptr;
   }
 #endif
+
+  memory_usage -= memory_size_;
+}
+
+bool Texture::init_storage()
+{
+  if (!this->init_internal()) {
+    return false;
+  }
+  /* Compressed formats are counted as uncompressed, this is only an estimate. */
+  for (int mip = 0; mip < mipmaps_; mip++) {
+    memory_size_ += size_t(this->mip_width_get(mip)) * size_t(this->mip_height_get(mip)) *
+                    size_t(max_ii(1, this->mip_depth_get(mip))) * to_bytesize(format_);
+  }
+  memory_usage += memory_size_;
+  return true;
 }
 
 bool Texture::init_1D(int w, int layers, int mip_len, eGPUTextureFormat format)
@@ -67,7 +85,7 @@ bool Texture::init_1D(int w, int layers, int mip_len, eGPUTextureFormat format)
   if ((format_flag_ & (GPU_FORMAT_DEPTH_STENCIL | GPU_FORMAT_INTEGER)) == 0) {
     sampler_state.filtering = GPU_SAMPLER_FILTERING_LINEAR;
   }
-  return this->init_internal();
+  return this->init_storage();
 }
 
 bool Texture::init_2D(int w, int h, int layers, int mip_len, eGPUTextureFormat format)
@@ -83,7 +101,7 @@ bool Texture::init_2D(int w, int h, int layers, int mip_len, eGPUTextureFormat f
   if ((format_flag_ & (GPU_FORMAT_DEPTH_STENCIL | GPU_FORMAT_INTEGER)) == 0) {
     sampler_state.filtering = GPU_SAMPLER_FILTERING_LINEAR;
   }
-  return this->init_internal();
+  return this->init_storage();
 }
 
 bool Texture::init_3D(int w, int h, int d, int mip_len, eGPUTextureFormat format)
@@ -99,7 +117,7 @@ bool Texture::init_3D(int w, int h, int d, int mip_len, eGPUTextureFormat format
   if ((format_flag_ & (GPU_FORMAT_DEPTH_STENCIL | GPU_FORMAT_INTEGER)) == 0) {
     sampler_state.filtering = GPU_SAMPLER_FILTERING_LINEAR;
   }
-  return this->init_internal();
+  return this->init_storage();
 }
 
 bool Texture::init_cubemap(int w, int layers, int mip_len, eGPUTextureFormat format)
@@ -115,7 +133,7 @@ bool Texture::init_cubemap(int w, int layers, int mip_len, eGPUTextureFormat for
   if ((format_flag_ & (GPU_FORMAT_DEPTH_STENCIL | GPU_FORMAT_INTEGER)) == 0) {
     sampler_state.filtering = GPU_SAMPLER_FILTERING_LINEAR;
   }
-  return this->init_internal();
+  return this->init_storage();
 }
 
 bool Texture::init_buffer(VertBuf *vbo, eGPUTextureFormat format)
@@ -245,10 +263,14 @@ using namespace blender::gpu;
 
 /* ------ Memory Management ------ */
 
-uint GPU_texture_memory_usage_get()
+size_t GPU_texture_memory_usage_get()
+{
+  return Texture::memory_usage;
+}
+
+size_t GPU_texture_memory_size(const GPUTexture *texture)
 {
-  /* TODO(fclem): Do that inside the new Texture class. */
-  return 0;
+  return reinterpret_cast<const Texture *>(texture)->memory_size_get();
 }
 
 /* ------ Creation ------ */
@@ -83,6 +83,9 @@ ENUM_OPERATORS(eGPUSamplerFormat, GPU_SAMPLER_TYPE_UINT)
  */
 class Texture {
  public:
+  /** Sum of the memory size of all allocated textures, in bytes. Texture views are not counted. */
+  static size_t memory_usage;
+
   /** Internal Sampler state. */
   GPUSamplerState sampler_state = GPUSamplerState::default_sampler();
   /** Reference counter. */
@@ -116,6 +119,9 @@ class Texture {
   /** For error checking */
   int mip_min_ = 0, mip_max_ = 0;
 
+  /** Memory size of the texture storage (including mipmaps), in bytes. Zero for views. */
+  size_t memory_size_ = 0;
+
   /** For debugging */
   char name_[DEBUG_NAME_LEN];
 
@@ -181,6 +187,10 @@ class Texture {
   {
     return gpu_image_usage_flags_;
   }
+  size_t memory_size_get() const
+  {
+    return memory_size_;
+  }
 
   void mip_size_get(int mip, int r_size[3]) const
   {
@@ -312,6 +322,9 @@ class Texture {
   }
 
  protected:
+  /** Allocate the texture storage and account for its memory usage. */
+  bool init_storage();
+
   virtual bool init_internal() = 0;
   virtual bool init_internal(VertBuf *vbo) = 0;
   virtual bool init_internal(GPUTexture *src,
@@ -7,6 +7,7 @@
 #if BLI_SUBPROCESS_SUPPORT
 
 #  include "BKE_appdir.hh"
+#  include "BLI_array.hh"
 #  include "BLI_fileops.hh"
 #  include "BLI_hash.hh"
 #  include "BLI_path_utils.hh"
@@ -183,6 +184,16 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
 
   std::string cache_dir = cache_dir_get();
 
+  /* Binaries are only valid for the driver that created them, so its version is part of the key.
+   * This avoids failing cache hits for every shader after a driver update or when switching
+   * between GPUs, which would then be compiled in the main process. */
+  DefaultHash<StringRefNull> hasher;
+  const std::string driver_str = std::string(reinterpret_cast<const char *>(
+                                     glGetString(GL_VENDOR))) +
+                                 reinterpret_cast<const char *>(glGetString(GL_RENDERER)) +
+                                 reinterpret_cast<const char *>(glGetString(GL_VERSION));
+  const std::string driver_hash_str = std::to_string(hasher(driver_str));
+
   while (true) {
     /* Process events to avoid crashes on Wayland.
      * See https://bugreports.qt.io/browse/QTBUG-81504 */
@@ -212,8 +223,7 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
     const char *geom_src = nullptr;
     const char *frag_src = nullptr;
 
-    DefaultHash<StringRefNull> hasher;
-    std::string hash_str = "_";
+    std::string hash_str = "_" + driver_hash_str + "_";
 
     auto get_src = [&]() {
       const char *src = next_src;
@@ -243,19 +253,26 @@ void GPU_compilation_subprocess_run(const char *subprocess_name)
       fstream file(cache_path, std::ios::binary | std::ios::in | std::ios::ate);
       std::streamsize size = file.tellg();
       if (size <= compilation_subprocess_shared_memory_size) {
+        /* Read into a separate buffer first, so the shader can still be compiled from the sources
+         * in the shared memory when the binary is rejected by the driver. */
+        Array<char> cached_binary(size, NoInitialization());
         file.seekg(0, std::ios::beg);
-        file.read(reinterpret_cast<char *>(shared_mem.get_data()), size);
-        /* Ensure it's valid. */
-        if (!validate_binary(shared_mem.get_data())) {
-          std::cout << "Compilation Subprocess: Failed to load cached shader binary " << hash_str
-                    << "\n";
-          /* We can't compile the shader anymore since we have written over the source code,
-           * but we delete the cache for the next time this shader is requested. */
-          file.close();
-          BLI_delete(cache_path.c_str(), false, false);
+        file.read(cached_binary.data(), size);
+        file.close();
+        /* Ensure it's complete and valid. */
+        const ShaderBinaryHeader *header = reinterpret_cast<const ShaderBinaryHeader *>(
+            cached_binary.data());
+        const int64_t header_size = offsetof(ShaderBinaryHeader, data);
+        if (size >= header_size && header->size <= size - header_size &&
+            validate_binary(cached_binary.data()))
+        {
+          memcpy(shared_mem.get_data(), cached_binary.data(), size);
+          end_semaphore.increment();
+          continue;
         }
-        end_semaphore.increment();
-        continue;
+        std::cout << "Compilation Subprocess: Failed to load cached shader binary " << hash_str
+                  << "\n";
+        BLI_delete(cache_path.c_str(), false, false);
       }
       else {
         /* This should never happen, since shaders larger than the pool size should be discarded
@@ -0,0 +1,18 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/* Evaluates geometry nodes fields for one element per invocation. The field_eval function is
+ * generated from the field tree, work groups are spread over two dimensions for large fields. */
+
+#include "gpu_shader_common_math.glsl"
+
+void main()
+{
+  uint index = gl_GlobalInvocationID.x +
+               gl_GlobalInvocationID.y * gl_NumWorkGroups.x * gl_WorkGroupSize.x;
+  if (index >= uint(elements_num)) {
+    return;
+  }
+  field_eval(index);
+}
@@ -11,6 +11,7 @@
  *  The index buffer can then be used to draw 'ncurves' curves with 'elements_per_curve+1'
  *  vertexes each, using GL_LINES primitives. Intended to be used if GL_LINE_STRIP
  *  primitives can't be used for some reason.
+ *  Row 'y' contains the indexes of curve 'y * curve_stride', to draw a subset of the curves.
  */
 void main()
 {
@@ -19,7 +20,8 @@ void main()
   for (int y = gid.y + gid.z * nthreads.y; y < ncurves; y += nthreads.y * nthreads.z) {
     for (int x = gid.x; x < elements_per_curve; x += nthreads.x) {
       int store_index = (x + y * elements_per_curve) * 2;
-      uint t = uint(x + y * (elements_per_curve + 1));
+      int curve = int(float(y) * curve_stride);
+      uint t = uint(x + curve * (elements_per_curve + 1));
       out_indices[store_index] = t;
       out_indices[store_index + 1] = t + 1u;
     }
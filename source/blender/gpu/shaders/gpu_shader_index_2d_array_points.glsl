@@ -7,6 +7,7 @@
  *  columns. Each row contains 'elements_per_curve-1' indexes and a restart index.
  *  The index buffer can then be used to draw either 'ncurves' lines with 'elements_per_curve-1'
  *  vertexes each, or 'ncurves' triangle strips with 'elements_per_curve-3' triangles each.
+ *  Row 'y' contains the indexes of curve 'y * curve_stride', to draw a subset of the curves.
  */
 void main()
 {
@@ -15,8 +16,9 @@ void main()
   for (int y = gid.y + gid.z * nthreads.y; y < ncurves; y += nthreads.y * nthreads.z) {
     for (int x = gid.x; x < elements_per_curve; x += nthreads.x) {
       int store_index = x + y * elements_per_curve;
+      int curve = int(float(y) * curve_stride);
       out_indices[store_index] = (x + 1 < elements_per_curve) ?
-                                     uint(x + y * (elements_per_curve - 1)) :
+                                     uint(x + curve * (elements_per_curve - 1)) :
                                      0xFFFFFFFFu;
     }
   }
@@ -7,6 +7,7 @@
  *  The index buffer can be used to draw 'ncurves' triangle strips with 'elements_per_curve*2'
  *  triangles each, using GL_TRIANGLES primitives. Intended to be used if GL_TRIANGLE_STRIP
  *  primitives can't be used for some reason.
+ *  Row 'y' contains the indexes of curve 'y * curve_stride', to draw a subset of the curves.
  */
 void main()
 {
@@ -15,7 +16,8 @@ void main()
   for (int y = gid.y + gid.z * nthreads.y; y < ncurves; y += nthreads.y * nthreads.z) {
     for (int x = gid.x; x < elements_per_curve; x += nthreads.x) {
       int store_index = (x + y * elements_per_curve) * 6;
-      uint t = x * 2 + y * (elements_per_curve * 2 + 2);
+      int curve = int(float(y) * curve_stride);
+      uint t = x * 2 + curve * (elements_per_curve * 2 + 2);
       out_indices[store_index + 0] = t;
       out_indices[store_index + 1] = t + 1u;
       out_indices[store_index + 2] = t + 2u;
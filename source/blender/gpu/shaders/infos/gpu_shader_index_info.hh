@@ -13,6 +13,7 @@ GPU_SHADER_CREATE_INFO(gpu_shader_index_2d_array_points)
 LOCAL_GROUP_SIZE(16, 16, 1)
 PUSH_CONSTANT(INT, elements_per_curve)
 PUSH_CONSTANT(INT, ncurves)
+PUSH_CONSTANT(FLOAT, curve_stride)
 STORAGE_BUF(0, WRITE, uint, out_indices[])
 COMPUTE_SOURCE("gpu_shader_index_2d_array_points.glsl")
 DO_STATIC_COMPILATION()
@@ -22,6 +23,7 @@ GPU_SHADER_CREATE_INFO(gpu_shader_index_2d_array_lines)
 LOCAL_GROUP_SIZE(16, 16, 1)
 PUSH_CONSTANT(INT, elements_per_curve)
 PUSH_CONSTANT(INT, ncurves)
+PUSH_CONSTANT(FLOAT, curve_stride)
 STORAGE_BUF(0, WRITE, uint, out_indices[])
 COMPUTE_SOURCE("gpu_shader_index_2d_array_lines.glsl")
 DO_STATIC_COMPILATION()
@@ -31,6 +33,7 @@ GPU_SHADER_CREATE_INFO(gpu_shader_index_2d_array_tris)
 LOCAL_GROUP_SIZE(16, 16, 1)
 PUSH_CONSTANT(INT, elements_per_curve)
 PUSH_CONSTANT(INT, ncurves)
+PUSH_CONSTANT(FLOAT, curve_stride)
 STORAGE_BUF(0, WRITE, uint, out_indices[])
 COMPUTE_SOURCE("gpu_shader_index_2d_array_tris.glsl")
 DO_STATIC_COMPILATION()
@@ -217,6 +217,90 @@ TEST(vk_render_graph, begin_draw_end)
   EXPECT_EQ("end_rendering()", log[4]);
 }
 
+/**
+ * The barriers of the nodes inside a rendering scope are recorded before the scope begins. When
+ * they are about different resources they are recorded as a single pipeline barrier.
+ */
+TEST(vk_render_graph, begin_draw_end__coalesce_barriers)
+{
+  VkHandle<VkImage> image(1u);
+  VkHandle<VkImageView> image_view(2u);
+  VkHandle<VkPipelineLayout> pipeline_layout(4u);
+  VkHandle<VkPipeline> pipeline(3u);
+  VkHandle<VkBuffer> buffer(5u);
+
+  Vector<std::string> log;
+  VKResourceStateTracker resources;
+  VKRenderGraph render_graph(std::make_unique<CommandBufferLog>(log), resources);
+  resources.add_image(image, 1, VK_IMAGE_LAYOUT_UNDEFINED, ResourceOwner::APPLICATION);
+  resources.add_buffer(buffer);
+
+  {
+    VKResourceAccessInfo access_info = {};
+    access_info.images.append(
+        {image, VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, VK_IMAGE_ASPECT_COLOR_BIT, 0});
+    VKBeginRenderingNode::CreateInfo begin_rendering(access_info);
+    begin_rendering.node_data.color_attachments[0].sType =
+        VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO_KHR;
+    begin_rendering.node_data.color_attachments[0].imageLayout =
+        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    begin_rendering.node_data.color_attachments[0].imageView = image_view;
+    begin_rendering.node_data.color_attachments[0].loadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
+    begin_rendering.node_data.color_attachments[0].storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    begin_rendering.node_data.vk_rendering_info.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+    begin_rendering.node_data.vk_rendering_info.colorAttachmentCount = 1;
+    begin_rendering.node_data.vk_rendering_info.layerCount = 1;
+    begin_rendering.node_data.vk_rendering_info.pColorAttachments =
+        begin_rendering.node_data.color_attachments;
+
+    render_graph.add_node(begin_rendering);
+  }
+
+  {
+    VKResourceAccessInfo access_info = {};
+    access_info.buffers.append({buffer, VK_ACCESS_SHADER_READ_BIT});
+    VKDrawNode::CreateInfo draw(access_info);
+    draw.node_data.first_instance = 0;
+    draw.node_data.first_vertex = 0;
+    draw.node_data.instance_count = 1;
+    draw.node_data.vertex_count = 4;
+    draw.node_data.pipeline_data.push_constants_data = nullptr;
+    draw.node_data.pipeline_data.push_constants_size = 0;
+    draw.node_data.pipeline_data.vk_descriptor_set = VK_NULL_HANDLE;
+    draw.node_data.pipeline_data.vk_pipeline = pipeline;
+    draw.node_data.pipeline_data.vk_pipeline_layout = pipeline_layout;
+    render_graph.add_node(draw);
+  }
+
+  {
+    VKEndRenderingNode::CreateInfo end_rendering = {};
+    render_graph.add_node(end_rendering);
+  }
+
+  render_graph.submit();
+  EXPECT_EQ(5, log.size());
+  EXPECT_EQ(
+      "pipeline_barrier(src_stage_mask=VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT, "
+      "dst_stage_mask=VK_PIPELINE_STAGE_ALL_GRAPHICS_BIT" +
+          endl() +
+          " - image_barrier(src_access_mask=, "
+          "dst_access_mask=VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT, "
+          "old_layout=VK_IMAGE_LAYOUT_UNDEFINED, "
+          "new_layout=VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL, image=0x1, subresource_range=" +
+          endl() +
+          "    aspect_mask=VK_IMAGE_ASPECT_COLOR_BIT, base_mip_level=0, "
+          "level_count=4294967295, base_array_layer=0, layer_count=4294967295  )" +
+          endl() +
+          " - buffer_barrier(src_access_mask=, dst_access_mask=VK_ACCESS_SHADER_READ_BIT, "
+          "buffer=0x5, offset=0, size=18446744073709551615)" +
+          endl() + ")",
+      log[0]);
+  EXPECT_EQ("bind_pipeline(pipeline_bind_point=VK_PIPELINE_BIND_POINT_GRAPHICS, pipeline=0x3)",
+            log[2]);
+  EXPECT_EQ("draw(vertex_count=4, instance_count=1, first_vertex=0, first_instance=0)", log[3]);
+  EXPECT_EQ("end_rendering()", log[4]);
+}
+
 TEST(vk_render_graph, begin_draw_end__layered)
 {
   VkHandle<VkImage> image(1u);
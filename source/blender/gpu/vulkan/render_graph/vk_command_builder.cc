@@ -6,6 +6,8 @@
  * \ingroup gpu
  */
 
+#include <algorithm>
+
 #include "vk_command_builder.hh"
 #include "vk_render_graph.hh"
 
@@ -102,6 +104,7 @@ void VKCommandBuilder::build_node_group(VKRenderGraph &render_graph,
       layer_tracking_begin(render_graph, node_handle);
     }
   }
+  send_group_pipeline_barriers(command_buffer);
 
   for (NodeHandle node_handle : node_group) {
     VKRenderGraphNode &node = render_graph.nodes_[node_handle];
@@ -235,7 +238,7 @@ void VKCommandBuilder::build_pipeline_barriers(VKRenderGraph &render_graph,
   reset_barriers();
   add_image_barriers(render_graph, node_handle, pipeline_stage);
   add_buffer_barriers(render_graph, node_handle, pipeline_stage);
-  send_pipeline_barriers(command_buffer);
+  group_pipeline_barriers(command_buffer);
 }
 
 /** \} */
@@ -278,6 +281,73 @@ void VKCommandBuilder::send_pipeline_barriers(VKCommandBufferInterface &command_
   reset_barriers();
 }
 
+void VKCommandBuilder::group_pipeline_barriers(VKCommandBufferInterface &command_buffer)
+{
+  if (vk_image_memory_barriers_.is_empty() && vk_buffer_memory_barriers_.is_empty()) {
+    reset_barriers();
+    return;
+  }
+
+  const bool has_image_conflict = std::any_of(
+      vk_image_memory_barriers_.begin(),
+      vk_image_memory_barriers_.end(),
+      [&](const VkImageMemoryBarrier &barrier) {
+        return std::any_of(group_barriers_.vk_image_memory_barriers.begin(),
+                           group_barriers_.vk_image_memory_barriers.end(),
+                           [&](const VkImageMemoryBarrier &group_barrier) {
+                             return group_barrier.image == barrier.image;
+                           });
+      });
+  const bool has_buffer_conflict = std::any_of(
+      vk_buffer_memory_barriers_.begin(),
+      vk_buffer_memory_barriers_.end(),
+      [&](const VkBufferMemoryBarrier &barrier) {
+        return std::any_of(group_barriers_.vk_buffer_memory_barriers.begin(),
+                           group_barriers_.vk_buffer_memory_barriers.end(),
+                           [&](const VkBufferMemoryBarrier &group_barrier) {
+                             return group_barrier.buffer == barrier.buffer;
+                           });
+      });
+  if (has_image_conflict || has_buffer_conflict) {
+    send_group_pipeline_barriers(command_buffer);
+  }
+
+  group_barriers_.vk_image_memory_barriers.extend(vk_image_memory_barriers_);
+  group_barriers_.vk_buffer_memory_barriers.extend(vk_buffer_memory_barriers_);
+  group_barriers_.src_stage_mask |= state_.src_stage_mask;
+  group_barriers_.dst_stage_mask |= state_.dst_stage_mask;
+  reset_barriers();
+}
+
+void VKCommandBuilder::send_group_pipeline_barriers(VKCommandBufferInterface &command_buffer)
+{
+  if (group_barriers_.vk_image_memory_barriers.is_empty() &&
+      group_barriers_.vk_buffer_memory_barriers.is_empty())
+  {
+    return;
+  }
+
+  /* The stage masks of the barriers are combined, which is what a single barrier for all these
+   * resources requires. */
+  if (group_barriers_.src_stage_mask == VK_PIPELINE_STAGE_NONE) {
+    group_barriers_.src_stage_mask = VK_PIPELINE_STAGE_TOP_OF_PIPE_BIT;
+  }
+
+  command_buffer.pipeline_barrier(group_barriers_.src_stage_mask,
+                                  group_barriers_.dst_stage_mask,
+                                  VK_DEPENDENCY_BY_REGION_BIT,
+                                  0,
+                                  nullptr,
+                                  group_barriers_.vk_buffer_memory_barriers.size(),
+                                  group_barriers_.vk_buffer_memory_barriers.data(),
+                                  group_barriers_.vk_image_memory_barriers.size(),
+                                  group_barriers_.vk_image_memory_barriers.data());
+  group_barriers_.vk_buffer_memory_barriers.clear();
+  group_barriers_.vk_image_memory_barriers.clear();
+  group_barriers_.src_stage_mask = VK_PIPELINE_STAGE_NONE;
+  group_barriers_.dst_stage_mask = VK_PIPELINE_STAGE_NONE;
+}
+
 void VKCommandBuilder::add_buffer_barriers(VKRenderGraph &render_graph,
                                            NodeHandle node_handle,
                                            VkPipelineStageFlags node_stages)
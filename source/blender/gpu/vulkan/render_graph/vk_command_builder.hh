@@ -36,6 +36,17 @@ class VKCommandBuilder {
   Vector<VkBufferMemoryBarrier> vk_buffer_memory_barriers_;
   Vector<VkImageMemoryBarrier> vk_image_memory_barriers_;
 
+  /**
+   * Barriers of the previous nodes of the node group that haven't been recorded yet. The barriers
+   * of a node group are recorded together, see #group_pipeline_barriers.
+   */
+  struct {
+    Vector<VkBufferMemoryBarrier> vk_buffer_memory_barriers;
+    Vector<VkImageMemoryBarrier> vk_image_memory_barriers;
+    VkPipelineStageFlags src_stage_mask = VK_PIPELINE_STAGE_NONE;
+    VkPipelineStageFlags dst_stage_mask = VK_PIPELINE_STAGE_NONE;
+  } group_barriers_;
+
   /** Template buffer memory barrier. */
   VkBufferMemoryBarrier vk_buffer_memory_barrier_;
   /** Template image memory barrier. */
@@ -126,6 +137,15 @@ class VKCommandBuilder {
   void reset_barriers();
   void send_pipeline_barriers(VKCommandBufferInterface &command_buffer);
 
+  /**
+   * Move the barriers of the current node to the barriers of the node group, so they are recorded
+   * with a single `vkCmdPipelineBarrier`. When the node uses a resource that already has a
+   * barrier in the group, the barriers of the group are recorded first, as the barriers inside a
+   * single command don't have an order.
+   */
+  void group_pipeline_barriers(VKCommandBufferInterface &command_buffer);
+  void send_group_pipeline_barriers(VKCommandBufferInterface &command_buffer);
+
   void add_buffer_barriers(VKRenderGraph &render_graph,
                            NodeHandle node_handle,
                            VkPipelineStageFlags node_stages);
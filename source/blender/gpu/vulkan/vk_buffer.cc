@@ -50,11 +50,17 @@ static VkMemoryPropertyFlags vma_required_flags(const bool is_host_visible)
   return is_host_visible ? VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT : 0;
 }
 
-/*
- * TODO: Check which memory is selected and adjust the creation flag to add mapping. This way the
- * staging buffer can be skipped, or in case of a vertex buffer an intermediate buffer can be
- * removed.
+/**
+ * On integrated GPUs all device local memory is host visible. Static buffers are mapped when that
+ * is the case, so their initial data can be written directly, skipping the staging buffer and the
+ * copy command.
  */
+static bool allow_host_access(const VKDevice &device, GPUUsageType usage)
+{
+  return usage == GPU_USAGE_STATIC && device.physical_device_properties_get().deviceType ==
+                                          VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU;
+}
+
 bool VKBuffer::create(size_t size_in_bytes,
                       GPUUsageType usage,
                       VkBufferUsageFlags buffer_usage,
@@ -84,8 +90,13 @@ bool VKBuffer::create(size_t size_in_bytes,
   const uint32_t queue_family_indices[1] = {device.queue_family_get()};
   create_info.pQueueFamilyIndices = queue_family_indices;
 
+  const bool use_host_access = !is_host_visible && allow_host_access(device, usage);
   VmaAllocationCreateInfo vma_create_info = {};
   vma_create_info.flags = vma_allocation_flags(usage);
+  if (use_host_access) {
+    vma_create_info.flags |= VMA_ALLOCATION_CREATE_HOST_ACCESS_SEQUENTIAL_WRITE_BIT |
+                             VMA_ALLOCATION_CREATE_HOST_ACCESS_ALLOW_TRANSFER_INSTEAD_BIT;
+  }
   vma_create_info.priority = 1.0f;
   vma_create_info.requiredFlags = vma_required_flags(is_host_visible);
   vma_create_info.preferredFlags = vma_preferred_flags();
@@ -102,6 +113,14 @@ bool VKBuffer::create(size_t size_in_bytes,
   if (is_host_visible) {
     return map();
   }
+  if (use_host_access) {
+    VkMemoryPropertyFlags memory_properties;
+    vmaGetAllocationMemoryProperties(allocator, allocation_, &memory_properties);
+    if (memory_properties & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+      /* Not being mapped is fine, the data is uploaded via a staging buffer then. */
+      map();
+    }
+  }
   return true;
 }
 
@@ -21,7 +21,9 @@ void VKIndexBuffer::ensure_updated()
     return;
   }
 
-  if (!buffer_.is_allocated()) {
+  /* The host can only write to a buffer directly when the device can't be using it. */
+  const bool is_new_buffer = !buffer_.is_allocated();
+  if (is_new_buffer) {
     allocate();
   }
 
@@ -29,10 +31,15 @@ void VKIndexBuffer::ensure_updated()
     return;
   }
 
-  VKContext &context = *VKContext::get();
-  VKStagingBuffer staging_buffer(buffer_, VKStagingBuffer::Direction::HostToDevice);
-  staging_buffer.host_buffer_get().update_immediately(data_);
-  staging_buffer.copy_to_device(context);
+  if (is_new_buffer && buffer_.is_mapped()) {
+    buffer_.update_immediately(data_);
+  }
+  else {
+    VKContext &context = *VKContext::get();
+    VKStagingBuffer staging_buffer(buffer_, VKStagingBuffer::Direction::HostToDevice);
+    staging_buffer.host_buffer_get().update_immediately(data_);
+    staging_buffer.copy_to_device(context);
+  }
   MEM_SAFE_FREE(data_);
 }
 
@@ -17,11 +17,17 @@ namespace blender::gpu {
 
 void VKUniformBuffer::update(const void *data)
 {
-  if (!buffer_.is_allocated()) {
+  /* The host can only write to a buffer directly when the device can't be using it. */
+  const bool is_new_buffer = !buffer_.is_allocated();
+  if (is_new_buffer) {
     allocate();
   }
 
-  /* TODO: when buffer is mapped and newly created we should use `buffer_.update_immediately`. */
+  if (is_new_buffer && buffer_.is_mapped()) {
+    buffer_.update_immediately(data);
+    return;
+  }
+
   void *data_copy = MEM_mallocN(size_in_bytes_, __func__);
   memcpy(data_copy, data, size_in_bytes_);
   VKContext &context = *VKContext::get();
@@ -49,13 +55,17 @@ void VKUniformBuffer::clear_to_zero()
 
 void VKUniformBuffer::ensure_updated()
 {
-  if (!buffer_.is_allocated()) {
+  const bool is_new_buffer = !buffer_.is_allocated();
+  if (is_new_buffer) {
     allocate();
   }
 
   /* Upload attached data, during bind time. */
-  if (data_) {
-    /* TODO: when buffer is mapped and newly created we should use `buffer_.update_immediately`. */
+  if (data_ && is_new_buffer && buffer_.is_mapped()) {
+    buffer_.update_immediately(data_);
+    MEM_SAFE_FREE(data_);
+  }
+  else if (data_) {
     VKContext &context = *VKContext::get();
     buffer_.update_render_graph(context, std::move(data_));
     data_ = nullptr;
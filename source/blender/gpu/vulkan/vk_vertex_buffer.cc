@@ -139,7 +139,9 @@ void VKVertexBuffer::upload_data_via_staging_buffer(VKContext &context)
 
 void VKVertexBuffer::upload_data()
 {
-  if (!buffer_.is_allocated()) {
+  /* The host can only write to a buffer directly when the device can't be using it. */
+  const bool is_new_buffer = !buffer_.is_allocated();
+  if (is_new_buffer) {
     allocate();
   }
   if (!ELEM(usage_, GPU_USAGE_STATIC, GPU_USAGE_STREAM, GPU_USAGE_DYNAMIC)) {
@@ -148,7 +150,7 @@ void VKVertexBuffer::upload_data()
 
   if (flag & GPU_VERTBUF_DATA_DIRTY) {
     device_format_ensure();
-    if (buffer_.is_mapped()) {
+    if (is_new_buffer && buffer_.is_mapped()) {
       upload_data_direct(buffer_);
     }
     else {
@@ -96,6 +96,8 @@ enum eImBufFlags {
   IB_multilayer = 1 << 7,
   IB_metadata = 1 << 8,
   IB_animdeinterlace = 1 << 9,
+  /** Decode movies on a hardware device if one is available. */
+  IB_animhwdecode = 1 << 11,
   /** Do not clear image pixel buffer to zero. Without this flag, allocating
    * a new ImBuf does clear the pixel data to zero (transparent black). If
    * whole pixel data is overwritten after allocation, then this flag can be
@@ -18,6 +18,7 @@ struct AVCodecContext;
 struct AVCodec;
 struct AVFrame;
 struct AVPacket;
+struct AVBufferRef;
 struct SwsContext;
 #endif
 
@@ -47,8 +48,15 @@ struct ImBufAnim {
   AVFrame *pFrameRGB;
   AVFrame *pFrameDeinterlaced;
   SwsContext *img_convert_ctx;
+  /** The #AVPixelFormat of the frames #img_convert_ctx converts from. */
+  int img_convert_ctx_pix_fmt;
   int videoStream;
 
+  /** Hardware device used for decoding, null if decoding is done in software. */
+  AVBufferRef *hw_device_ctx;
+  /** The #AVPixelFormat of frames decoded on #hw_device_ctx. */
+  int hw_pix_fmt;
+
   AVFrame *pFrame;
   bool pFrame_complete;
   AVFrame *pFrame_backup;
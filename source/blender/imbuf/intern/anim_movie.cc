@@ -44,7 +44,9 @@
 extern "C" {
 #  include <libavcodec/avcodec.h>
 #  include <libavformat/avformat.h>
+#  include <libavutil/hwcontext.h>
 #  include <libavutil/imgutils.h>
+#  include <libavutil/pixdesc.h>
 #  include <libavutil/rational.h>
 #  include <libswscale/swscale.h>
 
@@ -234,6 +236,124 @@ static int ffmpeg_frame_count_get(AVFormatContext *pFormatCtx, AVStream *video_s
   return 0;
 }
 
+/**
+ * Create the context converting frames of the given pixel format to RGBA, releasing the existing
+ * one if any. Returns false if the conversion is not supported.
+ */
+static bool ffmpeg_sws_context_create(ImBufAnim *anim, const AVPixelFormat pix_fmt)
+{
+  /* The following for color space determination */
+  int srcRange, dstRange, brightness, contrast, saturation;
+  int *table;
+  const int *inv_table;
+
+  if (anim->img_convert_ctx) {
+    BKE_ffmpeg_sws_release_context(anim->img_convert_ctx);
+  }
+
+  anim->img_convert_ctx = BKE_ffmpeg_sws_get_context(anim->x,
+                                                     anim->y,
+                                                     pix_fmt,
+                                                     anim->x,
+                                                     anim->y,
+                                                     AV_PIX_FMT_RGBA,
+                                                     SWS_BILINEAR | SWS_PRINT_INFO |
+                                                         SWS_FULL_CHR_H_INT);
+  anim->img_convert_ctx_pix_fmt = pix_fmt;
+
+  if (!anim->img_convert_ctx) {
+    return false;
+  }
+
+  /* Try do detect if input has 0-255 YCbCR range (JFIF, JPEG, Motion-JPEG). */
+  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
+                                (int **)&inv_table,
+                                &srcRange,
+                                &table,
+                                &dstRange,
+                                &brightness,
+                                &contrast,
+                                &saturation))
+  {
+    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
+    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
+
+    if (sws_setColorspaceDetails(anim->img_convert_ctx,
+                                 (int *)inv_table,
+                                 srcRange,
+                                 table,
+                                 dstRange,
+                                 brightness,
+                                 contrast,
+                                 saturation))
+    {
+      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+    }
+  }
+  else {
+    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
+  }
+
+  return true;
+}
+
+/**
+ * Pick the hardware pixel format chosen by #ffmpeg_hw_decode_init if the decoder offers it for
+ * the stream, otherwise fall back to the first software format, such that the stream is still
+ * decoded on the CPU.
+ */
+static AVPixelFormat ffmpeg_hw_get_format(AVCodecContext *codec_ctx,
+                                          const AVPixelFormat *pix_fmts)
+{
+  const ImBufAnim *anim = static_cast<const ImBufAnim *>(codec_ctx->opaque);
+  for (const AVPixelFormat *pix_fmt = pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; pix_fmt++) {
+    if (*pix_fmt == anim->hw_pix_fmt) {
+      return *pix_fmt;
+    }
+  }
+
+  av_log(anim->pFormatCtx, AV_LOG_WARNING, "Hardware decoding unavailable, using software.\n");
+  for (const AVPixelFormat *pix_fmt = pix_fmts; *pix_fmt != AV_PIX_FMT_NONE; pix_fmt++) {
+    if (!(av_pix_fmt_desc_get(*pix_fmt)->flags & AV_PIX_FMT_FLAG_HWACCEL)) {
+      return *pix_fmt;
+    }
+  }
+  return AV_PIX_FMT_NONE;
+}
+
+/**
+ * Set up the codec context to decode on the first hardware device supported by both the decoder
+ * and the system, like VAAPI, NVDEC, VideoToolbox or D3D11VA. The codec context is left untouched
+ * if no device could be created.
+ */
+static void ffmpeg_hw_decode_init(ImBufAnim *anim, const AVCodec *codec, AVCodecContext *codec_ctx)
+{
+  for (int i = 0;; i++) {
+    const AVCodecHWConfig *config = avcodec_get_hw_config(codec, i);
+    if (config == nullptr) {
+      return;
+    }
+    if (!(config->methods & AV_CODEC_HW_CONFIG_METHOD_HW_DEVICE_CTX)) {
+      continue;
+    }
+    if (av_hwdevice_ctx_create(&anim->hw_device_ctx, config->device_type, nullptr, nullptr, 0) <
+        0)
+    {
+      continue;
+    }
+
+    anim->hw_pix_fmt = config->pix_fmt;
+    codec_ctx->hw_device_ctx = av_buffer_ref(anim->hw_device_ctx);
+    codec_ctx->opaque = anim;
+    codec_ctx->get_format = ffmpeg_hw_get_format;
+    av_log(anim->pFormatCtx,
+           AV_LOG_INFO,
+           "Using %s hardware decoding.\n",
+           av_hwdevice_get_type_name(config->device_type));
+    return;
+  }
+}
+
 static int startffmpeg(ImBufAnim *anim)
 {
   const AVCodec *pCodec;
@@ -245,11 +365,6 @@ static int startffmpeg(ImBufAnim *anim)
   double frs_den;
   int streamcount;
 
-  /* The following for color space determination */
-  int srcRange, dstRange, brightness, contrast, saturation;
-  int *table;
-  const int *inv_table;
-
   if (anim == nullptr) {
     return (-1);
   }
@@ -313,13 +428,25 @@ static int startffmpeg(ImBufAnim *anim)
     pCodecCtx->thread_type = FF_THREAD_SLICE;
   }
 
+  /* De-interlacing operates on frames of the pixel format of the codec, so it is not supported
+   * together with hardware decoding. */
+  anim->hw_pix_fmt = AV_PIX_FMT_NONE;
+  anim->pFormatCtx = pFormatCtx;
+  if ((anim->ib_flags & IB_animhwdecode) && !(anim->ib_flags & IB_animdeinterlace)) {
+    ffmpeg_hw_decode_init(anim, pCodec, pCodecCtx);
+  }
+
   if (avcodec_open2(pCodecCtx, pCodec, nullptr) < 0) {
+    av_buffer_unref(&anim->hw_device_ctx);
+    anim->pFormatCtx = nullptr;
     avformat_close_input(&pFormatCtx);
     return -1;
   }
   if (pCodecCtx->pix_fmt == AV_PIX_FMT_NONE) {
     avcodec_free_context(&anim->pCodecCtx);
     avformat_close_input(&pFormatCtx);
+    av_buffer_unref(&anim->hw_device_ctx);
+    anim->pFormatCtx = nullptr;
     return -1;
   }
 
@@ -375,6 +502,7 @@ static int startffmpeg(ImBufAnim *anim)
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = nullptr;
     return -1;
   }
@@ -388,6 +516,7 @@ static int startffmpeg(ImBufAnim *anim)
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = nullptr;
     return -1;
   }
@@ -409,16 +538,7 @@ static int startffmpeg(ImBufAnim *anim)
         1);
   }
 
-  anim->img_convert_ctx = BKE_ffmpeg_sws_get_context(anim->x,
-                                                     anim->y,
-                                                     anim->pCodecCtx->pix_fmt,
-                                                     anim->x,
-                                                     anim->y,
-                                                     AV_PIX_FMT_RGBA,
-                                                     SWS_BILINEAR | SWS_PRINT_INFO |
-                                                         SWS_FULL_CHR_H_INT);
-
-  if (!anim->img_convert_ctx) {
+  if (!ffmpeg_sws_context_create(anim, anim->pCodecCtx->pix_fmt)) {
     fprintf(stderr, "Can't transform color space??? Bailing out...\n");
     avcodec_free_context(&anim->pCodecCtx);
     avformat_close_input(&anim->pFormatCtx);
@@ -427,39 +547,11 @@ static int startffmpeg(ImBufAnim *anim)
     av_frame_free(&anim->pFrameDeinterlaced);
     av_frame_free(&anim->pFrame);
     av_frame_free(&anim->pFrame_backup);
+    av_buffer_unref(&anim->hw_device_ctx);
     anim->pCodecCtx = nullptr;
     return -1;
   }
 
-  /* Try do detect if input has 0-255 YCbCR range (JFIF, JPEG, Motion-JPEG). */
-  if (!sws_getColorspaceDetails(anim->img_convert_ctx,
-                                (int **)&inv_table,
-                                &srcRange,
-                                &table,
-                                &dstRange,
-                                &brightness,
-                                &contrast,
-                                &saturation))
-  {
-    srcRange = srcRange || anim->pCodecCtx->color_range == AVCOL_RANGE_JPEG;
-    inv_table = sws_getCoefficients(anim->pCodecCtx->colorspace);
-
-    if (sws_setColorspaceDetails(anim->img_convert_ctx,
-                                 (int *)inv_table,
-                                 srcRange,
-                                 table,
-                                 dstRange,
-                                 brightness,
-                                 contrast,
-                                 saturation))
-    {
-      fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-    }
-  }
-  else {
-    fprintf(stderr, "Warning: Could not set libswscale colorspace details.\n");
-  }
-
   return 0;
 }
 
@@ -559,6 +651,15 @@ static void ffmpeg_postprocess(ImBufAnim *anim, AVFrame *input, ImBuf *ibuf)
     }
   }
 
+  /* Frames downloaded from hardware decoders use the software format of the device, which can
+   * differ from the pixel format of the codec. */
+  if (input->format != anim->img_convert_ctx_pix_fmt &&
+      !ffmpeg_sws_context_create(anim, AVPixelFormat(input->format)))
+  {
+    fprintf(stderr, "ffmpeg_fetchibuf: unsupported pixel format of decoded frame...\n");
+    return;
+  }
+
   /* If final destination image layout matches that of decoded RGB frame (including
    * any line padding done by ffmpeg for SIMD alignment), we can directly
    * decode into that, doing the vertical flip in the same step. Otherwise have
@@ -681,6 +782,36 @@ static int ffmpeg_read_video_frame(ImBufAnim *anim, AVPacket *packet)
   return ret;
 }
 
+/**
+ * Receive a decoded frame into `anim->pFrame`, downloading it to system memory if it was decoded
+ * on a hardware device. Returns true if a frame was received.
+ */
+static bool ffmpeg_receive_frame(ImBufAnim *anim)
+{
+  if (avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) != 0) {
+    return false;
+  }
+
+  if (anim->pFrame->format != anim->hw_pix_fmt || anim->hw_pix_fmt == AV_PIX_FMT_NONE) {
+    return true;
+  }
+
+  AVFrame *sw_frame = av_frame_alloc();
+  if (av_hwframe_transfer_data(sw_frame, anim->pFrame, 0) < 0 ||
+      av_frame_copy_props(sw_frame, anim->pFrame) < 0)
+  {
+    av_log(anim->pFormatCtx, AV_LOG_ERROR, "  DECODE: hardware frame transfer failed\n");
+    av_frame_free(&sw_frame);
+    av_frame_unref(anim->pFrame);
+    return false;
+  }
+
+  av_frame_unref(anim->pFrame);
+  av_frame_move_ref(anim->pFrame, sw_frame);
+  av_frame_free(&sw_frame);
+  return true;
+}
+
 /* decode one video frame also considering the packet read into cur_packet */
 static int ffmpeg_decode_video_frame(ImBufAnim *anim)
 {
@@ -688,7 +819,7 @@ static int ffmpeg_decode_video_frame(ImBufAnim *anim)
 
   /* Sometimes, decoder returns more than one frame per sent packet. Check if frames are available.
    * This frames must be read, otherwise decoding will fail. See #91405. */
-  anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+  anim->pFrame_complete = ffmpeg_receive_frame(anim);
   if (anim->pFrame_complete) {
     av_log(anim->pFormatCtx, AV_LOG_DEBUG, "  DECODE FROM CODEC BUFFER\n");
     ffmpeg_decode_store_frame_pts(anim);
@@ -715,7 +846,7 @@ static int ffmpeg_decode_video_frame(ImBufAnim *anim)
            (anim->cur_packet->flags & AV_PKT_FLAG_KEY) ? " KEY" : "");
 
     avcodec_send_packet(anim->pCodecCtx, anim->cur_packet);
-    anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+    anim->pFrame_complete = ffmpeg_receive_frame(anim);
 
     if (anim->pFrame_complete) {
       ffmpeg_decode_store_frame_pts(anim);
@@ -728,7 +859,7 @@ static int ffmpeg_decode_video_frame(ImBufAnim *anim)
   if (rval == AVERROR_EOF) {
     /* Flush any remaining frames out of the decoder. */
     avcodec_send_packet(anim->pCodecCtx, nullptr);
-    anim->pFrame_complete = avcodec_receive_frame(anim->pCodecCtx, anim->pFrame) == 0;
+    anim->pFrame_complete = ffmpeg_receive_frame(anim);
 
     if (anim->pFrame_complete) {
       ffmpeg_decode_store_frame_pts(anim);
@@ -1082,9 +1213,39 @@ static bool ffmpeg_must_decode(ImBufAnim *anim, int position)
   return !anim->pFrame_complete || anim->cur_position != position;
 }
 
-static bool ffmpeg_must_seek(ImBufAnim *anim, int position)
+/* Check if the frame with the given PTS is ahead of the current frame in the same GOP, using the
+ * key frame index of the demuxer, which containers like MP4 and MOV read from the file header. In
+ * that case decoding can continue from the current frame, instead of seeking back to the key frame
+ * and decoding the GOP again. */
+static bool ffmpeg_can_scan_to_pts(ImBufAnim *anim, int64_t pts_to_search)
+{
+#if LIBAVFORMAT_VERSION_INT >= AV_VERSION_INT(58, 78, 100)
+  if (ffmpeg_is_first_frame_decode(anim) || pts_to_search <= anim->cur_pts) {
+    return false;
+  }
+
+  AVStream *v_st = anim->pFormatCtx->streams[anim->videoStream];
+  if (avformat_index_get_entries_count(v_st) == 0) {
+    return false;
+  }
+
+  const int current_key_frame = av_index_search_timestamp(
+      v_st, anim->cur_pts, AVSEEK_FLAG_BACKWARD);
+  const int requested_key_frame = av_index_search_timestamp(
+      v_st, pts_to_search, AVSEEK_FLAG_BACKWARD);
+  return current_key_frame >= 0 && current_key_frame == requested_key_frame;
+#else
+  UNUSED_VARS(anim, pts_to_search);
+  return false;
+#endif
+}
+
+static bool ffmpeg_must_seek(ImBufAnim *anim, int position, int64_t pts_to_search)
 {
   bool must_seek = position != anim->cur_position + 1 || ffmpeg_is_first_frame_decode(anim);
+  if (must_seek && ffmpeg_can_scan_to_pts(anim, pts_to_search)) {
+    must_seek = false;
+  }
   anim->seek_before_decode = must_seek;
   return must_seek;
 }
@@ -1114,7 +1275,7 @@ static ImBuf *ffmpeg_fetchibuf(ImBufAnim *anim, int position, IMB_Timecode_Type
          start_pts);
 
   if (ffmpeg_must_decode(anim, position)) {
-    if (ffmpeg_must_seek(anim, position)) {
+    if (ffmpeg_must_seek(anim, position, pts_to_search)) {
       ffmpeg_seek_to_key_frame(anim, position, tc_index, pts_to_search);
     }
 
@@ -1179,6 +1340,8 @@ static void free_anim_ffmpeg(ImBufAnim *anim)
     }
     av_frame_free(&anim->pFrameDeinterlaced);
     BKE_ffmpeg_sws_release_context(anim->img_convert_ctx);
+    anim->img_convert_ctx = nullptr;
+    av_buffer_unref(&anim->hw_device_ctx);
   }
   anim->duration_in_frames = 0;
 }
@@ -4160,40 +4160,44 @@ void IMB_colormanagement_processor_apply(ColormanageProcessor *cm_processor,
                                          int channels,
                                          bool predivide)
 {
-  /* apply curve mapping */
-  if (cm_processor->curve_mapping) {
-    int x, y;
+  using namespace blender;
 
-    for (y = 0; y < height; y++) {
-      for (x = 0; x < width; x++) {
-        float *pixel = buffer + channels * (size_t(y) * width + x);
+  /* Process blocks of scanlines in parallel. OCIO CPU processors are safe to use from multiple
+   * threads, and callers that already split work into chunks only add a little overhead here. */
+  const int64_t grain_size = max_ii(1, (64 * 1024) / max_ii(1, width));
+  threading::parallel_for(IndexRange(height), grain_size, [&](const IndexRange y_range) {
+    float *block = buffer + size_t(channels) * width * y_range.first();
 
-        curve_mapping_apply_pixel(cm_processor->curve_mapping, pixel, channels);
+    /* apply curve mapping */
+    if (cm_processor->curve_mapping) {
+      const size_t pixel_count = size_t(width) * y_range.size();
+      for (size_t i = 0; i < pixel_count; i++) {
+        curve_mapping_apply_pixel(cm_processor->curve_mapping, block + channels * i, channels);
       }
     }
-  }
 
-  if (cm_processor->cpu_processor && channels >= 3) {
-    OCIO_PackedImageDesc *img;
+    if (cm_processor->cpu_processor && channels >= 3) {
+      OCIO_PackedImageDesc *img;
 
-    /* apply OCIO processor */
-    img = OCIO_createOCIO_PackedImageDesc(buffer,
-                                          width,
-                                          height,
-                                          channels,
-                                          sizeof(float),
-                                          size_t(channels) * sizeof(float),
-                                          size_t(channels) * sizeof(float) * width);
+      /* apply OCIO processor */
+      img = OCIO_createOCIO_PackedImageDesc(block,
+                                            width,
+                                            y_range.size(),
+                                            channels,
+                                            sizeof(float),
+                                            size_t(channels) * sizeof(float),
+                                            size_t(channels) * sizeof(float) * width);
 
-    if (predivide) {
-      OCIO_cpuProcessorApply_predivide(cm_processor->cpu_processor, img);
-    }
-    else {
-      OCIO_cpuProcessorApply(cm_processor->cpu_processor, img);
-    }
+      if (predivide) {
+        OCIO_cpuProcessorApply_predivide(cm_processor->cpu_processor, img);
+      }
+      else {
+        OCIO_cpuProcessorApply(cm_processor->cpu_processor, img);
+      }
 
-    OCIO_PackedImageDescRelease(img);
-  }
+      OCIO_PackedImageDescRelease(img);
+    }
+  });
 }
 
 void IMB_colormanagement_processor_apply_byte(
@@ -4203,15 +4207,19 @@ void IMB_colormanagement_processor_apply_byte(
    * but for now it's not so important.
    */
   BLI_assert(channels == 4);
-  float pixel[4];
-  for (int y = 0; y < height; y++) {
-    for (int x = 0; x < width; x++) {
-      size_t offset = channels * (size_t(y) * width + x);
-      rgba_uchar_to_float(pixel, buffer + offset);
-      IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
-      rgba_float_to_uchar(buffer + offset, pixel);
+  using namespace blender;
+  const int64_t grain_size = max_ii(1, (64 * 1024) / max_ii(1, width));
+  threading::parallel_for(IndexRange(height), grain_size, [&](const IndexRange y_range) {
+    float pixel[4];
+    for (const int y : y_range) {
+      for (int x = 0; x < width; x++) {
+        size_t offset = channels * (size_t(y) * width + x);
+        rgba_uchar_to_float(pixel, buffer + offset);
+        IMB_colormanagement_processor_apply_v4(cm_processor, pixel);
+        rgba_float_to_uchar(buffer + offset, pixel);
+      }
     }
-  }
+  });
 }
 
 void IMB_colormanagement_processor_free(ColormanageProcessor *cm_processor)
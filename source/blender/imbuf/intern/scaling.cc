@@ -10,6 +10,7 @@
 #include <cmath>
 
 #include "BLI_math_vector.hh"
+#include "BLI_simd.hh"
 #include "BLI_task.hh"
 #include "BLI_utildefines.h"
 #include "MEM_guardedalloc.h"
@@ -366,7 +367,18 @@ static void alloc_scale_dst_buffers(
 
 static inline float4 load_pixel(const uchar4 *ptr)
 {
+#if BLI_HAVE_SSE2
+  /* Widen the 4 bytes to 32 bit integers in registers, instead of converting
+   * each channel separately. */
+  __m128i rgba8 = _mm_cvtsi32_si128(*(const int *)ptr);
+  __m128i rgba16 = _mm_unpacklo_epi8(rgba8, _mm_setzero_si128());
+  __m128i rgba32 = _mm_unpacklo_epi16(rgba16, _mm_setzero_si128());
+  float4 pix;
+  _mm_storeu_ps(pix, _mm_cvtepi32_ps(rgba32));
+  return pix;
+#else
   return float4(ptr[0]);
+#endif
 }
 static inline float4 load_pixel(const float *ptr)
 {
@@ -386,7 +398,17 @@ static inline float4 load_pixel(const float4 *ptr)
 }
 static inline void store_pixel(float4 pix, uchar4 *ptr)
 {
+#if BLI_HAVE_SSE2
+  /* Filtered values are never negative, so adding 0.5 and truncating matches rounding. Packing
+   * with saturation narrows all channels at once. */
+  __m128 rgba = _mm_add_ps(_mm_loadu_ps(pix), _mm_set1_ps(0.5f));
+  __m128i rgba32 = _mm_cvttps_epi32(rgba);
+  __m128i rgba16 = _mm_packs_epi32(rgba32, _mm_setzero_si128());
+  __m128i rgba8 = _mm_packus_epi16(rgba16, _mm_setzero_si128());
+  *(int *)ptr = _mm_cvtsi128_si32(rgba8);
+#else
   *ptr = uchar4(blender::math::round(pix));
+#endif
 }
 static inline void store_pixel(float4 pix, float *ptr)
 {
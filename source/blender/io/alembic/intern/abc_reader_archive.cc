@@ -15,11 +15,13 @@
 
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_threads.h"
 
 #ifdef WIN32
 #  include "utfconv.hh"
 #endif
 
+#include <algorithm>
 #include <fstream>
 #include <vector>
 
@@ -111,16 +113,29 @@ ArchiveReader::ArchiveReader(const Main *bmain, const char *filename)
   STRNCPY(abs_filepath, filename);
   BLI_path_abs(abs_filepath, BKE_main_blendfile_path(bmain));
 
+  const int streams_num = std::clamp(BLI_system_thread_count(), 1, 8);
+
 #ifdef WIN32
   UTF16_ENCODE(abs_filepath);
   std::wstring wstr(abs_filepath_16);
-  m_infile.open(wstr.c_str(), std::ios::in | std::ios::binary);
-  UTF16_UN_ENCODE(abs_filepath);
+#endif
+  for (int i = 0; i < streams_num; i++) {
+    std::unique_ptr<std::ifstream> infile = std::make_unique<std::ifstream>();
+#ifdef WIN32
+    infile->open(wstr.c_str(), std::ios::in | std::ios::binary);
 #else
-  m_infile.open(abs_filepath, std::ios::in | std::ios::binary);
+    infile->open(abs_filepath, std::ios::in | std::ios::binary);
+#endif
+    if (!infile->is_open() && !m_infiles.empty()) {
+      /* Running out of file handles is not fatal, read with the streams opened so far. */
+      break;
+    }
+    m_streams.push_back(infile.get());
+    m_infiles.push_back(std::move(infile));
+  }
+#ifdef WIN32
+  UTF16_UN_ENCODE(abs_filepath);
 #endif
-
-  m_streams.push_back(&m_infile);
 
   m_archive = open_archive(abs_filepath, m_streams);
 }
@@ -11,6 +11,7 @@
 #include <Alembic/Abc/IObject.h>
 
 #include <fstream>
+#include <memory>
 #include <vector>
 
 struct Main;
@@ -24,7 +25,10 @@ namespace blender::io::alembic {
  */
 class ArchiveReader {
   Alembic::Abc::IArchive m_archive;
-  std::ifstream m_infile;
+  /* Several streams on the same file, so that Ogawa can read from multiple threads at once
+   * (e.g. when evaluating cache modifiers of different objects) instead of serializing all reads
+   * on a single stream. */
+  std::vector<std::unique_ptr<std::ifstream>> m_infiles;
   std::vector<std::istream *> m_streams;
 
   std::vector<ArchiveReader *> m_readers;
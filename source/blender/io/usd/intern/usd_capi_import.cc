@@ -25,6 +25,7 @@
 #include "BLI_math_rotation.h"
 #include "BLI_path_utils.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_timeit.hh"
 
 #include "BLT_translation.hh"
@@ -336,6 +337,20 @@ static void import_startjob(void *customdata, wmJobWorkerStatus *worker_status)
     }
   }
 
+  /* Convert prim data that does not depend on `Main` in parallel, leaving only the final
+   * assignment to Blender data to the serial loop below. */
+  const Span<USDPrimReader *> readers = archive->readers();
+  threading::parallel_for(readers.index_range(), 16, [&](const IndexRange range) {
+    for (const int64_t reader_index : range) {
+      if (G.is_break) {
+        return;
+      }
+      if (USDPrimReader *reader = readers[reader_index]) {
+        reader->prepare_object_data(0.0);
+      }
+    }
+  });
+
   /* Setup parenthood and read actual object data. */
   i = 0;
   for (USDPrimReader *reader : archive->readers()) {
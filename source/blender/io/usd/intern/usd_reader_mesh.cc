@@ -17,6 +17,7 @@
 #include "BKE_attribute.hh"
 #include "BKE_customdata.hh"
 #include "BKE_geometry_set.hh"
+#include "BKE_lib_id.hh"
 #include "BKE_main.hh"
 #include "BKE_material.h"
 #include "BKE_mesh.hh"
@@ -170,6 +171,13 @@ USDMeshReader::USDMeshReader(const pxr::UsdPrim &prim,
 {
 }
 
+USDMeshReader::~USDMeshReader()
+{
+  if (prepared_mesh_ != nullptr) {
+    BKE_id_free(nullptr, prepared_mesh_);
+  }
+}
+
 void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/)
 {
   Mesh *mesh = BKE_mesh_add(bmain, name_.c_str());
@@ -178,8 +186,9 @@ void USDMeshReader::create_object(Main *bmain, const double /*motionSampleTime*/
   object_->data = mesh;
 }
 
-void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+void USDMeshReader::prepare_object_data(const double motionSampleTime)
 {
+  BLI_assert(!is_prepared_);
   Mesh *mesh = (Mesh *)object_->data;
 
   is_initial_load_ = true;
@@ -187,8 +196,24 @@ void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
                                                            import_params_.mesh_read_flag);
 
   Mesh *read_mesh = this->read_mesh(mesh, params, nullptr);
+  if (read_mesh != mesh) {
+    prepared_mesh_ = read_mesh;
+  }
 
   is_initial_load_ = false;
+  is_prepared_ = true;
+}
+
+void USDMeshReader::read_object_data(Main *bmain, const double motionSampleTime)
+{
+  Mesh *mesh = (Mesh *)object_->data;
+
+  if (!is_prepared_) {
+    this->prepare_object_data(motionSampleTime);
+  }
+  Mesh *read_mesh = prepared_mesh_ ? prepared_mesh_ : mesh;
+  prepared_mesh_ = nullptr;
+
   if (read_mesh != mesh) {
     BKE_mesh_nomain_to_mesh(read_mesh, mesh, object_);
   }
@@ -109,6 +109,11 @@ class USDPrimReader {
 
   virtual void create_object(Main *bmain, double motionSampleTime) = 0;
   virtual void read_object_data(Main * /*bmain*/, double /*motionSampleTime*/){};
+  /**
+   * Optionally convert prim data ahead of #read_object_data(), without touching `Main` or the
+   * object. The importer calls this for many readers concurrently, after #create_object().
+   */
+  virtual void prepare_object_data(double /*motionSampleTime*/){};
 
   Object *object() const;
   void object(Object *ob);
@@ -8,6 +8,7 @@
 
 #include <cstdio>
 #include <memory>
+#include <mutex>
 #include <system_error>
 
 #include "BKE_context.hh"
@@ -204,7 +205,13 @@ static void write_mesh_objects(const Span<std::unique_ptr<OBJMesh>> exportable_a
     offsets.normal_offset += obj.get_normal_coords().size();
   }
 
-  /* Parallel over meshes: main result writing. */
+  /* Parallel over meshes: main result writing. Text buffers are written into the file, in
+   * object order, as soon as they and all the preceding ones are finished. This overlaps file
+   * output with formatting, and does not keep the whole file text in memory. */
+  FILE *f = obj_writer.get_outfile();
+  std::mutex write_mutex;
+  Array<bool> finished(count, false);
+  size_t next_to_write = 0;
   threading::parallel_for(IndexRange(count), 1, [&](IndexRange range) {
     for (const int i : range) {
       OBJMesh &obj = *exportable_as_mesh[i];
@@ -242,14 +249,16 @@ static void write_mesh_objects(const Span<std::unique_ptr<OBJMesh>> exportable_a
       /* Nothing will need this object's data after this point, release
        * various arrays here. */
       obj.clear();
+
+      std::scoped_lock lock(write_mutex);
+      finished[i] = true;
+      while (next_to_write < count && finished[next_to_write]) {
+        buffers[next_to_write].write_to_file(f);
+        next_to_write++;
+      }
     }
   });
-
-  /* Write all the object text buffers into the output file. */
-  FILE *f = obj_writer.get_outfile();
-  for (auto &b : buffers) {
-    b.write_to_file(f);
-  }
+  BLI_assert(next_to_write == count);
 }
 
 /**
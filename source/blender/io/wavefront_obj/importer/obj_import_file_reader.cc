@@ -14,6 +14,7 @@
 #include "BLI_math_vector_types.hh"
 #include "BLI_string.h"
 #include "BLI_string_ref.hh"
+#include "BLI_task.hh"
 #include "BLI_vector.hh"
 
 #include "obj_export_mtl.hh"
@@ -499,58 +500,9 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
   string state_material_name;
   int state_material_index = -1;
 
-  /* Read the input file in chunks. We need up to twice the possible chunk size,
-   * to possibly store remainder of the previous input line that got broken mid-chunk. */
-  Array<char> buffer(read_buffer_size_ * 2);
-
-  size_t buffer_offset = 0;
+  /* Parse a buffer that ends with a newline, line by line. */
   size_t line_number = 0;
-  while (true) {
-    /* Read a chunk of input from the file. */
-    size_t bytes_read = fread(buffer.data() + buffer_offset, 1, read_buffer_size_, obj_file_);
-    if (bytes_read == 0 && buffer_offset == 0) {
-      break; /* No more data to read. */
-    }
-
-    /* Take care of line continuations now (turn them into spaces);
-     * the rest of the parsing code does not need to worry about them anymore. */
-    fixup_line_continuations(buffer.data() + buffer_offset,
-                             buffer.data() + buffer_offset + bytes_read);
-
-    /* Ensure buffer ends in a newline. */
-    if (bytes_read < read_buffer_size_) {
-      if (bytes_read == 0 || buffer[buffer_offset + bytes_read - 1] != '\n') {
-        buffer[buffer_offset + bytes_read] = '\n';
-        bytes_read++;
-      }
-    }
-
-    size_t buffer_end = buffer_offset + bytes_read;
-    if (buffer_end == 0) {
-      break;
-    }
-
-    /* Find last newline. */
-    size_t last_nl = buffer_end;
-    while (last_nl > 0) {
-      --last_nl;
-      if (buffer[last_nl] == '\n') {
-        break;
-      }
-    }
-    if (buffer[last_nl] != '\n') {
-      /* Whole line did not fit into our read buffer. Warn and exit. */
-      fprintf(stderr,
-              "OBJ file contains a line #%zu that is too long (max. length %zu)\n",
-              line_number,
-              read_buffer_size_);
-      break;
-    }
-    ++last_nl;
-
-    /* Parse the buffer (until last newline) that we have so far,
-     * line by line. */
-    StringRef buffer_str{buffer.data(), int64_t(last_nl)};
+  auto parse_lines = [&](StringRef buffer_str) {
     while (!buffer_str.is_empty()) {
       StringRef line = read_next_line(buffer_str);
       const char *p = line.begin(), *end = line.end();
@@ -671,12 +623,73 @@ void OBJParser::parse(Vector<std::unique_ptr<Geometry>> &r_all_geometries,
         std::cout << "OBJ element not recognized: '" << std::string(p, end) << "'" << std::endl;
       }
     }
+  };
+
+  /* Read a chunk of input from the file into `buf`, after the `offset` bytes of a line that got
+   * broken mid-chunk. Returns the size of the valid data in the buffer. */
+  auto read_chunk = [&](char *buf, const size_t offset) -> size_t {
+    size_t bytes_read = fread(buf + offset, 1, read_buffer_size_, obj_file_);
+    if (bytes_read == 0 && offset == 0) {
+      return 0; /* No more data to read. */
+    }
+
+    /* Take care of line continuations now (turn them into spaces);
+     * the rest of the parsing code does not need to worry about them anymore. */
+    fixup_line_continuations(buf + offset, buf + offset + bytes_read);
+
+    /* Ensure buffer ends in a newline. */
+    if (bytes_read < read_buffer_size_) {
+      if (bytes_read == 0 || buf[offset + bytes_read - 1] != '\n') {
+        buf[offset + bytes_read] = '\n';
+        bytes_read++;
+      }
+    }
+    return offset + bytes_read;
+  };
+
+  /* Read the input file in chunks. We need up to twice the possible chunk size,
+   * to possibly store remainder of the previous input line that got broken mid-chunk.
+   * Two buffers are used, so that the next chunk is read while the current one is parsed. */
+  Array<char> buffers[2] = {Array<char>(read_buffer_size_ * 2),
+                            Array<char>(read_buffer_size_ * 2)};
+  int buffer_index = 0;
+
+  size_t buffer_end = read_chunk(buffers[buffer_index].data(), 0);
+  while (buffer_end != 0) {
+    char *buffer = buffers[buffer_index].data();
+
+    /* Find last newline. */
+    size_t last_nl = buffer_end;
+    while (last_nl > 0) {
+      --last_nl;
+      if (buffer[last_nl] == '\n') {
+        break;
+      }
+    }
+    if (buffer[last_nl] != '\n') {
+      /* Whole line did not fit into our read buffer. Warn and exit. */
+      fprintf(stderr,
+              "OBJ file contains a line #%zu that is too long (max. length %zu)\n",
+              line_number,
+              read_buffer_size_);
+      break;
+    }
+    ++last_nl;
 
     /* We might have a line that was cut in the middle by the previous buffer;
-     * copy it over for next chunk reading. */
-    size_t left_size = buffer_end - last_nl;
-    memmove(buffer.data(), buffer.data() + last_nl, left_size);
-    buffer_offset = left_size;
+     * copy it over to the other buffer, and read the next chunk after it while
+     * parsing the lines we have so far. */
+    char *next_buffer = buffers[1 - buffer_index].data();
+    const size_t left_size = buffer_end - last_nl;
+    memcpy(next_buffer, buffer + last_nl, left_size);
+
+    size_t next_buffer_end = 0;
+    threading::parallel_invoke(
+        [&]() { next_buffer_end = read_chunk(next_buffer, left_size); },
+        [&]() { parse_lines(StringRef(buffer, int64_t(last_nl))); });
+
+    buffer_end = next_buffer_end;
+    buffer_index = 1 - buffer_index;
   }
 
   r_global_vertices.flush_mrgb_block();
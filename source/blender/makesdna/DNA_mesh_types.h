@@ -31,6 +31,10 @@ using offset_indices::GroupedSpan;
 using offset_indices::OffsetIndices;
 template<typename T> class MutableSpan;
 template<typename T> class Span;
+namespace index_mask {
+class IndexMask;
+}  // namespace index_mask
+using index_mask::IndexMask;
 namespace bke {
 struct MeshRuntime;
 class AttributeAccessor;
@@ -402,6 +406,11 @@ typedef struct Mesh {
 
   /** Call after changing vertex positions to tag lazily calculated caches for recomputation. */
   void tag_positions_changed();
+  /**
+   * Like #tag_positions_changed but only \a changed_verts moved. Normals that are already
+   * calculated are updated for the affected part of the mesh instead of being recomputed later.
+   */
+  void tag_positions_changed(const blender::IndexMask &changed_verts);
   /** Call after moving every mesh vertex by the same translation. */
   void tag_positions_changed_uniformly();
   /** Like #tag_positions_changed but doesn't tag normals; they must be updated separately. */
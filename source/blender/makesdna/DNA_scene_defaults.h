@@ -253,6 +253,8 @@
     .light_threshold = 0.01f, \
  \
     .overscan = 3.0f, \
+ \
+    .render_tile_size = 2048, \
  \
     .flag = SCE_EEVEE_VOLUMETRIC_LIGHTS | SCE_EEVEE_GTAO_BENT_NORMALS | \
                     SCE_EEVEE_GTAO_BOUNCE | SCE_EEVEE_TAA_REPROJECTION | \
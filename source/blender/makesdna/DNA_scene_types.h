@@ -1966,6 +1966,10 @@ typedef struct SceneEEVEE {
 
   float overscan;
   float light_threshold;
+
+  /** Size in pixels of the tiles of final renders, see #SCE_EEVEE_RENDER_TILES. */
+  int render_tile_size;
+  char _pad1[4];
 } SceneEEVEE;
 
 typedef struct SceneGpencil {
@@ -2915,6 +2919,7 @@ enum {
   SCE_EEVEE_SHADOW_JITTERED_VIEWPORT = (1 << 26),
   SCE_EEVEE_VOLUME_CUSTOM_RANGE = (1 << 27),
   SCE_EEVEE_FAST_GI_ENABLED = (1 << 28),
+  SCE_EEVEE_RENDER_TILES = (1 << 29),
 };
 
 typedef enum RaytraceEEVEE_Flag {
@@ -200,7 +200,8 @@ typedef struct Sequence {
 
   /** Stream-index for movie or sound files with several streams. */
   short streamindex;
-  short _pad1;
+  /** Movie decoding flags, see #SEQ_MOVIE_USE_HW_DECODE. */
+  short movie_flag;
   /** For multi-camera source selection. */
   int multicam_source;
   /** MOVIECLIP render flags. */
@@ -655,6 +656,11 @@ enum {
   SEQ_INVALID_EFFECT = (1u << 31),
 };
 
+/** #Sequence.movie_flag */
+enum {
+  SEQ_MOVIE_USE_HW_DECODE = (1 << 0),
+};
+
 /** #StripProxy.storage */
 enum {
   SEQ_STORAGE_PROXY_CUSTOM_FILE = (1 << 1), /* store proxy in custom directory */
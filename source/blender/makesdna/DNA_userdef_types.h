@@ -760,7 +760,8 @@ typedef struct UserDef_Experimental {
   char use_new_file_import_nodes;
   char use_shader_node_previews;
   char enable_new_cpu_compositor;
-  char _pad[3];
+  char use_geometry_nodes_gpu_fields;
+  char _pad[2];
   /** `makesdna` does not allow empty structs. */
 } UserDef_Experimental;
 
@@ -974,7 +975,8 @@ typedef struct UserDef {
   int prefetchframes;
   /** Control the rotation step of the view when PAD2, PAD4, PAD6&PAD8 is use. */
   float pad_rot_angle;
-  char _pad12[4];
+  /** Maximum memory used by the GPU textures of images, in megabytes (0 for no limit). */
+  int texmemlimit;
   /** Rotating view icon size. */
   short rvisize;
   /** Rotating view icon brightness. */
@@ -685,6 +685,32 @@ static void rna_ChannelBag_fcurve_clear(ID *dna_action_id,
   WM_event_add_notifier(C, NC_ANIMATION | ND_KEYFRAME | NA_EDITED, nullptr);
 }
 
+static void rna_ChannelBag_fcurve_evaluate(ActionChannelBag *dna_channelbag,
+                                           ReportList *reports,
+                                           const float *frames,
+                                           const int frames_num,
+                                           float **r_values,
+                                           int *r_values_num)
+{
+  const Span<float> evaltimes(frames, frames_num);
+  if (!std::is_sorted(evaltimes.begin(), evaltimes.end())) {
+    BKE_report(reports, RPT_ERROR, "Frames must be sorted in ascending order");
+    *r_values = nullptr;
+    *r_values_num = 0;
+    return;
+  }
+
+  const Span<const FCurve *> fcurves = std::as_const(dna_channelbag->wrap()).fcurves();
+  *r_values_num = int(fcurves.size() * evaltimes.size());
+  if (*r_values_num == 0) {
+    *r_values = nullptr;
+    return;
+  }
+  *r_values = static_cast<float *>(
+      MEM_mallocN(sizeof(**r_values) * size_t(*r_values_num), __func__));
+  evaluate_fcurves_times(fcurves, evaltimes, {*r_values, *r_values_num});
+}
+
 static void rna_iterator_ChannelBag_groups_begin(CollectionPropertyIterator *iter, PointerRNA *ptr)
 {
   animrig::ChannelBag &bag = rna_data_channelbag(ptr);
@@ -2333,6 +2359,37 @@ static void rna_def_channelbag_fcurves(BlenderRNA *brna, PropertyRNA *cprop)
   func = RNA_def_function(srna, "clear", "rna_ChannelBag_fcurve_clear");
   RNA_def_function_flag(func, FUNC_USE_CONTEXT | FUNC_USE_SELF_ID);
   RNA_def_function_ui_description(func, "Remove all F-Curves from this channelbag");
+
+  /* ChannelBag.fcurves.evaluate(...) */
+  func = RNA_def_function(srna, "evaluate", "rna_ChannelBag_fcurve_evaluate");
+  RNA_def_function_ui_description(
+      func,
+      "Evaluate all F-Curves at the given frames in parallel, which is much faster than "
+      "evaluating each F-Curve at each frame separately");
+  RNA_def_function_flag(func, FUNC_USE_REPORTS);
+  parm = RNA_def_float_array(func,
+                             "frames",
+                             1,
+                             nullptr,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "Frames",
+                             "Frames to evaluate the F-Curves at, in ascending order",
+                             -FLT_MAX,
+                             FLT_MAX);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_REQUIRED);
+  parm = RNA_def_float_array(func,
+                             "values",
+                             1,
+                             nullptr,
+                             -FLT_MAX,
+                             FLT_MAX,
+                             "Values",
+                             "The values of all F-Curves at all frames, one F-Curve after the "
+                             "other",
+                             -FLT_MAX,
+                             FLT_MAX);
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, PARM_OUTPUT);
 }
 
 static void rna_def_channelbag_groups(BlenderRNA *brna, PropertyRNA *cprop)
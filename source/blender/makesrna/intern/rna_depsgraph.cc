@@ -281,6 +281,32 @@ static void rna_Depsgraph_debug_stats_gnuplot(Depsgraph *depsgraph,
   fclose(f);
 }
 
+static void rna_Depsgraph_debug_trace_begin(Depsgraph *depsgraph)
+{
+  DEG_debug_trace_begin(depsgraph);
+}
+
+static void rna_Depsgraph_debug_trace_end(Depsgraph *depsgraph, const char *filepath)
+{
+  DEG_debug_trace_end(depsgraph);
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    return;
+  }
+  const std::string json_str = DEG_debug_trace_to_json(*depsgraph);
+  fprintf(f, "%s", json_str.c_str());
+  fclose(f);
+}
+
+static void rna_Depsgraph_debug_memory_report(Depsgraph *depsgraph,
+                                              const char **r_str,
+                                              int *r_len)
+{
+  const std::string report = DEG_debug_memory_report(*depsgraph);
+  *r_len = report.size();
+  *r_str = BLI_strdup(report.c_str());
+}
+
 static void rna_Depsgraph_debug_tag_update(Depsgraph *depsgraph)
 {
   DEG_graph_tag_relations_update(depsgraph);
@@ -732,6 +758,25 @@ static void rna_def_depsgraph(BlenderRNA *brna)
                                   "File name where gnuplot script will save the result");
   RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
 
+  func = RNA_def_function(srna, "debug_trace_begin", "rna_Depsgraph_debug_trace_begin");
+  RNA_def_function_ui_description(
+      func, "Start recording the evaluation time and thread of every operation");
+
+  func = RNA_def_function(srna, "debug_trace_end", "rna_Depsgraph_debug_trace_end");
+  RNA_def_function_ui_description(
+      func, "Stop recording operations and write them in the Chrome trace event format");
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the JSON trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
+  func = RNA_def_function(srna, "debug_memory_report", "rna_Depsgraph_debug_memory_report");
+  RNA_def_function_ui_description(
+      func, "Report the geometry memory used by the original and evaluated data of every ID");
+  parm = RNA_def_string(func, "report", nullptr, INT32_MAX, "Report", "");
+  RNA_def_parameter_flags(parm, PROP_DYNAMIC, ParameterFlag(0));
+  RNA_def_parameter_clear_flags(parm, PROP_NEVER_NULL, ParameterFlag(0));
+  RNA_def_function_output(func, parm);
+
   func = RNA_def_function(srna, "debug_tag_update", "rna_Depsgraph_debug_tag_update");
 
   func = RNA_def_function(srna, "debug_stats", "rna_Depsgraph_debug_stats");
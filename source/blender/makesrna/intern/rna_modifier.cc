@@ -2024,6 +2024,27 @@ static int rna_NodesModifierWarning_type_get(PointerRNA *ptr)
   return int(warning->type);
 }
 
+static void rna_NodesModifier_debug_profile_begin(NodesModifierData * /*nmd*/)
+{
+  blender::nodes::geo_eval_log::set_profiling_enabled(true);
+}
+
+static void rna_NodesModifier_debug_profile_end(NodesModifierData *nmd, const char *filepath)
+{
+  blender::nodes::geo_eval_log::set_profiling_enabled(false);
+  if (!nmd->runtime->eval_log || nmd->node_group == nullptr) {
+    return;
+  }
+  FILE *f = fopen(filepath, "w");
+  if (f == nullptr) {
+    return;
+  }
+  const std::string json_str = nmd->runtime->eval_log->execution_times_to_trace_json(
+      *nmd->node_group);
+  fprintf(f, "%s", json_str.c_str());
+  fclose(f);
+}
+
 static IDProperty **rna_NodesModifier_properties(PointerRNA *ptr)
 {
   NodesModifierData *nmd = static_cast<NodesModifierData *>(ptr->data);
@@ -2542,6 +2563,24 @@ static void rna_def_modifier_subsurf(BlenderRNA *brna)
                            "levels of subdivision (smoothest possible shape)");
   RNA_def_property_update(prop, 0, "rna_Modifier_update");
 
+  prop = RNA_def_property(srna, "use_view_dependent_levels", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(
+      prop, nullptr, "flags", eSubsurfModifierFlag_UseViewDependentLevels);
+  RNA_def_property_ui_text(prop,
+                           "View Dependent",
+                           "Use fewer levels when the object is far away from the scene camera, "
+                           "the levels are used as maximum");
+  RNA_def_property_update(prop, 0, "rna_Modifier_dependency_update");
+
+  prop = RNA_def_property(srna, "view_dicing_rate", PROP_FLOAT, PROP_PIXEL);
+  RNA_def_property_range(prop, 0.1f, 1000.0f);
+  RNA_def_property_ui_range(prop, 0.5f, 100.0f, 10, 2);
+  RNA_def_property_ui_text(prop,
+                           "Dicing Rate",
+                           "Size of subdivided edges in pixels as seen from the scene camera, at "
+                           "the closest point of the object");
+  RNA_def_property_update(prop, 0, "rna_Modifier_update");
+
   RNA_define_lib_overridable(false);
 }
 
@@ -7954,6 +7993,14 @@ static void rna_def_modifier_nodes_bake(BlenderRNA *brna)
       prop, "Custom Path", "Specify a path where the baked data should be stored manually");
   RNA_def_property_update(prop, 0, "rna_NodesModifier_bake_update");
 
+  prop = RNA_def_property(srna, "use_compression", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", NODES_MODIFIER_BAKE_COMPRESS);
+  RNA_def_property_ui_text(prop,
+                           "Compress",
+                           "Compress large arrays in the baked data. This makes bakes smaller, "
+                           "but compressed arrays have to be decompressed when they are loaded");
+  RNA_def_property_update(prop, 0, "rna_NodesModifier_bake_update");
+
   prop = RNA_def_property(srna, "bake_target", PROP_ENUM, PROP_NONE);
   RNA_def_property_enum_items(prop, bake_target_in_node_items);
   RNA_def_property_ui_text(prop, "Bake Target", "Where to store the baked data");
@@ -8053,6 +8100,8 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
 {
   StructRNA *srna;
   PropertyRNA *prop;
+  FunctionRNA *func;
+  PropertyRNA *parm;
 
   rna_def_modifier_nodes_data_block(brna);
 
@@ -8118,6 +8167,18 @@ static void rna_def_modifier_nodes(BlenderRNA *brna)
                                     nullptr);
   RNA_def_property_struct_type(prop, "NodesModifierWarning");
 
+  func = RNA_def_function(srna, "debug_profile_begin", "rna_NodesModifier_debug_profile_begin");
+  RNA_def_function_ui_description(
+      func, "Start recording the output geometry memory of nodes in addition to their timings");
+
+  func = RNA_def_function(srna, "debug_profile_end", "rna_NodesModifier_debug_profile_end");
+  RNA_def_function_ui_description(func,
+                                  "Stop profiling and write the node timings of the last "
+                                  "evaluation in the Chrome trace event format");
+  parm = RNA_def_string_file_path(
+      func, "filepath", nullptr, FILE_MAX, "File Name", "Output path for the JSON trace file");
+  RNA_def_parameter_flags(parm, PropertyFlag(0), PARM_REQUIRED);
+
   rna_def_modifier_panel_open_prop(
       srna, "open_output_attributes_panel", NODES_MODIFIER_PANEL_OUTPUT_ATTRIBUTES);
   rna_def_modifier_panel_open_prop(srna, "open_manage_panel", NODES_MODIFIER_PANEL_MANAGE);
@@ -7405,7 +7405,10 @@ static void rna_def_scene_render_data(BlenderRNA *brna)
 
   prop = RNA_def_property(srna, "simplify_child_particles", PROP_FLOAT, PROP_FACTOR);
   RNA_def_property_float_sdna(prop, nullptr, "simplify_particles");
-  RNA_def_property_ui_text(prop, "Simplify Child Particles", "Global child particles percentage");
+  RNA_def_property_ui_text(prop,
+                           "Simplify Child Particles",
+                           "Global child particles percentage, also used to reduce the number of "
+                           "drawn hair curves");
   RNA_def_property_update(prop, 0, "rna_Scene_simplify_update");
 
   prop = RNA_def_property(srna, "simplify_subdivision_render", PROP_INT, PROP_UNSIGNED);
@@ -7418,7 +7421,10 @@ static void rna_def_scene_render_data(BlenderRNA *brna)
   prop = RNA_def_property(srna, "simplify_child_particles_render", PROP_FLOAT, PROP_FACTOR);
   RNA_def_property_float_sdna(prop, nullptr, "simplify_particles_render");
   RNA_def_property_ui_text(
-      prop, "Simplify Child Particles", "Global child particles percentage during rendering");
+      prop,
+      "Simplify Child Particles",
+      "Global child particles percentage during rendering, also used to reduce the number of "
+      "drawn hair curves");
   RNA_def_property_update(prop, 0, "rna_Scene_simplify_update");
 
   prop = RNA_def_property(srna, "simplify_volumes", PROP_FLOAT, PROP_FACTOR);
@@ -8630,6 +8636,21 @@ static void rna_def_scene_eevee(BlenderRNA *brna)
   RNA_def_property_ui_range(prop, 0.0f, 10.0f, 1, 2);
   RNA_def_property_override_flag(prop, PROPOVERRIDE_OVERRIDABLE_LIBRARY);
 
+  /* Render Tiles */
+  prop = RNA_def_property(srna, "use_render_tiles", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "flag", SCE_EEVEE_RENDER_TILES);
+  RNA_def_property_ui_text(prop,
+                           "Use Tiling",
+                           "Render high resolution images in tiles to reduce GPU memory usage. "
+                           "Use overscan to avoid seams in screen-space effects");
+  RNA_def_property_override_flag(prop, PROPOVERRIDE_OVERRIDABLE_LIBRARY);
+
+  prop = RNA_def_property(srna, "render_tile_size", PROP_INT, PROP_PIXEL);
+  RNA_def_property_ui_text(prop, "Tile Size", "Size of the tiles of final renders");
+  RNA_def_property_range(prop, 64, 16384);
+  RNA_def_property_ui_range(prop, 256, 8192, 256, -1);
+  RNA_def_property_override_flag(prop, PROPOVERRIDE_OVERRIDABLE_LIBRARY);
+
   prop = RNA_def_property(srna, "ray_tracing_options", PROP_POINTER, PROP_NONE);
   RNA_def_property_struct_type(prop, "RaytraceEEVEE");
   RNA_def_property_ui_text(
@@ -33,7 +33,9 @@
 #  include "BKE_editmesh.hh"
 #  include "BKE_global.hh"
 #  include "BKE_image.h"
+#  include "BKE_node.hh"
 #  include "BKE_scene.hh"
+#  include "BKE_scene_runtime.hh"
 #  include "BKE_writemovie.hh"
 
 #  include "DEG_depsgraph_query.hh"
@@ -89,6 +91,23 @@ static void rna_Scene_frame_set(Scene *scene, Main *bmain, int frame, float subf
   }
 }
 
+static float rna_Scene_compositor_node_execution_time(Scene *scene, bNode *node)
+{
+  if (!scene->nodetree) {
+    return 0.0f;
+  }
+
+  const bNodeInstanceKey key = blender::bke::node_instance_key(
+      blender::bke::NODE_INSTANCE_KEY_BASE, scene->nodetree, node);
+  const blender::timeit::Nanoseconds *execution_time =
+      scene->runtime->compositor.per_node_execution_time.lookup_ptr(key);
+  if (!execution_time) {
+    return 0.0f;
+  }
+
+  return std::chrono::duration<float>(*execution_time).count();
+}
+
 static void rna_Scene_uvedit_aspect(Scene * /*scene*/, Object *ob, float aspect[2])
 {
   if ((ob->type == OB_MESH) && (ob->mode == OB_MODE_EDIT)) {
@@ -279,6 +298,19 @@ void RNA_api_scene(StructRNA *srna)
   RNA_def_parameter_flags(parm, PROP_THICK_WRAP, ParameterFlag(0));
   RNA_def_function_output(func, parm);
 
+  func = RNA_def_function(
+      srna, "compositor_node_execution_time", "rna_Scene_compositor_node_execution_time");
+  RNA_def_function_ui_description(
+      func,
+      "Get the time in seconds it took to evaluate a node of the compositor node tree during the "
+      "last compositor evaluation, including background renders. Group nodes include the time of "
+      "their inner nodes. Zero is returned for nodes that were not evaluated or can't be "
+      "measured individually");
+  parm = RNA_def_pointer(func, "node", "Node", "", "Node in the compositor node tree of the scene");
+  RNA_def_parameter_flags(parm, PROP_NEVER_NULL, PARM_REQUIRED);
+  parm = RNA_def_float(func, "time", 0.0f, 0.0f, FLT_MAX, "", "Execution time", 0.0f, FLT_MAX);
+  RNA_def_function_return(func, parm);
+
   /* Ray Cast */
   func = RNA_def_function(srna, "ray_cast", "rna_Scene_ray_cast");
   RNA_def_function_ui_description(func, "Cast a ray onto in object space");
@@ -2866,6 +2866,15 @@ static void rna_def_movie(BlenderRNA *brna)
       "For files with several movie streams, use the stream with the given index");
   RNA_def_property_update(prop, NC_SCENE | ND_SEQUENCER, "rna_Sequence_reopen_files_update");
 
+  prop = RNA_def_property(srna, "use_hardware_decoding", PROP_BOOLEAN, PROP_NONE);
+  RNA_def_property_boolean_sdna(prop, nullptr, "movie_flag", SEQ_MOVIE_USE_HW_DECODE);
+  RNA_def_property_ui_text(
+      prop,
+      "Hardware Decoding",
+      "Decode the movie on a hardware device like the GPU if the codec and system support it, "
+      "falling back to software decoding otherwise. Not used together with deinterlacing");
+  RNA_def_property_update(prop, NC_SCENE | ND_SEQUENCER, "rna_Sequence_reopen_files_update");
+
   prop = RNA_def_property(srna, "elements", PROP_COLLECTION, PROP_NONE);
   RNA_def_property_collection_sdna(prop, nullptr, "strip->stripdata", nullptr);
   RNA_def_property_struct_type(prop, "SequenceElement");
@@ -275,4 +275,5 @@ ModifierTypeInfo modifierType_Armature = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -1099,4 +1099,5 @@ ModifierTypeInfo modifierType_Array = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -458,6 +458,32 @@ static void blend_read(BlendDataReader *reader, ModifierData *md)
   }
 }
 
+static void result_cache_key(const ModifierData *md, blender::Vector<char> &r_key)
+{
+  BevelModifierData bmd = *(const BevelModifierData *)md;
+  const CurveProfile *profile = bmd.custom_profile;
+  /* The profile is copied with the modifier, only its contents are relevant. */
+  bmd.custom_profile = nullptr;
+  BKE_modifier_result_cache_key_append_settings(&bmd.modifier, r_key);
+  if (profile == nullptr) {
+    return;
+  }
+  const auto append = [&](const auto &value) {
+    r_key.extend(blender::Span(reinterpret_cast<const char *>(&value), sizeof(value)));
+  };
+  append(profile->path_len);
+  append(profile->preset);
+  append(profile->flag);
+  for (const CurveProfilePoint &point : blender::Span(profile->path, profile->path_len)) {
+    append(point.x);
+    append(point.y);
+    append(point.h1);
+    append(point.h2);
+    append(point.h1_loc);
+    append(point.h2_loc);
+  }
+}
+
 ModifierTypeInfo modifierType_Bevel = {
     /*idname*/ "Bevel",
     /*name*/ N_("Bevel"),
@@ -489,4 +515,5 @@ ModifierTypeInfo modifierType_Bevel = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ result_cache_key,
 };
@@ -697,4 +697,5 @@ ModifierTypeInfo modifierType_Boolean = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -325,4 +325,5 @@ ModifierTypeInfo modifierType_Build = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
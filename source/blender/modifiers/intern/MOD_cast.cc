@@ -533,4 +533,5 @@ ModifierTypeInfo modifierType_Cast = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -299,4 +299,5 @@ ModifierTypeInfo modifierType_Cloth = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -306,4 +306,5 @@ ModifierTypeInfo modifierType_Collision = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
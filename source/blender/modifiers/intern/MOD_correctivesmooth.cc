@@ -844,4 +844,5 @@ ModifierTypeInfo modifierType_CorrectiveSmooth = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
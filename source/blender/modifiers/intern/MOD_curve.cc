@@ -215,4 +215,5 @@ ModifierTypeInfo modifierType_Curve = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -505,4 +505,5 @@ ModifierTypeInfo modifierType_DataTransfer = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -304,4 +304,5 @@ ModifierTypeInfo modifierType_Decimate = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -465,4 +465,5 @@ ModifierTypeInfo modifierType_Displace = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -216,4 +216,5 @@ ModifierTypeInfo modifierType_DynamicPaint = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
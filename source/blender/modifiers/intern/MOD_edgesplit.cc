@@ -189,4 +189,5 @@ ModifierTypeInfo modifierType_EdgeSplit = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ BKE_modifier_result_cache_key_append_settings,
 };
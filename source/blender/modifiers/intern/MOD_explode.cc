@@ -1241,4 +1241,5 @@ ModifierTypeInfo modifierType_Explode = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
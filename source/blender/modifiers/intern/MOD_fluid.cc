@@ -270,4 +270,5 @@ ModifierTypeInfo modifierType_Fluid = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -211,4 +211,5 @@ ModifierTypeInfo modifierType_GreasePencilSubdiv = {
     /*blend_write*/ blender::blend_write,
     /*blend_read*/ blender::blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
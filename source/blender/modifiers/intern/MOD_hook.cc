@@ -570,4 +570,5 @@ ModifierTypeInfo modifierType_Hook = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
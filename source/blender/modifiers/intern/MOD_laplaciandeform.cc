@@ -877,4 +877,5 @@ ModifierTypeInfo modifierType_LaplacianDeform = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
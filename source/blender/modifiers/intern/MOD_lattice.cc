@@ -188,4 +188,5 @@ ModifierTypeInfo modifierType_Lattice = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -828,4 +828,5 @@ ModifierTypeInfo modifierType_Mask = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
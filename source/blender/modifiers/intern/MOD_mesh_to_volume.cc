@@ -220,4 +220,5 @@ ModifierTypeInfo modifierType_MeshToVolume = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
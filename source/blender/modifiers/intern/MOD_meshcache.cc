@@ -404,4 +404,5 @@ ModifierTypeInfo modifierType_MeshCache = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
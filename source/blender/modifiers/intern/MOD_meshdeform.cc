@@ -642,4 +642,5 @@ ModifierTypeInfo modifierType_MeshDeform = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
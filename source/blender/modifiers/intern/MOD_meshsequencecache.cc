@@ -518,4 +518,5 @@ ModifierTypeInfo modifierType_MeshSequenceCache = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -266,4 +266,5 @@ ModifierTypeInfo modifierType_Mirror = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
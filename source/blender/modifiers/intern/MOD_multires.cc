@@ -497,4 +497,5 @@ ModifierTypeInfo modifierType_Multires = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
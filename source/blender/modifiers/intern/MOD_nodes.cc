@@ -21,6 +21,7 @@
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
 #include "BLI_string.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "DNA_array_utils.hh"
@@ -1017,7 +1018,8 @@ static void ensure_bake_loaded(bake::NodeBakeCache &bake_cache, bake::FrameCache
   if (!meta_path) {
     return;
   }
-  bake::DiskBlobReader blob_reader{*bake_cache.blobs_dir};
+  bake::DiskBlobReader blob_reader{*bake_cache.blobs_dir,
+                                   (G.f & G_FLAG_READFILE_ZERO_COPY) != 0};
   fstream meta_file{*meta_path};
   std::optional<bake::BakeState> bake_state = bake::deserialize_bake(
       meta_file, blob_reader, *bake_cache.blob_sharing);
@@ -1763,6 +1765,7 @@ static void modifyGeometry(ModifierData *md,
                            bke::GeometrySet &geometry_set)
 {
   using namespace blender;
+  BLI_TRACE_ZONE("Geometry Nodes Modifier", "geometry_nodes");
   NodesModifierData *nmd = reinterpret_cast<NodesModifierData *>(md);
   if (nmd->node_group == nullptr) {
     return;
@@ -2822,4 +2825,5 @@ ModifierTypeInfo modifierType_Nodes = {
     /*blend_write*/ blender::blend_write,
     /*blend_read*/ blender::blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
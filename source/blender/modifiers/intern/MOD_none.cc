@@ -56,4 +56,5 @@ ModifierTypeInfo modifierType_None = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
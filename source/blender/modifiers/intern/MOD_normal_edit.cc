@@ -740,4 +740,5 @@ ModifierTypeInfo modifierType_NormalEdit = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
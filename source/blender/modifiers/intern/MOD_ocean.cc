@@ -721,4 +721,5 @@ ModifierTypeInfo modifierType_Ocean = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -664,4 +664,5 @@ ModifierTypeInfo modifierType_ParticleInstance = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -292,4 +292,5 @@ ModifierTypeInfo modifierType_ParticleSystem = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -1171,4 +1171,5 @@ ModifierTypeInfo modifierType_Screw = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -134,4 +134,5 @@ ModifierTypeInfo modifierType_ShapeKey = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
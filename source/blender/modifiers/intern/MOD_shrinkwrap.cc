@@ -224,4 +224,5 @@ ModifierTypeInfo modifierType_Shrinkwrap = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -554,4 +554,5 @@ ModifierTypeInfo modifierType_SimpleDeform = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -2098,4 +2098,5 @@ ModifierTypeInfo modifierType_Skin = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
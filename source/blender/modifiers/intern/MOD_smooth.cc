@@ -240,4 +240,5 @@ ModifierTypeInfo modifierType_Smooth = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -117,4 +117,5 @@ ModifierTypeInfo modifierType_Softbody = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -288,4 +288,5 @@ ModifierTypeInfo modifierType_Solidify = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
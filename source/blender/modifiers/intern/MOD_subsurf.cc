@@ -12,7 +12,10 @@
 
 #include "MEM_guardedalloc.h"
 
+#include "BLI_bounds.hh"
+#include "BLI_math_matrix.hh"
 #include "BLI_string.h"
+#include "BLI_task.hh"
 #include "BLI_utildefines.h"
 
 #include "BLT_translation.hh"
@@ -23,6 +26,7 @@
 #include "DNA_scene_types.h"
 #include "DNA_screen_types.h"
 
+#include "BKE_camera.h"
 #include "BKE_context.hh"
 #include "BKE_editmesh.hh"
 #include "BKE_mesh.hh"
@@ -86,7 +90,8 @@ static void free_runtime_data(void *runtime_data_v)
   }
   SubsurfRuntimeData *runtime_data = (SubsurfRuntimeData *)runtime_data_v;
   if (runtime_data->subdiv_cpu != nullptr) {
-    blender::bke::subdiv::free(runtime_data->subdiv_cpu);
+    /* The same topology is likely to be evaluated again by a new copy of the modifier. */
+    blender::bke::subdiv::free_or_keep_for_reuse(runtime_data->subdiv_cpu);
   }
   if (runtime_data->subdiv_gpu != nullptr) {
     blender::bke::subdiv::free(runtime_data->subdiv_gpu);
@@ -117,22 +122,95 @@ static bool is_disabled(const Scene *scene, ModifierData *md, bool use_render_pa
   return get_render_subsurf_level(&scene->r, levels, use_render_params != 0) == 0;
 }
 
+static float mean_edge_length(const Mesh &mesh)
+{
+  using namespace blender;
+  const Span<float3> positions = mesh.vert_positions();
+  const Span<int2> edges = mesh.edges();
+  const float length_sum = threading::parallel_reduce(
+      edges.index_range(),
+      4096,
+      0.0f,
+      [&](const IndexRange range, float sum) {
+        for (const int2 edge : edges.slice(range)) {
+          sum += math::distance(positions[edge[0]], positions[edge[1]]);
+        }
+        return sum;
+      },
+      std::plus<>());
+  return length_sum / edges.size();
+}
+
+/**
+ * Find the level at which the subdivided edges are about as long as the dicing rate in pixels,
+ * as seen from the scene camera. The level is the same for the whole mesh, so the distance to the
+ * closest point of its bounds is used.
+ */
+static int subdiv_view_dependent_level_get(const SubsurfModifierData *smd,
+                                           const ModifierEvalContext *ctx,
+                                           const Mesh &mesh,
+                                           const int max_level)
+{
+  using namespace blender;
+  const Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
+  const Object *camera = scene->camera;
+  if (camera == nullptr || camera->type != OB_CAMERA || mesh.edges_num == 0) {
+    return max_level;
+  }
+  int width, height;
+  BKE_render_resolution(&scene->r, false, &width, &height);
+  CameraParams params;
+  BKE_camera_params_init(&params);
+  BKE_camera_params_from_object(&params, camera);
+  BKE_camera_params_compute_viewplane(&params, width, height, scene->r.xasp, scene->r.yasp);
+
+  const float4x4 &object_to_world = ctx->object->object_to_world();
+  const Bounds<float3> bounds = *mesh.bounds_min_max();
+  const float3 camera_position = math::transform_point(ctx->object->world_to_object(),
+                                                       camera->object_to_world().location());
+  const float3 closest_position = math::clamp(camera_position, bounds.min, bounds.max);
+  const float distance = math::distance(
+      math::transform_point(object_to_world, closest_position),
+      camera->object_to_world().location());
+
+  /* The view plane is computed at the clip start distance for perspective cameras. */
+  const float pixel_size = params.is_ortho ? params.viewdx :
+                                             params.viewdx *
+                                                 (std::max(distance, params.clip_start) /
+                                                  params.clip_start);
+  const float target_length = smd->view_dicing_rate * pixel_size;
+  const float3 scale = math::to_scale(object_to_world);
+  const float edge_length = mean_edge_length(mesh) * (scale.x + scale.y + scale.z) / 3.0f;
+  if (!(edge_length > target_length)) {
+    return 0;
+  }
+  /* Every level halves the edge length. */
+  const int level = int(std::ceil(std::log2(edge_length / target_length)));
+  return std::clamp(level, 0, max_level);
+}
+
 static int subdiv_levels_for_modifier_get(const SubsurfModifierData *smd,
-                                          const ModifierEvalContext *ctx)
+                                          const ModifierEvalContext *ctx,
+                                          const Mesh &mesh)
 {
   Scene *scene = DEG_get_evaluated_scene(ctx->depsgraph);
   const bool use_render_params = (ctx->flag & MOD_APPLY_RENDER);
   const int requested_levels = (use_render_params) ? smd->renderLevels : smd->levels;
-  return get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
+  const int level = get_render_subsurf_level(&scene->r, requested_levels, use_render_params);
+  if (smd->flags & eSubsurfModifierFlag_UseViewDependentLevels) {
+    return subdiv_view_dependent_level_get(smd, ctx, mesh, level);
+  }
+  return level;
 }
 
 /* Subdivide into fully qualified mesh. */
 
 static void subdiv_mesh_settings_init(blender::bke::subdiv::ToMeshSettings *settings,
                                       const SubsurfModifierData *smd,
-                                      const ModifierEvalContext *ctx)
+                                      const ModifierEvalContext *ctx,
+                                      const Mesh &mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->use_optimal_display = (smd->flags & eSubsurfModifierFlag_ControlEdges) &&
                                   !(ctx->flag & MOD_APPLY_TO_ORIGINAL);
@@ -145,7 +223,7 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   blender::bke::subdiv::ToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, *mesh);
   if (mesh_settings.resolution < 3) {
     return result;
   }
@@ -157,9 +235,10 @@ static Mesh *subdiv_as_mesh(SubsurfModifierData *smd,
 
 static void subdiv_ccg_settings_init(SubdivToCCGSettings *settings,
                                      const SubsurfModifierData *smd,
-                                     const ModifierEvalContext *ctx)
+                                     const ModifierEvalContext *ctx,
+                                     const Mesh &mesh)
 {
-  const int level = subdiv_levels_for_modifier_get(smd, ctx);
+  const int level = subdiv_levels_for_modifier_get(smd, ctx, mesh);
   settings->resolution = (1 << level) + 1;
   settings->need_normal = true;
   settings->need_mask = false;
@@ -172,7 +251,7 @@ static Mesh *subdiv_as_ccg(SubsurfModifierData *smd,
 {
   Mesh *result = mesh;
   SubdivToCCGSettings ccg_settings;
-  subdiv_ccg_settings_init(&ccg_settings, smd, ctx);
+  subdiv_ccg_settings_init(&ccg_settings, smd, ctx, *mesh);
   if (ccg_settings.resolution < 3) {
     return result;
   }
@@ -188,7 +267,7 @@ static void subdiv_cache_mesh_wrapper_settings(const ModifierEvalContext *ctx,
                                                SubsurfRuntimeData *runtime_data)
 {
   blender::bke::subdiv::ToMeshSettings mesh_settings;
-  subdiv_mesh_settings_init(&mesh_settings, smd, ctx);
+  subdiv_mesh_settings_init(&mesh_settings, smd, ctx, *mesh);
 
   runtime_data->has_gpu_subdiv = true;
   runtime_data->resolution = mesh_settings.resolution;
@@ -394,6 +473,11 @@ static void panel_draw(const bContext *C, Panel *panel)
     uiLayout *col = uiLayoutColumn(layout, true);
     uiItemR(col, ptr, "levels", UI_ITEM_NONE, IFACE_("Levels Viewport"), ICON_NONE);
     uiItemR(col, ptr, "render_levels", UI_ITEM_NONE, IFACE_("Render"), ICON_NONE);
+
+    uiItemR(layout, ptr, "use_view_dependent_levels", UI_ITEM_NONE, nullptr, ICON_NONE);
+    if (RNA_boolean_get(ptr, "use_view_dependent_levels")) {
+      uiItemR(layout, ptr, "view_dicing_rate", UI_ITEM_NONE, nullptr, ICON_NONE);
+    }
   }
 
   uiItemR(layout, ptr, "show_only_control_edges", UI_ITEM_NONE, nullptr, ICON_NONE);
@@ -468,6 +552,21 @@ static void panel_register(ARegionType *region_type)
       region_type, "advanced", "Advanced", nullptr, advanced_panel_draw, panel_type);
 }
 
+static void update_depsgraph(ModifierData *md, const ModifierUpdateDepsgraphContext *ctx)
+{
+  const SubsurfModifierData *smd = reinterpret_cast<const SubsurfModifierData *>(md);
+  if (!(smd->flags & eSubsurfModifierFlag_UseViewDependentLevels)) {
+    return;
+  }
+  if (ctx->scene->camera) {
+    DEG_add_object_relation(
+        ctx->node, ctx->scene->camera, DEG_OB_COMP_TRANSFORM, "Subdivision Surface Modifier");
+    DEG_add_object_relation(
+        ctx->node, ctx->scene->camera, DEG_OB_COMP_PARAMETERS, "Subdivision Surface Modifier");
+  }
+  DEG_add_depends_on_transform_relation(ctx->node, "Subdivision Surface Modifier");
+}
+
 static void blend_read(BlendDataReader * /*reader*/, ModifierData *md)
 {
   SubsurfModifierData *smd = (SubsurfModifierData *)md;
@@ -500,7 +599,7 @@ ModifierTypeInfo modifierType_Subsurf = {
     /*required_data_mask*/ required_data_mask,
     /*free_data*/ free_data,
     /*is_disabled*/ is_disabled,
-    /*update_depsgraph*/ nullptr,
+    /*update_depsgraph*/ update_depsgraph,
     /*depends_on_time*/ nullptr,
     /*depends_on_normals*/ nullptr,
     /*foreach_ID_link*/ nullptr,
@@ -510,4 +609,5 @@ ModifierTypeInfo modifierType_Subsurf = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
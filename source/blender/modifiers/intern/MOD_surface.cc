@@ -227,4 +227,5 @@ ModifierTypeInfo modifierType_Surface = {
     /*blend_write*/ nullptr,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -1739,4 +1739,5 @@ ModifierTypeInfo modifierType_SurfaceDeform = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -376,4 +376,5 @@ ModifierTypeInfo modifierType_UVProject = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
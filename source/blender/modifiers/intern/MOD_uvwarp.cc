@@ -334,4 +334,5 @@ ModifierTypeInfo modifierType_UVWarp = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
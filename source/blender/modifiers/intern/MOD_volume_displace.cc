@@ -342,4 +342,5 @@ ModifierTypeInfo modifierType_VolumeDisplace = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
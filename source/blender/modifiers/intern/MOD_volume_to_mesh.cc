@@ -225,4 +225,5 @@ ModifierTypeInfo modifierType_VolumeToMesh = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -496,4 +496,5 @@ ModifierTypeInfo modifierType_Warp = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
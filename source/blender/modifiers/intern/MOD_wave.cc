@@ -440,4 +440,5 @@ ModifierTypeInfo modifierType_Wave = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
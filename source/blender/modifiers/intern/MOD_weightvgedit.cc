@@ -420,4 +420,5 @@ ModifierTypeInfo modifierType_WeightVGEdit = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -520,4 +520,5 @@ ModifierTypeInfo modifierType_WeightVGMix = {
     /*blend_write*/ nullptr,
     /*blend_read*/ nullptr,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -763,4 +763,5 @@ ModifierTypeInfo modifierType_WeightVGProximity = {
     /*blend_write*/ blend_write,
     /*blend_read*/ blend_read,
     /*foreach_cache*/ nullptr,
+    /*result_cache_key*/ nullptr,
 };
@@ -142,6 +142,8 @@ class GeoNodeExecParams {
 
   void check_input_geometry_set(StringRef identifier, const GeometrySet &geometry_set) const;
   void check_output_geometry_set(const GeometrySet &geometry_set) const;
+  /** Add the memory used by the output geometry to the profile of the node. */
+  void count_output_geometry_memory(const GeometrySet &geometry_set) const;
 
   /**
    * Get the input value for the input socket with the given identifier.
@@ -190,6 +192,9 @@ class GeoNodeExecParams {
 #endif
       if constexpr (std::is_same_v<StoredT, GeometrySet>) {
         this->check_output_geometry_set(value);
+        if (geo_eval_log::is_profiling_enabled()) {
+          this->count_output_geometry_memory(value);
+        }
       }
       const int index = this->get_output_index(identifier);
       params_.set_output(index, std::forward<T>(value));
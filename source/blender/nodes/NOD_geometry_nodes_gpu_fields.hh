@@ -0,0 +1,41 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup nodes
+ *
+ * Experimental evaluation of large fields with compute shaders. Field operations whose
+ * multi-function has a registered GLSL equivalent are compiled into a compute shader, field
+ * inputs are uploaded into storage buffers and the results are read back. Fields using any
+ * other operation are evaluated on the CPU as usual.
+ */
+
+#include "BLI_string_ref.hh"
+
+#include "FN_multi_function.hh"
+
+namespace blender::nodes::gpu_fields {
+
+/**
+ * Register the GLSL function that computes the same result as the given multi-function. The
+ * multi-function has to have single float inputs followed by a single float output. The GLSL
+ * function takes \a glsl_inputs_num floats followed by an `out float`, unused trailing inputs
+ * are passed zero.
+ */
+void register_function(const mf::MultiFunction &fn, StringRefNull glsl_name, int glsl_inputs_num);
+
+/** Install the GPU evaluator for fields, it is only used when enabled in the preferences. */
+void register_field_evaluator();
+
+/**
+ * Create the GPU context that fields are evaluated with, when enabled in the preferences. Has to
+ * be called from the main thread, and changes the active context.
+ */
+void gpu_context_create();
+/** Free the GPU context and the shaders compiled for fields. */
+void gpu_context_destroy();
+
+}  // namespace blender::nodes::gpu_fields
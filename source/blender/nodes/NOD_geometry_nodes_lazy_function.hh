@@ -30,6 +30,7 @@
 
 #include "BLI_compute_context.hh"
 #include "BLI_math_quaternion_types.hh"
+#include "BLI_trace.hh"
 
 #include "BKE_bake_items.hh"
 #include "BKE_node_tree_zones.hh"
@@ -286,6 +287,14 @@ struct GeoNodesLFLocalUserData : public lf::LocalUserData {
   mutable std::optional<geo_eval_log::GeoTreeLogger *> tree_logger_;
 
  public:
+  /**
+   * Time the node that is about to be executed on this thread waited until it was executed. Used
+   * by #ScopedNodeTimer.
+   */
+  std::chrono::nanoseconds node_queue_time{0};
+  /** Memory used by geometries that the currently executed node has output so far. */
+  int64_t node_output_geometry_bytes = 0;
+
   GeoNodesLFLocalUserData(GeoNodesLFUserData & /*user_data*/) {}
 
   /**
@@ -300,6 +309,15 @@ struct GeoNodesLFLocalUserData : public lf::LocalUserData {
     return *tree_logger_;
   }
 
+  /**
+   * Log to the given logger instead of the one of the current compute context, e.g. to find out
+   * what a single node logs.
+   */
+  void set_tree_logger(geo_eval_log::GeoTreeLogger *tree_logger)
+  {
+    tree_logger_.emplace(tree_logger);
+  }
+
  private:
   void ensure_tree_logger(const GeoNodesLFUserData &user_data) const;
 };
@@ -510,10 +528,18 @@ class ScopedNodeTimer {
   const lf::Context &context_;
   const bNode &node_;
   geo_eval_log::TimePoint start_;
+  std::chrono::nanoseconds queue_time_;
+  /** Restored at the end, because other nodes may be executed while this node is running. */
+  int64_t parent_output_geometry_bytes_;
 
  public:
   ScopedNodeTimer(const lf::Context &context, const bNode &node) : context_(context), node_(node)
   {
+    auto &local_user_data = static_cast<GeoNodesLFLocalUserData &>(*context_.local_user_data);
+    queue_time_ = local_user_data.node_queue_time;
+    local_user_data.node_queue_time = std::chrono::nanoseconds(0);
+    parent_output_geometry_bytes_ = local_user_data.node_output_geometry_bytes;
+    local_user_data.node_output_geometry_bytes = 0;
     start_ = geo_eval_log::Clock::now();
   }
 
@@ -522,10 +548,17 @@ class ScopedNodeTimer {
     const geo_eval_log::TimePoint end = geo_eval_log::Clock::now();
     auto &user_data = static_cast<GeoNodesLFUserData &>(*context_.user_data);
     auto &local_user_data = static_cast<GeoNodesLFLocalUserData &>(*context_.local_user_data);
+    const int64_t output_geometry_bytes = local_user_data.node_output_geometry_bytes;
+    local_user_data.node_output_geometry_bytes = parent_output_geometry_bytes_;
     if (geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(user_data))
     {
       tree_logger->node_execution_times.append(*tree_logger->allocator,
-                                               {node_.identifier, start_, end});
+                                               {node_.identifier,
+                                                start_,
+                                                end,
+                                                trace::current_thread_index(),
+                                                queue_time_,
+                                                output_geometry_bytes});
     }
   }
 };
@@ -192,6 +192,13 @@ class ViewerNodeLog {
 using Clock = std::chrono::steady_clock;
 using TimePoint = Clock::time_point;
 
+/**
+ * Profiling gathers additional statistics about the execution of every node that are more costly
+ * to compute, like the memory used by the geometries they output. It is disabled by default.
+ */
+void set_profiling_enabled(bool enabled);
+bool is_profiling_enabled();
+
 /**
  * Logs all data for a specific geometry node tree in a specific context. When the same node group
  * is used in multiple times each instantiation will have a separate logger.
@@ -219,6 +226,12 @@ class GeoTreeLogger {
     int32_t node_id;
     TimePoint start;
     TimePoint end;
+    /** See #trace::current_thread_index. */
+    int thread_index = 0;
+    /** Time between the node being scheduled and its execution. */
+    std::chrono::nanoseconds queue_time{0};
+    /** Memory used by the geometry outputs, only counted when profiling is enabled. */
+    int64_t output_geometry_bytes = 0;
   };
   struct ViewerNodeLogWithNode {
     int32_t node_id;
@@ -395,6 +408,13 @@ class GeoModifierLog {
   static Map<const bke::bNodeTreeZone *, GeoTreeLog *> get_tree_log_by_zone_for_node_editor(
       const SpaceNode &snode);
   static const ViewerNodeLog *find_viewer_node_log_for_path(const ViewerPath &viewer_path);
+
+  /**
+   * Get the execution times of all nodes in the Chrome trace event format, which can be viewed
+   * with e.g. `chrome://tracing` or Perfetto. Node groups and zones are resolved starting at the
+   * given root tree.
+   */
+  std::string execution_times_to_trace_json(const bNodeTree &root_tree);
 };
 
 }  // namespace blender::nodes::geo_eval_log
@@ -0,0 +1,93 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#pragma once
+
+/** \file
+ * \ingroup nodes
+ *
+ * Outputs of expensive nodes (see #bNodeType::geometry_node_cache_outputs) are stored in the
+ * memory cache, so that they don't have to be recomputed when e.g. only a different branch of the
+ * node tree depends on the current frame.
+ *
+ * Geometry inputs are not hashed. Instead they are identified by the implicit sharing infos and
+ * versions of all their arrays. Unchanged geometry generally keeps referencing the same arrays
+ * when it is evaluated again, and the same is true for the outputs of cached nodes, so cached
+ * nodes can also depend on each other. Inputs that can't be identified this way (e.g. instances,
+ * volumes or context dependent fields) disable the cache for the evaluation.
+ */
+
+#include "BLI_generic_key.hh"
+#include "BLI_generic_pointer.hh"
+#include "BLI_implicit_sharing_ptr.hh"
+#include "BLI_memory_cache.hh"
+#include "BLI_vector.hh"
+
+#include "NOD_geometry_nodes_log.hh"
+
+namespace blender::nodes {
+
+class NodeOutputCacheKey : public GenericKey {
+ public:
+  /** Small values that are compared directly, like sizes and single values of inputs. */
+  Vector<char> data;
+  /** References to the arrays that the input geometries consist of, with their versions. */
+  Vector<std::pair<WeakImplicitSharingPtr, int64_t>> shared_data;
+
+  template<typename T> void append(const T &value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>);
+    data.extend(Span(reinterpret_cast<const char *>(&value), sizeof(T)));
+  }
+
+  void append_string(const StringRef str)
+  {
+    this->append(str.size());
+    data.extend(Span(str.data(), str.size()));
+  }
+
+  [[nodiscard]] bool append_shared_data(const ImplicitSharingInfo *sharing_info)
+  {
+    if (sharing_info == nullptr) {
+      return false;
+    }
+    sharing_info->add_weak_user();
+    shared_data.append({WeakImplicitSharingPtr(sharing_info), sharing_info->version()});
+    return true;
+  }
+
+  uint64_t hash() const override;
+  bool equal_to(const GenericKey &other) const override;
+  std::unique_ptr<GenericKey> to_storable() const override;
+};
+
+class CachedNodeOutputs : public memory_cache::CachedValue {
+ public:
+  /** Output values by lazy-function output index. */
+  Vector<std::pair<int, GMutablePointer>> values;
+  /**
+   * What the node logged when it was executed. It is logged again every time the outputs are
+   * used, so that e.g. warnings stay visible.
+   */
+  Vector<geo_eval_log::NodeWarning> warnings;
+  Vector<std::pair<std::string, geo_eval_log::NamedAttributeUsage>> used_named_attributes;
+
+  ~CachedNodeOutputs() override;
+
+  void count_memory(MemoryCounter &memory) const override;
+  StringRefNull category() const override;
+
+  /** Copy what has been logged to a logger that was only used by the node. */
+  void copy_log_from(const geo_eval_log::GeoTreeLogger &node_logger);
+  /** Log everything that the node logged when it was executed again, for the given node. */
+  void log_to(geo_eval_log::GeoTreeLogger &tree_logger, int32_t node_id) const;
+};
+
+/**
+ * Add a value passed to an input of the node to the key.
+ * \return False if the value can't be identified cheaply, in which case the cache can't be used.
+ */
+[[nodiscard]] bool add_input_to_output_cache_key(GPointer value, NodeOutputCacheKey &key);
+
+}  // namespace blender::nodes
@@ -295,6 +295,7 @@ static void node_register()
   ntype.draw_buttons = node_layout;
   ntype.initfunc = node_init;
   ntype.geometry_node_execute = node_geo_exec;
+  ntype.geometry_node_cache_outputs = true;
   blender::bke::node_register_type(&ntype);
 
   node_rna(ntype.rna_ext.srna);
@@ -167,6 +167,7 @@ static void node_register()
   bke::node_type_size(&ntype, 200, 120, 700);
   ntype.initfunc = node_init;
   ntype.geometry_node_execute = node_geo_exec;
+  ntype.geometry_node_cache_outputs = true;
   ntype.draw_buttons = node_layout;
   blender::bke::node_type_storage(
       &ntype, "NodeGeometryMeshToVolume", node_free_standard_storage, node_copy_standard_storage);
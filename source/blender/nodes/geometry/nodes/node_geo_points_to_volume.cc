@@ -228,6 +228,7 @@ static void node_register()
   ntype.initfunc = node_init;
   ntype.declare = node_declare;
   ntype.geometry_node_execute = node_geo_exec;
+  ntype.geometry_node_cache_outputs = true;
   ntype.draw_buttons = node_layout;
   blender::bke::node_register_type(&ntype);
 
@@ -213,6 +213,10 @@ class ProximityFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Consecutive samples are usually close to each other, so the previous result is used to
+     * limit the search distance. */
+    int hint_group = -1;
+    int hint_index = -1;
     mask.foreach_index([&](const int i) {
       const float3 sample_position = sample_positions[i];
       const int sample_id = sample_ids[i];
@@ -234,13 +238,17 @@ class ProximityFunction : public mf::MultiFunction {
       /* Take mesh and pointcloud bvh tree into account. The final result is the closer of the two.
        * The first bvhtree query will set `nearest.dist_sq` which is then passed into the second
        * query as a maximum distance. */
+      nearest.index = -1;
       nearest.dist_sq = FLT_MAX;
       if (trees.mesh_bvh.tree != nullptr) {
-        BLI_bvhtree_find_nearest(trees.mesh_bvh.tree,
-                                 sample_position,
-                                 &nearest,
-                                 trees.mesh_bvh.nearest_callback,
-                                 const_cast<BVHTreeFromMesh *>(&trees.mesh_bvh));
+        BLI_bvhtree_find_nearest_with_hint(trees.mesh_bvh.tree,
+                                           sample_position,
+                                           &nearest,
+                                           trees.mesh_bvh.nearest_callback,
+                                           const_cast<BVHTreeFromMesh *>(&trees.mesh_bvh),
+                                           group_index == hint_group ? hint_index : -1);
+        hint_group = group_index;
+        hint_index = nearest.index;
       }
       if (trees.pointcloud_bvh.tree != nullptr) {
         BLI_bvhtree_find_nearest(trees.pointcloud_bvh.tree,
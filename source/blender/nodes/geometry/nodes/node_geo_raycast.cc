@@ -109,6 +109,9 @@ static void raycast_to_mesh(const IndexMask &mask,
   /* We shouldn't be rebuilding the BVH tree when calling this function in parallel. */
   BLI_assert(tree_data.cached);
 
+  /* Neighboring rays often hit the same or a nearby triangle, so the previous hit is used to
+   * limit the ray length. */
+  int hint_index = -1;
   mask.foreach_index([&](const int i) {
     const float ray_length = ray_lengths[i];
     const float3 ray_origin = ray_origins[i];
@@ -117,14 +120,15 @@ static void raycast_to_mesh(const IndexMask &mask,
     BVHTreeRayHit hit;
     hit.index = -1;
     hit.dist = ray_length;
-    if (BLI_bvhtree_ray_cast(tree_data.tree,
-                             ray_origin,
-                             ray_direction,
-                             0.0f,
-                             &hit,
-                             tree_data.raycast_callback,
-                             &tree_data) != -1)
-    {
+    hint_index = BLI_bvhtree_ray_cast_with_hint(tree_data.tree,
+                                                ray_origin,
+                                                ray_direction,
+                                                0.0f,
+                                                &hit,
+                                                tree_data.raycast_callback,
+                                                &tree_data,
+                                                hint_index);
+    if (hint_index != -1) {
       if (!r_hit.is_empty()) {
         r_hit[i] = hit.index >= 0;
       }
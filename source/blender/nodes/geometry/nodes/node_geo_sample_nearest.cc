@@ -29,13 +29,17 @@ void get_closest_in_bvhtree(BVHTreeFromMesh &tree_data,
   BLI_assert(positions.size() >= r_distances_sq.size());
   BLI_assert(positions.size() >= r_positions.size());
 
+  /* Consecutive positions are usually close to each other, so the previous result is used to
+   * limit the search distance. */
+  int hint_index = -1;
   mask.foreach_index([&](const int i) {
     BVHTreeNearest nearest;
     nearest.index = -1;
     nearest.dist_sq = FLT_MAX;
     const float3 position = positions[i];
-    BLI_bvhtree_find_nearest(
-        tree_data.tree, position, &nearest, tree_data.nearest_callback, &tree_data);
+    BLI_bvhtree_find_nearest_with_hint(
+        tree_data.tree, position, &nearest, tree_data.nearest_callback, &tree_data, hint_index);
+    hint_index = nearest.index;
     if (!r_indices.is_empty()) {
       r_indices[i] = nearest.index;
     }
@@ -147,6 +147,10 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
     MutableSpan<bool> is_valid_span = params.uninitialized_single_output_if_required<bool>(
         4, "Is Valid");
 
+    /* Consecutive samples are usually close to each other, so the previous result is used to
+     * limit the search distance. */
+    int hint_group = -1;
+    int hint_index = -1;
     mask.foreach_index([&](const int i) {
       const float3 position = positions[i];
       const int sample_id = sample_ids[i];
@@ -163,8 +167,14 @@ class SampleNearestSurfaceFunction : public mf::MultiFunction {
       BVHTreeNearest nearest;
       nearest.dist_sq = FLT_MAX;
       nearest.index = -1;
-      BLI_bvhtree_find_nearest(
-          bvh.tree, position, &nearest, bvh.nearest_callback, const_cast<BVHTreeFromMesh *>(&bvh));
+      BLI_bvhtree_find_nearest_with_hint(bvh.tree,
+                                         position,
+                                         &nearest,
+                                         bvh.nearest_callback,
+                                         const_cast<BVHTreeFromMesh *>(&bvh),
+                                         group_index == hint_group ? hint_index : -1);
+      hint_group = group_index;
+      hint_index = nearest.index;
       triangle_index[i] = nearest.index;
       sample_position[i] = nearest.co;
       if (!is_valid_span.is_empty()) {
@@ -2,6 +2,8 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <mutex>
+
 #include "NOD_geometry_nodes_lazy_function.hh"
 
 #include "BKE_anonymous_attribute_make.hh"
@@ -20,6 +22,8 @@
 #include "BLT_translation.hh"
 
 #include "BLI_array_utils.hh"
+#include "BLI_math_base.h"
+#include "BLI_threads.h"
 
 #include "DEG_depsgraph_query.hh"
 
@@ -60,8 +64,7 @@ struct ForeachElementComponent {
   Array<Array<SocketValueVariant>> item_input_values;
   /** Geometry for each iteration. */
   std::optional<Array<GeometrySet>> element_geometries;
-  /** The set of body evaluation nodes that correspond to this component. This indexes into
-   * `lf_body_nodes`. */
+  /** The iterations that correspond to this component. */
   IndexRange body_nodes_range;
 
   void emplace_field_context(const GeometrySet &geometry)
@@ -132,39 +135,93 @@ struct LazyFunctionForReduceForeachGeometryElement : public LazyFunction {
 };
 
 /**
- * This is called whenever an evaluation node is entered. It sets up the compute context if the
- * node is a loop body node.
+ * State of a single loop body evaluation within a batch.
+ */
+struct ForeachGeometryElementBodyState {
+  /** Storage of the body function. It only exists while the iteration is not finished. */
+  void *storage = nullptr;
+  bool is_finished = false;
+  /** True when an input was requested in the last execution that is not available yet. */
+  bool has_missing_inputs = false;
+  /**
+   * Copies of the inputs of the body. Inputs of the batch are shared by all iterations, but every
+   * iteration may move the value out of its input.
+   */
+  MutableSpan<void *> inputs;
+  /** Outputs of the body that are not passed to the batch outputs directly. */
+  MutableSpan<void *> outputs;
+  MutableSpan<bool> outputs_set;
+  /** Usages of the border links, which are kept after the iteration is finished. */
+  MutableSpan<std::optional<bool>> border_link_usages;
+};
+
+struct ForeachGeometryElementBatchStorage {
+  /**
+   * Protects the allocator and the body states. The body is evaluated with its own executor that
+   * may access its parameters from multiple threads once multi-threading is enabled.
+   */
+  std::mutex mutex;
+  LinearAllocator<> allocator;
+  MutableSpan<ForeachGeometryElementBodyState> bodies;
+};
+
+/**
+ * Evaluates the loop body for a range of consecutive iterations. Using a single node in the
+ * execution graph for multiple iterations reduces the scheduling overhead a lot when there are
+ * many cheap iterations. The first iteration of the range is passed in as first input, so that
+ * the same function can be used for all batches of the same size.
  */
-class ForeachGeometryElementNodeExecuteWrapper : public lf::GraphExecutorNodeExecuteWrapper {
+class LazyFunctionForForeachGeometryElementBatch : public LazyFunction {
+ private:
+  const LazyFunctionForForeachGeometryElementZone &parent_;
+  const ForeachGeometryElementEvalStorage &eval_storage_;
+  int iterations_num_;
+  int body_main_outputs_num_;
+  /**
+   * For every input of the body function, the index of the corresponding input of this function.
+   * -1 for inputs that are different for every iteration.
+   */
+  Array<int> batch_input_by_body_input_;
+  /** For every input of the body function, the index in the main inputs or -1. */
+  Array<int> main_input_by_body_input_;
+  /** For every output of the body function, the index in the main or border link outputs. */
+  Array<int> main_output_by_body_output_;
+  Array<int> border_link_usage_by_body_output_;
+
+  friend class ForeachGeometryElementBodyParams;
+
  public:
-  const bNode *output_bnode_ = nullptr;
-  VectorSet<lf::FunctionNode *> *lf_body_nodes_ = nullptr;
+  LazyFunctionForForeachGeometryElementBatch(
+      const LazyFunctionForForeachGeometryElementZone &parent,
+      const ForeachGeometryElementEvalStorage &eval_storage,
+      int iterations_num);
+
+  void *init_storage(LinearAllocator<> &allocator) const override;
+  void destruct_storage(void *storage) const override;
+  void execute_impl(lf::Params &params, const lf::Context &context) const override;
+
+  const LazyFunction &body_function() const;
 
-  void execute_node(const lf::FunctionNode &node,
-                    lf::Params &params,
-                    const lf::Context &context) const
+  int batch_input_by_body_input(const int body_input_i) const
   {
-    GeoNodesLFUserData &user_data = *static_cast<GeoNodesLFUserData *>(context.user_data);
-    const int index = lf_body_nodes_->index_of_try(const_cast<lf::FunctionNode *>(&node));
-    const LazyFunction &fn = node.function();
-    if (index == -1) {
-      /* The node is not a loop body node, just execute it normally. */
-      fn.execute(params, context);
-      return;
-    }
+    return batch_input_by_body_input_[body_input_i];
+  }
 
-    /* Setup context for the loop body evaluation. */
-    bke::ForeachGeometryElementZoneComputeContext body_compute_context{
-        user_data.compute_context, *output_bnode_, index};
-    GeoNodesLFUserData body_user_data = user_data;
-    body_user_data.compute_context = &body_compute_context;
-    body_user_data.log_socket_values = should_log_socket_values_for_context(
-        user_data, body_compute_context.hash());
+  int main_output(const int iteration_in_batch, const int main_output_i) const
+  {
+    return iteration_in_batch * body_main_outputs_num_ + main_output_i;
+  }
 
-    GeoNodesLFLocalUserData body_local_user_data{body_user_data};
-    lf::Context body_context{context.storage, &body_user_data, &body_local_user_data};
-    fn.execute(params, body_context);
+  int border_link_usage_output(const int border_link_i) const
+  {
+    return iterations_num_ * body_main_outputs_num_ + border_link_i;
   }
+
+ private:
+  const void *iteration_input_value(int iteration_i, int main_input_i) const;
+  void destruct_body_state(ForeachGeometryElementBodyState &body_state) const;
+  void set_border_link_usages(lf::Params &params,
+                              const ForeachGeometryElementBatchStorage &storage) const;
 };
 
 /**
@@ -174,7 +231,9 @@ class ForeachGeometryElementNodeExecuteWrapper : public lf::GraphExecutorNodeExe
 class ForeachGeometryElementZoneSideEffectProvider : public lf::GraphExecutorSideEffectProvider {
  public:
   const bNode *output_bnode_ = nullptr;
-  Span<lf::FunctionNode *> lf_body_nodes_;
+  Span<lf::FunctionNode *> lf_batch_nodes_;
+  int iterations_num_ = 0;
+  int batch_size_ = 1;
 
   Vector<const lf::FunctionNode *> get_nodes_with_side_effects(
       const lf::Context &context) const override
@@ -191,8 +250,8 @@ class ForeachGeometryElementZoneSideEffectProvider : public lf::GraphExecutorSid
 
     Vector<const lf::FunctionNode *> lf_nodes;
     for (const int i : iterations_with_side_effects) {
-      if (i >= 0 && i < lf_body_nodes_.size()) {
-        lf_nodes.append(lf_body_nodes_[i]);
+      if (i >= 0 && i < iterations_num_) {
+        lf_nodes.append_non_duplicates(lf_batch_nodes_[i / batch_size_]);
       }
     }
     return lf_nodes;
@@ -209,19 +268,24 @@ struct ForeachGeometryElementEvalStorage {
   /** The lazy-function graph and its executor. */
   lf::Graph graph;
   std::optional<ForeachGeometryElementZoneSideEffectProvider> side_effect_provider;
-  std::optional<ForeachGeometryElementNodeExecuteWrapper> body_execute_wrapper;
   std::optional<lf::GraphExecutor> graph_executor;
   void *graph_executor_storage = nullptr;
 
   /** Some lazy-functions that are constructed once the total number of iterations is known. */
   std::optional<LazyFunctionForLogicalOr> or_function;
   std::optional<LazyFunctionForReduceForeachGeometryElement> reduce_function;
+  std::optional<LazyFunctionForForeachGeometryElementBatch> batch_function;
+  /** Used for the last batch if the number of iterations is not a multiple of the batch size. */
+  std::optional<LazyFunctionForForeachGeometryElementBatch> last_batch_function;
 
   /**
-   * All the body nodes in the lazy-function graph in order. This only contains nodes for the
-   * selected indices.
+   * All the nodes in the lazy-function graph that evaluate the loop body, in order. Each of them
+   * evaluates #batch_size iterations, except for the last one which may evaluate fewer.
    */
-  VectorSet<lf::FunctionNode *> lf_body_nodes;
+  Vector<lf::FunctionNode *> lf_batch_nodes;
+  /** First iteration of each batch, used as input for the batch nodes. */
+  Array<int> batch_start_iterations;
+  int batch_size = 1;
 
   /** The main input geometry that is iterated over. */
   GeometrySet main_geometry;
@@ -231,6 +295,18 @@ struct ForeachGeometryElementEvalStorage {
   int total_iterations_num = 0;
 };
 
+/**
+ * Decides how many iterations are evaluated by a single node in the execution graph. Larger
+ * batches have less overhead, but there have to be enough batches to keep all threads busy.
+ */
+static int get_foreach_batch_size(const int iterations_num)
+{
+  const int max_batch_size = 64;
+  const int batches_per_thread = 8;
+  const int batches_num = BLI_system_thread_count() * batches_per_thread;
+  return std::clamp(iterations_num / batches_num, 1, max_batch_size);
+}
+
 class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
  private:
   const bNodeTree &btree_;
@@ -257,6 +333,7 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
   } indices_;
 
   friend LazyFunctionForReduceForeachGeometryElement;
+  friend LazyFunctionForForeachGeometryElementBatch;
 
  public:
   LazyFunctionForForeachGeometryElementZone(const bNodeTree &btree,
@@ -388,11 +465,9 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
 
     eval_storage.side_effect_provider.emplace();
     eval_storage.side_effect_provider->output_bnode_ = &output_bnode_;
-    eval_storage.side_effect_provider->lf_body_nodes_ = eval_storage.lf_body_nodes;
-
-    eval_storage.body_execute_wrapper.emplace();
-    eval_storage.body_execute_wrapper->output_bnode_ = &output_bnode_;
-    eval_storage.body_execute_wrapper->lf_body_nodes_ = &eval_storage.lf_body_nodes;
+    eval_storage.side_effect_provider->lf_batch_nodes_ = eval_storage.lf_batch_nodes;
+    eval_storage.side_effect_provider->iterations_num_ = eval_storage.total_iterations_num;
+    eval_storage.side_effect_provider->batch_size_ = eval_storage.batch_size;
 
     lf_graph.update_node_indices();
     eval_storage.graph_executor.emplace(lf_graph,
@@ -400,7 +475,7 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
                                         graph_outputs.as_span(),
                                         nullptr,
                                         &*eval_storage.side_effect_provider,
-                                        &*eval_storage.body_execute_wrapper);
+                                        nullptr);
     eval_storage.graph_executor_storage = eval_storage.graph_executor->init_storage(
         eval_storage.allocator);
 
@@ -643,59 +718,51 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
   {
     lf::Graph &lf_graph = eval_storage.graph;
 
-    /* Create body nodes. */
-    VectorSet<lf::FunctionNode *> &lf_body_nodes = eval_storage.lf_body_nodes;
-    for ([[maybe_unused]] const int i : IndexRange(eval_storage.total_iterations_num)) {
-      lf::FunctionNode &lf_node = lf_graph.add_function(*body_fn_.function);
-      lf_body_nodes.add_new(&lf_node);
+    /* Create the nodes that evaluate the loop body. */
+    const int iterations_num = eval_storage.total_iterations_num;
+    const int batch_size = get_foreach_batch_size(iterations_num);
+    const int batches_num = int(divide_ceil_u(uint(iterations_num), uint(batch_size)));
+    eval_storage.batch_size = batch_size;
+    eval_storage.batch_start_iterations.reinitialize(batches_num);
+    if (batches_num > 0) {
+      eval_storage.batch_function.emplace(*this, eval_storage, batch_size);
+      const int last_batch_size = iterations_num - (batches_num - 1) * batch_size;
+      if (last_batch_size != batch_size) {
+        eval_storage.last_batch_function.emplace(*this, eval_storage, last_batch_size);
+      }
+    }
+    Vector<lf::FunctionNode *> &lf_batch_nodes = eval_storage.lf_batch_nodes;
+    for (const int batch_i : IndexRange(batches_num)) {
+      const bool is_last = batch_i == batches_num - 1;
+      const LazyFunctionForForeachGeometryElementBatch &batch_fn =
+          (is_last && eval_storage.last_batch_function) ? *eval_storage.last_batch_function :
+                                                          *eval_storage.batch_function;
+      lf::FunctionNode &lf_node = lf_graph.add_function(batch_fn);
+      eval_storage.batch_start_iterations[batch_i] = batch_i * batch_size;
+      lf_node.input(0).set_default_value(&eval_storage.batch_start_iterations[batch_i]);
+      lf_batch_nodes.append(&lf_node);
     }
 
-    /* Link up output usages to body nodes. */
-    for (const int zone_output_i : body_fn_.indices.inputs.output_usages.index_range()) {
-      /* +1 because of geometry output. */
-      lf::GraphInputSocket &lf_graph_input =
-          *graph_inputs[zone_info_.indices.inputs.output_usages[1 + zone_output_i]];
-      for (const int i : lf_body_nodes.index_range()) {
-        lf::FunctionNode &lf_node = *lf_body_nodes[i];
+    /* Link up the inputs that are shared by all iterations. */
+    for (lf::FunctionNode *lf_batch_node : lf_batch_nodes) {
+      const auto &batch_fn = static_cast<const LazyFunctionForForeachGeometryElementBatch &>(
+          lf_batch_node->function());
+      for (const int zone_output_i : body_fn_.indices.inputs.output_usages.index_range()) {
+        /* +1 because of geometry output. */
+        lf::GraphInputSocket &lf_graph_input =
+            *graph_inputs[zone_info_.indices.inputs.output_usages[1 + zone_output_i]];
         lf_graph.add_link(lf_graph_input,
-                          lf_node.input(body_fn_.indices.inputs.output_usages[zone_output_i]));
+                          lf_batch_node->input(batch_fn.batch_input_by_body_input(
+                              body_fn_.indices.inputs.output_usages[zone_output_i])));
       }
-    }
-
-    const bNodeSocket &element_geometry_bsocket = zone_.input_node->output_socket(1);
-
-    static const GeometrySet empty_geometry;
-    for (const ForeachElementComponent &component_info : eval_storage.components) {
-      for (const int i : component_info.body_nodes_range.index_range()) {
-        const int body_i = component_info.body_nodes_range[i];
-        lf::FunctionNode &lf_body_node = *lf_body_nodes[body_i];
-        /* Set index input for loop body. */
-        lf_body_node.input(body_fn_.indices.inputs.main[0])
-            .set_default_value(&component_info.index_values[i]);
-        /* Set geometry element input for loop body. */
-        if (element_geometry_bsocket.is_available()) {
-          const GeometrySet *element_geometry = component_info.element_geometries.has_value() ?
-                                                    &(*component_info.element_geometries)[i] :
-                                                    &empty_geometry;
-          lf_body_node.input(body_fn_.indices.inputs.main[1]).set_default_value(element_geometry);
-        }
-        /* Set main input values for loop body. */
-        for (const int item_i : IndexRange(node_storage.input_items.items_num)) {
-          lf_body_node.input(body_fn_.indices.inputs.main[indices_.inputs.lf_inner[item_i]])
-              .set_default_value(&component_info.item_input_values[item_i][i]);
-        }
-        /* Link up border-link inputs to the loop body. */
-        for (const int border_link_i : zone_info_.indices.inputs.border_links.index_range()) {
-          lf_graph.add_link(
-              *graph_inputs[zone_info_.indices.inputs.border_links[border_link_i]],
-              lf_body_node.input(body_fn_.indices.inputs.border_links[border_link_i]));
-        }
-        /* Link up reference sets. */
-        for (const auto &item : body_fn_.indices.inputs.reference_sets.items()) {
-          lf_graph.add_link(
-              *graph_inputs[zone_info_.indices.inputs.reference_sets.lookup(item.key)],
-              lf_body_node.input(item.value));
-        }
+      for (const int border_link_i : zone_info_.indices.inputs.border_links.index_range()) {
+        lf_graph.add_link(*graph_inputs[zone_info_.indices.inputs.border_links[border_link_i]],
+                          lf_batch_node->input(batch_fn.batch_input_by_body_input(
+                              body_fn_.indices.inputs.border_links[border_link_i])));
+      }
+      for (const auto &item : body_fn_.indices.inputs.reference_sets.items()) {
+        lf_graph.add_link(*graph_inputs[zone_info_.indices.inputs.reference_sets.lookup(item.key)],
+                          lf_batch_node->input(batch_fn.batch_input_by_body_input(item.value)));
       }
     }
 
@@ -707,15 +774,13 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
     const int body_main_outputs_num = node_storage.main_items.items_num +
                                       node_storage.generation_items.items_num;
     BLI_assert(body_main_outputs_num == body_fn_.indices.outputs.main.size());
-    for (const int i : IndexRange(eval_storage.total_iterations_num)) {
-      lf::FunctionNode &lf_body_node = *lf_body_nodes[i];
-      for (const int item_i : IndexRange(node_storage.main_items.items_num)) {
-        lf_graph.add_link(lf_body_node.output(body_fn_.indices.outputs.main[item_i]),
-                          lf_reduce.input(i * body_main_outputs_num + item_i));
-      }
-      for (const int item_i : IndexRange(node_storage.generation_items.items_num)) {
-        const int body_output_i = item_i + node_storage.main_items.items_num;
-        lf_graph.add_link(lf_body_node.output(body_fn_.indices.outputs.main[body_output_i]),
+    for (const int i : IndexRange(iterations_num)) {
+      lf::FunctionNode &lf_batch_node = *lf_batch_nodes[i / batch_size];
+      const auto &batch_fn = static_cast<const LazyFunctionForForeachGeometryElementBatch &>(
+          lf_batch_node.function());
+      for (const int body_output_i : IndexRange(body_main_outputs_num)) {
+        const int batch_output_i = batch_fn.main_output(i % batch_size, body_output_i);
+        lf_graph.add_link(lf_batch_node.output(batch_output_i),
                           lf_reduce.input(i * body_main_outputs_num + body_output_i));
       }
     }
@@ -741,14 +806,15 @@ class LazyFunctionForForeachGeometryElementZone : public LazyFunction {
 
     /* Handle usage outputs for border-links. A border-link is used if it's used by any of the
      * iterations. */
-    eval_storage.or_function.emplace(eval_storage.total_iterations_num);
+    eval_storage.or_function.emplace(batches_num);
     for (const int border_link_i : zone_.border_links.index_range()) {
       lf::FunctionNode &lf_or = lf_graph.add_function(*eval_storage.or_function);
-      for (const int i : lf_body_nodes.index_range()) {
-        lf::FunctionNode &lf_body_node = *lf_body_nodes[i];
-        lf_graph.add_link(
-            lf_body_node.output(body_fn_.indices.outputs.border_link_usages[border_link_i]),
-            lf_or.input(i));
+      for (const int batch_i : lf_batch_nodes.index_range()) {
+        lf::FunctionNode &lf_batch_node = *lf_batch_nodes[batch_i];
+        const auto &batch_fn = static_cast<const LazyFunctionForForeachGeometryElementBatch &>(
+            lf_batch_node.function());
+        lf_graph.add_link(lf_batch_node.output(batch_fn.border_link_usage_output(border_link_i)),
+                          lf_or.input(batch_i));
       }
       lf_graph.add_link(
           lf_or.output(0),
@@ -780,7 +846,7 @@ LazyFunctionForReduceForeachGeometryElement::LazyFunctionForReduceForeachGeometr
   inputs_.reserve(eval_storage.total_iterations_num *
                   (node_storage.main_items.items_num + node_storage.generation_items.items_num));
 
-  for ([[maybe_unused]] const int i : eval_storage.lf_body_nodes.index_range()) {
+  for ([[maybe_unused]] const int i : IndexRange(eval_storage.total_iterations_num)) {
     /* Add parameters for main items. */
     for (const int item_i : IndexRange(node_storage.main_items.items_num)) {
       const NodeForeachGeometryElementMainItem &item = node_storage.main_items.items[item_i];
@@ -819,6 +885,367 @@ LazyFunctionForReduceForeachGeometryElement::LazyFunctionForReduceForeachGeometr
   }
 }
 
+LazyFunctionForForeachGeometryElementBatch::LazyFunctionForForeachGeometryElementBatch(
+    const LazyFunctionForForeachGeometryElementZone &parent,
+    const ForeachGeometryElementEvalStorage &eval_storage,
+    const int iterations_num)
+    : parent_(parent), eval_storage_(eval_storage), iterations_num_(iterations_num)
+{
+  debug_name_ = "Batch";
+
+  const ZoneBodyFunction &body_fn = parent.body_fn_;
+  const LazyFunction &fn = *body_fn.function;
+  body_main_outputs_num_ = body_fn.indices.outputs.main.size();
+
+  inputs_.append_as("First Iteration", CPPType::get<int>(), lf::ValueUsage::Used);
+  batch_input_by_body_input_.reinitialize(fn.inputs().size());
+  batch_input_by_body_input_.fill(-1);
+  main_input_by_body_input_.reinitialize(fn.inputs().size());
+  main_input_by_body_input_.fill(-1);
+  for (const int i : body_fn.indices.inputs.main.index_range()) {
+    main_input_by_body_input_[body_fn.indices.inputs.main[i]] = i;
+  }
+  for (const int i : fn.inputs().index_range()) {
+    if (main_input_by_body_input_[i] != -1) {
+      continue;
+    }
+    const lf::Input &input = fn.inputs()[i];
+    batch_input_by_body_input_[i] = inputs_.append_and_get_index_as(
+        input.debug_name, *input.type, input.usage);
+  }
+
+  main_output_by_body_output_.reinitialize(fn.outputs().size());
+  main_output_by_body_output_.fill(-1);
+  border_link_usage_by_body_output_.reinitialize(fn.outputs().size());
+  border_link_usage_by_body_output_.fill(-1);
+  for (const int i : body_fn.indices.outputs.main.index_range()) {
+    main_output_by_body_output_[body_fn.indices.outputs.main[i]] = i;
+  }
+  for (const int i : body_fn.indices.outputs.border_link_usages.index_range()) {
+    border_link_usage_by_body_output_[body_fn.indices.outputs.border_link_usages[i]] = i;
+  }
+
+  for ([[maybe_unused]] const int iteration_i : IndexRange(iterations_num)) {
+    for (const int output_i : body_fn.indices.outputs.main) {
+      const lf::Output &output = fn.outputs()[output_i];
+      outputs_.append_as(output.debug_name, *output.type);
+    }
+  }
+  for (const int output_i : body_fn.indices.outputs.border_link_usages) {
+    const lf::Output &output = fn.outputs()[output_i];
+    outputs_.append_as(output.debug_name, *output.type);
+  }
+}
+
+const LazyFunction &LazyFunctionForForeachGeometryElementBatch::body_function() const
+{
+  return *parent_.body_fn_.function;
+}
+
+void *LazyFunctionForForeachGeometryElementBatch::init_storage(
+    LinearAllocator<> &allocator) const
+{
+  auto *storage = allocator.construct<ForeachGeometryElementBatchStorage>().release();
+  storage->bodies = storage->allocator.construct_array<ForeachGeometryElementBodyState>(
+      iterations_num_);
+  const int border_links_num = parent_.body_fn_.indices.outputs.border_link_usages.size();
+  for (ForeachGeometryElementBodyState &body_state : storage->bodies) {
+    body_state.border_link_usages = storage->allocator.construct_array<std::optional<bool>>(
+        border_links_num);
+  }
+  return storage;
+}
+
+void LazyFunctionForForeachGeometryElementBatch::destruct_storage(void *storage) const
+{
+  auto *s = static_cast<ForeachGeometryElementBatchStorage *>(storage);
+  for (ForeachGeometryElementBodyState &body_state : s->bodies) {
+    this->destruct_body_state(body_state);
+  }
+  std::destroy_at(s);
+}
+
+void LazyFunctionForForeachGeometryElementBatch::destruct_body_state(
+    ForeachGeometryElementBodyState &body_state) const
+{
+  const LazyFunction &fn = *parent_.body_fn_.function;
+  if (body_state.storage) {
+    fn.destruct_storage(body_state.storage);
+    body_state.storage = nullptr;
+  }
+  for (const int i : body_state.inputs.index_range()) {
+    if (body_state.inputs[i]) {
+      fn.inputs()[i].type->destruct(body_state.inputs[i]);
+      body_state.inputs[i] = nullptr;
+    }
+  }
+  for (const int i : body_state.outputs.index_range()) {
+    if (body_state.outputs_set[i]) {
+      fn.outputs()[i].type->destruct(body_state.outputs[i]);
+      body_state.outputs_set[i] = false;
+    }
+  }
+}
+
+const void *LazyFunctionForForeachGeometryElementBatch::iteration_input_value(
+    const int iteration_i, const int main_input_i) const
+{
+  for (const ForeachElementComponent &component_info : eval_storage_.components) {
+    if (!component_info.body_nodes_range.contains(iteration_i)) {
+      continue;
+    }
+    const int i = iteration_i - component_info.body_nodes_range.start();
+    if (main_input_i == 0) {
+      return &component_info.index_values[i];
+    }
+    if (parent_.indices_.inputs.lf_inner.contains(main_input_i)) {
+      const int item_i = main_input_i - parent_.indices_.inputs.lf_inner.start();
+      return &component_info.item_input_values[item_i][i];
+    }
+    static const GeometrySet empty_geometry;
+    return component_info.element_geometries.has_value() ?
+               &(*component_info.element_geometries)[i] :
+               &empty_geometry;
+  }
+  BLI_assert_unreachable();
+  return nullptr;
+}
+
+/**
+ * Passes the parameters of a batch node to the evaluation of a single iteration.
+ */
+class ForeachGeometryElementBodyParams : public lf::Params {
+ private:
+  const LazyFunctionForForeachGeometryElementBatch &batch_fn_;
+  lf::Params &batch_params_;
+  ForeachGeometryElementBatchStorage &batch_storage_;
+  ForeachGeometryElementBodyState &state_;
+  int iteration_in_batch_;
+  int iteration_;
+
+ public:
+  ForeachGeometryElementBodyParams(const LazyFunctionForForeachGeometryElementBatch &batch_fn,
+                                   lf::Params &batch_params,
+                                   ForeachGeometryElementBatchStorage &batch_storage,
+                                   const int iteration_in_batch,
+                                   const int iteration)
+      : lf::Params(batch_fn.body_function(), false),
+        batch_fn_(batch_fn),
+        batch_params_(batch_params),
+        batch_storage_(batch_storage),
+        state_(batch_storage.bodies[iteration_in_batch]),
+        iteration_in_batch_(iteration_in_batch),
+        iteration_(iteration)
+  {
+  }
+
+ private:
+  void *get_input_copy(const int index, const bool request) const
+  {
+    std::lock_guard lock{batch_storage_.mutex};
+    if (state_.inputs[index]) {
+      return state_.inputs[index];
+    }
+    const CPPType &type = *fn_.inputs()[index].type;
+    const void *value;
+    const int batch_input_i = batch_fn_.batch_input_by_body_input(index);
+    if (batch_input_i == -1) {
+      value = batch_fn_.iteration_input_value(iteration_,
+                                              batch_fn_.main_input_by_body_input_[index]);
+    }
+    else {
+      value = request ? batch_params_.try_get_input_data_ptr_or_request(batch_input_i) :
+                        batch_params_.try_get_input_data_ptr(batch_input_i);
+      if (value == nullptr) {
+        state_.has_missing_inputs |= request;
+        return nullptr;
+      }
+    }
+    void *buffer = batch_storage_.allocator.allocate(type.size(), type.alignment());
+    type.copy_construct(value, buffer);
+    state_.inputs[index] = buffer;
+    return buffer;
+  }
+
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return this->get_input_copy(index, false);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return this->get_input_copy(index, true);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    const int main_output_i = batch_fn_.main_output_by_body_output_[index];
+    if (main_output_i != -1) {
+      return batch_params_.get_output_data_ptr(
+          batch_fn_.main_output(iteration_in_batch_, main_output_i));
+    }
+    std::lock_guard lock{batch_storage_.mutex};
+    if (state_.outputs[index] == nullptr) {
+      const CPPType &type = *fn_.outputs()[index].type;
+      state_.outputs[index] = batch_storage_.allocator.allocate(type.size(), type.alignment());
+    }
+    return state_.outputs[index];
+  }
+
+  void output_set_impl(const int index) override
+  {
+    const int main_output_i = batch_fn_.main_output_by_body_output_[index];
+    if (main_output_i != -1) {
+      batch_params_.output_set(batch_fn_.main_output(iteration_in_batch_, main_output_i));
+      return;
+    }
+    std::lock_guard lock{batch_storage_.mutex};
+    state_.outputs_set[index] = true;
+    const int border_link_i = batch_fn_.border_link_usage_by_body_output_[index];
+    if (border_link_i != -1) {
+      state_.border_link_usages[border_link_i] = *static_cast<const bool *>(state_.outputs[index]);
+    }
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    const int main_output_i = batch_fn_.main_output_by_body_output_[index];
+    if (main_output_i != -1) {
+      return batch_params_.output_was_set(
+          batch_fn_.main_output(iteration_in_batch_, main_output_i));
+    }
+    std::lock_guard lock{batch_storage_.mutex};
+    return state_.outputs_set[index];
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    const int main_output_i = batch_fn_.main_output_by_body_output_[index];
+    if (main_output_i != -1) {
+      return batch_params_.get_output_usage(
+          batch_fn_.main_output(iteration_in_batch_, main_output_i));
+    }
+    const int border_link_i = batch_fn_.border_link_usage_by_body_output_[index];
+    if (border_link_i != -1) {
+      return batch_params_.get_output_usage(batch_fn_.border_link_usage_output(border_link_i));
+    }
+    /* Other outputs of the body are not linked in the execution graph. */
+    return lf::ValueUsage::Unused;
+  }
+
+  void set_input_unused_impl(const int /*index*/) override
+  {
+    /* Inputs of the batch are shared between iterations, so other iterations may still use the
+     * value. The copied inputs are freed once the iteration is finished. */
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return batch_params_.try_enable_multi_threading();
+  }
+};
+
+void LazyFunctionForForeachGeometryElementBatch::execute_impl(lf::Params &params,
+                                                             const lf::Context &context) const
+{
+  GeoNodesLFUserData &user_data = *static_cast<GeoNodesLFUserData *>(context.user_data);
+  auto &storage = *static_cast<ForeachGeometryElementBatchStorage *>(context.storage);
+  const LazyFunction &body_fn = *parent_.body_fn_.function;
+  const int first_iteration = params.get_input<int>(0);
+
+  for (const int iteration_in_batch : IndexRange(iterations_num_)) {
+    ForeachGeometryElementBodyState &body_state = storage.bodies[iteration_in_batch];
+    if (body_state.is_finished) {
+      continue;
+    }
+    if (body_state.storage == nullptr) {
+      /* The body state is only created when the iteration is evaluated for the first time, and
+       * its values are destructed again when it is finished, so that e.g. geometries are not kept
+       * alive until the whole batch is done. The buffers themselves come from the batch allocator
+       * and are only freed together with the batch storage. */
+      body_state.inputs = storage.allocator.construct_array<void *>(body_fn.inputs().size(),
+                                                                     nullptr);
+      body_state.outputs = storage.allocator.construct_array<void *>(body_fn.outputs().size(),
+                                                                      nullptr);
+      body_state.outputs_set = storage.allocator.construct_array<bool>(body_fn.outputs().size(),
+                                                                        false);
+      body_state.storage = body_fn.init_storage(storage.allocator);
+    }
+    const int iteration = first_iteration + iteration_in_batch;
+
+    /* Setup context for the loop body evaluation. */
+    bke::ForeachGeometryElementZoneComputeContext body_compute_context{
+        user_data.compute_context, parent_.output_bnode_, iteration};
+    GeoNodesLFUserData body_user_data = user_data;
+    body_user_data.compute_context = &body_compute_context;
+    body_user_data.log_socket_values = should_log_socket_values_for_context(
+        user_data, body_compute_context.hash());
+    GeoNodesLFLocalUserData body_local_user_data{body_user_data};
+    lf::Context body_context{body_state.storage, &body_user_data, &body_local_user_data};
+
+    body_state.has_missing_inputs = false;
+    ForeachGeometryElementBodyParams body_params{
+        *this, params, storage, iteration_in_batch, iteration};
+    body_fn.execute(body_params, body_context);
+
+    /* Check if the iteration has to be executed again. */
+    if (body_state.has_missing_inputs) {
+      continue;
+    }
+    bool all_outputs_done = true;
+    for (const int i : IndexRange(body_main_outputs_num_)) {
+      const int output_i = this->main_output(iteration_in_batch, i);
+      if (!params.output_was_set(output_i) &&
+          params.get_output_usage(output_i) != lf::ValueUsage::Unused)
+      {
+        all_outputs_done = false;
+        break;
+      }
+    }
+    for (const int i : body_state.border_link_usages.index_range()) {
+      if (!body_state.border_link_usages[i].has_value() &&
+          params.get_output_usage(this->border_link_usage_output(i)) != lf::ValueUsage::Unused)
+      {
+        all_outputs_done = false;
+        break;
+      }
+    }
+    if (all_outputs_done) {
+      this->destruct_body_state(body_state);
+      body_state.is_finished = true;
+    }
+  }
+
+  this->set_border_link_usages(params, storage);
+}
+
+void LazyFunctionForForeachGeometryElementBatch::set_border_link_usages(
+    lf::Params &params, const ForeachGeometryElementBatchStorage &storage) const
+{
+  /* A border link is used when it is used by any iteration in the batch. */
+  const int border_links_num = parent_.body_fn_.indices.outputs.border_link_usages.size();
+  for (const int border_link_i : IndexRange(border_links_num)) {
+    const int output_i = this->border_link_usage_output(border_link_i);
+    if (params.output_was_set(output_i)) {
+      continue;
+    }
+    bool all_known = true;
+    bool is_used = false;
+    for (const ForeachGeometryElementBodyState &body_state : storage.bodies) {
+      const std::optional<bool> &usage = body_state.border_link_usages[border_link_i];
+      if (usage.has_value()) {
+        is_used |= *usage;
+      }
+      else {
+        all_known = false;
+      }
+    }
+    if (is_used || all_known) {
+      params.set_output(output_i, is_used);
+    }
+  }
+}
+
 /** Gives the domain with the smallest number of elements that always exists. */
 static std::optional<AttrDomain> get_foreach_attribute_propagation_target_domain(
     const GeometryComponent::Type component_type)
@@ -1018,7 +1445,7 @@ void LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group(
   /* TODO: Get propagation info from input, but that's not necessary for correctness for now. */
   bke::AttributeFilter attribute_filter;
 
-  const int bodies_num = eval_storage_.lf_body_nodes.size();
+  const int bodies_num = eval_storage_.total_iterations_num;
   Array<GeometrySet> geometries(bodies_num + 1);
 
   /* Create attribute names for the outputs. */
@@ -1231,7 +1658,7 @@ bool LazyFunctionForReduceForeachGeometryElement::handle_generation_items_group_
     /* Only execute below if we are sure that the output is actually needed. */
     return false;
   }
-  const int bodies_num = eval_storage_.lf_body_nodes.size();
+  const int bodies_num = eval_storage_.total_iterations_num;
 
   /* Check if all inputs are available, and request them if not. */
   bool has_missing_input = false;
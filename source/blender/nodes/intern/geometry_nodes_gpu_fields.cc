@@ -0,0 +1,430 @@
+/* SPDX-FileCopyrightText: 2024 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+#include <cstring>
+#include <mutex>
+#include <sstream>
+
+#include "BLI_map.hh"
+#include "BLI_math_base.h"
+#include "BLI_threads.h"
+#include "BLI_vector_set.hh"
+
+#include "BKE_global.hh"
+
+#include "DNA_userdef_types.h"
+
+#include "FN_field.hh"
+
+#include "GPU_capabilities.hh"
+#include "GPU_compute.hh"
+#include "GPU_context.hh"
+#include "GPU_shader.hh"
+#include "GPU_state.hh"
+#include "GPU_storage_buffer.hh"
+#include "gpu_shader_create_info.hh"
+
+#include "NOD_geometry_nodes_gpu_fields.hh"
+
+#include "WM_api.hh"
+
+namespace blender::nodes::gpu_fields {
+
+using fn::ExternalFieldEvaluator;
+using fn::FieldConstant;
+using fn::FieldInput;
+using fn::FieldNode;
+using fn::FieldNodeType;
+using fn::FieldOperation;
+using fn::GFieldRef;
+
+/**
+ * Uploading the inputs, compiling the shader and reading back the results is only worth it for
+ * very large fields.
+ */
+static constexpr int64_t min_elements_num = 1 << 20;
+static constexpr int local_group_size = 256;
+/** Compiled shaders are kept for later evaluations, up to this number. */
+static constexpr int max_cached_shaders = 64;
+
+struct GPUFunction {
+  std::string glsl_name;
+  int glsl_inputs_num;
+};
+
+static std::mutex gpu_functions_mutex;
+static Map<const mf::MultiFunction *, GPUFunction> gpu_functions;
+
+void register_function(const mf::MultiFunction &fn,
+                       const StringRefNull glsl_name,
+                       const int glsl_inputs_num)
+{
+  BLI_assert(fn.param_amount() - 1 <= glsl_inputs_num);
+  std::lock_guard lock{gpu_functions_mutex};
+  gpu_functions.add(&fn, {glsl_name, glsl_inputs_num});
+}
+
+static std::optional<GPUFunction> lookup_function(const mf::MultiFunction &fn)
+{
+  std::lock_guard lock{gpu_functions_mutex};
+  if (const GPUFunction *function = gpu_functions.lookup_ptr(&fn)) {
+    return *function;
+  }
+  return std::nullopt;
+}
+
+static std::string glsl_float_literal(const float value)
+{
+  /* Use the exact bit pattern, decimal literals may round differently. */
+  uint32_t bits;
+  memcpy(&bits, &value, sizeof(float));
+  return "uintBitsToFloat(" + std::to_string(bits) + "u)";
+}
+
+/** Generates the body of the compute shader for a set of float fields. */
+class FieldShaderBuilder {
+ private:
+  FunctionRef<const GVArray &(const FieldInput &)> get_input_;
+  std::stringstream code_;
+  Map<GFieldRef, std::string> variable_by_field_;
+  int variables_num_ = 0;
+
+ public:
+  /** Arrays that have to be uploaded into the input storage buffers, in binding order. */
+  VectorSet<const GVArray *> input_varrays;
+
+  FieldShaderBuilder(FunctionRef<const GVArray &(const FieldInput &)> get_input)
+      : get_input_(get_input)
+  {
+  }
+
+  /** Returns false if the field contains something that can't be evaluated on the GPU. */
+  bool add_output(const GFieldRef field, const int output_index)
+  {
+    const std::optional<std::string> variable = this->build_field(field);
+    if (!variable) {
+      return false;
+    }
+    code_ << "  field_out_" << output_index << "[index] = " << *variable << ";\n";
+    return true;
+  }
+
+  std::string code() const
+  {
+    return "void field_eval(uint index)\n{\n" + code_.str() + "}\n";
+  }
+
+ private:
+  std::optional<std::string> build_field(const GFieldRef field)
+  {
+    if (const std::string *variable = variable_by_field_.lookup_ptr(field)) {
+      return *variable;
+    }
+    if (field.cpp_type() != CPPType::get<float>()) {
+      return std::nullopt;
+    }
+    std::optional<std::string> expression;
+    const FieldNode &node = field.node();
+    switch (node.node_type()) {
+      case FieldNodeType::Input: {
+        const GVArray &varray = get_input_(static_cast<const FieldInput &>(node));
+        if (varray.is_single()) {
+          float value;
+          varray.get_internal_single(&value);
+          expression = glsl_float_literal(value);
+        }
+        else {
+          expression = "field_in_" + std::to_string(input_varrays.index_of_or_add(&varray)) +
+                       "[index]";
+        }
+        break;
+      }
+      case FieldNodeType::Constant: {
+        const FieldConstant &constant = static_cast<const FieldConstant &>(node);
+        expression = glsl_float_literal(*constant.value().get<float>());
+        break;
+      }
+      case FieldNodeType::Operation: {
+        expression = this->build_operation(static_cast<const FieldOperation &>(node));
+        break;
+      }
+    }
+    if (!expression) {
+      return std::nullopt;
+    }
+    const std::string variable = "v" + std::to_string(variables_num_++);
+    code_ << "  float " << variable << " = " << *expression << ";\n";
+    variable_by_field_.add(field, variable);
+    return variable;
+  }
+
+  std::optional<std::string> build_operation(const FieldOperation &operation)
+  {
+    const mf::MultiFunction &fn = operation.multi_function();
+    const std::optional<GPUFunction> function = lookup_function(fn);
+    if (!function) {
+      return std::nullopt;
+    }
+    Vector<std::string> args;
+    for (const GFieldRef input : operation.inputs()) {
+      const std::optional<std::string> variable = this->build_field(input);
+      if (!variable) {
+        return std::nullopt;
+      }
+      args.append(*variable);
+    }
+    while (args.size() < function->glsl_inputs_num) {
+      args.append("0.0");
+    }
+    const std::string result = "v" + std::to_string(variables_num_++);
+    code_ << "  float " << result << ";\n";
+    code_ << "  " << function->glsl_name << "(";
+    for (const std::string &arg : args) {
+      code_ << arg << ", ";
+    }
+    code_ << result << ");\n";
+    return result;
+  }
+};
+
+/**
+ * Fields are evaluated on depsgraph worker threads, which must not wait for the draw manager
+ * context: the thread that holds it may be waiting for the depsgraph evaluation itself. Instead
+ * there is a separate context that is only used for fields. Only one thread can use it at a time,
+ * other threads evaluate their fields on the CPU in the meantime.
+ */
+struct GPUFieldContext {
+  std::mutex mutex;
+  void *system_gpu_context = nullptr;
+  GPUContext *blender_gpu_context = nullptr;
+  /** Compiled shaders by their generated source, only used with the context active. */
+  Map<std::string, GPUShader *> shaders;
+};
+
+static GPUFieldContext &gpu_field_context()
+{
+  static GPUFieldContext context;
+  return context;
+}
+
+void gpu_context_create()
+{
+  BLI_assert(BLI_thread_is_main());
+  if (!U.experimental.use_geometry_nodes_gpu_fields || G.background ||
+      GPU_use_main_context_workaround())
+  {
+    return;
+  }
+  GPUFieldContext &context = gpu_field_context();
+  BLI_assert(context.system_gpu_context == nullptr);
+  /* This changes the active context, the caller has to restore it. */
+  context.system_gpu_context = WM_system_gpu_context_create();
+  WM_system_gpu_context_activate(context.system_gpu_context);
+  context.blender_gpu_context = GPU_context_create(nullptr, context.system_gpu_context);
+  GPU_context_active_set(nullptr);
+  WM_system_gpu_context_release(context.system_gpu_context);
+}
+
+void gpu_context_destroy()
+{
+  BLI_assert(BLI_thread_is_main());
+  GPUFieldContext &context = gpu_field_context();
+  std::lock_guard lock{context.mutex};
+  if (context.system_gpu_context == nullptr) {
+    return;
+  }
+  WM_system_gpu_context_activate(context.system_gpu_context);
+  GPU_context_active_set(context.blender_gpu_context);
+  for (GPUShader *shader : context.shaders.values()) {
+    GPU_shader_free(shader);
+  }
+  context.shaders.clear();
+  GPU_context_discard(context.blender_gpu_context);
+  WM_system_gpu_context_dispose(context.system_gpu_context);
+  context.blender_gpu_context = nullptr;
+  context.system_gpu_context = nullptr;
+}
+
+/** Activates the field context on the calling thread, when it is not used by another thread. */
+class ScopedGPUContext {
+ private:
+  GPUFieldContext &context_;
+  std::unique_lock<std::mutex> lock_;
+
+ public:
+  ScopedGPUContext() : context_(gpu_field_context()), lock_(context_.mutex, std::try_to_lock)
+  {
+    if (!this->is_valid()) {
+      return;
+    }
+    GPU_render_begin();
+    WM_system_gpu_context_activate(context_.system_gpu_context);
+    GPU_context_active_set(context_.blender_gpu_context);
+  }
+
+  ~ScopedGPUContext()
+  {
+    if (!this->is_valid()) {
+      return;
+    }
+    GPU_context_active_set(nullptr);
+    WM_system_gpu_context_release(context_.system_gpu_context);
+    GPU_render_end();
+  }
+
+  bool is_valid() const
+  {
+    return lock_.owns_lock() && context_.system_gpu_context != nullptr;
+  }
+
+  GPUFieldContext &context()
+  {
+    return context_;
+  }
+};
+
+class GPUFieldEvaluator : public ExternalFieldEvaluator {
+ public:
+  bool try_evaluate(ResourceScope &scope,
+                    const Span<GFieldRef> fields,
+                    const IndexMask &mask,
+                    const FunctionRef<const GVArray &(const FieldInput &)> get_input,
+                    MutableSpan<GVArray> r_varrays) const override
+  {
+    if (!U.experimental.use_geometry_nodes_gpu_fields) {
+      return false;
+    }
+    /* Another context may be active on this thread, e.g. when a render thread that uses the
+     * draw manager context helps with the depsgraph evaluation. */
+    if (GPU_context_active_get() != nullptr) {
+      return false;
+    }
+    if (mask.size() < min_elements_num || mask.size() != mask.min_array_size()) {
+      return false;
+    }
+
+    FieldShaderBuilder builder{get_input};
+    for (const int i : fields.index_range()) {
+      if (!builder.add_output(fields[i], i)) {
+        return false;
+      }
+    }
+
+    ScopedGPUContext gpu_context;
+    if (!gpu_context.is_valid()) {
+      return false;
+    }
+    const int64_t buffers_num = builder.input_varrays.size() + fields.size();
+    if (buffers_num > GPU_max_compute_shader_storage_blocks() ||
+        mask.size() * sizeof(float) > GPU_max_storage_buffer_size())
+    {
+      return false;
+    }
+    GPUShader *shader = this->ensure_shader(gpu_context.context(), builder, fields.size());
+    if (shader == nullptr) {
+      return false;
+    }
+    GPU_shader_bind(shader);
+    GPU_shader_uniform_1i(shader, "elements_num", int(mask.size()));
+
+    const size_t buffer_size = size_t(mask.size()) * sizeof(float);
+    Vector<GPUStorageBuf *> buffers;
+    {
+      Array<float> data(mask.size());
+      for (const GVArray *varray : builder.input_varrays) {
+        varray->materialize(mask, data.data());
+        GPUStorageBuf *buffer = GPU_storagebuf_create_ex(
+            buffer_size, data.data(), GPU_USAGE_STATIC, "Field Input");
+        GPU_storagebuf_bind(buffer, buffers.size());
+        buffers.append(buffer);
+      }
+    }
+    const int outputs_start = buffers.size();
+    for ([[maybe_unused]] const int i : fields.index_range()) {
+      GPUStorageBuf *buffer = GPU_storagebuf_create_ex(
+          buffer_size, nullptr, GPU_USAGE_DEVICE_ONLY, "Field Output");
+      GPU_storagebuf_bind(buffer, buffers.size());
+      buffers.append(buffer);
+    }
+
+    /* Spread the work groups over two dimensions when there are too many for one. */
+    const uint groups_num = divide_ceil_u(uint(mask.size()), local_group_size);
+    const uint groups_x = std::min(groups_num, uint(GPU_max_work_group_count(0)));
+    const uint groups_y = divide_ceil_u(groups_num, groups_x);
+    GPU_compute_dispatch(shader, groups_x, groups_y, 1);
+    GPU_memory_barrier(GPU_BARRIER_BUFFER_UPDATE);
+
+    for (const int i : fields.index_range()) {
+      MutableSpan<float> result = scope.construct<Array<float>>(mask.size());
+      GPU_storagebuf_read(buffers[outputs_start + i], result.data());
+      r_varrays[i] = VArray<float>::ForSpan(result);
+    }
+
+    for (GPUStorageBuf *buffer : buffers) {
+      GPU_storagebuf_unbind(buffer);
+      GPU_storagebuf_free(buffer);
+    }
+    GPU_shader_unbind();
+    return true;
+  }
+
+ private:
+  GPUShader *ensure_shader(GPUFieldContext &context,
+                           const FieldShaderBuilder &builder,
+                           const int outputs_num) const
+  {
+    /* The generated code references all outputs, but not necessarily all inputs. */
+    const std::string key = std::to_string(builder.input_varrays.size()) + "\n" + builder.code();
+    if (GPUShader *const *shader = context.shaders.lookup_ptr(key)) {
+      return *shader;
+    }
+    GPUShader *shader = this->create_shader(builder, outputs_num);
+    if (shader == nullptr) {
+      return nullptr;
+    }
+    if (context.shaders.size() >= max_cached_shaders) {
+      for (GPUShader *cached_shader : context.shaders.values()) {
+        GPU_shader_free(cached_shader);
+      }
+      context.shaders.clear();
+    }
+    context.shaders.add_new(key, shader);
+    return shader;
+  }
+
+  GPUShader *create_shader(const FieldShaderBuilder &builder, const int outputs_num) const
+  {
+    using namespace gpu::shader;
+    ShaderCreateInfo info("gpu_field_eval");
+    info.local_group_size(local_group_size);
+    /* The create info only references the names. */
+    Array<std::string> names(builder.input_varrays.size() + outputs_num);
+    for (const int i : builder.input_varrays.index_range()) {
+      names[i] = "field_in_" + std::to_string(i) + "[]";
+      info.storage_buf(i, Qualifier::READ, "float", names[i]);
+    }
+    for (const int i : IndexRange(outputs_num)) {
+      const int slot = builder.input_varrays.size() + i;
+      names[slot] = "field_out_" + std::to_string(i) + "[]";
+      info.storage_buf(slot, Qualifier::WRITE, "float", names[slot]);
+    }
+    info.push_constant(Type::INT, "elements_num");
+    info.compute_source("gpu_shader_field_eval_comp.glsl");
+    /* The main function calls the generated function, so it has to be declared before.
+     * NOTE(Metal): Metal does not require forward declarations. */
+    if (GPU_backend_get_type() != GPU_BACKEND_METAL) {
+      info.typedef_source_generated += "void field_eval(uint index);\n";
+    }
+    info.compute_source_generated = builder.code();
+    return GPU_shader_create_from_info(reinterpret_cast<const GPUShaderCreateInfo *>(&info));
+  }
+};
+
+void register_field_evaluator()
+{
+  static GPUFieldEvaluator evaluator;
+  fn::set_external_field_evaluator(&evaluator);
+}
+
+}  // namespace blender::nodes::gpu_fields
@@ -22,6 +22,7 @@
 
 #include "NOD_geometry_exec.hh"
 #include "NOD_geometry_nodes_lazy_function.hh"
+#include "NOD_geometry_nodes_output_cache.hh"
 #include "NOD_multi_function.hh"
 #include "NOD_node_declaration.hh"
 
@@ -34,6 +35,7 @@
 #include "BLI_hash_md5.hh"
 #include "BLI_lazy_threading.hh"
 #include "BLI_map.hh"
+#include "BLI_memory_cache.hh"
 
 #include "DNA_ID.h"
 
@@ -127,12 +129,130 @@ static void lazy_function_interface_from_node(const bNode &node,
   }
 }
 
+/* -------------------------------------------------------------------- */
+/** \name Node Output Cache
+ *
+ * See #NOD_geometry_nodes_output_cache.hh.
+ * \{ */
+
+/**
+ * Forwards everything to the wrapped params, except for the outputs, which are kept so that they
+ * can be stored in the cache.
+ */
+class NodeOutputCaptureParams : public lf::Params {
+ private:
+  lf::Params &params_;
+  Array<void *> buffers_;
+  Array<bool> output_set_;
+
+ public:
+  NodeOutputCaptureParams(const LazyFunction &fn, lf::Params &params)
+      : lf::Params(fn, false),
+        params_(params),
+        buffers_(fn.outputs().size(), nullptr),
+        output_set_(fn.outputs().size(), false)
+  {
+  }
+
+  ~NodeOutputCaptureParams()
+  {
+    for (const int i : buffers_.index_range()) {
+      if (buffers_[i] == nullptr) {
+        continue;
+      }
+      if (output_set_[i]) {
+        fn_.outputs()[i].type->destruct(buffers_[i]);
+      }
+      MEM_freeN(buffers_[i]);
+    }
+  }
+
+  /** Move the outputs that have been set into a value that can be cached. */
+  std::unique_ptr<CachedNodeOutputs> take_outputs()
+  {
+    auto outputs = std::make_unique<CachedNodeOutputs>();
+    for (const int i : buffers_.index_range()) {
+      if (!output_set_[i]) {
+        continue;
+      }
+      const CPPType &type = *fn_.outputs()[i].type;
+      if (type.is<GeometrySet>()) {
+        /* The output may reference data of the inputs, which may be freed before the cached
+         * output is used again. */
+        static_cast<GeometrySet *>(buffers_[i])->ensure_owns_direct_data();
+      }
+      outputs->values.append({i, GMutablePointer(type, buffers_[i])});
+      buffers_[i] = nullptr;
+    }
+    return outputs;
+  }
+
+ private:
+  void *try_get_input_data_ptr_impl(const int index) const override
+  {
+    return params_.try_get_input_data_ptr(index);
+  }
+
+  void *try_get_input_data_ptr_or_request_impl(const int index) override
+  {
+    return params_.try_get_input_data_ptr_or_request(index);
+  }
+
+  void *get_output_data_ptr_impl(const int index) override
+  {
+    BLI_assert(!output_set_[index]);
+    if (buffers_[index] == nullptr) {
+      const CPPType &type = *fn_.outputs()[index].type;
+      buffers_[index] = MEM_mallocN_aligned(type.size(), type.alignment(), __func__);
+    }
+    return buffers_[index];
+  }
+
+  void output_set_impl(const int index) override
+  {
+    output_set_[index] = true;
+  }
+
+  bool output_was_set_impl(const int index) const override
+  {
+    return output_set_[index] || params_.output_was_set(index);
+  }
+
+  lf::ValueUsage get_output_usage_impl(const int index) const override
+  {
+    return params_.get_output_usage(index);
+  }
+
+  void set_input_unused_impl(const int index) override
+  {
+    params_.set_input_unused(index);
+  }
+
+  bool try_enable_multi_threading_impl() override
+  {
+    return params_.try_enable_multi_threading();
+  }
+};
+
+static uint64_t next_node_function_session_uid()
+{
+  static std::atomic<uint64_t> last_uid = 0;
+  return ++last_uid;
+}
+
+/** \} */
+
 /**
  * Used for most normal geometry nodes like Subdivision Surface and Set Position.
  */
 class LazyFunctionForGeometryNode : public LazyFunction {
  private:
   const bNode &node_;
+  /**
+   * Unique for every lazy-function ever created. The graph is rebuilt when the node tree changes,
+   * so this invalidates cached outputs of nodes whose properties changed.
+   */
+  uint64_t session_uid_;
   const GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info_;
   /**
    * A bool for every output bsocket. If true, the socket just outputs a field containing an
@@ -145,6 +265,7 @@ class LazyFunctionForGeometryNode : public LazyFunction {
   LazyFunctionForGeometryNode(const bNode &node,
                               GeometryNodesLazyFunctionGraphInfo &own_lf_graph_info)
       : node_(node),
+        session_uid_(next_node_function_session_uid()),
         own_lf_graph_info_(own_lf_graph_info),
         is_attribute_output_bsocket_(node.output_sockets().size(), false)
   {
@@ -247,6 +368,15 @@ class LazyFunctionForGeometryNode : public LazyFunction {
       return this->anonymous_attribute_name_for_output(*user_data, i);
     };
 
+    if (node_.typeinfo->geometry_node_cache_outputs) {
+      if (const std::optional<NodeOutputCacheKey> key = this->output_cache_key(params,
+                                                                                *user_data))
+      {
+        this->execute_with_output_cache(*key, params, context, get_anonymous_attribute_name);
+        return;
+      }
+    }
+
     GeoNodeExecParams geo_params{
         node_,
         params,
@@ -258,6 +388,74 @@ class LazyFunctionForGeometryNode : public LazyFunction {
     node_.typeinfo->geometry_node_execute(geo_params);
   }
 
+  std::optional<NodeOutputCacheKey> output_cache_key(const lf::Params &params,
+                                                     const GeoNodesLFUserData &user_data) const
+  {
+    NodeOutputCacheKey key;
+    key.append(session_uid_);
+    key.append(user_data.compute_context->hash());
+    /* Names of anonymous attributes created by the node depend on the object. */
+    key.append_string(user_data.call_data->self_object()->id.name);
+    for (const int i : outputs_.index_range()) {
+      key.append(params.get_output_usage(i));
+      key.append(params.output_was_set(i));
+    }
+    for (const int i : inputs_.index_range()) {
+      const GPointer value{inputs_[i].type, params.try_get_input_data_ptr(i)};
+      if (!add_input_to_output_cache_key(value, key)) {
+        return std::nullopt;
+      }
+    }
+    return key;
+  }
+
+  void execute_with_output_cache(
+      const NodeOutputCacheKey &key,
+      lf::Params &params,
+      const lf::Context &context,
+      const FunctionRef<std::string(int)> get_anonymous_attribute_name) const
+  {
+    GeoNodesLFUserData &user_data = *static_cast<GeoNodesLFUserData *>(context.user_data);
+    GeoNodesLFLocalUserData &local_user_data = *static_cast<GeoNodesLFLocalUserData *>(
+        context.local_user_data);
+    const std::shared_ptr<const CachedNodeOutputs> cached_outputs =
+        memory_cache::get<CachedNodeOutputs>(key, [&]() {
+          /* Log to a separate logger, so that warnings etc. can be stored with the outputs. This
+           * is done even if nothing is logged currently, because the outputs may be used by a
+           * later evaluation that does log. */
+          LinearAllocator<> node_log_allocator;
+          geo_eval_log::GeoTreeLogger node_logger;
+          node_logger.allocator = &node_log_allocator;
+          GeoNodesLFLocalUserData node_local_user_data{user_data};
+          node_local_user_data.set_tree_logger(&node_logger);
+          const lf::Context node_context{context.storage, &user_data, &node_local_user_data};
+
+          NodeOutputCaptureParams capture_params{*this, params};
+          GeoNodeExecParams geo_params{
+              node_,
+              capture_params,
+              node_context,
+              own_lf_graph_info_.mapping.lf_input_index_for_output_bsocket_usage,
+              own_lf_graph_info_.mapping.lf_input_index_for_reference_set_for_output,
+              get_anonymous_attribute_name};
+          node_.typeinfo->geometry_node_execute(geo_params);
+          local_user_data.node_output_geometry_bytes +=
+              node_local_user_data.node_output_geometry_bytes;
+
+          std::unique_ptr<CachedNodeOutputs> outputs = capture_params.take_outputs();
+          outputs->copy_log_from(node_logger);
+          return outputs;
+        });
+    if (geo_eval_log::GeoTreeLogger *tree_logger = local_user_data.try_get_tree_logger(user_data))
+    {
+      cached_outputs->log_to(*tree_logger, node_.identifier);
+    }
+    for (const auto &[lf_index, value] : cached_outputs->values) {
+      value.type()->copy_construct(value.get(), params.get_output_data_ptr(lf_index));
+      params.output_set(lf_index);
+    }
+  }
+
   std::string input_name(const int index) const override
   {
     for (const bNodeSocket *bsocket : node_.output_sockets()) {
@@ -1728,6 +1926,14 @@ class GeometryNodesLazyFunctionLogger : public lf::GraphExecutor::Logger {
     user_data->compute_context->print_stack(std::cout, ss.str());
   }
 
+  void log_node_queue_time(const lf::FunctionNode & /*node*/,
+                           const std::chrono::nanoseconds duration,
+                           const lf::Context &context) const override
+  {
+    auto &local_user_data = *static_cast<GeoNodesLFLocalUserData *>(context.local_user_data);
+    local_user_data.node_queue_time = duration;
+  }
+
   void log_before_node_execute(const lf::FunctionNode &node,
                                const lf::Params & /*params*/,
                                const lf::Context &context) const override
@@ -2,9 +2,14 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include <atomic>
+
 #include "NOD_geometry_nodes_lazy_function.hh"
 #include "NOD_geometry_nodes_log.hh"
 
+#include "BLI_serialize.hh"
+#include "BLI_trace.hh"
+
 #include "BKE_compute_contexts.hh"
 #include "BKE_curves.hh"
 #include "BKE_geometry_nodes_gizmos_transforms.hh"
@@ -194,6 +199,18 @@ GeometryInfoLog::GeometryInfoLog(const bke::GVolumeGrid &grid)
 #endif
 }
 
+static std::atomic<bool> profiling_enabled = false;
+
+void set_profiling_enabled(const bool enabled)
+{
+  profiling_enabled.store(enabled, std::memory_order_relaxed);
+}
+
+bool is_profiling_enabled()
+{
+  return profiling_enabled.load(std::memory_order_relaxed);
+}
+
 /* Avoid generating these in every translation unit. */
 GeoModifierLog::GeoModifierLog() = default;
 GeoModifierLog::~GeoModifierLog() = default;
@@ -774,6 +791,90 @@ const ViewerNodeLog *GeoModifierLog::find_viewer_node_log_for_path(const ViewerP
   return viewer_log;
 }
 
+std::string GeoModifierLog::execution_times_to_trace_json(const bNodeTree &root_tree)
+{
+  using namespace io::serialize;
+
+  /* Every thread has its own logger for each compute context. */
+  MultiValueMap<ComputeContextHash, const GeoTreeLogger *> loggers_by_context;
+  std::optional<ComputeContextHash> root_hash;
+  std::optional<TimePoint> first_start;
+  for (LocalData &local_data : data_per_thread_) {
+    for (const auto item : local_data.tree_logger_by_context.items()) {
+      const GeoTreeLogger &tree_logger = *item.value;
+      loggers_by_context.add(item.key, &tree_logger);
+      if (!tree_logger.parent_hash) {
+        root_hash = item.key;
+      }
+      for (const GeoTreeLogger::NodeExecutionTime &timings : tree_logger.node_execution_times) {
+        if (!first_start || timings.start < *first_start) {
+          first_start = timings.start;
+        }
+      }
+    }
+  }
+
+  /* Find the node tree of every compute context, starting at the root. */
+  Map<ComputeContextHash, const bNodeTree *> tree_by_context;
+  if (root_hash) {
+    tree_by_context.add(*root_hash, &root_tree);
+    Vector<ComputeContextHash> hashes_to_check = {*root_hash};
+    while (!hashes_to_check.is_empty()) {
+      const ComputeContextHash hash = hashes_to_check.pop_last();
+      const bNodeTree &tree = *tree_by_context.lookup(hash);
+      for (const GeoTreeLogger *tree_logger : loggers_by_context.lookup(hash)) {
+        for (const ComputeContextHash &child_hash : tree_logger->children_hashes) {
+          if (tree_by_context.contains(child_hash)) {
+            continue;
+          }
+          const Span<const GeoTreeLogger *> child_loggers = loggers_by_context.lookup(child_hash);
+          if (child_loggers.is_empty() || !child_loggers[0]->parent_node_id) {
+            continue;
+          }
+          const bNode *node = tree.node_by_id(*child_loggers[0]->parent_node_id);
+          if (node == nullptr) {
+            continue;
+          }
+          /* Zones are evaluated in a separate context, but belong to the same tree. */
+          const bNodeTree *child_tree = &tree;
+          if (node->is_group()) {
+            if (node->id == nullptr) {
+              continue;
+            }
+            child_tree = reinterpret_cast<const bNodeTree *>(node->id);
+          }
+          tree_by_context.add(child_hash, child_tree);
+          hashes_to_check.append(child_hash);
+        }
+      }
+    }
+  }
+
+  trace::ChromeTraceWriter writer(root_tree.id.name + 2);
+  for (const auto item : loggers_by_context.items()) {
+    const bNodeTree *tree = tree_by_context.lookup_default(item.key, nullptr);
+    for (const GeoTreeLogger *tree_logger : item.value) {
+      for (const GeoTreeLogger::NodeExecutionTime &timings : tree_logger->node_execution_times) {
+        const bNode *node = tree ? tree->node_by_id(timings.node_id) : nullptr;
+        const std::string name = node ? std::string(node->name) :
+                                        "Node " + std::to_string(timings.node_id);
+        using Seconds = std::chrono::duration<double>;
+        DictionaryValue &trace_event = writer.add_event(
+            name,
+            tree ? tree->id.name + 2 : "",
+            timings.thread_index,
+            Seconds(timings.start - *first_start).count(),
+            Seconds(timings.end - *first_start).count());
+        DictionaryValue &args = *trace_event.append_dict("args");
+        args.append_double("queue_time_us",
+                           std::chrono::duration<double, std::micro>(timings.queue_time).count());
+        args.append_int("output_geometry_bytes", timings.output_geometry_bytes);
+      }
+    }
+  }
+  return writer.to_json();
+}
+
 int node_warning_type_icon(const NodeWarningType type)
 {
   switch (type) {
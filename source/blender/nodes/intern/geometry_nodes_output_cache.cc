@@ -0,0 +1,243 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: GPL-2.0-or-later */
+
+/** \file
+ * \ingroup nodes
+ */
+
+#include "NOD_geometry_nodes_output_cache.hh"
+
+#include "BLI_hash.hh"
+#include "BLI_memory_counter.hh"
+
+#include "DNA_ID.h"
+#include "DNA_curves_types.h"
+#include "DNA_mesh_types.h"
+#include "DNA_pointcloud_types.h"
+
+#include "BKE_curves.hh"
+#include "BKE_geometry_nodes_reference_set.hh"
+#include "BKE_geometry_set.hh"
+#include "BKE_mesh_types.hh"
+#include "BKE_node_socket_value.hh"
+
+#include <algorithm>
+#include <xxhash.h>
+
+namespace blender::nodes {
+
+uint64_t NodeOutputCacheKey::hash() const
+{
+  uint64_t hash = XXH3_64bits(data.data(), size_t(data.size()));
+  for (const auto &[sharing_info, version] : shared_data) {
+    hash = get_default_hash(hash, sharing_info.get(), version);
+  }
+  return hash;
+}
+
+bool NodeOutputCacheKey::equal_to(const GenericKey &other) const
+{
+  if (const auto *other_typed = dynamic_cast<const NodeOutputCacheKey *>(&other)) {
+    return data == other_typed->data && shared_data == other_typed->shared_data;
+  }
+  return false;
+}
+
+std::unique_ptr<GenericKey> NodeOutputCacheKey::to_storable() const
+{
+  return std::make_unique<NodeOutputCacheKey>(*this);
+}
+
+CachedNodeOutputs::~CachedNodeOutputs()
+{
+  for (const auto &item : values) {
+    GMutablePointer value = item.second;
+    value.destruct();
+    MEM_freeN(value.get());
+  }
+}
+
+void CachedNodeOutputs::count_memory(MemoryCounter &memory) const
+{
+  for (const auto &item : values) {
+    const GMutablePointer value = item.second;
+    if (value.is_type<bke::GeometrySet>()) {
+      value.get<bke::GeometrySet>()->count_memory(memory);
+    }
+  }
+}
+
+StringRefNull CachedNodeOutputs::category() const
+{
+  return "geometry_nodes";
+}
+
+void CachedNodeOutputs::copy_log_from(const geo_eval_log::GeoTreeLogger &node_logger)
+{
+  for (const geo_eval_log::GeoTreeLogger::WarningWithNode &item : node_logger.node_warnings) {
+    warnings.append(item.warning);
+  }
+  for (const geo_eval_log::GeoTreeLogger::AttributeUsageWithNode &item :
+       node_logger.used_named_attributes)
+  {
+    used_named_attributes.append({item.attribute_name, item.usage});
+  }
+}
+
+void CachedNodeOutputs::log_to(geo_eval_log::GeoTreeLogger &tree_logger,
+                               const int32_t node_id) const
+{
+  for (const geo_eval_log::NodeWarning &warning : warnings) {
+    tree_logger.node_warnings.append(*tree_logger.allocator, {node_id, warning});
+  }
+  for (const auto &[attribute_name, usage] : used_named_attributes) {
+    tree_logger.used_named_attributes.append(
+        *tree_logger.allocator,
+        {node_id, tree_logger.allocator->copy_string(attribute_name), usage});
+  }
+}
+
+static bool add_attributes_to_key(const bke::AttributeAccessor &attributes,
+                                  NodeOutputCacheKey &key)
+{
+  bool success = true;
+  attributes.foreach_attribute([&](const bke::AttributeIter &iter) {
+    key.append_string(iter.name);
+    key.append(iter.domain);
+    key.append(iter.data_type);
+    /* Attributes that don't reference shared arrays (e.g. vertex groups) can't be identified. */
+    const bke::GAttributeReader reader = iter.get();
+    if (!key.append_shared_data(reader.sharing_info)) {
+      success = false;
+      iter.stop();
+    }
+  });
+  return success;
+}
+
+static void add_materials_to_key(const Span<const Material *> materials, NodeOutputCacheKey &key)
+{
+  key.append(materials.size());
+  for (const Material *material : materials) {
+    key.append(material ? reinterpret_cast<const ID *>(material)->session_uid : 0u);
+  }
+}
+
+static bool add_geometry_to_key(const bke::GeometrySet &geometry, NodeOutputCacheKey &key)
+{
+  key.append_string(geometry.name);
+  for (const bke::GeometryComponent *component : geometry.get_components()) {
+    key.append(component->type());
+    if (component->is_empty()) {
+      continue;
+    }
+    switch (component->type()) {
+      case bke::GeometryComponent::Type::Mesh: {
+        const Mesh &mesh = *static_cast<const bke::MeshComponent *>(component)->get();
+        key.append(mesh.verts_num);
+        key.append(mesh.edges_num);
+        key.append(mesh.faces_num);
+        key.append(mesh.corners_num);
+        if (mesh.faces_num > 0 && !key.append_shared_data(mesh.runtime->face_offsets_sharing_info))
+        {
+          return false;
+        }
+        add_materials_to_key({mesh.mat, mesh.totcol}, key);
+        break;
+      }
+      case bke::GeometryComponent::Type::PointCloud: {
+        const PointCloud &pointcloud =
+            *static_cast<const bke::PointCloudComponent *>(component)->get();
+        key.append(pointcloud.totpoint);
+        add_materials_to_key({pointcloud.mat, pointcloud.totcol}, key);
+        break;
+      }
+      case bke::GeometryComponent::Type::Curve: {
+        const Curves &curves_id = *static_cast<const bke::CurveComponent *>(component)->get();
+        const bke::CurvesGeometry &curves = curves_id.geometry.wrap();
+        key.append(curves.points_num());
+        key.append(curves.curves_num());
+        if (curves.curves_num() > 0 &&
+            !key.append_shared_data(curves.runtime->curve_offsets_sharing_info))
+        {
+          return false;
+        }
+        add_materials_to_key({curves_id.mat, curves_id.totcol}, key);
+        break;
+      }
+      default: {
+        /* Other components can't be identified by their arrays (yet). */
+        return false;
+      }
+    }
+    if (!add_attributes_to_key(*component->attributes(), key)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool add_socket_value_to_key(const bke::SocketValueVariant &value, NodeOutputCacheKey &key)
+{
+  if (value.is_context_dependent_field() || value.is_volume_grid()) {
+    return false;
+  }
+  bke::SocketValueVariant single_value = value;
+  single_value.convert_to_single();
+  const GPointer ptr = single_value.get_single_ptr();
+  const CPPType &type = *ptr.type();
+  if (ptr.is_type<std::string>()) {
+    key.append_string(*ptr.get<std::string>());
+    return true;
+  }
+  if (!type.is_trivially_destructible()) {
+    return false;
+  }
+  key.data.extend(Span(static_cast<const char *>(ptr.get()), type.size()));
+  return true;
+}
+
+bool add_input_to_output_cache_key(const GPointer value, NodeOutputCacheKey &key)
+{
+  if (value.is_type<bke::GeometrySet>()) {
+    return add_geometry_to_key(*value.get<bke::GeometrySet>(), key);
+  }
+  if (value.is_type<Vector<bke::GeometrySet>>()) {
+    const Vector<bke::GeometrySet> &geometries = *value.get<Vector<bke::GeometrySet>>();
+    key.append(geometries.size());
+    for (const bke::GeometrySet &geometry : geometries) {
+      if (!add_geometry_to_key(geometry, key)) {
+        return false;
+      }
+    }
+    return true;
+  }
+  if (value.is_type<bke::SocketValueVariant>()) {
+    return add_socket_value_to_key(*value.get<bke::SocketValueVariant>(), key);
+  }
+  if (value.is_type<bool>()) {
+    key.append(*value.get<bool>());
+    return true;
+  }
+  if (value.is_type<bke::GeometryNodesReferenceSet>()) {
+    const bke::GeometryNodesReferenceSet &reference_set =
+        *value.get<bke::GeometryNodesReferenceSet>();
+    if (!reference_set.names) {
+      key.append(int64_t(0));
+      return true;
+    }
+    Vector<StringRef> names(reference_set.names->begin(), reference_set.names->end());
+    std::sort(names.begin(), names.end());
+    key.append(names.size());
+    for (const StringRef name : names) {
+      key.append_string(name);
+    }
+    return true;
+  }
+  /* Data-block inputs depend on the evaluated state of the data-block. */
+  return false;
+}
+
+
+}  // namespace blender::nodes
@@ -2,10 +2,20 @@
  *
  * SPDX-License-Identifier: GPL-2.0-or-later */
 
+#include "NOD_geometry_nodes_gpu_fields.hh"
 #include "NOD_math_functions.hh"
 
 namespace blender::nodes {
 
+/** Allow evaluating the function in compute shaders, all GLSL math functions take 3 inputs. */
+static bool register_gpu_function(const mf::MultiFunction &fn, const FloatMathOperationInfo &info)
+{
+  if (!info.shader_name.is_empty()) {
+    gpu_fields::register_function(fn, info.shader_name, 3);
+  }
+  return true;
+}
+
 static const mf::MultiFunction *get_base_multi_function(const bNode &node)
 {
   const int mode = node.custom1;
@@ -15,6 +25,7 @@ static const mf::MultiFunction *get_base_multi_function(const bNode &node)
       mode, [&](auto devi_fn, auto function, const FloatMathOperationInfo &info) {
         static auto fn = mf::build::SI1_SO<float, float>(
             info.title_case_name.c_str(), function, devi_fn);
+        [[maybe_unused]] static const bool gpu_registered = register_gpu_function(fn, info);
         base_fn = &fn;
       });
   if (base_fn != nullptr) {
@@ -25,6 +36,7 @@ static const mf::MultiFunction *get_base_multi_function(const bNode &node)
       mode, [&](auto devi_fn, auto function, const FloatMathOperationInfo &info) {
         static auto fn = mf::build::SI2_SO<float, float, float>(
             info.title_case_name.c_str(), function, devi_fn);
+        [[maybe_unused]] static const bool gpu_registered = register_gpu_function(fn, info);
         base_fn = &fn;
       });
   if (base_fn != nullptr) {
@@ -35,6 +47,7 @@ static const mf::MultiFunction *get_base_multi_function(const bNode &node)
       mode, [&](auto devi_fn, auto function, const FloatMathOperationInfo &info) {
         static auto fn = mf::build::SI3_SO<float, float, float, float>(
             info.title_case_name.c_str(), function, devi_fn);
+        [[maybe_unused]] static const bool gpu_registered = register_gpu_function(fn, info);
         base_fn = &fn;
       });
   if (base_fn != nullptr) {
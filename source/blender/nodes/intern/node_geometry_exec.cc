@@ -10,6 +10,8 @@
 
 #include "DEG_depsgraph_query.hh"
 
+#include "BLI_memory_counter.hh"
+
 #include "BKE_curves.hh"
 #include "BKE_type_conversions.hh"
 
@@ -150,6 +152,14 @@ void GeoNodeExecParams::check_output_geometry_set(const GeometrySet &geometry_se
 #endif
 }
 
+void GeoNodeExecParams::count_output_geometry_memory(const GeometrySet &geometry_set) const
+{
+  MemoryCount memory;
+  MemoryCounter memory_counter{memory};
+  geometry_set.count_memory(memory_counter);
+  this->local_user_data()->node_output_geometry_bytes += memory.total_bytes;
+}
+
 const bNodeSocket *GeoNodeExecParams::find_available_socket(const StringRef name) const
 {
   for (const bNodeSocket *socket : node_.input_sockets()) {
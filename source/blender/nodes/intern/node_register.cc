@@ -5,6 +5,7 @@
 #include "BLI_string.h"
 
 #include "NOD_geometry.hh"
+#include "NOD_geometry_nodes_gpu_fields.hh"
 #include "NOD_register.hh"
 #include "NOD_socket.hh"
 
@@ -133,4 +134,6 @@ void register_nodes()
   register_texture_nodes();
   register_geometry_nodes();
   register_function_nodes();
+
+  blender::nodes::gpu_fields::register_field_evaluator();
 }
@@ -49,9 +49,11 @@ static int gpu_shader_clamp(GPUMaterial *mat,
 
 static void sh_node_clamp_build_multi_function(NodeMultiFunctionBuilder &builder)
 {
+  static auto exec_preset = mf::build::exec_presets::AllSpanOrSingle();
   static auto minmax_fn = mf::build::SI3_SO<float, float, float, float>(
       "Clamp (Min Max)",
-      [](float value, float min, float max) { return std::min(std::max(value, min), max); });
+      [](float value, float min, float max) { return std::min(std::max(value, min), max); },
+      exec_preset);
   static auto range_fn = mf::build::SI3_SO<float, float, float, float>(
       "Clamp (Range)", [](float value, float a, float b) {
         if (a < b) {
@@ -59,7 +61,8 @@ static void sh_node_clamp_build_multi_function(NodeMultiFunctionBuilder &builder
         }
 
         return clamp_f(value, b, a);
-      });
+      },
+      exec_preset);
 
   int clamp_type = builder.node().custom1;
   if (clamp_type == NODE_CLAMP_MINMAX) {
@@ -460,20 +460,24 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
   const NodeShaderMix *data = (NodeShaderMix *)node.storage;
   bool uniform_factor = data->factor_mode == NODE_MIX_MODE_UNIFORM;
   const bool clamp_factor = data->clamp_factor;
+  /* Devirtualize spans so that the loops over contiguous arrays can be vectorized. */
+  static auto exec_preset = mf::build::exec_presets::AllSpanOrSingle();
   switch (data->data_type) {
     case SOCK_FLOAT: {
       if (clamp_factor) {
         static auto fn = mf::build::SI3_SO<float, float, float, float>(
             "Clamp Mix Float", [](float t, const float a, const float b) {
               return math::interpolate(a, b, std::clamp(t, 0.0f, 1.0f));
-            });
+            },
+            exec_preset);
         return &fn;
       }
       else {
         static auto fn = mf::build::SI3_SO<float, float, float, float>(
             "Mix Float", [](const float t, const float a, const float b) {
               return math::interpolate(a, b, t);
-            });
+            },
+            exec_preset);
         return &fn;
       }
     }
@@ -483,7 +487,8 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
           static auto fn = mf::build::SI3_SO<float, float3, float3, float3>(
               "Clamp Mix Vector", [](const float t, const float3 a, const float3 b) {
                 return math::interpolate(a, b, std::clamp(t, 0.0f, 1.0f));
-              });
+              },
+              exec_preset);
           return &fn;
         }
         else {
@@ -491,7 +496,8 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
               "Clamp Mix Vector Non Uniform", [](float3 t, const float3 a, const float3 b) {
                 t = math::clamp(t, 0.0f, 1.0f);
                 return a * (float3(1.0f) - t) + b * t;
-              });
+              },
+              exec_preset);
           return &fn;
         }
       }
@@ -500,14 +506,16 @@ static const mf::MultiFunction *get_multi_function(const bNode &node)
           static auto fn = mf::build::SI3_SO<float, float3, float3, float3>(
               "Mix Vector", [](const float t, const float3 a, const float3 b) {
                 return math::interpolate(a, b, t);
-              });
+              },
+              exec_preset);
           return &fn;
         }
         else {
           static auto fn = mf::build::SI3_SO<float3, float3, float3, float3>(
               "Mix Vector Non Uniform", [](const float3 t, const float3 a, const float3 b) {
                 return a * (float3(1.0f) - t) + b * t;
-              });
+              },
+              exec_preset);
           return &fn;
         }
       }
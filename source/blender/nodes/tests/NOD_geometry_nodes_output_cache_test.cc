@@ -0,0 +1,137 @@
+/* SPDX-FileCopyrightText: 2026 Blender Authors
+ *
+ * SPDX-License-Identifier: Apache-2.0 */
+
+#include "BKE_geometry_set.hh"
+#include "BKE_idtype.hh"
+#include "BKE_mesh.hh"
+#include "BKE_node_socket_value.hh"
+
+#include "NOD_geometry_nodes_output_cache.hh"
+
+#include "testing/testing.h"
+
+namespace blender::nodes::tests {
+
+static Mesh *create_triangle_mesh()
+{
+  Mesh *mesh = BKE_mesh_new_nomain(3, 3, 1, 3);
+  mesh->vert_positions_for_write().copy_from(
+      {float3(0.0f, 0.0f, 0.0f), float3(1.0f, 0.0f, 0.0f), float3(0.0f, 1.0f, 0.0f)});
+  mesh->edges_for_write().copy_from({int2(0, 1), int2(1, 2), int2(2, 0)});
+  mesh->face_offsets_for_write().copy_from({0, 3});
+  mesh->corner_verts_for_write().copy_from({0, 1, 2});
+  mesh->corner_edges_for_write().copy_from({0, 1, 2});
+  return mesh;
+}
+
+static NodeOutputCacheKey create_key(const bke::GeometrySet &geometry, const float value)
+{
+  NodeOutputCacheKey key;
+  EXPECT_TRUE(add_input_to_output_cache_key(GPointer(&geometry), key));
+  const bke::SocketValueVariant value_variant(value);
+  EXPECT_TRUE(add_input_to_output_cache_key(GPointer(&value_variant), key));
+  return key;
+}
+
+/** Get the cached value for the key, and count how often it had to be computed. */
+static void cache_get(const NodeOutputCacheKey &key, int &r_compute_count)
+{
+  memory_cache::get<CachedNodeOutputs>(key, [&]() {
+    r_compute_count++;
+    return std::make_unique<CachedNodeOutputs>();
+  });
+}
+
+TEST(geometry_nodes_output_cache, Hit)
+{
+  BKE_idtype_init();
+  memory_cache::clear();
+  const bke::GeometrySet geometry = bke::GeometrySet::from_mesh(create_triangle_mesh());
+
+  const NodeOutputCacheKey key_a = create_key(geometry, 1.0f);
+  /* A copy of the geometry shares all its arrays. */
+  const bke::GeometrySet geometry_copy = geometry;
+  const NodeOutputCacheKey key_b = create_key(geometry_copy, 1.0f);
+  EXPECT_EQ(key_a.hash(), key_b.hash());
+  EXPECT_TRUE(key_a.equal_to(key_b));
+
+  int compute_count = 0;
+  cache_get(key_a, compute_count);
+  cache_get(key_b, compute_count);
+  EXPECT_EQ(compute_count, 1);
+}
+
+TEST(geometry_nodes_output_cache, Miss)
+{
+  BKE_idtype_init();
+  memory_cache::clear();
+  const bke::GeometrySet geometry = bke::GeometrySet::from_mesh(create_triangle_mesh());
+
+  const NodeOutputCacheKey key_a = create_key(geometry, 1.0f);
+  const NodeOutputCacheKey key_b = create_key(geometry, 2.0f);
+  EXPECT_FALSE(key_a.equal_to(key_b));
+
+  int compute_count = 0;
+  cache_get(key_a, compute_count);
+  cache_get(key_b, compute_count);
+  EXPECT_EQ(compute_count, 2);
+}
+
+TEST(geometry_nodes_output_cache, InvalidatedByModification)
+{
+  BKE_idtype_init();
+  memory_cache::clear();
+  bke::GeometrySet geometry = bke::GeometrySet::from_mesh(create_triangle_mesh());
+
+  const NodeOutputCacheKey key_a = create_key(geometry, 1.0f);
+  int compute_count = 0;
+  cache_get(key_a, compute_count);
+
+  /* The positions are not shared, so they are modified in place, which changes their version. */
+  geometry.get_mesh_for_write()->vert_positions_for_write()[0] = float3(0.5f);
+  const NodeOutputCacheKey key_b = create_key(geometry, 1.0f);
+  EXPECT_FALSE(key_a.equal_to(key_b));
+
+  cache_get(key_b, compute_count);
+  EXPECT_EQ(compute_count, 2);
+}
+
+TEST(geometry_nodes_output_cache, LogIsReplayed)
+{
+  LinearAllocator<> allocator;
+  geo_eval_log::GeoTreeLogger node_logger;
+  node_logger.allocator = &allocator;
+  node_logger.node_warnings.append(
+      allocator, {3, {geo_eval_log::NodeWarningType::Warning, allocator.copy_string("Warning")}});
+  node_logger.used_named_attributes.append(
+      allocator, {3, allocator.copy_string("attribute"), geo_eval_log::NamedAttributeUsage::Read});
+
+  CachedNodeOutputs outputs;
+  outputs.copy_log_from(node_logger);
+
+  geo_eval_log::GeoTreeLogger tree_logger;
+  tree_logger.allocator = &allocator;
+  outputs.log_to(tree_logger, 7);
+  outputs.log_to(tree_logger, 7);
+
+  int warnings_num = 0;
+  for (const geo_eval_log::GeoTreeLogger::WarningWithNode &item : tree_logger.node_warnings) {
+    EXPECT_EQ(item.node_id, 7);
+    EXPECT_EQ(item.warning.message, "Warning");
+    warnings_num++;
+  }
+  EXPECT_EQ(warnings_num, 2);
+
+  int attributes_num = 0;
+  for (const geo_eval_log::GeoTreeLogger::AttributeUsageWithNode &item :
+       tree_logger.used_named_attributes)
+  {
+    EXPECT_EQ(item.node_id, 7);
+    EXPECT_EQ(item.attribute_name, "attribute");
+    attributes_num++;
+  }
+  EXPECT_EQ(attributes_num, 2);
+}
+
+}  // namespace blender::nodes::tests
@@ -40,10 +40,13 @@
 #include "BKE_appdir.hh"
 #include "BKE_blender_version.h"
 #include "BKE_global.hh"
+#include "BKE_idtype.hh"
 #include "BKE_main.hh"
 
 #include "DNA_ID.h"
 
+#include "BLO_undofile.hh"
+
 #include "UI_interface_icons.hh"
 
 #include "MEM_guardedalloc.h"
@@ -584,6 +587,47 @@ static PyObject *bpy_app_is_job_running(PyObject * /*self*/, PyObject *args, PyO
   return PyBool_FromLong(WM_jobs_has_running_type(wm, job_type_enum.value));
 }
 
+PyDoc_STRVAR(
+    /* Wrap. */
+    bpy_app_memfile_undo_stats_doc,
+    ".. staticmethod:: memfile_undo_stats()\n"
+    "\n"
+    "   Return statistics about the last global undo step that was loaded.\n"
+    "\n"
+    "   :return: Dictionary with the total ``duration`` in seconds and ``id_types``, mapping ID "
+    "type names to dictionaries with the number of ``reused`` unchanged IDs and ``read`` IDs, "
+    "as well as the ``read_size`` in bytes and ``read_duration`` in seconds of the read IDs.\n"
+    "   :rtype: dict\n");
+static PyObject *bpy_app_memfile_undo_stats(PyObject * /*self*/, PyObject * /*args*/)
+{
+  const MemFileReadStats &stats = BLO_memfile_read_stats_last();
+  auto dict_set_item_string_steal = [](PyObject *dict, const char *key, PyObject *value) {
+    PyDict_SetItemString(dict, key, value);
+    Py_DECREF(value);
+  };
+
+  PyObject *id_types = PyDict_New();
+  for (int i = 0; i < INDEX_ID_MAX; i++) {
+    const MemFileReadStats::IDTypeStats &id_stats = stats.id_types[i];
+    const IDTypeInfo *id_type = BKE_idtype_get_info_from_idtype_index(i);
+    if (id_type == nullptr || (id_stats.reused_num == 0 && id_stats.read_num == 0)) {
+      continue;
+    }
+    PyObject *item = PyDict_New();
+    dict_set_item_string_steal(item, "reused", PyLong_FromLong(id_stats.reused_num));
+    dict_set_item_string_steal(item, "read", PyLong_FromLong(id_stats.read_num));
+    dict_set_item_string_steal(item, "read_size", PyLong_FromSize_t(id_stats.read_size));
+    dict_set_item_string_steal(
+        item, "read_duration", PyFloat_FromDouble(id_stats.read_duration));
+    dict_set_item_string_steal(id_types, id_type->name, item);
+  }
+
+  PyObject *result = PyDict_New();
+  dict_set_item_string_steal(result, "duration", PyFloat_FromDouble(stats.duration));
+  dict_set_item_string_steal(result, "id_types", id_types);
+  return result;
+}
+
 char *(*BPY_python_app_help_text_fn)(bool all) = nullptr;
 
 PyDoc_STRVAR(
@@ -632,6 +676,10 @@ static PyMethodDef bpy_app_methods[] = {
      (PyCFunction)bpy_app_help_text,
      METH_VARARGS | METH_KEYWORDS | METH_STATIC,
      bpy_app_help_text_doc},
+    {"memfile_undo_stats",
+     (PyCFunction)bpy_app_memfile_undo_stats,
+     METH_NOARGS | METH_STATIC,
+     bpy_app_memfile_undo_stats_doc},
     {nullptr, nullptr, 0, nullptr},
 };
 
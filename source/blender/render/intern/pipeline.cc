@@ -39,6 +39,7 @@
 #include "BLI_threads.h"
 #include "BLI_time.h"
 #include "BLI_timecode.h"
+#include "BLI_trace.hh"
 #include "BLI_vector.hh"
 
 #include "BLT_translation.hh"
@@ -62,11 +63,13 @@
 #include "BKE_pointcache.h"
 #include "BKE_report.hh"
 #include "BKE_scene.hh"
+#include "BKE_scene_runtime.hh"
 #include "BKE_sound.h"
 #include "BKE_writemovie.hh"
 
 #include "NOD_composite.hh"
 
+#include "COM_profiler.hh"
 #include "COM_render_context.hh"
 
 #include "DEG_depsgraph.hh"
@@ -1370,6 +1373,7 @@ static void do_render_compositor(Render *re)
         }
 
         blender::realtime_compositor::RenderContext compositor_render_context;
+        blender::realtime_compositor::Profiler compositor_profiler;
         LISTBASE_FOREACH (RenderView *, rv, &re->result->views) {
           ntreeCompositExecTree(re,
                                 re->pipeline_scene_eval,
@@ -1377,10 +1381,18 @@ static void do_render_compositor(Render *re)
                                 &re->r,
                                 rv->name,
                                 &compositor_render_context,
-                                nullptr);
+                                &compositor_profiler);
         }
         compositor_render_context.save_file_outputs(re->pipeline_scene_eval);
 
+        /* Expose the node evaluation times of the render to Python. In interactive sessions, the
+         * times are drawn by the node editor from the main thread while this runs in the render
+         * job, so they are only stored in background mode. */
+        if (G.background) {
+          re->scene->runtime->compositor.per_node_execution_time =
+              compositor_profiler.get_nodes_evaluation_times();
+        }
+
         ntree->runtime->stats_draw = nullptr;
         ntree->runtime->test_break = nullptr;
         ntree->runtime->progress = nullptr;
@@ -1568,6 +1580,7 @@ static void do_render_sequencer(Render *re)
 /* Render full pipeline, using render engine, sequencer and compositing nodes. */
 static void do_render_full_pipeline(Render *re)
 {
+  BLI_TRACE_ZONE("Render Frame", "render");
   bool render_seq = false;
 
   re->current_scene_update_cb(re->suh, re->scene);
@@ -6,13 +6,18 @@
  * \ingroup sequencer
  */
 
+#include "BLI_fileops.h"
+#include "BLI_fileops_types.h"
+#include "BLI_hash.hh"
 #include "BLI_map.hh"
 #include "BLI_math_base.h"
 #include "BLI_path_utils.hh"
 #include "BLI_set.hh"
+#include "BLI_string.h"
 #include "BLI_task.hh"
 #include "BLI_vector.hh"
 
+#include "BKE_appdir.hh"
 #include "BKE_context.hh"
 #include "BKE_main.hh"
 
@@ -20,6 +25,7 @@
 #include "DNA_sequence_types.h"
 
 #include "IMB_imbuf.hh"
+#include "IMB_imbuf_types.hh"
 
 #include "SEQ_render.hh"
 #include "SEQ_thumbnail_cache.hh"
@@ -32,6 +38,8 @@
 namespace blender::seq {
 
 static constexpr int MAX_THUMBNAILS = 5000;
+/* Size limit of the movie thumbnails stored on disk. */
+static constexpr int64_t MAX_DISK_THUMBNAILS_SIZE = int64_t(256) * 1024 * 1024;
 
 // #define DEBUG_PRINT_THUMB_JOB_TIMES
 
@@ -232,6 +240,133 @@ static void scale_to_thumbnail_size(ImBuf *ibuf)
   IMB_scale(ibuf, width, height, IMBScaleFilter::Nearest, false);
 }
 
+/* Movie frame thumbnails are additionally stored on disk, in the user cache directory, so that
+ * reopening a project does not have to decode the movies again. Files are keyed by a hash of
+ * the movie path, modification time, size and stream index, so a changed movie gets new
+ * entries. The least recently used files are removed when the directory exceeds
+ * #MAX_DISK_THUMBNAILS_SIZE. */
+static bool movie_thumb_disk_dir(char r_dir[FILE_MAX])
+{
+  char dir[FILE_MAX];
+  if (!BKE_appdir_folder_caches(dir, sizeof(dir))) {
+    return false;
+  }
+  BLI_path_join(r_dir, FILE_MAX, dir, "vse_thumbnails");
+  return true;
+}
+
+/* Returns false if the movie file can not be accessed. */
+static bool movie_thumb_disk_path(const ThumbnailCache::Request &request,
+                                  char r_path[FILE_MAX])
+{
+  BLI_stat_t st;
+  if (BLI_stat(request.file_path.c_str(), &st) != 0) {
+    return false;
+  }
+  char dir[FILE_MAX];
+  if (!movie_thumb_disk_dir(dir)) {
+    return false;
+  }
+  const uint64_t hash = get_default_hash(
+      request.file_path, int64_t(st.st_mtime), int64_t(st.st_size), request.stream_index);
+  char filename[64];
+  SNPRINTF(filename, "%016llx_%d.png", (unsigned long long)hash, request.frame_index);
+  BLI_path_join(r_path, FILE_MAX, dir, filename);
+  return true;
+}
+
+/* Bytes written to the disk cache since its size was last checked. */
+static std::atomic<int64_t> disk_thumbs_written_size = 0;
+static std::atomic<bool> disk_thumbs_checked = false;
+
+/* Remove the least recently used thumbnails when the disk cache exceeds its size limit. Loading a
+ * thumbnail updates its modification time, so that is used as the time of the last use. */
+static void limit_movie_thumbs_disk_size()
+{
+  char dir[FILE_MAX];
+  if (!movie_thumb_disk_dir(dir) || !BLI_is_dir(dir)) {
+    return;
+  }
+  direntry *filelist;
+  const int filelist_num = BLI_filelist_dir_contents(dir, &filelist);
+  Vector<const direntry *> files;
+  int64_t size_total = 0;
+  for (const direntry &entry : Span(filelist, filelist_num)) {
+    if (!S_ISREG(entry.type)) {
+      continue;
+    }
+    files.append(&entry);
+    size_total += entry.s.st_size;
+  }
+  if (size_total > MAX_DISK_THUMBNAILS_SIZE) {
+    std::sort(files.begin(), files.end(), [](const direntry *a, const direntry *b) {
+      return a->s.st_mtime < b->s.st_mtime;
+    });
+    for (const direntry *entry : files) {
+      if (size_total <= MAX_DISK_THUMBNAILS_SIZE) {
+        break;
+      }
+      if (BLI_delete(entry->path, false, false) == 0) {
+        size_total -= entry->s.st_size;
+      }
+    }
+  }
+  BLI_filelist_free(filelist, filelist_num);
+}
+
+/* Checking the size of the whole directory is not free, so it is only done once per session and
+ * then whenever a significant amount of thumbnails was written. */
+static void limit_movie_thumbs_disk_size_if_needed()
+{
+  if (disk_thumbs_checked && disk_thumbs_written_size < MAX_DISK_THUMBNAILS_SIZE / 8) {
+    return;
+  }
+  disk_thumbs_checked = true;
+  disk_thumbs_written_size = 0;
+  limit_movie_thumbs_disk_size();
+}
+
+static ImBuf *load_movie_thumb_from_disk(const char *path)
+{
+  if (!BLI_exists(path)) {
+    return nullptr;
+  }
+  ImBuf *thumb = IMB_loadiffname(path, IB_rect, nullptr);
+  if (thumb != nullptr) {
+    /* Mark the thumbnail as recently used. */
+    BLI_file_touch(path);
+  }
+  return thumb;
+}
+
+static void save_movie_thumb_to_disk(ImBuf *thumb, const char *path)
+{
+  /* Only byte thumbnails are stored; float ones would lose precision as PNG. */
+  if (thumb == nullptr || thumb->byte_buffer.data == nullptr ||
+      thumb->float_buffer.data != nullptr)
+  {
+    return;
+  }
+  if (!BLI_file_ensure_parent_dir_exists(path)) {
+    return;
+  }
+  /* Write into a temporary file first, so that other Blender instances never read a
+   * partially written thumbnail. */
+  char temp_path[FILE_MAX];
+  SNPRINTF(temp_path, "%s.%p.tmp", path, (void *)thumb);
+  const eImbFileType ftype = thumb->ftype;
+  thumb->ftype = IMB_FTYPE_PNG;
+  if (IMB_saveiff(thumb, temp_path, IB_rect)) {
+    if (BLI_rename_overwrite(temp_path, path) == 0) {
+      disk_thumbs_written_size += int64_t(BLI_file_size(path));
+    }
+    else {
+      BLI_delete(temp_path, false, false);
+    }
+  }
+  thumb->ftype = ftype;
+}
+
 /* Background job that processes in-flight thumbnail requests. */
 class ThumbGenerationJob {
   Scene *scene_ = nullptr;
@@ -279,6 +414,8 @@ void ThumbGenerationJob::run_fn(void *customdata, wmJobWorkerStatus *worker_stat
 #endif
 
   ThumbGenerationJob *job = static_cast<ThumbGenerationJob *>(customdata);
+  limit_movie_thumbs_disk_size_if_needed();
+
   Vector<ThumbnailCache::Request> requests;
   while (!worker_status->stop) {
     /* Under cache mutex lock: copy all current requests into a vector for processing.
@@ -346,8 +483,16 @@ void ThumbGenerationJob::run_fn(void *customdata, wmJobWorkerStatus *worker_stat
           ++total_movies;
 #endif
 
+          char disk_path[FILE_MAX];
+          const bool use_disk_cache = movie_thumb_disk_path(request, disk_path);
+          if (use_disk_cache) {
+            thumb = load_movie_thumb_from_disk(disk_path);
+          }
+
           /* Are we switching to a different movie file / stream? */
-          if (request.file_path != cur_anim_path || request.stream_index != cur_stream) {
+          if (thumb == nullptr &&
+              (request.file_path != cur_anim_path || request.stream_index != cur_stream))
+          {
             if (cur_anim != nullptr) {
               IMB_free_anim(cur_anim);
               cur_anim = nullptr;
@@ -359,10 +504,14 @@ void ThumbGenerationJob::run_fn(void *customdata, wmJobWorkerStatus *worker_stat
           }
 
           /* Decode the movie frame. */
-          if (cur_anim != nullptr) {
+          if (thumb == nullptr && cur_anim != nullptr) {
             thumb = IMB_anim_absolute(cur_anim, request.frame_index, IMB_TC_NONE, IMB_PROXY_NONE);
             if (thumb != nullptr) {
               seq_imbuf_assign_spaces(job->scene_, thumb);
+              scale_to_thumbnail_size(thumb);
+              if (use_disk_cache) {
+                save_movie_thumb_to_disk(thumb, disk_path);
+              }
             }
           }
         }
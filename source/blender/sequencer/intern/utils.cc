@@ -202,6 +202,18 @@ ListBase *SEQ_get_seqbase_from_sequence(Sequence *seq, ListBase **r_channels, in
   return seqbase;
 }
 
+int seq_anim_ib_flags_get(const Sequence *seq)
+{
+  int flags = IB_rect;
+  if (seq->flag & SEQ_FILTERY) {
+    flags |= IB_animdeinterlace;
+  }
+  if (seq->movie_flag & SEQ_MOVIE_USE_HW_DECODE) {
+    flags |= IB_animhwdecode;
+  }
+  return flags;
+}
+
 static void open_anim_filepath(Sequence *seq,
                                StripAnim *sanim,
                                const char *filepath,
@@ -209,13 +221,13 @@ static void open_anim_filepath(Sequence *seq,
 {
   if (openfile) {
     sanim->anim = openanim(filepath,
-                           IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                           seq_anim_ib_flags_get(seq),
                            seq->streamindex,
                            seq->strip->colorspace_settings.name);
   }
   else {
     sanim->anim = openanim_noload(filepath,
-                                  IB_rect | ((seq->flag & SEQ_FILTERY) ? IB_animdeinterlace : 0),
+                                  seq_anim_ib_flags_get(seq),
                                   seq->streamindex,
                                   seq->strip->colorspace_settings.name);
   }
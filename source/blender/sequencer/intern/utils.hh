@@ -13,3 +13,5 @@ struct Scene;
 
 bool sequencer_seq_generates_image(Sequence *seq);
 void seq_open_anim_file(Scene *scene, Sequence *seq, bool openfile);
+/** The #eImBufFlags used to open the movie files of the given movie strip. */
+int seq_anim_ib_flags_get(const Sequence *seq);
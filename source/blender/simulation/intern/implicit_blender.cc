@@ -20,6 +20,7 @@
 #  include "BLI_math_geom.h"
 #  include "BLI_math_matrix.h"
 #  include "BLI_math_vector.h"
+#  include "BLI_task.hh"
 #  include "BLI_utildefines.h"
 
 #  include "BKE_cloth.hh"
@@ -32,9 +33,8 @@
 #    pragma GCC diagnostic ignored "-Wtype-limits"
 #  endif
 
-#  ifdef _OPENMP
-#    define CLOTH_OPENMP_LIMIT 512
-#  endif
+/* Minimum number of vertices for multi-threading the solver operations. */
+#  define CLOTH_PARALLEL_LIMIT 512
 
 // #define DEBUG_TIME
 
@@ -179,7 +179,7 @@ DO_INLINE float dot_lfvector(float (*fLongVectorA)[3], float (*fLongVectorB)[3],
    * due to non-commutative nature of floating point ops this makes the sim give
    * different results each time you run it!
    * schedule(guided, 2) */
-  // #pragma omp parallel for reduction(+: temp) if (verts > CLOTH_OPENMP_LIMIT)
+  // #pragma omp parallel for reduction(+: temp) if (verts > CLOTH_PARALLEL_LIMIT)
   for (i = 0; i < long(verts); i++) {
     temp += dot_v3v3(fLongVectorA[i], fLongVectorB[i]);
   }
@@ -591,23 +591,22 @@ DO_INLINE void mul_bfmatrix_lfvector(float (*to)[3], fmatrix3x3 *from, lfVector
 
   zero_lfvector(to, vcount);
 
-#  pragma omp parallel sections if (vcount > CLOTH_OPENMP_LIMIT)
-  {
-#  pragma omp section
-    {
-      for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
-        /* This is the lower triangle of the sparse matrix,
-         * therefore multiplication occurs with transposed sub-matrices. */
-        muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
-      }
-    }
-#  pragma omp section
-    {
-      for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
-        muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
-      }
-    }
-  }
+  /* Both halves write to their own vector in a fixed order, so running them concurrently keeps
+   * the result deterministic. */
+  blender::threading::parallel_invoke(
+      vcount > CLOTH_PARALLEL_LIMIT,
+      [&]() {
+        for (uint i = from[0].vcount; i < from[0].vcount + from[0].scount; i++) {
+          /* This is the lower triangle of the sparse matrix,
+           * therefore multiplication occurs with transposed sub-matrices. */
+          muladd_fmatrixT_fvector(to[from[i].c], from[i].m, fLongVector[from[i].r]);
+        }
+      },
+      [&]() {
+        for (uint i = 0; i < from[0].vcount + from[0].scount; i++) {
+          muladd_fmatrix_fvector(temp[from[i].r], from[i].m, fLongVector[from[i].c]);
+        }
+      });
   add_lfvector_lfvector(to, to, temp, from[0].vcount);
 
   del_lfvector(temp);
@@ -921,7 +920,7 @@ DO_INLINE void BuildPPinv(fmatrix3x3 *lA, fmatrix3x3 *P, fmatrix3x3 *Pinv)
   uint i = 0;
 
   /* Take only the diagonal blocks of A */
-  // #pragma omp parallel for private(i) if (lA[0].vcount > CLOTH_OPENMP_LIMIT)
+  // #pragma omp parallel for private(i) if (lA[0].vcount > CLOTH_PARALLEL_LIMIT)
   for (i = 0; i < lA[0].vcount; i++) {
     /* block diagonalizer */
     cp_fmatrix(P[i].m, lA[i].m);
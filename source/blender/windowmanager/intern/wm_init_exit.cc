@@ -28,6 +28,7 @@
 #include "BLI_task.h"
 #include "BLI_threads.h"
 #include "BLI_timer.h"
+#include "BLI_trace.hh"
 #include "BLI_utildefines.h"
 
 #include "BLO_undofile.hh"
@@ -58,6 +59,8 @@
 #include "BKE_subdiv.hh"
 #include "BKE_tracking.h" /* Free tracking clipboard. */
 
+#include "NOD_geometry_nodes_gpu_fields.hh"
+
 #include "RE_engine.h"
 #include "RE_pipeline.h" /* `RE_` free stuff. */
 
@@ -156,6 +159,8 @@ void WM_init_gpu()
 
   /* Needs to be first to have an OpenGL context bound. */
   DRW_gpu_context_create();
+  blender::nodes::gpu_fields::gpu_context_create();
+  wm_window_reset_drawable();
 
   GPU_init();
 
@@ -654,6 +659,7 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
   /* Delete GPU resources and context. The UI also uses GPU resources and so
    * is also deleted with the context active. */
   if (gpu_is_init) {
+    blender::nodes::gpu_fields::gpu_context_destroy();
     DRW_gpu_context_enable_ex(false);
     UI_exit();
     GPU_pass_cache_free();
@@ -678,6 +684,9 @@ void WM_exit_ex(bContext *C, const bool do_python_exit, const bool do_user_exit_
 
   DNA_sdna_current_free();
 
+  /* Write the trace requested with `--debug-trace`, covering the whole session. */
+  blender::trace::write_exit_file();
+
   BLI_threadapi_exit();
   BLI_task_scheduler_exit();
 
@@ -32,6 +32,7 @@
 #include "BLI_system.h"
 #include "BLI_task.h"
 #include "BLI_threads.h"
+#include "BLI_time.h"
 #include "BLI_utildefines.h"
 
 /* Mostly initialization functions. */
@@ -191,6 +192,53 @@ static void callback_clg_fatal(void *fp)
 
 /** \} */
 
+/* -------------------------------------------------------------------- */
+/** \name Startup Time Profiling
+ *
+ * Stages are always timed since most of them run before the arguments are parsed,
+ * they are only printed when `--debug-startup-time` is passed.
+ * \{ */
+
+struct StartupStage {
+  const char *name;
+  double duration;
+};
+
+static struct {
+  StartupStage stages[16];
+  int stages_num;
+  double stage_start;
+  double start;
+} startup_time = {};
+
+static void startup_time_begin()
+{
+  startup_time.start = startup_time.stage_start = BLI_time_now_seconds();
+}
+
+static void startup_time_stage_end(const char *name)
+{
+  const double time = BLI_time_now_seconds();
+  if (startup_time.stages_num < int(ARRAY_SIZE(startup_time.stages))) {
+    startup_time.stages[startup_time.stages_num++] = {name, time - startup_time.stage_start};
+  }
+  startup_time.stage_start = time;
+}
+
+static void startup_time_print()
+{
+  if ((G.debug & G_DEBUG_STARTUP_TIME) == 0) {
+    return;
+  }
+  printf("Startup time: %.3fs\n", startup_time.stage_start - startup_time.start);
+  for (int i = 0; i < startup_time.stages_num; i++) {
+    printf("  %8.3fs  %s\n", startup_time.stages[i].duration, startup_time.stages[i].name);
+  }
+  fflush(stdout);
+}
+
+/** \} */
+
 /* -------------------------------------------------------------------- */
 /** \name Blender as a Stand-Alone Python Module (bpy)
  *
@@ -417,6 +465,8 @@ int main(int argc,
   fpsetmask(0);
 #endif
 
+  startup_time_begin();
+
   /* Initialize path to executable. */
   BKE_appdir_program_path_init(argv[0]);
 
@@ -438,6 +488,7 @@ int main(int argc,
   RE_texture_rng_init();
 
   BKE_callback_global_init();
+  startup_time_stage_end("Kernel types");
 
 /* First test for background-mode (#Global.background). */
 #ifndef WITH_PYTHON_MODULE
@@ -481,6 +532,7 @@ int main(int argc,
 
   main_signal_setup();
 #endif
+  startup_time_stage_end("Arguments, directories and task scheduler");
 
   /* Must be initialized after #BKE_appdir_init to account for color-management paths. */
   IMB_init();
@@ -488,14 +540,17 @@ int main(int argc,
   /* Keep after #ARG_PASS_SETTINGS since debug flags are checked. */
   IMB_ffmpeg_init();
 #endif
+  startup_time_stage_end("Image buffers");
 
   /* After #ARG_PASS_SETTINGS arguments, this is so #WM_main_playanim skips #RNA_init. */
   RNA_init();
+  startup_time_stage_end("RNA");
 
   RE_engines_init();
   blender::bke::node_system_init();
   BKE_particle_init_rng();
   /* End second initialization. */
+  startup_time_stage_end("Render engines and node types");
 
 #if defined(WITH_PYTHON_MODULE) || defined(WITH_HEADLESS)
   /* Python module mode ALWAYS runs in background-mode (for now). */
@@ -516,6 +571,7 @@ int main(int argc,
   BKE_sound_init_once();
 
   BKE_materials_init();
+  startup_time_stage_end("Fonts, sound and materials");
 
 #ifndef WITH_PYTHON_MODULE
   if (G.background == 0) {
@@ -525,6 +581,7 @@ int main(int argc,
 #endif
 
   WM_init(C, argc, (const char **)argv);
+  startup_time_stage_end("Window manager, Python and add-ons");
 
 #ifndef WITH_PYTHON
   printf(
@@ -536,8 +593,11 @@ int main(int argc,
   /* Initialize Freestyle. */
   FRS_init();
   FRS_set_context(C);
+  startup_time_stage_end("Freestyle");
 #endif
 
+  startup_time_print();
+
 /* OK we are ready for it. */
 #ifndef WITH_PYTHON_MODULE
   /* Handles #ARG_PASS_FINAL. */
@@ -28,7 +28,9 @@
 #  include "BLI_string.h"
 #  include "BLI_string_utf8.h"
 #  include "BLI_system.h"
+#  include "BLI_task.h"
 #  include "BLI_threads.h"
+#  include "BLI_trace.hh"
 #  include "BLI_utildefines.h"
 #  ifndef NDEBUG
 #    include "BLI_mempool.h"
@@ -655,6 +657,7 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--render-output");
   BLI_args_print_arg_doc(ba, "--engine");
   BLI_args_print_arg_doc(ba, "--threads");
+  BLI_args_print_arg_doc(ba, "--enable-numa");
 
   if (defs.with_cycles) {
     PRINT("Cycles Render Options:\n");
@@ -739,6 +742,8 @@ static void print_help(bArgs *ba, bool all)
   }
   BLI_args_print_arg_doc(ba, "--debug-memory");
   BLI_args_print_arg_doc(ba, "--debug-jobs");
+  BLI_args_print_arg_doc(ba, "--debug-startup-time");
+  BLI_args_print_arg_doc(ba, "--debug-trace");
   BLI_args_print_arg_doc(ba, "--debug-python");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph");
   BLI_args_print_arg_doc(ba, "--debug-depsgraph-eval");
@@ -790,6 +795,9 @@ static void print_help(bArgs *ba, bool all)
   BLI_args_print_arg_doc(ba, "--app-template");
   BLI_args_print_arg_doc(ba, "--factory-startup");
   BLI_args_print_arg_doc(ba, "--enable-event-simulate");
+  BLI_args_print_arg_doc(ba, "--enable-zero-copy-load");
+  BLI_args_print_arg_doc(ba, "--enable-threaded-load");
+  BLI_args_print_arg_doc(ba, "--enable-incremental-save");
   PRINT("\n");
   BLI_args_print_arg_doc(ba, "--env-system-datafiles");
   BLI_args_print_arg_doc(ba, "--env-system-scripts");
@@ -1001,6 +1009,40 @@ static int arg_handle_abort_handler_disable(int /*argc*/, const char ** /*argv*/
   return 0;
 }
 
+static const char arg_handle_readfile_zero_copy_set_doc[] =
+    "\n\t"
+    "Keep large attribute arrays of uncompressed blend-files and of baked geometry backed by\n"
+    "\tmemory-mapped files instead of copying them when loading (experimental).";
+static int arg_handle_readfile_zero_copy_set(int /*argc*/,
+                                             const char ** /*argv*/,
+                                             void * /*data*/)
+{
+  G.f |= G_FLAG_READFILE_ZERO_COPY;
+  return 0;
+}
+
+static const char arg_handle_readfile_threaded_set_doc[] =
+    "\n\t"
+    "Read the data of large data-blocks of uncompressed blend-files on multiple threads\n"
+    "\t(experimental).";
+static int arg_handle_readfile_threaded_set(int /*argc*/, const char ** /*argv*/, void * /*data*/)
+{
+  G.f |= G_FLAG_READFILE_THREADED;
+  return 0;
+}
+
+static const char arg_handle_writefile_incremental_set_doc[] =
+    "\n\t"
+    "When saving over an existing blend-file, let the file system copy unchanged parts of the\n"
+    "\tprevious file instead of writing them again (experimental, Linux only).";
+static int arg_handle_writefile_incremental_set(int /*argc*/,
+                                                const char ** /*argv*/,
+                                                void * /*data*/)
+{
+  G.f |= G_FLAG_WRITEFILE_INCREMENTAL;
+  return 0;
+}
+
 static void clog_abort_on_error_callback(void *fp)
 {
   BLI_system_backtrace(static_cast<FILE *>(fp));
@@ -1287,6 +1329,9 @@ static const char arg_handle_debug_mode_generic_set_doc_xr_time[] =
 static const char arg_handle_debug_mode_generic_set_doc_jobs[] =
     "\n\t"
     "Enable time profiling for background jobs.";
+static const char arg_handle_debug_mode_generic_set_doc_startup_time[] =
+    "\n\t"
+    "Enable time profiling of the application startup stages.";
 static const char arg_handle_debug_mode_generic_set_doc_depsgraph[] =
     "\n\t"
     "Enable all debug messages from dependency graph.";
@@ -1398,6 +1443,21 @@ static int arg_handle_debug_value_set(int argc, const char **argv, void * /*data
   return 0;
 }
 
+static const char arg_handle_debug_trace_set_doc[] =
+    "<filepath>\n"
+    "\tRecord a timeline of depsgraph evaluation, geometry nodes, drawing and rendering,\n"
+    "\tand write it to <filepath> on exit (in the Chrome trace format, see Perfetto).";
+static int arg_handle_debug_trace_set(int argc, const char **argv, void * /*data*/)
+{
+  const char *arg_id = "--debug-trace";
+  if (argc > 1) {
+    blender::trace::begin_with_exit_file(argv[1]);
+    return 1;
+  }
+  fprintf(stderr, "\nError: '%s' no args given.\n", arg_id);
+  return 0;
+}
+
 static const char arg_handle_debug_gpu_set_doc[] =
     "\n"
     "\tEnable GPU debug context and information for OpenGL 4.3+.";
@@ -2014,6 +2074,16 @@ static int arg_handle_threads_set(int argc, const char **argv, void * /*data*/)
   return 0;
 }
 
+static const char arg_handle_numa_set_doc[] =
+    "\n"
+    "\tSchedule tasks separately for every NUMA node of the system,\n"
+    "\tso that memory is mostly accessed by threads of the node it is stored on.";
+static int arg_handle_numa_set(int /*argc*/, const char ** /*argv*/, void * /*data*/)
+{
+  BLI_task_scheduler_use_numa_set(true);
+  return 0;
+}
+
 static const char arg_handle_verbosity_set_doc[] =
     "<verbose>\n"
     "\tSet the logging verbosity level for debug messages that support it.";
@@ -2618,6 +2688,7 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                nullptr);
 
   BLI_args_add(ba, "-t", "--threads", CB(arg_handle_threads_set), nullptr);
+  BLI_args_add(ba, nullptr, "--enable-numa", CB(arg_handle_numa_set), nullptr);
 
   /* Include in the environment pass so it's possible display errors initializing subsystems,
    * especially `bpy.appdir` since it's useful to show errors finding paths on startup. */
@@ -2662,6 +2733,15 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
       ba, nullptr, "--disable-crash-handler", CB(arg_handle_crash_handler_disable), nullptr);
   BLI_args_add(
       ba, nullptr, "--disable-abort-handler", CB(arg_handle_abort_handler_disable), nullptr);
+  BLI_args_add(
+      ba, nullptr, "--enable-zero-copy-load", CB(arg_handle_readfile_zero_copy_set), nullptr);
+  BLI_args_add(
+      ba, nullptr, "--enable-threaded-load", CB(arg_handle_readfile_threaded_set), nullptr);
+  BLI_args_add(ba,
+               nullptr,
+               "--enable-incremental-save",
+               CB(arg_handle_writefile_incremental_set),
+               nullptr);
 
   BLI_args_add(ba, "-q", "--quiet", CB(arg_handle_quiet_set), nullptr);
   BLI_args_add(ba, "-b", "--background", CB(arg_handle_background_mode_set), nullptr);
@@ -2746,6 +2826,12 @@ void main_args_setup(bContext *C, bArgs *ba, bool all)
                "--debug-jobs",
                CB_EX(arg_handle_debug_mode_generic_set, jobs),
                (void *)G_DEBUG_JOBS);
+  BLI_args_add(ba,
+               nullptr,
+               "--debug-startup-time",
+               CB_EX(arg_handle_debug_mode_generic_set, startup_time),
+               (void *)G_DEBUG_STARTUP_TIME);
+  BLI_args_add(ba, nullptr, "--debug-trace", CB(arg_handle_debug_trace_set), nullptr);
   BLI_args_add(ba, nullptr, "--debug-gpu", CB(arg_handle_debug_gpu_set), nullptr);
   BLI_args_add(ba,
                nullptr,
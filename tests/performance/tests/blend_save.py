@@ -0,0 +1,48 @@
+# SPDX-FileCopyrightText: 2024 Blender Authors
+#
+# SPDX-License-Identifier: Apache-2.0
+
+import api
+
+
+def _run(filepath):
+    import bpy
+    import os
+    import tempfile
+    import time
+
+    bpy.ops.wm.open_mainfile(filepath=filepath)
+
+    with tempfile.TemporaryDirectory() as tmpdir:
+        save_filepath = os.path.join(tmpdir, "save.blend")
+
+        # Save once to ensure the output file exists and the OS caches are warm.
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True)
+
+        # Measure saving the second time
+        start_time = time.time()
+        bpy.ops.wm.save_as_mainfile(filepath=save_filepath, copy=True)
+        elapsed_time = time.time() - start_time
+
+    result = {'time': elapsed_time}
+    return result
+
+
+class BlendSaveTest(api.Test):
+    def __init__(self, filepath):
+        self.filepath = filepath
+
+    def name(self):
+        return self.filepath.stem
+
+    def category(self):
+        return "blend_save"
+
+    def run(self, env, device_id):
+        result, _ = env.run_in_blender(_run, str(self.filepath))
+        return result
+
+
+def generate(env):
+    filepaths = env.find_blend_files('*/*')
+    return [BlendSaveTest(filepath) for filepath in filepaths]
@@ -306,6 +306,27 @@ class ChannelBagsTest(unittest.TestCase):
         channelbag.fcurves.clear()
         self.assertEquals([], channelbag.fcurves[:])
 
+    def test_fcurves_evaluate(self):
+        channelbag = self.strip.channelbags.new(self.slot)
+
+        fcurves = [channelbag.fcurves.new('location', index=index) for index in range(3)]
+        for index, fcurve in enumerate(fcurves):
+            fcurve.keyframe_points.insert(1.0, float(index))
+            fcurve.keyframe_points.insert(10.0, float(index) + 9.0)
+            for key in fcurve.keyframe_points:
+                key.interpolation = 'LINEAR'
+
+        frames = [0.0, 1.0, 2.5, 10.0, 20.0]
+        values = channelbag.fcurves.evaluate(frames)
+        self.assertEqual(len(fcurves) * len(frames), len(values))
+        for index, fcurve in enumerate(fcurves):
+            for frame_index, frame in enumerate(frames):
+                self.assertAlmostEqual(fcurve.evaluate(frame), values[index * len(frames) + frame_index])
+
+        # The frames have to be sorted.
+        with self.assertRaises(RuntimeError):
+            channelbag.fcurves.evaluate([2.0, 1.0])
+
     def test_channel_groups(self):
         channelbag = self.strip.channelbags.new(self.slot)
 